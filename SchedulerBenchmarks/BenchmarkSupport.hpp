@@ -0,0 +1,122 @@
+//
+//  BenchmarkSupport.hpp
+//  SchedulerBenchmarks
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef BenchmarkSupport_hpp
+#define BenchmarkSupport_hpp
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// A cheap pseudo-random number generator so that generating keys does not dominate the measured operations
+struct Xorshift32
+{
+    uint32_t state = 0x9E3779B9;
+
+    uint32_t operator()()
+    {
+        this->state ^= this->state << 13;
+
+        this->state ^= this->state >> 17;
+
+        this->state ^= this->state << 5;
+
+        return this->state;
+    }
+};
+
+///
+/// Measures the latency of an operation in batches and reports its percentiles as benchmark counters
+///
+/// @note Reading the clock around every single operation would cost more than most operations being measured,
+///       so each sample is the average latency of `kBatchSize` consecutive operations.
+///       As a result, the reported percentiles describe batches rather than individual operations.
+///
+struct LatencySampler
+{
+    /// The number of operations measured by each sample
+    static constexpr size_t kBatchSize = 64;
+
+    /// The average latency in nanoseconds of each batch
+    std::vector<double> samples;
+
+    ///
+    /// Measure a batch of operations in one iteration of the benchmark
+    ///
+    /// @param operation A callable that performs one operation
+    ///
+    template <typename Operation>
+    void measure(Operation&& operation)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (size_t index = 0; index < kBatchSize; index++)
+        {
+            operation();
+        }
+
+        auto end = std::chrono::steady_clock::now();
+
+        this->samples.push_back(std::chrono::duration<double, std::nano>(end - start).count() / kBatchSize);
+    }
+
+    ///
+    /// Report the throughput and the latency percentiles to the given benchmark state
+    ///
+    /// @param state The benchmark state
+    ///
+    void report(benchmark::State& state)
+    {
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kBatchSize));
+
+        // Guard: The benchmark may not have run any iteration
+        if (this->samples.empty())
+        {
+            return;
+        }
+
+        std::sort(this->samples.begin(), this->samples.end());
+
+        auto percentile = [&](double fraction) -> double
+        {
+            return this->samples[static_cast<size_t>(fraction * static_cast<double>(this->samples.size() - 1))];
+        };
+
+        state.counters["p50_ns"] = percentile(0.50);
+
+        state.counters["p99_ns"] = percentile(0.99);
+
+        state.counters["p999_ns"] = percentile(0.999);
+    }
+};
+
+///
+/// Register the ready queue depths in powers of 16 from one task up to the given number of tasks, including the given number
+///
+/// @param benchmark The benchmark to configure
+/// @param maxDepth The largest depth to measure
+///
+inline void applyDepths(benchmark::internal::Benchmark* benchmark, int64_t maxDepth)
+{
+    int64_t depth = 1;
+
+    for (; depth <= maxDepth; depth *= 16)
+    {
+        benchmark->Arg(depth);
+    }
+
+    // Guard: Always measure the largest depth
+    if (depth / 16 != maxDepth)
+    {
+        benchmark->Arg(maxDepth);
+    }
+}
+
+#endif /* BenchmarkSupport_hpp */
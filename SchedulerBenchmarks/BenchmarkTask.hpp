@@ -0,0 +1,165 @@
+//
+//  BenchmarkTask.hpp
+//  SchedulerBenchmarks
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef BenchmarkTask_hpp
+#define BenchmarkTask_hpp
+
+#include <LinkedList.hpp>
+#include <Scheduler/Scheduler.hpp>
+#include <algorithm>
+#include <cstdint>
+
+/// A task that satisfies the constraints of every policy and sample scheduler without logging anything
+class BenchmarkTask: public Listable<BenchmarkTask>, public Scheduler::Schedulable, public Scheduler::StableHeapIndexable, public Scheduler::WakeupLinkable<BenchmarkTask>, public Scheduler::TreeLinkable<BenchmarkTask>, public Scheduler::WeightedRuntime
+{
+private:
+    uint32_t identifier;
+
+    uint32_t priority;
+
+    uint32_t ticks;
+
+public:
+    /// The lowest priority level of a task other than the idle task
+    static constexpr uint32_t kMinPriorityLevel = 1;
+
+    /// The highest priority level of a task
+    static constexpr uint32_t kMaxPriorityLevel = 3;
+
+    // MARK: Constructor
+    BenchmarkTask(uint32_t identifier, uint32_t priority) :
+            Listable(), identifier(identifier), priority(priority), ticks(0) {}
+
+    // MARK: Prioritizable By Mutable Priority IMP
+    using Priority = uint32_t;
+
+    [[nodiscard]]
+    const uint32_t& getPriority() const
+    {
+        return this->priority;
+    }
+
+    void setPriority(const uint32_t& priority)
+    {
+        this->priority = priority;
+    }
+
+    void demote()
+    {
+        if (this->priority > kMinPriorityLevel)
+        {
+            this->priority -= 1;
+        }
+    }
+
+    void promote()
+    {
+        if (this->priority < kMaxPriorityLevel)
+        {
+            this->priority += 1;
+        }
+    }
+
+    // MARK: Quantizable IMP
+    using Tick = uint32_t;
+
+    void tick()
+    {
+        this->ticks -= 1;
+    }
+
+    void consumeTicks(uint32_t ticks)
+    {
+        this->ticks -= std::min(ticks, this->ticks);
+    }
+
+    [[nodiscard]]
+    uint32_t getRemainingTicks() const
+    {
+        return this->ticks;
+    }
+
+    bool hasUsedUpTimeAllotment()
+    {
+        return this->ticks == 0;
+    }
+
+    void allocateTicks(uint32_t ticks)
+    {
+        this->ticks = ticks;
+    }
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+
+    // Quantum Specifier
+    struct QuantumSpecifier
+    {
+        constexpr uint32_t operator()(const uint32_t& priority)
+        {
+            // A task at the highest level runs for one tick, and each level below doubles the quantum
+            return 1u << (kMaxPriorityLevel - std::clamp(priority, kMinPriorityLevel, kMaxPriorityLevel));
+        }
+    };
+};
+
+/// A real-time task that does not log anything, where the task that has the earliest deadline has the highest priority
+class BenchmarkRealtimeTask: public Listable<BenchmarkRealtimeTask>, public Scheduler::Schedulable, public Scheduler::StableHeapIndexable
+{
+private:
+    uint32_t identifier;
+
+    uint64_t deadline;
+
+public:
+    // MARK: Constructor
+    BenchmarkRealtimeTask(uint32_t identifier, uint64_t deadline) :
+        Listable(), identifier(identifier), deadline(deadline) {}
+
+    // MARK: Prioritizable IMP
+    friend bool operator<(const BenchmarkRealtimeTask& lhs, const BenchmarkRealtimeTask& rhs)
+    {
+        return lhs.deadline > rhs.deadline;
+    }
+
+    friend bool operator>(const BenchmarkRealtimeTask& lhs, const BenchmarkRealtimeTask& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const BenchmarkRealtimeTask& lhs, const BenchmarkRealtimeTask& rhs)
+    {
+        return !(lhs > rhs);
+    }
+
+    friend bool operator>=(const BenchmarkRealtimeTask& lhs, const BenchmarkRealtimeTask& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+
+    [[nodiscard]]
+    uint64_t getDeadline() const
+    {
+        return this->deadline;
+    }
+
+    void setDeadline(uint64_t deadline)
+    {
+        this->deadline = deadline;
+    }
+};
+
+#endif /* BenchmarkTask_hpp */
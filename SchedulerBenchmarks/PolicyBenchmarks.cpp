@@ -0,0 +1,172 @@
+//
+//  PolicyBenchmarks.cpp
+//  SchedulerBenchmarks
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#include "BenchmarkSupport.hpp"
+#include "BenchmarkTask.hpp"
+#include <memory>
+
+using namespace Scheduler;
+
+/// The largest ready queue depth measured for policies of which operations run in constant or logarithmic time
+static constexpr int64_t kMaxDepth = 1 << 20;
+
+/// The largest ready queue depth measured for policies of which enqueue operation runs in linear time
+static constexpr int64_t kMaxLinearDepth = 1 << 12;
+
+/// The largest ready queue depth measured for policies that are designed for a few dozen ready tasks
+static constexpr int64_t kMaxSmallDepth = 64;
+
+/// The largest priority level used by multi-queue policies
+static constexpr size_t kMaxPriorityLevel = 63;
+
+/// Generates priority levels uniformly distributed in `[0, Max]`
+template <uint32_t Max>
+struct UniformKey
+{
+    static uint32_t initial(Xorshift32& random, [[maybe_unused]] size_t index)
+    {
+        return random() % (Max + 1);
+    }
+
+    static uint32_t next(Xorshift32& random, [[maybe_unused]] const BenchmarkTask& task)
+    {
+        return random() % (Max + 1);
+    }
+};
+
+/// Generates time keys shortly after that of the task that has just been dequeued, as periodic releases do
+struct TimeKey
+{
+    static uint32_t initial(Xorshift32& random, [[maybe_unused]] size_t index)
+    {
+        return random() % 1024;
+    }
+
+    static uint32_t next(Xorshift32& random, const BenchmarkTask& task)
+    {
+        return task.getPriority() + 1 + random() % 64;
+    }
+};
+
+///
+/// Measure the throughput and the latency of a dequeue operation followed by an enqueue operation in a steady state
+///
+/// @tparam Policy Specify the concrete policy
+/// @tparam Key Specify the generator of the priority level of each enqueued task
+/// @tparam Interface Specify the type through which the policy is called,
+///                   `Scheduler::Policy<Task>` to measure policies in the `Virtual` namespace through virtual calls
+/// @note `state.range(0)` specifies the number of tasks in the ready queue.
+///
+template <typename Policy, typename Key, typename Interface = Policy>
+static void BM_ReadyNext(benchmark::State& state)
+{
+    auto depth = static_cast<size_t>(state.range(0));
+
+    Xorshift32 random;
+
+    std::vector<BenchmarkTask> tasks;
+
+    tasks.reserve(depth);
+
+    for (size_t index = 0; index < depth; index++)
+    {
+        tasks.emplace_back(index + 1, Key::initial(random, index));
+    }
+
+    // Hide the concrete type from the compiler so that calls through a virtual interface are not devirtualized
+    std::unique_ptr<Interface> policy = std::make_unique<Policy>();
+
+    Interface* queue = policy.get();
+
+    benchmark::DoNotOptimize(queue);
+
+    for (BenchmarkTask& task : tasks)
+    {
+        queue->ready(&task);
+    }
+
+    LatencySampler sampler;
+
+    for (auto _ : state)
+    {
+        sampler.measure([&]()
+        {
+            BenchmarkTask* task = queue->next();
+
+            task->setPriority(Key::next(random, *task));
+
+            queue->ready(task);
+        });
+    }
+
+    sampler.report(state);
+
+    // Drain the queue before the tasks are released
+    while (queue->next() != nullptr);
+}
+
+///
+/// Register the benchmark of a policy in the `Normal` namespace and its counterpart in the `Virtual` namespace
+///
+#define POLICY_BENCHMARK(Family, Key, MaxDepth, ...) \
+    BENCHMARK(BM_ReadyNext<Policies::Family::Normal::__VA_ARGS__, Key>)->Name("Normal::" #Family "::" #__VA_ARGS__)->Apply([](auto* benchmark) { applyDepths(benchmark, MaxDepth); }); \
+    BENCHMARK(BM_ReadyNext<Policies::Family::Virtual::__VA_ARGS__, Key, Scheduler::Policy<BenchmarkTask>>)->Name("Virtual::" #Family "::" #__VA_ARGS__)->Apply([](auto* benchmark) { applyDepths(benchmark, MaxDepth); })
+
+// MARK: - FIFO Policies
+
+POLICY_BENCHMARK(FIFO, UniformKey<0>, kMaxDepth, LinkedListImp<BenchmarkTask>);
+
+POLICY_BENCHMARK(FIFO, UniformKey<0>, kMaxDepth, StlQueueImp<BenchmarkTask>);
+
+// The lock-free queue cannot remove an arbitrary task, so it has no counterpart in the `Virtual` namespace
+BENCHMARK(BM_ReadyNext<Policies::FIFO::Normal::IntrusiveMpscQueueImp<BenchmarkTask>, UniformKey<0>>)->Name("Normal::FIFO::IntrusiveMpscQueueImp<BenchmarkTask>")->Apply([](auto* benchmark) { applyDepths(benchmark, kMaxDepth); });
+
+// MARK: - Prioritized Single Queue Policies
+
+POLICY_BENCHMARK(PrioritizedSingleQueue, UniformKey<UINT32_MAX - 1>, kMaxLinearDepth, LinkedListImp<BenchmarkTask>);
+
+POLICY_BENCHMARK(PrioritizedSingleQueue, UniformKey<UINT32_MAX - 1>, kMaxDepth, StlPriorityQueueImp<BenchmarkTask>);
+
+POLICY_BENCHMARK(PrioritizedSingleQueue, UniformKey<UINT32_MAX - 1>, kMaxDepth, DaryHeapImp<BenchmarkTask, 2>);
+
+POLICY_BENCHMARK(PrioritizedSingleQueue, UniformKey<UINT32_MAX - 1>, kMaxDepth, DaryHeapImp<BenchmarkTask, 4>);
+
+POLICY_BENCHMARK(PrioritizedSingleQueue, UniformKey<UINT32_MAX - 1>, kMaxDepth, StableDaryHeapImp<BenchmarkTask, 4>);
+
+POLICY_BENCHMARK(PrioritizedSingleQueue, UniformKey<UINT32_MAX - 1>, kMaxLinearDepth, PackedArrayImp<BenchmarkTask, kMaxLinearDepth>);
+
+POLICY_BENCHMARK(PrioritizedSingleQueue, UniformKey<UINT32_MAX - 1>, kMaxSmallDepth, UnsortedArrayImp<BenchmarkTask, kMaxSmallDepth>);
+
+// MARK: - Prioritized Multi Queue Policies
+
+POLICY_BENCHMARK(PrioritizedMultiQueue, UniformKey<kMaxPriorityLevel>, kMaxDepth, ArrayMapImp<BenchmarkTask, PolicyMakers::DynamicFIFO<BenchmarkTask>, kMaxPriorityLevel>);
+
+POLICY_BENCHMARK(PrioritizedMultiQueue, UniformKey<kMaxPriorityLevel>, kMaxDepth, ArrayMapHomoImp<BenchmarkTask, Policies::FIFO::Normal::LinkedListImp<BenchmarkTask>, kMaxPriorityLevel>);
+
+POLICY_BENCHMARK(PrioritizedMultiQueue, UniformKey<kMaxPriorityLevel>, kMaxDepth, BitmapArrayMapImp<BenchmarkTask, PolicyMakers::DynamicFIFO<BenchmarkTask>, kMaxPriorityLevel>);
+
+POLICY_BENCHMARK(PrioritizedMultiQueue, UniformKey<kMaxPriorityLevel>, kMaxDepth, BitmapArrayMapHomoImp<BenchmarkTask, Policies::FIFO::Normal::LinkedListImp<BenchmarkTask>, kMaxPriorityLevel>);
+
+POLICY_BENCHMARK(PrioritizedMultiQueue, UniformKey<kMaxPriorityLevel>, kMaxDepth, StlMapImp<BenchmarkTask, PolicyMakers::DynamicFIFO<BenchmarkTask>>);
+
+POLICY_BENCHMARK(PrioritizedMultiQueue, UniformKey<kMaxPriorityLevel>, kMaxDepth, StlMapHomoImp<BenchmarkTask, Policies::FIFO::Normal::LinkedListImp<BenchmarkTask>>);
+
+POLICY_BENCHMARK(PrioritizedMultiQueue, UniformKey<kMaxPriorityLevel>, kMaxDepth, SparseMapImp<BenchmarkTask, PolicyMakers::StaticFIFO<BenchmarkTask, kMaxPriorityLevel + 1>>);
+
+POLICY_BENCHMARK(PrioritizedMultiQueue, UniformKey<kMaxPriorityLevel>, kMaxDepth, SparseMapHomoImp<BenchmarkTask, Policies::FIFO::Normal::LinkedListImp<BenchmarkTask>>);
+
+// The adaptive map has no counterpart in the `Virtual` namespace
+// It is measured with all levels in use, where it settles on the dense representation, and with a few levels in use, where it settles on the sparse one
+BENCHMARK(BM_ReadyNext<Policies::PrioritizedMultiQueue::Normal::AdaptiveMapHomoImp<BenchmarkTask, Policies::FIFO::Normal::LinkedListImp<BenchmarkTask>, kMaxPriorityLevel>, UniformKey<kMaxPriorityLevel>>)->Name("Normal::PrioritizedMultiQueue::AdaptiveMapHomoImp<BenchmarkTask, Policies::FIFO::Normal::LinkedListImp<BenchmarkTask>, kMaxPriorityLevel>/Dense")->Apply([](auto* benchmark) { applyDepths(benchmark, kMaxDepth); });
+
+BENCHMARK(BM_ReadyNext<Policies::PrioritizedMultiQueue::Normal::AdaptiveMapHomoImp<BenchmarkTask, Policies::FIFO::Normal::LinkedListImp<BenchmarkTask>, kMaxPriorityLevel>, UniformKey<3>>)->Name("Normal::PrioritizedMultiQueue::AdaptiveMapHomoImp<BenchmarkTask, Policies::FIFO::Normal::LinkedListImp<BenchmarkTask>, kMaxPriorityLevel>/Sparse")->Apply([](auto* benchmark) { applyDepths(benchmark, kMaxDepth); });
+
+POLICY_BENCHMARK(PrioritizedMultiQueue, UniformKey<3>, kMaxDepth, TupleMapImp<BenchmarkTask, Policies::FIFO::Normal::LinkedListImp<BenchmarkTask>, Policies::FIFO::Normal::LinkedListImp<BenchmarkTask>, Policies::FIFO::Normal::LinkedListImp<BenchmarkTask>, Policies::FIFO::Normal::LinkedListImp<BenchmarkTask>>);
+
+// MARK: - Timing Wheel Policies
+
+POLICY_BENCHMARK(TimingWheel, TimeKey, kMaxDepth, LinkedListImp<BenchmarkTask>);
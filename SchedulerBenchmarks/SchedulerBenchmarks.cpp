@@ -0,0 +1,295 @@
+//
+//  SchedulerBenchmarks.cpp
+//  SchedulerBenchmarks
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#include "BenchmarkSupport.hpp"
+#include "BenchmarkTask.hpp"
+#include "SampleSchedulers.hpp"
+
+namespace Schedulers = SampleSchedulers;
+
+/// The number of tasks that are unblocked at once by a burst
+static constexpr size_t kBurstSize = 16;
+
+/// The largest priority level used by the prioritized round-robin scheduler
+static constexpr uint32_t kMaxPriorityLevel = 63;
+
+///
+/// Create the given tasks in the given scheduler
+///
+/// @param scheduler The scheduler
+/// @param idle The idle task of the scheduler
+/// @param tasks The tasks to be created
+/// @return The task selected to run after all tasks are created.
+///
+template <typename Scheduler, typename Task>
+static Task* createTasks(Scheduler& scheduler, Task* idle, std::vector<Task>& tasks)
+{
+    Task* running = idle;
+
+    for (Task& task : tasks)
+    {
+        running = scheduler.onTaskCreated(running, &task);
+    }
+
+    return running;
+}
+
+///
+/// Measure a burst of blocked tasks that are unblocked at once, e.g. by an interrupt that completes a batch of I/O requests
+///
+/// @tparam Scheduler Specify the sample scheduler
+/// @note `state.range(0)` specifies the number of tasks managed by the scheduler.
+///       Each sample blocks `kBurstSize` tasks one by one and then unblocks all of them through group operations.
+///
+template <typename Scheduler>
+static void BM_BurstyUnblock(benchmark::State& state)
+{
+    auto count = static_cast<size_t>(state.range(0));
+
+    BenchmarkTask idle(0, 0);
+
+    std::vector<BenchmarkTask> tasks;
+
+    tasks.reserve(count);
+
+    Xorshift32 random;
+
+    for (size_t index = 0; index < count; index++)
+    {
+        tasks.emplace_back(index + 1, BenchmarkTask::kMinPriorityLevel + random() % kMaxPriorityLevel);
+    }
+
+    Scheduler scheduler(&idle);
+
+    BenchmarkTask* running = createTasks(scheduler, &idle, tasks);
+
+    std::vector<BenchmarkTask*> blocked;
+
+    blocked.reserve(kBurstSize);
+
+    LatencySampler sampler;
+
+    for (auto _ : state)
+    {
+        sampler.measure([&]()
+        {
+            // Guard: Unblock all blocked tasks once the burst is complete or no task is left to block
+            if (blocked.size() < kBurstSize && running != &idle)
+            {
+                blocked.push_back(running);
+
+                running = scheduler.onTaskBlocked(running);
+
+                return;
+            }
+
+            for (size_t index = 0; index + 1 < blocked.size(); index++)
+            {
+                scheduler.onTaskUnblocked(nullptr, blocked[index]);
+            }
+
+            running = scheduler.onTaskUnblocked(running, blocked.back());
+
+            blocked.clear();
+        });
+    }
+
+    sampler.report(state);
+}
+
+///
+/// Measure a stream of priority changes of ready tasks followed by a timer interrupt
+///
+/// @tparam Scheduler Specify the sample scheduler
+/// @note `state.range(0)` specifies the number of tasks managed by the scheduler.
+///
+template <typename Scheduler>
+static void BM_PriorityChurn(benchmark::State& state)
+{
+    auto count = static_cast<size_t>(state.range(0));
+
+    BenchmarkTask idle(0, 0);
+
+    std::vector<BenchmarkTask> tasks;
+
+    tasks.reserve(count);
+
+    Xorshift32 random;
+
+    for (size_t index = 0; index < count; index++)
+    {
+        tasks.emplace_back(index + 1, BenchmarkTask::kMinPriorityLevel + random() % kMaxPriorityLevel);
+    }
+
+    Scheduler scheduler(&idle);
+
+    BenchmarkTask* running = createTasks(scheduler, &idle, tasks);
+
+    LatencySampler sampler;
+
+    for (auto _ : state)
+    {
+        sampler.measure([&]()
+        {
+            BenchmarkTask& task = tasks[random() % count];
+
+            // Guard: Only tasks in the ready queue can have their position adjusted
+            if (&task != running)
+            {
+                uint32_t oldPriority = task.getPriority();
+
+                task.setPriority(BenchmarkTask::kMinPriorityLevel + random() % kMaxPriorityLevel);
+
+                scheduler.adjustPosition(&task, oldPriority);
+            }
+
+            running = scheduler.onTimerInterrupt(running);
+        });
+    }
+
+    sampler.report(state);
+}
+
+///
+/// Measure timer interrupts that keep demoting tasks until they run out of levels and are recreated at the highest level
+///
+/// @tparam Scheduler Specify the multilevel feedback queue scheduler
+/// @note `state.range(0)` specifies the number of tasks managed by the scheduler.
+///
+template <typename Scheduler>
+static void BM_FeedbackDemotion(benchmark::State& state)
+{
+    auto count = static_cast<size_t>(state.range(0));
+
+    BenchmarkTask idle(0, 0);
+
+    std::vector<BenchmarkTask> tasks;
+
+    tasks.reserve(count);
+
+    for (size_t index = 0; index < count; index++)
+    {
+        tasks.emplace_back(index + 1, BenchmarkTask::kMaxPriorityLevel);
+    }
+
+    Scheduler scheduler(&idle);
+
+    BenchmarkTask* running = createTasks(scheduler, &idle, tasks);
+
+    // The first task is selected to run without being enqueued, so it has not been allocated a quantum yet
+    running->allocateTicks(BenchmarkTask::QuantumSpecifier()(running->getPriority()));
+
+    LatencySampler sampler;
+
+    for (auto _ : state)
+    {
+        sampler.measure([&]()
+        {
+            // Guard: Recreate a task at the highest level once it has been demoted to the lowest one
+            if (running != &idle && running->getPriority() == BenchmarkTask::kMinPriorityLevel)
+            {
+                BenchmarkTask* finished = running;
+
+                running = scheduler.onTaskFinished(finished);
+
+                finished->setPriority(BenchmarkTask::kMaxPriorityLevel);
+
+                running = scheduler.onTaskCreated(running, finished);
+
+                return;
+            }
+
+            running = scheduler.onTimerInterrupt(running);
+        });
+    }
+
+    sampler.report(state);
+}
+
+///
+/// Measure periodic real-time tasks that are released at the start of each period and finish before their deadlines
+///
+/// @tparam Scheduler Specify the scheduler that arranges tasks based on their deadlines
+/// @note `state.range(0)` specifies the number of periodic tasks, each of which has a distinct period.
+///       A task finishes its job and is released again with the deadline of its next period.
+///
+template <typename Scheduler>
+static void BM_PeriodicRelease(benchmark::State& state)
+{
+    auto count = static_cast<size_t>(state.range(0));
+
+    BenchmarkRealtimeTask idle(0, UINT64_MAX);
+
+    std::vector<BenchmarkRealtimeTask> tasks;
+
+    std::vector<uint64_t> periods;
+
+    tasks.reserve(count);
+
+    periods.reserve(count);
+
+    for (size_t index = 0; index < count; index++)
+    {
+        periods.push_back(count + index * 7);
+
+        tasks.emplace_back(index + 1, periods.back());
+    }
+
+    Scheduler scheduler(&idle);
+
+    BenchmarkRealtimeTask* running = createTasks(scheduler, &idle, tasks);
+
+    LatencySampler sampler;
+
+    for (auto _ : state)
+    {
+        sampler.measure([&]()
+        {
+            BenchmarkRealtimeTask* finished = running;
+
+            running = scheduler.onTaskFinished(finished);
+
+            size_t index = finished->getIdentifier() - 1;
+
+            finished->setDeadline(finished->getDeadline() + periods[index]);
+
+            running = scheduler.onTaskUnblocked(running, finished);
+        });
+    }
+
+    sampler.report(state);
+}
+
+///
+/// Register the given workload measured with a number of tasks from 16 to 4096
+///
+#define SCHEDULER_BENCHMARK(Workload, ...) \
+    BENCHMARK(Workload<Schedulers::__VA_ARGS__>)->Name(#Workload "<" #__VA_ARGS__ ">")->RangeMultiplier(16)->Range(16, 4096)
+
+// MARK: - Bursty Unblocks
+
+SCHEDULER_BENCHMARK(BM_BurstyUnblock, FIFO<BenchmarkTask>);
+
+SCHEDULER_BENCHMARK(BM_BurstyUnblock, RoundRobin<BenchmarkTask>);
+
+SCHEDULER_BENCHMARK(BM_BurstyUnblock, WorkStealingRoundRobin<BenchmarkTask>);
+
+SCHEDULER_BENCHMARK(BM_BurstyUnblock, PrioritizedRoundRobin<BenchmarkTask, kMaxPriorityLevel>);
+
+SCHEDULER_BENCHMARK(BM_BurstyUnblock, FairShare<BenchmarkTask>);
+
+// MARK: - Priority Churn
+
+SCHEDULER_BENCHMARK(BM_PriorityChurn, PrioritizedRoundRobin<BenchmarkTask, kMaxPriorityLevel>);
+
+SCHEDULER_BENCHMARK(BM_FeedbackDemotion, MultilevelFeedbackQueue<BenchmarkTask, BenchmarkTask::QuantumSpecifier, BenchmarkTask::kMaxPriorityLevel>);
+
+SCHEDULER_BENCHMARK(BM_FeedbackDemotion, TicklessMultilevelFeedbackQueue<BenchmarkTask, BenchmarkTask::QuantumSpecifier, BenchmarkTask::kMaxPriorityLevel>);
+
+// MARK: - Periodic Releases
+
+SCHEDULER_BENCHMARK(BM_PeriodicRelease, EarliestDeadlineFirst<BenchmarkRealtimeTask>);
@@ -0,0 +1,478 @@
+//
+//  DifferentialHarness.hpp
+//  SchedulerFuzzer
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef DifferentialHarness_hpp
+#define DifferentialHarness_hpp
+
+#include "FuzzTask.hpp"
+#include <Debug.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+/// Defines the harness that replays random operations against a policy and a reference model at the same time
+namespace Fuzzing
+{
+    /// The number of tasks managed by each replay, which does not exceed the capacity of any bounded policy under test
+    static constexpr size_t kNumberOfTasks = 32;
+
+    /// The largest priority level of a task
+    static constexpr uint32_t kMaxPriorityLevel = 15;
+
+    /// The largest number of tasks in a batch operation
+    static constexpr size_t kMaxBatchSize = 8;
+
+    /// The operations decoded from the input
+    enum Operation: uint8_t
+    {
+        kReady,
+        kNext,
+        kRemove,
+        kAdjustPosition,
+        kSetPriority,
+        kReadyBatch,
+        kRemoveBatch,
+        kNumberOfOperations
+    };
+
+    /// A boost extension that does nothing, since the harness never boosts the ready tasks
+    struct NoBoostExtension
+    {
+        void operator()([[maybe_unused]] FuzzTask* task) {}
+    };
+
+    ///
+    /// [Helper] Declare a tuple map policy that has a policy for every priority level
+    ///
+    /// @note Even levels use linked lists and odd levels use ring buffers,
+    ///       so that the tuple map dispatches calls to level policies of different types.
+    ///
+    template <size_t... Levels>
+    auto makeTupleMapImp(std::index_sequence<Levels...>) -> Scheduler::Policies::PrioritizedMultiQueue::Normal::TupleMapImp<FuzzTask,
+        std::conditional_t<Levels % 2 == 0, Scheduler::Policies::FIFO::Normal::LinkedListImp<FuzzTask>, Scheduler::Policies::FIFO::Normal::RingBufferImp<FuzzTask, kNumberOfTasks>>...>;
+
+    /// The reference model of the first-come, first-served ordering
+    using FIFOReference = Scheduler::Policies::FIFO::Normal::LinkedListImp<FuzzTask>;
+
+    /// The reference model of the priority ordering, where tasks at the same level are served on a first-come, first-served basis
+    using PriorityReference = Scheduler::Policies::PrioritizedSingleQueue::Normal::LinkedListImp<FuzzTask>;
+
+    ///
+    /// The reference model of the time ordering, where the task that has the smallest priority level is served first
+    ///
+    /// @note Tasks at the same priority level are served on a first-come, first-served basis.
+    ///
+    struct TimeReference
+    {
+    private:
+        /// The comparator that sorts tasks in ascending order of their priority levels while preserving the insertion order of equal levels
+        struct EarlierComparator
+        {
+            bool operator()(FuzzTask* const& lhs, FuzzTask* const& rhs)
+            {
+                return lhs->getPriority() < rhs->getPriority();
+            }
+        };
+
+        /// An internal sorted queue
+        LinkedList<FuzzTask> queue;
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = FuzzTask;
+
+        /// Dequeue the task that has the smallest priority level, `NULL` if the queue is empty
+        FuzzTask* next()
+        {
+            return this->queue.isEmpty() ? nullptr : this->queue.dequeue();
+        }
+
+        /// Enqueue the given task after all tasks whose priority levels are not larger than its own
+        void ready(FuzzTask* task)
+        {
+            this->queue.template insert(task, EarlierComparator{});
+        }
+
+        /// Remove the given task from the queue
+        void remove(FuzzTask* task)
+        {
+            this->queue.remove(task);
+        }
+
+        /// Move the given task to the position of its new priority level
+        void adjustPosition(FuzzTask* task, [[maybe_unused]] const uint32_t& oldPriority)
+        {
+            this->queue.remove(task);
+
+            this->queue.template insert(task, EarlierComparator{});
+        }
+    };
+
+    ///
+    /// Reads bytes from the fuzzer input, yielding zeros once the input is exhausted
+    ///
+    struct InputReader
+    {
+    private:
+        /// The input
+        std::span<const uint8_t> input;
+
+        /// The index of the next byte
+        size_t offset = 0;
+
+    public:
+        /// Create a reader of the given input
+        explicit InputReader(std::span<const uint8_t> input) : input(input) {}
+
+        ///
+        /// Check whether all bytes have been read
+        ///
+        /// @return `true` if there is no byte left, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool isExhausted() const
+        {
+            return this->offset >= this->input.size();
+        }
+
+        ///
+        /// Read the next byte
+        ///
+        /// @return The next byte, `0` if the input is exhausted.
+        ///
+        uint8_t read()
+        {
+            return this->isExhausted() ? 0 : this->input[this->offset++];
+        }
+    };
+
+    ///
+    /// Replay the operations encoded in the given input against a policy and a reference model
+    ///
+    /// @tparam Policy Specify the policy under test
+    /// @tparam Reference Specify the reference model, one of `FIFOReference`, `PriorityReference` and `TimeReference`
+    /// @tparam kStable Pass `true` if the policy serves tasks at the same priority level on a first-come, first-served basis,
+    ///                 `false` if it only guarantees to serve a task at the highest priority level
+    /// @param name The name of the policy printed on a mismatch
+    /// @param input The fuzzer input
+    /// @note Each operation is encoded as an opcode followed by a task index and, for some operations, one more operand.
+    ///       Operations that are not applicable in the current state, e.g. readying a task that is already ready,
+    ///       or that are not supported by the policy, e.g. removing a task from a policy that cannot remove one, are skipped.
+    /// @note Every task dequeued from the policy is checked against the reference model.
+    ///       An unstable policy may pick any task at the highest priority level,
+    ///       in which case the same task is taken out of the reference model instead of its own choice.
+    ///       Both queues are drained and compared once the input is exhausted.
+    /// @note The reference model manages its own copies of the tasks, since both queues may use the same intrusive links.
+    ///       Batch operations are mirrored to the reference model one task at a time.
+    /// @note A mismatch aborts the process, so that the fuzzer records the input that triggers it.
+    ///
+    template <typename Policy, typename Reference, bool kStable = true>
+    void replay(const char* name, std::span<const uint8_t> input)
+    {
+        std::array<FuzzTask, kNumberOfTasks> tasks;
+
+        std::array<FuzzTask, kNumberOfTasks> shadows;
+
+        std::array<bool, kNumberOfTasks> isReady = {};
+
+        for (uint32_t index = 0; index < kNumberOfTasks; index += 1)
+        {
+            tasks[index] = FuzzTask(index, index % (kMaxPriorityLevel + 1));
+
+            shadows[index] = FuzzTask(index, index % (kMaxPriorityLevel + 1));
+        }
+
+        Policy policy;
+
+        Reference reference;
+
+        InputReader reader(input);
+
+        // Dequeue a task from both queues and compare them
+        auto next = [&]() -> bool
+        {
+            FuzzTask* actual = policy.next();
+
+            FuzzTask* expected = reference.next();
+
+            // Guard: Both queues are empty
+            if (actual == nullptr && expected == nullptr)
+            {
+                return false;
+            }
+
+            if (actual == nullptr || expected == nullptr)
+            {
+                pfatal("%s: Dequeued task %d while the reference model dequeued task %d.", name,
+                       actual == nullptr ? -1 : static_cast<int>(actual->getIdentifier()),
+                       expected == nullptr ? -1 : static_cast<int>(expected->getIdentifier()));
+            }
+
+            if constexpr (kStable)
+            {
+                if (actual->getIdentifier() != expected->getIdentifier())
+                {
+                    pfatal("%s: Dequeued task %u while the reference model dequeued task %u.", name, actual->getIdentifier(), expected->getIdentifier());
+                }
+            }
+            else
+            {
+                if (actual->getPriority() != expected->getPriority())
+                {
+                    pfatal("%s: Dequeued task %u at level %u while the reference model dequeued task %u at level %u.", name,
+                           actual->getIdentifier(), actual->getPriority(), expected->getIdentifier(), expected->getPriority());
+                }
+
+                // Take the same task out of the reference model
+                if (actual->getIdentifier() != expected->getIdentifier())
+                {
+                    reference.remove(&shadows[actual->getIdentifier()]);
+
+                    reference.ready(expected);
+                }
+            }
+
+            isReady[actual->getIdentifier()] = false;
+
+            return true;
+        };
+
+        while (!reader.isExhausted())
+        {
+            uint8_t operation = reader.read() % kNumberOfOperations;
+
+            size_t index = reader.read() % kNumberOfTasks;
+
+            switch (operation)
+            {
+                case kReady:
+                {
+                    if (!isReady[index])
+                    {
+                        policy.ready(&tasks[index]);
+
+                        reference.ready(&shadows[index]);
+
+                        isReady[index] = true;
+                    }
+
+                    break;
+                }
+
+                case kNext:
+                {
+                    next();
+
+                    break;
+                }
+
+                case kRemove:
+                {
+                    if constexpr (Scheduler::Concepts::RemovablePolicy<Policy>)
+                    {
+                        if (isReady[index])
+                        {
+                            policy.remove(&tasks[index]);
+
+                            reference.remove(&shadows[index]);
+
+                            isReady[index] = false;
+                        }
+                    }
+
+                    break;
+                }
+
+                case kAdjustPosition:
+                {
+                    uint32_t priority = reader.read() % (kMaxPriorityLevel + 1);
+
+                    if constexpr (Scheduler::Concepts::AdjustablePolicy<Policy>)
+                    {
+                        if (isReady[index])
+                        {
+                            uint32_t oldPriority = tasks[index].getPriority();
+
+                            tasks[index].setPriority(priority);
+
+                            shadows[index].setPriority(priority);
+
+                            policy.adjustPosition(&tasks[index], oldPriority);
+
+                            reference.adjustPosition(&shadows[index], oldPriority);
+                        }
+                    }
+
+                    break;
+                }
+
+                case kSetPriority:
+                {
+                    uint32_t priority = reader.read() % (kMaxPriorityLevel + 1);
+
+                    if (!isReady[index])
+                    {
+                        tasks[index].setPriority(priority);
+
+                        shadows[index].setPriority(priority);
+                    }
+
+                    break;
+                }
+
+                case kReadyBatch:
+                {
+                    size_t size = reader.read() % (kMaxBatchSize + 1);
+
+                    std::array<FuzzTask*, kMaxBatchSize> batch = {};
+
+                    size_t count = 0;
+
+                    // Collect tasks that are not ready, starting from the given index
+                    for (size_t offset = 0; offset < kNumberOfTasks && count < size; offset += 1)
+                    {
+                        size_t candidate = (index + offset) % kNumberOfTasks;
+
+                        if (!isReady[candidate])
+                        {
+                            batch[count++] = &tasks[candidate];
+
+                            reference.ready(&shadows[candidate]);
+
+                            isReady[candidate] = true;
+                        }
+                    }
+
+                    Scheduler::Utilities::readyBatch(policy, std::span<FuzzTask* const>(batch.data(), count));
+
+                    break;
+                }
+
+                case kRemoveBatch:
+                {
+                    size_t size = reader.read() % (kMaxBatchSize + 1);
+
+                    if constexpr (Scheduler::Concepts::RemovablePolicy<Policy>)
+                    {
+                        std::array<FuzzTask*, kMaxBatchSize> batch = {};
+
+                        size_t count = 0;
+
+                        // Collect tasks that are ready, starting from the given index
+                        for (size_t offset = 0; offset < kNumberOfTasks && count < size; offset += 1)
+                        {
+                            size_t candidate = (index + offset) % kNumberOfTasks;
+
+                            if (isReady[candidate])
+                            {
+                                batch[count++] = &tasks[candidate];
+
+                                reference.remove(&shadows[candidate]);
+
+                                isReady[candidate] = false;
+                            }
+                        }
+
+                        Scheduler::Utilities::removeBatch(policy, std::span<FuzzTask* const>(batch.data(), count));
+                    }
+
+                    break;
+                }
+
+                default:
+                    break;
+            }
+        }
+
+        // Drain both queues
+        while (next());
+    }
+
+    ///
+    /// Replay the given input against every policy that implements the first-come, first-served, the priority or the time ordering
+    ///
+    /// @param input The fuzzer input
+    /// @note The reference models themselves are not replayed against each other.
+    ///       Policies in the `Virtual` namespace that share their implementation with their `Normal` counterparts are covered by the latter.
+    ///       `BoostableBitmapArrayMapImp` is replayed without any boost, which the reference models do not implement.
+    /// @note Timing wheels are replayed with a window of four keys, so that tasks move through the late and the overflow lists as well as the slots.
+    /// @note The following policies are deliberately out of scope, since their order depends on more than the operations replayed here:
+    ///       `FairShare::RedBlackTreeImp` orders tasks by their virtual runtime, which only changes as tasks run,
+    ///       and moves a task that falls behind forward to the smallest runtime it has dequeued when it is enqueued.
+    ///       `EarliestDeadlineFirst::PolicyWithOverloadDetection` skips or sheds tasks whose deadlines have passed on the clock advanced by timer interrupts.
+    ///       Both are covered by their unit tests instead.
+    ///
+    inline void replayAll(std::span<const uint8_t> input)
+    {
+        using namespace Scheduler::Policies;
+
+        using LevelFIFO = FIFO::Normal::LinkedListImp<FuzzTask>;
+
+        using LevelRingBuffer = FIFO::Normal::RingBufferImp<FuzzTask, kNumberOfTasks>;
+
+        using LevelMaker = Scheduler::PolicyMakers::DynamicFIFO<FuzzTask>;
+
+        // First-come, first-served ordering
+        replay<FIFO::Normal::RingBufferImp<FuzzTask, kNumberOfTasks>, FIFOReference>("FIFO::RingBufferImp", input);
+
+        replay<FIFO::Normal::StlQueueImp<FuzzTask>, FIFOReference>("FIFO::StlQueueImp", input);
+
+        replay<FIFO::Normal::IntrusiveMpscQueueImp<FuzzTask>, FIFOReference>("FIFO::IntrusiveMpscQueueImp", input);
+
+        replay<FIFO::Virtual::LinkedListImp<FuzzTask>, FIFOReference>("FIFO::Virtual::LinkedListImp", input);
+
+        // Priority ordering with ties broken on a first-come, first-served basis
+        replay<PrioritizedSingleQueue::Normal::StableDaryHeapImp<FuzzTask, 2>, PriorityReference>("PrioritizedSingleQueue::StableDaryHeapImp<2>", input);
+
+        replay<PrioritizedSingleQueue::Normal::StableDaryHeapImp<FuzzTask, 4>, PriorityReference>("PrioritizedSingleQueue::StableDaryHeapImp<4>", input);
+
+        replay<PrioritizedSingleQueue::Normal::PackedArrayImp<FuzzTask, kNumberOfTasks>, PriorityReference>("PrioritizedSingleQueue::PackedArrayImp", input);
+
+        replay<PrioritizedMultiQueue::Normal::ArrayMapImp<FuzzTask, LevelMaker, kMaxPriorityLevel>, PriorityReference>("PrioritizedMultiQueue::ArrayMapImp", input);
+
+        replay<PrioritizedMultiQueue::Normal::StlMapImp<FuzzTask, LevelMaker>, PriorityReference>("PrioritizedMultiQueue::StlMapImp", input);
+
+        replay<PrioritizedMultiQueue::Normal::BitmapArrayMapImp<FuzzTask, LevelMaker, kMaxPriorityLevel>, PriorityReference>("PrioritizedMultiQueue::BitmapArrayMapImp", input);
+
+        replay<PrioritizedMultiQueue::Normal::SparseMapImp<FuzzTask, LevelMaker>, PriorityReference>("PrioritizedMultiQueue::SparseMapImp", input);
+
+        replay<PrioritizedMultiQueue::Normal::ArrayMapHomoImp<FuzzTask, LevelFIFO, kMaxPriorityLevel>, PriorityReference>("PrioritizedMultiQueue::ArrayMapHomoImp", input);
+
+        replay<PrioritizedMultiQueue::Normal::StlMapHomoImp<FuzzTask, LevelFIFO>, PriorityReference>("PrioritizedMultiQueue::StlMapHomoImp", input);
+
+        replay<PrioritizedMultiQueue::Normal::BitmapArrayMapHomoImp<FuzzTask, LevelFIFO, kMaxPriorityLevel>, PriorityReference>("PrioritizedMultiQueue::BitmapArrayMapHomoImp", input);
+
+        replay<PrioritizedMultiQueue::Normal::BitmapArrayMapHomoImp<FuzzTask, LevelRingBuffer, kMaxPriorityLevel>, PriorityReference>("PrioritizedMultiQueue::BitmapArrayMapHomoImp<RingBufferImp>", input);
+
+        replay<PrioritizedMultiQueue::Normal::SparseMapHomoImp<FuzzTask, LevelFIFO>, PriorityReference>("PrioritizedMultiQueue::SparseMapHomoImp", input);
+
+        replay<PrioritizedMultiQueue::Normal::AdaptiveMapHomoImp<FuzzTask, LevelFIFO, kMaxPriorityLevel, 2, 5>, PriorityReference>("PrioritizedMultiQueue::AdaptiveMapHomoImp", input);
+
+        replay<PrioritizedMultiQueue::Normal::BoostableBitmapArrayMapImp<FuzzTask, LevelMaker, kMaxPriorityLevel, NoBoostExtension>, PriorityReference>("PrioritizedMultiQueue::BoostableBitmapArrayMapImp", input);
+
+        replay<decltype(makeTupleMapImp(std::make_index_sequence<kMaxPriorityLevel + 1>{})), PriorityReference>("PrioritizedMultiQueue::TupleMapImp", input);
+
+        replay<PrioritizedSingleQueue::Virtual::LinkedListImp<FuzzTask>, PriorityReference>("PrioritizedSingleQueue::Virtual::LinkedListImp", input);
+
+        // Time ordering with ties broken on a first-come, first-served basis
+        replay<TimingWheel::Normal::LinkedListImp<FuzzTask, 4>, TimeReference>("TimingWheel::LinkedListImp", input);
+
+        replay<TimingWheel::Virtual::LinkedListImp<FuzzTask, 4>, TimeReference>("TimingWheel::Virtual::LinkedListImp", input);
+
+        // Priority ordering with ties broken arbitrarily
+        replay<PrioritizedSingleQueue::Normal::StlPriorityQueueImp<FuzzTask>, PriorityReference, false>("PrioritizedSingleQueue::StlPriorityQueueImp", input);
+
+        replay<PrioritizedSingleQueue::Normal::DaryHeapImp<FuzzTask, 4>, PriorityReference, false>("PrioritizedSingleQueue::DaryHeapImp", input);
+
+        replay<PrioritizedSingleQueue::Normal::UnsortedArrayImp<FuzzTask, kNumberOfTasks>, PriorityReference, false>("PrioritizedSingleQueue::UnsortedArrayImp", input);
+    }
+}
+
+#endif /* DifferentialHarness_hpp */
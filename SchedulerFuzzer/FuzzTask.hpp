@@ -0,0 +1,49 @@
+//
+//  FuzzTask.hpp
+//  SchedulerFuzzer
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef FuzzTask_hpp
+#define FuzzTask_hpp
+
+#include <LinkedList.hpp>
+#include <Scheduler/Scheduler.hpp>
+#include <cstdint>
+
+/// A task that satisfies the constraints of every policy under test without logging anything
+class FuzzTask: public Listable<FuzzTask>, public Scheduler::Schedulable, public Scheduler::StableHeapIndexable, public Scheduler::WakeupLinkable<FuzzTask>, public Scheduler::Boostable
+{
+private:
+    uint32_t identifier;
+
+    uint32_t priority;
+
+public:
+    // MARK: Constructor
+    FuzzTask(uint32_t identifier = 0, uint32_t priority = 0) :
+            Listable(), identifier(identifier), priority(priority) {}
+
+    // MARK: Prioritizable By Mutable Priority IMP
+    using Priority = uint32_t;
+
+    [[nodiscard]]
+    const uint32_t& getPriority() const
+    {
+        return this->priority;
+    }
+
+    void setPriority(const uint32_t& priority)
+    {
+        this->priority = priority;
+    }
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+};
+
+#endif /* FuzzTask_hpp */
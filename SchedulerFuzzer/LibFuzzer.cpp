@@ -0,0 +1,16 @@
+//
+//  LibFuzzer.cpp
+//  SchedulerFuzzer
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#include "DifferentialHarness.hpp"
+
+/// The entry point invoked by libFuzzer with each generated input
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    Fuzzing::replayAll(std::span<const uint8_t>(data, size));
+
+    return 0;
+}
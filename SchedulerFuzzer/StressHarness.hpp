@@ -0,0 +1,185 @@
+//
+//  StressHarness.hpp
+//  SchedulerFuzzer
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef StressHarness_hpp
+#define StressHarness_hpp
+
+#include "FuzzTask.hpp"
+#include <Debug.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+/// Defines the harness that hammers concurrent queues from many threads
+namespace Fuzzing
+{
+    ///
+    /// Checks the tasks received by the consumer of a concurrent queue
+    ///
+    /// @note Each task must be received exactly once,
+    ///       and tasks enqueued by the same producer must be received in the order they were enqueued.
+    ///
+    struct DeliveryChecker
+    {
+    private:
+        /// The name of the queue printed on a violation
+        const char* name;
+
+        /// The number of tasks enqueued by each producer
+        size_t tasksPerProducer;
+
+        /// The sequence number of the next task expected from each producer
+        std::vector<size_t> expected;
+
+        /// The number of tasks received so far
+        size_t received = 0;
+
+    public:
+        ///
+        /// Create a checker for the given number of producers
+        ///
+        /// @param name The name of the queue
+        /// @param producers The number of producer threads
+        /// @param tasksPerProducer The number of tasks enqueued by each producer
+        ///
+        DeliveryChecker(const char* name, size_t producers, size_t tasksPerProducer) :
+            name(name), tasksPerProducer(tasksPerProducer), expected(producers, 0) {}
+
+        ///
+        /// Check a task received by the consumer
+        ///
+        /// @param task A non-null task whose identifier encodes its producer and its sequence number
+        ///
+        void receive(const FuzzTask* task)
+        {
+            size_t producer = task->getIdentifier() / this->tasksPerProducer;
+
+            size_t sequence = task->getIdentifier() % this->tasksPerProducer;
+
+            if (producer >= this->expected.size() || sequence != this->expected[producer])
+            {
+                pfatal("%s: Received task %zu of producer %zu while task %zu was expected.", this->name, sequence, producer,
+                       producer < this->expected.size() ? this->expected[producer] : SIZE_MAX);
+            }
+
+            this->expected[producer] += 1;
+
+            this->received += 1;
+        }
+
+        ///
+        /// Get the number of tasks received so far
+        ///
+        /// @return The number of tasks received by the consumer.
+        ///
+        [[nodiscard]]
+        size_t getReceivedCount() const
+        {
+            return this->received;
+        }
+    };
+
+    ///
+    /// Run producer threads that enqueue their own tasks while the calling thread consumes them
+    ///
+    /// @param name The name of the queue printed in the report
+    /// @param producers The number of producer threads
+    /// @param tasksPerProducer The number of tasks enqueued by each producer
+    /// @param produce A callable object that enqueues the given task, invoked on producer threads concurrently
+    /// @param consume A callable object that passes every task available to the given checker, invoked on the calling thread only
+    /// @note Producers start at the same time to maximize contention.
+    ///       The throughput is the number of tasks delivered per second, measured from the start of the producers to the last delivery.
+    ///
+    template <typename Produce, typename Consume>
+    void stress(const char* name, size_t producers, size_t tasksPerProducer, Produce&& produce, Consume&& consume)
+    {
+        std::vector<FuzzTask> tasks;
+
+        tasks.reserve(producers * tasksPerProducer);
+
+        for (size_t index = 0; index < producers * tasksPerProducer; index += 1)
+        {
+            tasks.emplace_back(static_cast<uint32_t>(index));
+        }
+
+        DeliveryChecker checker(name, producers, tasksPerProducer);
+
+        std::atomic<bool> start = false;
+
+        std::vector<std::thread> threads;
+
+        for (size_t producer = 0; producer < producers; producer += 1)
+        {
+            threads.emplace_back([&, producer]()
+            {
+                while (!start.load(std::memory_order_acquire));
+
+                for (size_t sequence = 0; sequence < tasksPerProducer; sequence += 1)
+                {
+                    produce(&tasks[producer * tasksPerProducer + sequence]);
+                }
+            });
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+
+        start.store(true, std::memory_order_release);
+
+        while (checker.getReceivedCount() < tasks.size())
+        {
+            consume(checker);
+        }
+
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        printf("%-32s %zu producers x %zu tasks in %.3f s (%.2f M tasks/s)\n",
+               name, producers, tasksPerProducer, elapsed, static_cast<double>(tasks.size()) / elapsed / 1e6);
+    }
+
+    ///
+    /// Stress every concurrent queue
+    ///
+    /// @param producers The number of producer threads
+    /// @param tasksPerProducer The number of tasks enqueued by each producer
+    ///
+    inline void stressAll(size_t producers, size_t tasksPerProducer)
+    {
+        {
+            Scheduler::Policies::FIFO::Normal::IntrusiveMpscQueueImp<FuzzTask> queue;
+
+            stress("FIFO::IntrusiveMpscQueueImp", producers, tasksPerProducer,
+                   [&](FuzzTask* task) { queue.ready(task); },
+                   [&](DeliveryChecker& checker)
+                   {
+                       // An empty result is transient while a producer is between the two steps of `ready()`
+                       for (FuzzTask* task = queue.next(); task != nullptr; task = queue.next())
+                       {
+                           checker.receive(task);
+                       }
+                   });
+        }
+
+        {
+            Scheduler::MultiCore::WakeupInbox<FuzzTask> inbox;
+
+            stress("MultiCore::WakeupInbox", producers, tasksPerProducer,
+                   [&](FuzzTask* task) { inbox.post(task); },
+                   [&](DeliveryChecker& checker) { inbox.drain([&](FuzzTask* task) { checker.receive(task); }); });
+        }
+    }
+}
+
+#endif /* StressHarness_hpp */
@@ -0,0 +1,115 @@
+//
+//  main.cpp
+//  SchedulerFuzzer
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include "DifferentialHarness.hpp"
+#include "StressHarness.hpp"
+
+/// Replay random inputs against every policy
+static int runProperties(uint64_t iterations, uint64_t seed)
+{
+    std::mt19937_64 generator(seed);
+
+    std::vector<uint8_t> input;
+
+    for (uint64_t iteration = 0; iteration < iterations; iteration += 1)
+    {
+        input.resize(generator() % 1024);
+
+        for (auto& byte : input)
+        {
+            byte = static_cast<uint8_t>(generator());
+        }
+
+        Fuzzing::replayAll(input);
+    }
+
+    std::cout << "Replayed " << iterations << " random inputs with seed " << seed << " against every policy.\n";
+
+    return EXIT_SUCCESS;
+}
+
+/// Replay the inputs stored in the given files, e.g. crashes recorded by libFuzzer
+static int runReplays(int count, const char* paths[])
+{
+    for (int index = 0; index < count; index += 1)
+    {
+        std::ifstream file(paths[index], std::ios::binary);
+
+        if (!file)
+        {
+            std::cerr << "Failed to open the input " << paths[index] << ".\n";
+
+            return EXIT_FAILURE;
+        }
+
+        std::vector<uint8_t> input((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        Fuzzing::replayAll(input);
+
+        std::cout << "Replayed " << paths[index] << " (" << input.size() << " bytes) against every policy.\n";
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/// Print the usage of the fuzzer
+static int usage()
+{
+    std::cerr << "Usage:\n"
+              << "  SchedulerFuzzer random [iterations] [seed]      Replay random inputs against every policy and the reference models\n"
+              << "  SchedulerFuzzer replay <input>...               Replay the given inputs, e.g. crashes recorded by libFuzzer\n"
+              << "  SchedulerFuzzer stress [producers] [tasks]      Stress the concurrent queues and report their throughput\n";
+
+    return EXIT_FAILURE;
+}
+
+int main(int argc, const char * argv[])
+{
+    if (argc < 2)
+    {
+        return usage();
+    }
+
+    if (std::strcmp(argv[1], "random") == 0)
+    {
+        uint64_t iterations = argc >= 3 ? std::strtoull(argv[2], nullptr, 10) : 10000;
+
+        uint64_t seed = argc >= 4 ? std::strtoull(argv[3], nullptr, 10) : std::random_device()();
+
+        return runProperties(iterations, seed);
+    }
+
+    if (std::strcmp(argv[1], "replay") == 0 && argc >= 3)
+    {
+        return runReplays(argc - 2, argv + 2);
+    }
+
+    if (std::strcmp(argv[1], "stress") == 0)
+    {
+        size_t producers = argc >= 3 ? std::strtoull(argv[2], nullptr, 10) : 4;
+
+        size_t tasks = argc >= 4 ? std::strtoull(argv[3], nullptr, 10) : 1000000;
+
+        if (producers == 0 || tasks == 0)
+        {
+            return usage();
+        }
+
+        Fuzzing::stressAll(producers, tasks);
+
+        return EXIT_SUCCESS;
+    }
+
+    return usage();
+}
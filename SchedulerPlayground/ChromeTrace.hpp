@@ -0,0 +1,122 @@
+//
+//  ChromeTrace.hpp
+//  SchedulerPlayground
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef ChromeTrace_hpp
+#define ChromeTrace_hpp
+
+#include <Scheduler/Instrumentation/Trace.hpp>
+#include <ostream>
+#include <span>
+
+/// Converts trace records to the Chrome trace event format, which can be loaded by `chrome://tracing` and Perfetto
+namespace ChromeTrace
+{
+    using Scheduler::Instrumentation::Event;
+
+    using Scheduler::Instrumentation::TraceRecord;
+
+    ///
+    /// Get the name of the given event
+    ///
+    /// @param event The event
+    /// @return The name of the event.
+    ///
+    inline const char* nameOf(Event event)
+    {
+        switch (event)
+        {
+            case Event::kTaskCreated:
+                return "TaskCreated";
+
+            case Event::kTaskFinished:
+                return "TaskFinished";
+
+            case Event::kTaskYielded:
+                return "TaskYielded";
+
+            case Event::kTaskBlocked:
+                return "TaskBlocked";
+
+            case Event::kTaskUnblocked:
+                return "TaskUnblocked";
+
+            case Event::kTaskKilled:
+                return "TaskKilled";
+
+            case Event::kTaskPriorityChanged:
+                return "TaskPriorityChanged";
+
+            case Event::kTaskSelfPriorityChanged:
+                return "TaskSelfPriorityChanged";
+
+            case Event::kTaskQuantumUsedUp:
+                return "TaskQuantumUsedUp";
+
+            case Event::kTimerInterrupt:
+                return "TimerInterrupt";
+
+            default:
+                return "Unknown";
+        }
+    }
+
+    ///
+    /// Write the given trace records as a Chrome trace JSON document
+    ///
+    /// @param stream The output stream
+    /// @param records Trace records in the order they are written
+    /// @param core The index of the core where the scheduler runs, which becomes the thread identifier
+    /// @param ticksPerMicrosecond The number of clock ticks per microsecond
+    /// @note Each event becomes an instant event on the core.
+    ///       Each period between two decisions that select a task becomes a complete event named after the running task.
+    ///
+    inline void write(std::ostream& stream, std::span<const TraceRecord> records, uint32_t core = 0, double ticksPerMicrosecond = 1)
+    {
+        stream << "{\"traceEvents\":[";
+
+        const char* separator = "";
+
+        // The last decision that selected a task to run
+        const TraceRecord* running = nullptr;
+
+        for (const TraceRecord& record : records)
+        {
+            double timestamp = static_cast<double>(record.timestamp) / ticksPerMicrosecond;
+
+            stream << separator
+                   << "{\"name\":\"" << nameOf(record.event) << "\",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":" << core
+                   << ",\"ts\":" << timestamp
+                   << ",\"args\":{\"current\":" << record.current << ",\"next\":" << record.next << ",\"priority\":" << record.priority << "}}";
+
+            separator = ",";
+
+            // Guard: Intermediate calls do not select a task to run
+            if (record.next == TraceRecord::kNoTask)
+            {
+                continue;
+            }
+
+            // Close the slice of the task that has been running so far
+            if (running != nullptr && running->next != record.next)
+            {
+                double start = static_cast<double>(running->timestamp) / ticksPerMicrosecond;
+
+                stream << ",{\"name\":\"Task " << running->next << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << core
+                       << ",\"ts\":" << start << ",\"dur\":" << timestamp - start << "}";
+            }
+
+            if (running == nullptr || running->next != record.next)
+            {
+                running = &record;
+            }
+        }
+
+        stream << "]}\n";
+    }
+}
+
+#endif /* ChromeTrace_hpp */
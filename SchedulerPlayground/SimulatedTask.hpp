@@ -0,0 +1,161 @@
+//
+//  SimulatedTask.hpp
+//  SchedulerPlayground
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef SimulatedTask_hpp
+#define SimulatedTask_hpp
+
+#include "Simulator.hpp"
+#include <LinkedList.hpp>
+#include <algorithm>
+
+/// Defines the components of the trace-driven discrete-event simulator
+namespace Simulation
+{
+    ///
+    /// A simulated task prioritized by its priority level, which can be managed by the sample schedulers other than the real-time ones
+    ///
+    /// @note Priority levels in the trace are clamped to `[kMinPriorityLevel, kMaxPriorityLevel]`,
+    ///       where the level zero is reserved for the idle task.
+    ///
+    class SimulatedTask: public Listable<SimulatedTask>, public Scheduler::Schedulable, public Scheduler::StableHeapIndexable, public TaskState
+    {
+    public:
+        /// The lowest priority level of a task other than the idle task
+        static constexpr uint32_t kMinPriorityLevel = 1;
+
+        /// The highest priority level of a task
+        static constexpr uint32_t kMaxPriorityLevel = 63;
+
+    private:
+        uint32_t priority;
+
+        uint32_t ticks;
+
+    public:
+        // MARK: Constructor
+        explicit SimulatedTask(const WorkloadRecord& record) :
+            Listable(), priority(record.task == 0 ? 0 : std::clamp<uint32_t>(record.priority, kMinPriorityLevel, kMaxPriorityLevel)), ticks(0) {}
+
+        // MARK: Prioritizable By Mutable Priority IMP
+        using Priority = uint32_t;
+
+        [[nodiscard]]
+        const uint32_t& getPriority() const
+        {
+            return this->priority;
+        }
+
+        void setPriority(const uint32_t& priority)
+        {
+            this->priority = std::clamp(priority, kMinPriorityLevel, kMaxPriorityLevel);
+        }
+
+        void demote()
+        {
+            if (this->priority > kMinPriorityLevel)
+            {
+                this->priority -= 1;
+            }
+        }
+
+        void promote()
+        {
+            if (this->priority < kMaxPriorityLevel)
+            {
+                this->priority += 1;
+            }
+        }
+
+        // MARK: Quantizable IMP
+        using Tick = uint32_t;
+
+        void tick()
+        {
+            // A task selected to run without being enqueued may not have been allocated a quantum
+            if (this->ticks > 0)
+            {
+                this->ticks -= 1;
+            }
+        }
+
+        void consumeTicks(uint32_t ticks)
+        {
+            this->ticks -= std::min(ticks, this->ticks);
+        }
+
+        [[nodiscard]]
+        uint32_t getRemainingTicks() const
+        {
+            return this->ticks;
+        }
+
+        bool hasUsedUpTimeAllotment()
+        {
+            return this->ticks == 0;
+        }
+
+        void allocateTicks(uint32_t ticks)
+        {
+            this->ticks = ticks;
+        }
+
+        [[nodiscard]]
+        uint32_t getIdentifier() const
+        {
+            return this->identifier;
+        }
+
+        // Quantum Specifier
+        struct QuantumSpecifier
+        {
+            constexpr uint32_t operator()(const uint32_t& priority)
+            {
+                // A task at the highest level runs for one tick, and every eight levels below double the quantum
+                return 1u << ((kMaxPriorityLevel - std::clamp(priority, kMinPriorityLevel, kMaxPriorityLevel)) / 8);
+            }
+        };
+    };
+
+    ///
+    /// A simulated real-time task, where the task whose current CPU burst has the earliest deadline has the highest priority
+    ///
+    class SimulatedRealtimeTask: public Listable<SimulatedRealtimeTask>, public Scheduler::Schedulable, public Scheduler::StableHeapIndexable, public TaskState
+    {
+    public:
+        // MARK: Constructor
+        explicit SimulatedRealtimeTask([[maybe_unused]] const WorkloadRecord& record) : Listable() {}
+
+        // MARK: Prioritizable IMP
+        friend bool operator<(const SimulatedRealtimeTask& lhs, const SimulatedRealtimeTask& rhs)
+        {
+            return lhs.absoluteDeadline > rhs.absoluteDeadline;
+        }
+
+        friend bool operator>(const SimulatedRealtimeTask& lhs, const SimulatedRealtimeTask& rhs)
+        {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(const SimulatedRealtimeTask& lhs, const SimulatedRealtimeTask& rhs)
+        {
+            return !(lhs > rhs);
+        }
+
+        friend bool operator>=(const SimulatedRealtimeTask& lhs, const SimulatedRealtimeTask& rhs)
+        {
+            return !(lhs < rhs);
+        }
+
+        [[nodiscard]]
+        uint32_t getIdentifier() const
+        {
+            return this->identifier;
+        }
+    };
+}
+
+#endif /* SimulatedTask_hpp */
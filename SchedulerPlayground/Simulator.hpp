@@ -0,0 +1,658 @@
+//
+//  Simulator.hpp
+//  SchedulerPlayground
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Simulator_hpp
+#define Simulator_hpp
+
+#include "WorkloadTrace.hpp"
+#include <Scheduler/Scheduler.hpp>
+#include <algorithm>
+#include <memory>
+#include <ostream>
+#include <unordered_map>
+
+/// Defines the components of the trace-driven discrete-event simulator
+namespace Simulation
+{
+    ///
+    /// The state kept by the simulator for each simulated task
+    ///
+    /// @note A simulated task must inherit from this struct.
+    ///
+    struct TaskState
+    {
+        /// States of a simulated task
+        enum class State: uint8_t
+        {
+            kReady,
+            kRunning,
+            kBlocked,
+            kFinished,
+        };
+
+        /// The identifier of the task in the trace
+        uint32_t identifier = 0;
+
+        /// The current state
+        State state = State::kReady;
+
+        /// `true` if the current CPU burst is the last one of the task
+        bool isLastBurst = false;
+
+        /// `true` if the task has been dispatched since its current CPU burst was released
+        bool isDispatched = false;
+
+        /// `true` if the task has been unblocked while it is still running its current CPU burst
+        bool hasPendingWakeup = false;
+
+        /// `true` if the task has a change of its priority level that is applied once it leaves the ready queue
+        bool hasPendingPriority = false;
+
+        /// The deferred priority level
+        uint16_t pendingPriority = 0;
+
+        /// The time when the task arrived
+        uint64_t arrivalTime = 0;
+
+        /// The time when the current CPU burst was released
+        uint64_t releaseTime = 0;
+
+        /// The absolute deadline of the current CPU burst, `UINT64_MAX` if the burst does not have a deadline
+        uint64_t absoluteDeadline = UINT64_MAX;
+
+        /// The amount of time left in the current CPU burst
+        uint64_t remainingBurst = 0;
+
+        /// The unblock event that has arrived while the task is still running its current CPU burst
+        WorkloadRecord pendingWakeup = {};
+
+        ///
+        /// Release a new CPU burst of the task
+        ///
+        /// @param now The current time
+        /// @param record The arrival or unblock event that starts the burst
+        ///
+        void release(uint64_t now, const WorkloadRecord& record)
+        {
+            this->isLastBurst = (record.flags & WorkloadRecord::kLastBurst) != 0;
+
+            this->isDispatched = false;
+
+            this->releaseTime = now;
+
+            this->absoluteDeadline = record.deadline == 0 ? UINT64_MAX : now + record.deadline;
+
+            this->remainingBurst = record.burst;
+        }
+    };
+
+    ///
+    /// Measurements of a simulation run
+    ///
+    struct Report
+    {
+        /// The simulated time span from the first event to the time when the last task stops running
+        uint64_t elapsedTime = 0;
+
+        /// The amount of time when a task other than the idle task is running
+        uint64_t busyTime = 0;
+
+        /// The number of tasks that have arrived
+        uint64_t tasksArrived = 0;
+
+        /// The number of tasks that have finished
+        uint64_t tasksFinished = 0;
+
+        /// The number of tasks that are still blocked when the trace ends
+        uint64_t tasksUnfinished = 0;
+
+        /// The number of CPU bursts that have been released
+        uint64_t burstsReleased = 0;
+
+        /// The number of CPU bursts that have completed
+        uint64_t burstsCompleted = 0;
+
+        /// The number of CPU bursts that have completed after their deadlines
+        uint64_t deadlineMisses = 0;
+
+        /// The number of times a different task is selected to run
+        uint64_t contextSwitches = 0;
+
+        /// The number of records that do not refer to a known task or a valid state and have been ignored
+        uint64_t recordsIgnored = 0;
+
+        /// The number of unblock events merged into a pending one because the task has not caught up with its previous bursts
+        uint64_t wakeupsCoalesced = 0;
+
+        /// The accumulated time from the arrival to the completion of each finished task
+        uint64_t totalTurnaroundTime = 0;
+
+        /// The longest time from the arrival to the completion of a task
+        uint64_t maxTurnaroundTime = 0;
+
+        /// The accumulated time from the release to the first dispatch of each CPU burst
+        uint64_t totalResponseTime = 0;
+
+        /// The longest time from the release to the first dispatch of a CPU burst
+        uint64_t maxResponseTime = 0;
+
+        /// The number of CPU bursts that have been dispatched at least once
+        uint64_t burstsDispatched = 0;
+
+        ///
+        /// Get the fraction of time when the processor is busy
+        ///
+        /// @return The CPU utilization in `[0, 1]`.
+        ///
+        [[nodiscard]]
+        double getUtilization() const
+        {
+            return this->elapsedTime == 0 ? 0 : static_cast<double>(this->busyTime) / static_cast<double>(this->elapsedTime);
+        }
+
+        ///
+        /// Get the mean turnaround time of finished tasks
+        ///
+        /// @return The mean turnaround time.
+        ///
+        [[nodiscard]]
+        double getMeanTurnaroundTime() const
+        {
+            return this->tasksFinished == 0 ? 0 : static_cast<double>(this->totalTurnaroundTime) / static_cast<double>(this->tasksFinished);
+        }
+
+        ///
+        /// Get the mean response time of dispatched CPU bursts
+        ///
+        /// @return The mean response time.
+        ///
+        [[nodiscard]]
+        double getMeanResponseTime() const
+        {
+            return this->burstsDispatched == 0 ? 0 : static_cast<double>(this->totalResponseTime) / static_cast<double>(this->burstsDispatched);
+        }
+
+        ///
+        /// Print the report to the given stream
+        ///
+        /// @param stream The output stream
+        ///
+        void print(std::ostream& stream) const
+        {
+            stream << "Elapsed Time    : " << this->elapsedTime << "\n"
+                   << "CPU Utilization : " << this->getUtilization() * 100 << "%\n"
+                   << "Tasks           : " << this->tasksArrived << " arrived, " << this->tasksFinished << " finished, " << this->tasksUnfinished << " unfinished\n"
+                   << "CPU Bursts      : " << this->burstsReleased << " released, " << this->burstsCompleted << " completed\n"
+                   << "Deadline Misses : " << this->deadlineMisses << "\n"
+                   << "Turnaround Time : " << this->getMeanTurnaroundTime() << " mean, " << this->maxTurnaroundTime << " max\n"
+                   << "Response Time   : " << this->getMeanResponseTime() << " mean, " << this->maxResponseTime << " max\n"
+                   << "Context Switches: " << this->contextSwitches << "\n"
+                   << "Coalesced Wakeup: " << this->wakeupsCoalesced << "\n"
+                   << "Ignored Records : " << this->recordsIgnored << "\n";
+        }
+    };
+
+    /// A task that can be driven by the simulator
+    template <typename Task>
+    concept SimulatableTask = std::derived_from<Task, TaskState> && std::constructible_from<Task, const WorkloadRecord&>;
+
+    ///
+    /// A discrete-event simulator that replays a workload trace against a scheduler
+    ///
+    /// @tparam ConcreteScheduler Specify a scheduler that supports the idle task and is constructed with it
+    /// @note The simulator advances the time from one event to the next one instead of stepping through each tick,
+    ///       where an event is a record in the trace, the completion of the current CPU burst or a timer interrupt.
+    /// @note A timer interrupt is delivered every `tickPeriod` units of time while a task other than the idle task is running,
+    ///       if the scheduler provides a timer interrupt handler.
+    /// @note A task that completes a CPU burst is reported to the task blocked handler,
+    ///       or to the task termination handler if the scheduler does not provide one, e.g. a scheduler of periodic jobs.
+    /// @note A priority change of a ready task is reported to the task priority changed handler, or applied by adjusting the position of the task,
+    ///       and is deferred until the task leaves the ready queue if the scheduler supports neither of them.
+    ///       Priority changes are ignored if tasks are not prioritizable by their mutable priority level.
+    /// @note Only tasks that are alive are kept in memory, so the memory usage does not grow with the length of the trace.
+    ///
+    template <typename ConcreteScheduler>
+    requires SimulatableTask<Scheduler::Traits::ScheduledTask<ConcreteScheduler>> &&
+             Scheduler::ProvidesTaskCreationHandler<ConcreteScheduler> &&
+             Scheduler::ProvidesTaskTerminationHandler<ConcreteScheduler> &&
+             Scheduler::ProvidesTaskUnblockedHandler<ConcreteScheduler> &&
+             Scheduler::SupportsIdleTask<ConcreteScheduler>
+    class Simulator
+    {
+    private:
+        /// Type of the task managed by the scheduler
+        using Task = Scheduler::Traits::ScheduledTask<ConcreteScheduler>;
+
+        /// The idle task
+        Task idle;
+
+        /// The scheduler under evaluation
+        ConcreteScheduler scheduler;
+
+        /// Tasks that are alive, keyed by their identifiers in the trace
+        std::unordered_map<uint32_t, std::unique_ptr<Task>> tasks;
+
+        /// The current running task
+        Task* running;
+
+        /// The current time
+        uint64_t now;
+
+        /// The interval between two timer interrupts
+        uint64_t tickPeriod;
+
+        /// The time of the next timer interrupt
+        uint64_t nextTick;
+
+        /// Measurements of the current run
+        Report report;
+
+        ///
+        /// [Helper] Switch to the task selected by an event handler
+        ///
+        /// @param next The non-null task returned by a terminating call
+        ///
+        void dispatch(Task* next)
+        {
+            // Guard: The current running task keeps running
+            if (next == this->running)
+            {
+                return;
+            }
+
+            this->report.contextSwitches += 1;
+
+            // The previous task is preempted unless it has stopped running on its own
+            if (this->running->state == TaskState::State::kRunning)
+            {
+                this->running->state = TaskState::State::kReady;
+            }
+
+            next->state = TaskState::State::kRunning;
+
+            if (next != &this->idle && !next->isDispatched)
+            {
+                uint64_t response = this->now - next->releaseTime;
+
+                next->isDispatched = true;
+
+                this->report.burstsDispatched += 1;
+
+                this->report.totalResponseTime += response;
+
+                this->report.maxResponseTime = std::max(this->report.maxResponseTime, response);
+            }
+
+            this->running = next;
+        }
+
+        ///
+        /// [Helper] Set the priority level of the given task that does not reside in the ready queue
+        ///
+        /// @param task A task that is running or blocked
+        ///
+        void applyPendingPriority(Task* task)
+        {
+            if constexpr (TaskConstraints::PrioritizableByMutablePriority<Task>)
+            {
+                if (task->hasPendingPriority)
+                {
+                    task->setPriority(task->pendingPriority);
+
+                    task->hasPendingPriority = false;
+                }
+            }
+        }
+
+        ///
+        /// [Helper] Handle the completion of the current CPU burst of the running task
+        ///
+        void completeBurst()
+        {
+            Task* task = this->running;
+
+            this->report.burstsCompleted += 1;
+
+            if (this->now > task->absoluteDeadline)
+            {
+                this->report.deadlineMisses += 1;
+            }
+
+            // Case 1: The task finishes
+            if (task->isLastBurst)
+            {
+                uint64_t turnaround = this->now - task->arrivalTime;
+
+                this->report.tasksFinished += 1;
+
+                this->report.totalTurnaroundTime += turnaround;
+
+                this->report.maxTurnaroundTime = std::max(this->report.maxTurnaroundTime, turnaround);
+
+                task->state = TaskState::State::kFinished;
+
+                this->dispatch(this->scheduler.onTaskFinished(task));
+
+                this->tasks.erase(task->identifier);
+
+                return;
+            }
+
+            // Case 2: The task has been unblocked before its burst ends, so it starts the next burst right away
+            if (task->hasPendingWakeup)
+            {
+                task->hasPendingWakeup = false;
+
+                task->release(this->now, task->pendingWakeup);
+
+                task->isDispatched = true;
+
+                this->report.burstsReleased += 1;
+
+                this->report.burstsDispatched += 1;
+
+                return;
+            }
+
+            // Case 3: The task blocks
+            task->state = TaskState::State::kBlocked;
+
+            this->applyPendingPriority(task);
+
+            if constexpr (Scheduler::ProvidesTaskBlockedHandler<ConcreteScheduler>)
+            {
+                this->dispatch(this->scheduler.onTaskBlocked(task));
+            }
+            else
+            {
+                this->dispatch(this->scheduler.onTaskFinished(task));
+            }
+        }
+
+        ///
+        /// [Helper] Handle an arrival event
+        ///
+        /// @param record The event
+        ///
+        void arrive(const WorkloadRecord& record)
+        {
+            // Guard: The identifier must not refer to the idle task or a task that is alive
+            if (record.task == 0 || this->tasks.contains(record.task))
+            {
+                this->report.recordsIgnored += 1;
+
+                return;
+            }
+
+            Task* task = this->tasks.emplace(record.task, std::make_unique<Task>(record)).first->second.get();
+
+            task->identifier = record.task;
+
+            task->arrivalTime = this->now;
+
+            task->release(this->now, record);
+
+            this->report.tasksArrived += 1;
+
+            this->report.burstsReleased += 1;
+
+            this->dispatch(this->scheduler.onTaskCreated(this->running, task));
+        }
+
+        ///
+        /// [Helper] Handle an unblock event
+        ///
+        /// @param task The task that is unblocked
+        /// @param record The event
+        ///
+        void unblock(Task* task, const WorkloadRecord& record)
+        {
+            // Guard: A task that is still running its current burst starts the next one once the current one ends
+            if (task->state != TaskState::State::kBlocked)
+            {
+                // Guard: A task that is running its last burst cannot be unblocked
+                if (task->isLastBurst)
+                {
+                    this->report.recordsIgnored += 1;
+
+                    return;
+                }
+
+                // Guard: The task falls behind, so the new burst is appended to the pending one
+                if (task->hasPendingWakeup)
+                {
+                    task->pendingWakeup.burst += record.burst;
+
+                    task->pendingWakeup.flags |= record.flags;
+
+                    this->report.wakeupsCoalesced += 1;
+
+                    return;
+                }
+
+                task->hasPendingWakeup = true;
+
+                task->pendingWakeup = record;
+
+                return;
+            }
+
+            task->state = TaskState::State::kReady;
+
+            task->release(this->now, record);
+
+            this->report.burstsReleased += 1;
+
+            this->dispatch(this->scheduler.onTaskUnblocked(this->running, task));
+        }
+
+        ///
+        /// [Helper] Handle a priority change event
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param record The event
+        ///
+        void changePriority(Task* task, const WorkloadRecord& record)
+        {
+            if constexpr (TaskConstraints::PrioritizableByMutablePriority<Task>)
+            {
+                typename Task::Priority oldPriority = task->getPriority();
+
+                // Case 1: The task is not in the ready queue
+                if (task->state != TaskState::State::kReady)
+                {
+                    task->setPriority(record.priority);
+
+                    if constexpr (Scheduler::ProvidesTaskSelfPriorityChangedHandler<ConcreteScheduler>)
+                    {
+                        if (task == this->running)
+                        {
+                            this->dispatch(this->scheduler.onTaskPriorityChanged(task));
+                        }
+                    }
+
+                    return;
+                }
+
+                // Case 2: The task is in the ready queue
+                if constexpr (Scheduler::ProvidesTaskPriorityChangedHandler<ConcreteScheduler>)
+                {
+                    task->setPriority(record.priority);
+
+                    this->dispatch(this->scheduler.onTaskPriorityChanged(this->running, task, oldPriority));
+                }
+                else if constexpr (Scheduler::SupportsAdjustingTaskPriority<ConcreteScheduler>)
+                {
+                    task->setPriority(record.priority);
+
+                    this->scheduler.adjustPosition(task, oldPriority);
+                }
+                else
+                {
+                    task->hasPendingPriority = true;
+
+                    task->pendingPriority = record.priority;
+                }
+            }
+            else
+            {
+                this->report.recordsIgnored += 1;
+            }
+        }
+
+        ///
+        /// [Helper] Handle the given record
+        ///
+        /// @param record The record of which timestamp has been reached
+        ///
+        void handle(const WorkloadRecord& record)
+        {
+            // Guard: Arrivals create new tasks
+            if (record.event == WorkloadEvent::kArrival)
+            {
+                this->arrive(record);
+
+                return;
+            }
+
+            auto iterator = this->tasks.find(record.task);
+
+            // Guard: Other events must refer to a task that is alive
+            if (iterator == this->tasks.end())
+            {
+                this->report.recordsIgnored += 1;
+
+                return;
+            }
+
+            switch (record.event)
+            {
+                case WorkloadEvent::kUnblocked:
+                    this->unblock(iterator->second.get(), record);
+
+                    break;
+
+                case WorkloadEvent::kPriorityChanged:
+                    this->changePriority(iterator->second.get(), record);
+
+                    break;
+
+                default:
+                    this->report.recordsIgnored += 1;
+
+                    break;
+            }
+        }
+
+    public:
+        ///
+        /// Create a simulator
+        ///
+        /// @param tickPeriod The interval between two timer interrupts
+        ///
+        explicit Simulator(uint64_t tickPeriod = 1) :
+            idle(WorkloadRecord{}), scheduler(&this->idle), running(&this->idle), now(0), tickPeriod(std::max<uint64_t>(tickPeriod, 1)), nextTick(0) {}
+
+        Simulator(const Simulator&) = delete;
+
+        Simulator& operator=(const Simulator&) = delete;
+
+        ///
+        /// Replay the given workload trace
+        ///
+        /// @param reader A reader of the trace
+        /// @return The measurements of the run.
+        /// @note The simulation ends once all records have been consumed and only the idle task is ready to run.
+        ///
+        Report run(WorkloadReader& reader)
+        {
+            this->idle.state = TaskState::State::kRunning;
+
+            const WorkloadRecord* record = reader.peek();
+
+            // Guard: The trace must have at least one record
+            if (record == nullptr)
+            {
+                return this->report;
+            }
+
+            uint64_t start = record->timestamp;
+
+            this->now = start;
+
+            while (record != nullptr || this->running != &this->idle)
+            {
+                bool busy = this->running != &this->idle;
+
+                // Find the time of the next event
+                uint64_t next = UINT64_MAX;
+
+                if (record != nullptr)
+                {
+                    next = std::max(record->timestamp, this->now);
+                }
+
+                if (busy)
+                {
+                    next = std::min(next, this->now + this->running->remainingBurst);
+
+                    if constexpr (Scheduler::ProvidesTimerInterruptHandler<ConcreteScheduler>)
+                    {
+                        // Timer interrupts are not delivered while the idle task is running
+                        if (this->nextTick <= this->now)
+                        {
+                            this->nextTick = (this->now / this->tickPeriod + 1) * this->tickPeriod;
+                        }
+
+                        next = std::min(next, this->nextTick);
+                    }
+                }
+
+                // Advance the time to the next event
+                if (busy)
+                {
+                    this->running->remainingBurst -= next - this->now;
+
+                    this->report.busyTime += next - this->now;
+                }
+
+                this->now = next;
+
+                // Deliver the events in the order of burst completion, trace records and timer interrupts
+                if (busy && this->running->remainingBurst == 0)
+                {
+                    this->completeBurst();
+                }
+
+                while (record != nullptr && record->timestamp <= this->now)
+                {
+                    this->handle(*record);
+
+                    reader.pop();
+
+                    record = reader.peek();
+                }
+
+                if constexpr (Scheduler::ProvidesTimerInterruptHandler<ConcreteScheduler>)
+                {
+                    if (this->now == this->nextTick && this->running != &this->idle)
+                    {
+                        this->dispatch(this->scheduler.onTimerInterrupt(this->running));
+                    }
+                }
+            }
+
+            this->report.elapsedTime = this->now - start;
+
+            this->report.tasksUnfinished = this->tasks.size();
+
+            return this->report;
+        }
+    };
+}
+
+#endif /* Simulator_hpp */
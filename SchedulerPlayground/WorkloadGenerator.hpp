@@ -0,0 +1,121 @@
+//
+//  WorkloadGenerator.hpp
+//  SchedulerPlayground
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef WorkloadGenerator_hpp
+#define WorkloadGenerator_hpp
+
+#include "WorkloadTrace.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+/// Defines the components of the trace-driven discrete-event simulator
+namespace Simulation
+{
+    ///
+    /// Write a synthetic workload of periodic tasks to the given trace
+    ///
+    /// @param writer The writer of the trace
+    /// @param numberOfTasks The number of tasks
+    /// @param burstsPerTask The number of CPU bursts released by each task, one per period
+    /// @param load The total utilization requested by all tasks
+    /// @param seed The seed of the random number generator
+    /// @return The number of records written.
+    /// @note Each task arrives at a random time, and then releases a CPU burst at the start of each period,
+    ///       of which deadline is the end of the period.
+    ///       The length of each burst is drawn around the share of the period given by the load divided by the number of tasks.
+    ///       One out of eight releases also changes the priority level of the task.
+    /// @note Records are produced in time order by merging the releases of all tasks,
+    ///       so the generator keeps only the state of each task in memory.
+    ///
+    inline uint64_t generate(WorkloadWriter& writer, uint32_t numberOfTasks, uint32_t burstsPerTask, double load = 0.8, uint32_t seed = 1)
+    {
+        struct Periodic
+        {
+            uint32_t period;
+
+            uint32_t burst;
+
+            uint32_t released;
+        };
+
+        std::mt19937 random(seed);
+
+        // Periods are stretched with the number of tasks, so that each burst lasts for several units of time
+        uint32_t scale = std::max<uint32_t>(1, numberOfTasks / 10);
+
+        std::vector<Periodic> tasks(numberOfTasks);
+
+        // The time of the next release of each task
+        std::priority_queue<std::pair<uint64_t, uint32_t>, std::vector<std::pair<uint64_t, uint32_t>>, std::greater<>> releases;
+
+        for (uint32_t index = 0; index < numberOfTasks; index++)
+        {
+            uint32_t period = (20 + random() % 180) * scale;
+
+            tasks[index] = {period, std::max<uint32_t>(1, static_cast<uint32_t>(std::lround(period * load / numberOfTasks))), 0};
+
+            releases.emplace(random() % (200 * scale), index);
+        }
+
+        uint64_t count = 0;
+
+        while (!releases.empty() && burstsPerTask > 0)
+        {
+            auto [timestamp, index] = releases.top();
+
+            releases.pop();
+
+            Periodic& task = tasks[index];
+
+            uint16_t priority = 1 + random() % 63;
+
+            // Change the priority level of a task that has already arrived
+            if (task.released > 0 && random() % 8 == 0)
+            {
+                writer.write({timestamp, index + 1, 0, 0, priority, WorkloadEvent::kPriorityChanged, 0});
+
+                count += 1;
+            }
+
+            WorkloadRecord record = {};
+
+            record.timestamp = timestamp;
+
+            record.task = index + 1;
+
+            record.burst = std::max<uint32_t>(1, task.burst - task.burst / 2 + random() % (task.burst + 1));
+
+            record.deadline = task.period;
+
+            record.priority = priority;
+
+            record.event = task.released == 0 ? WorkloadEvent::kArrival : WorkloadEvent::kUnblocked;
+
+            record.flags = task.released + 1 == burstsPerTask ? WorkloadRecord::kLastBurst : 0;
+
+            writer.write(record);
+
+            count += 1;
+
+            task.released += 1;
+
+            if (task.released < burstsPerTask)
+            {
+                releases.emplace(timestamp + task.period, index);
+            }
+        }
+
+        return count;
+    }
+}
+
+#endif /* WorkloadGenerator_hpp */
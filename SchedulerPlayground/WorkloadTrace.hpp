@@ -0,0 +1,279 @@
+//
+//  WorkloadTrace.hpp
+//  SchedulerPlayground
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef WorkloadTrace_hpp
+#define WorkloadTrace_hpp
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+/// Defines the components of the trace-driven discrete-event simulator
+namespace Simulation
+{
+    /// Kinds of events recorded in a workload trace
+    enum class WorkloadEvent: uint8_t
+    {
+        /// A task arrives and starts its first CPU burst
+        kArrival,
+
+        /// A blocked task is unblocked and starts its next CPU burst
+        kUnblocked,
+
+        /// The priority level of a task is changed
+        kPriorityChanged,
+    };
+
+    ///
+    /// A fixed-size record of an event in a workload trace
+    ///
+    /// @note A task blocks once it has run for the length of its current CPU burst, and finishes instead if the burst is its last one.
+    ///       An unblock event that arrives while the task is still running its current burst takes effect as soon as the burst ends,
+    ///       so captures that do not know when a task would block in the simulated system remain valid.
+    /// @note Records are stored in the native byte order.
+    ///
+    struct WorkloadRecord
+    {
+        /// The record starts the last CPU burst of the task
+        static constexpr uint8_t kLastBurst = 1 << 0;
+
+        /// The time when the event occurs
+        uint64_t timestamp;
+
+        /// The identifier of the task, which may be reused once the task has finished, while zero is reserved for the idle task
+        uint32_t task;
+
+        /// The length of the CPU burst started by an arrival or an unblock event
+        uint32_t burst;
+
+        /// The deadline of the CPU burst relative to the timestamp, zero if the burst does not have a deadline
+        uint32_t deadline;
+
+        /// The priority level of the task for an arrival or a priority change event
+        uint16_t priority;
+
+        /// The kind of the event
+        WorkloadEvent event;
+
+        /// A combination of `kLastBurst`
+        uint8_t flags;
+    };
+
+    static_assert(sizeof(WorkloadRecord) == 24, "Workload records must be packed.");
+
+    ///
+    /// The header at the beginning of a workload trace file
+    ///
+    struct WorkloadHeader
+    {
+        /// The magic number of a workload trace file
+        static constexpr char kMagic[8] = {'S', 'C', 'H', 'E', 'D', 'W', 'L', '\0'};
+
+        /// The current version of the format
+        static constexpr uint32_t kVersion = 1;
+
+        /// The magic number
+        char magic[8];
+
+        /// The version of the format
+        uint32_t version;
+
+        /// The size of each record in bytes
+        uint32_t recordSize;
+    };
+
+    ///
+    /// Reads workload records from a trace file in chunks, so that traces of any size are replayed with a constant amount of memory
+    ///
+    class WorkloadReader
+    {
+    private:
+        /// The number of records read from the file at once
+        static constexpr size_t kChunkSize = 4096;
+
+        /// The trace file, `nullptr` if the file cannot be opened or is not a workload trace
+        FILE* file;
+
+        /// Records of the current chunk
+        std::vector<WorkloadRecord> chunk;
+
+        /// The index of the next record in the current chunk
+        size_t position;
+
+        ///
+        /// [Helper] Read the next chunk of records from the file
+        ///
+        /// @return `true` if at least one record has been read, `false` otherwise.
+        ///
+        bool refill()
+        {
+            this->chunk.resize(kChunkSize);
+
+            size_t count = std::fread(this->chunk.data(), sizeof(WorkloadRecord), kChunkSize, this->file);
+
+            this->chunk.resize(count);
+
+            this->position = 0;
+
+            return count > 0;
+        }
+
+    public:
+        ///
+        /// Open the given workload trace file
+        ///
+        /// @param path The path to the trace file
+        /// @note Use `isValid()` to check whether the file is a valid workload trace.
+        ///
+        explicit WorkloadReader(const char* path) : file(std::fopen(path, "rb")), position(0)
+        {
+            // Guard: The file must exist
+            if (this->file == nullptr)
+            {
+                return;
+            }
+
+            WorkloadHeader header = {};
+
+            // Guard: The file must start with a compatible header
+            if (std::fread(&header, sizeof(WorkloadHeader), 1, this->file) != 1 ||
+                std::memcmp(header.magic, WorkloadHeader::kMagic, sizeof(header.magic)) != 0 ||
+                header.version != WorkloadHeader::kVersion ||
+                header.recordSize != sizeof(WorkloadRecord))
+            {
+                std::fclose(this->file);
+
+                this->file = nullptr;
+            }
+        }
+
+        WorkloadReader(const WorkloadReader&) = delete;
+
+        WorkloadReader& operator=(const WorkloadReader&) = delete;
+
+        ~WorkloadReader()
+        {
+            if (this->file != nullptr)
+            {
+                std::fclose(this->file);
+            }
+        }
+
+        ///
+        /// Check whether the trace file has been opened successfully
+        ///
+        /// @return `true` if records can be read from the file, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool isValid() const
+        {
+            return this->file != nullptr;
+        }
+
+        ///
+        /// Get the next record without consuming it
+        ///
+        /// @return The next record, `nullptr` if all records have been consumed.
+        ///
+        const WorkloadRecord* peek()
+        {
+            // Guard: The file must be valid
+            if (this->file == nullptr)
+            {
+                return nullptr;
+            }
+
+            // Guard: Read the next chunk once the current one has been consumed
+            if (this->position == this->chunk.size() && !this->refill())
+            {
+                return nullptr;
+            }
+
+            return &this->chunk[this->position];
+        }
+
+        ///
+        /// Consume the record returned by `peek()`
+        ///
+        void pop()
+        {
+            this->position += 1;
+        }
+    };
+
+    ///
+    /// Writes workload records to a trace file
+    ///
+    class WorkloadWriter
+    {
+    private:
+        /// The trace file, `nullptr` if the file cannot be created
+        FILE* file;
+
+    public:
+        ///
+        /// Create the given workload trace file
+        ///
+        /// @param path The path to the trace file
+        /// @note Use `isValid()` to check whether the file has been created.
+        ///
+        explicit WorkloadWriter(const char* path) : file(std::fopen(path, "wb"))
+        {
+            // Guard: The file must be created
+            if (this->file == nullptr)
+            {
+                return;
+            }
+
+            WorkloadHeader header = {};
+
+            std::memcpy(header.magic, WorkloadHeader::kMagic, sizeof(header.magic));
+
+            header.version = WorkloadHeader::kVersion;
+
+            header.recordSize = sizeof(WorkloadRecord);
+
+            std::fwrite(&header, sizeof(WorkloadHeader), 1, this->file);
+        }
+
+        WorkloadWriter(const WorkloadWriter&) = delete;
+
+        WorkloadWriter& operator=(const WorkloadWriter&) = delete;
+
+        ~WorkloadWriter()
+        {
+            if (this->file != nullptr)
+            {
+                std::fclose(this->file);
+            }
+        }
+
+        ///
+        /// Check whether the trace file has been created successfully
+        ///
+        /// @return `true` if records can be written to the file, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool isValid() const
+        {
+            return this->file != nullptr;
+        }
+
+        ///
+        /// Append the given record to the trace file
+        ///
+        /// @param record A record of which timestamp is not earlier than the one of the previous record
+        ///
+        void write(const WorkloadRecord& record)
+        {
+            std::fwrite(&record, sizeof(WorkloadRecord), 1, this->file);
+        }
+    };
+}
+
+#endif /* WorkloadTrace_hpp */
@@ -6,11 +6,194 @@
 //
 
 #include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <LinkedList.hpp>
 #include <Scheduler/Scheduler.hpp>
+#include "ChromeTrace.hpp"
+#include "SampleSchedulers.hpp"
+#include "SimulatedTask.hpp"
+#include "WorkloadGenerator.hpp"
 
-int main(int argc, const char * argv[])
+/// A minimal task that can be scheduled in a round-robin fashion
+struct PlaygroundTask: public Listable<PlaygroundTask>, public Scheduler::Schedulable
+{
+    uint32_t identifier;
+
+    explicit PlaygroundTask(uint32_t identifier) : Listable(), identifier(identifier) {}
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+};
+
+/// A clock that advances by one tick each time it is read
+struct PlaygroundClock
 {
-    // insert code here...
-    std::cout << "Hello, World!\n";
+    static inline uint64_t time = 0;
+
+    static uint64_t now()
+    {
+        return time++;
+    }
+};
+
+/// The trace recorder used by the playground scheduler
+using PlaygroundRecorder = Scheduler::Instrumentation::TraceRecorder<PlaygroundTask, PlaygroundClock, 64>;
+
+struct PlaygroundScheduler;
+
+template <>
+struct Scheduler::Traits::SchedulerTraits<PlaygroundScheduler>
+{
+    using Task = PlaygroundTask;
+};
+
+/// A round-robin scheduler that traces its scheduling decisions
+struct PlaygroundScheduler: public Scheduler::Assembler<
+        Scheduler::PolicyWithInstrumentation<Scheduler::Policies::FIFO::Normal::LinkedListImp<PlaygroundTask>, PlaygroundRecorder>,
+        Scheduler::EventHandlers::Instrumented<PlaygroundScheduler,
+                Scheduler::EventHandlers::TaskCreation::Cooperative::KeepRunningCurrentWithIdleTaskSupport<PlaygroundScheduler>,
+                Scheduler::EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<PlaygroundScheduler>,
+                Scheduler::EventHandlers::TimerInterrupt::Preemptive::RunNextWithIdleTaskSupport<PlaygroundScheduler>>>,
+                             public Scheduler::IdleTaskSupport<PlaygroundTask>
+{
+    using IdleTaskSupport<PlaygroundTask>::IdleTaskSupport;
+};
+
+/// Trace a few tasks scheduled in a round-robin fashion and print the trace as a Chrome trace JSON document
+static int runTraceDemo()
+{
+    PlaygroundTask idleTask(0);
+
+    PlaygroundTask t1(1), t2(2), t3(3);
+
+    PlaygroundScheduler scheduler(&idleTask);
+
+    // Create three tasks and let them run in a round-robin fashion until all of them finish
+    PlaygroundTask* running = scheduler.onTaskCreated(&idleTask, &t1);
+
+    running = scheduler.onTaskCreated(running, &t2);
+
+    running = scheduler.onTaskCreated(running, &t3);
+
+    for (int tick = 0; tick < 6; tick++)
+    {
+        running = scheduler.onTimerInterrupt(running);
+    }
+
+    while (running != &idleTask)
+    {
+        running = scheduler.onTaskFinished(running);
+    }
+
+    // Drain the trace and print it as a Chrome trace JSON document
+    Scheduler::Instrumentation::TraceRecord records[64];
+
+    size_t count = scheduler.getRecorder().drain(records);
+
+    ChromeTrace::write(std::cout, std::span(records, count));
+
     return 0;
 }
+
+/// Replay the given workload trace against the given scheduler and print the report
+template <typename ConcreteScheduler>
+static int simulate(const char* path, uint64_t tickPeriod)
+{
+    Simulation::WorkloadReader reader(path);
+
+    // Guard: The trace file must be valid
+    if (!reader.isValid())
+    {
+        std::cerr << "Failed to open the workload trace " << path << ".\n";
+
+        return EXIT_FAILURE;
+    }
+
+    auto simulator = std::make_unique<Simulation::Simulator<ConcreteScheduler>>(tickPeriod);
+
+    simulator->run(reader).print(std::cout);
+
+    return EXIT_SUCCESS;
+}
+
+/// Print the usage of the playground
+static int usage()
+{
+    std::cerr << "Usage: SchedulerPlayground\n"
+              << "       SchedulerPlayground generate <trace> <tasks> <bursts per task> [load]\n"
+              << "       SchedulerPlayground simulate <trace> <fifo|rr|prr|mlfq|edf> [tick period]\n";
+
+    return EXIT_FAILURE;
+}
+
+int main(int argc, const char * argv[])
+{
+    using namespace Simulation;
+
+    using namespace SampleSchedulers;
+
+    // Guard: Run the trace demo if no command is given
+    if (argc < 2)
+    {
+        return runTraceDemo();
+    }
+
+    if (std::strcmp(argv[1], "generate") == 0 && argc >= 5)
+    {
+        WorkloadWriter writer(argv[2]);
+
+        // Guard: The trace file must be created
+        if (!writer.isValid())
+        {
+            std::cerr << "Failed to create the workload trace " << argv[2] << ".\n";
+
+            return EXIT_FAILURE;
+        }
+
+        double load = argc >= 6 ? std::atof(argv[5]) : 0.8;
+
+        uint64_t count = generate(writer, std::atoi(argv[3]), std::atoi(argv[4]), load);
+
+        std::cout << "Generated " << count << " records.\n";
+
+        return EXIT_SUCCESS;
+    }
+
+    if (std::strcmp(argv[1], "simulate") == 0 && argc >= 4)
+    {
+        uint64_t tickPeriod = argc >= 5 ? std::strtoull(argv[4], nullptr, 10) : 10;
+
+        const char* scheduler = argv[3];
+
+        if (std::strcmp(scheduler, "fifo") == 0)
+        {
+            return simulate<FIFO<SimulatedTask>>(argv[2], tickPeriod);
+        }
+
+        if (std::strcmp(scheduler, "rr") == 0)
+        {
+            return simulate<RoundRobin<SimulatedTask>>(argv[2], tickPeriod);
+        }
+
+        if (std::strcmp(scheduler, "prr") == 0)
+        {
+            return simulate<PrioritizedRoundRobin<SimulatedTask, SimulatedTask::kMaxPriorityLevel>>(argv[2], tickPeriod);
+        }
+
+        if (std::strcmp(scheduler, "mlfq") == 0)
+        {
+            return simulate<MultilevelFeedbackQueue<SimulatedTask, SimulatedTask::QuantumSpecifier, SimulatedTask::kMaxPriorityLevel>>(argv[2], tickPeriod);
+        }
+
+        if (std::strcmp(scheduler, "edf") == 0)
+        {
+            return simulate<EarliestDeadlineFirst<SimulatedRealtimeTask>>(argv[2], tickPeriod);
+        }
+    }
+
+    return usage();
+}
@@ -0,0 +1,219 @@
+//
+//  ConstantBandwidthSchedulerTest.cpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#include "ConstantBandwidthSchedulerTest.hpp"
+#include "SimpleReservedTask.hpp"
+#include "SampleSchedulers.hpp"
+#include <Debug.hpp>
+
+namespace Schedulers = SampleSchedulers;
+
+using ConstantBandwidthScheduler = Schedulers::ConstantBandwidth<SimpleReservedTask, 64>;
+
+static_assert(Scheduler::Validation::validate<ConstantBandwidthScheduler>());
+
+void ConstantBandwidthSchedulerTest::runPrimitivesTest()
+{
+    // Throttled tasks leave the wheel once their replenishment time has come
+    Scheduler::Containers::TimingWheel<SimpleReservedTask, Scheduler::Policies::ConstantBandwidth::ReplenishmentTimeKey<SimpleReservedTask>, 16> wheel;
+
+    SimpleReservedTask w1(1, 1, 10);
+
+    SimpleReservedTask w2(2, 1, 10);
+
+    SimpleReservedTask w3(3, 1, 10);
+
+    w1.setReplenishmentTime(5);
+
+    w2.setReplenishmentTime(5);
+
+    w3.setReplenishmentTime(9);
+
+    wheel.insert(&w3);
+
+    wheel.insert(&w1);
+
+    wheel.insert(&w2);
+
+    passert(wheel.popUntil(4) == nullptr && wheel.size() == 3, "No task is due at time 4.");
+
+    passert(wheel.popUntil(5) == &w1 && wheel.popUntil(5) == &w2, "Tasks due at the same time leave in the order they are inserted.");
+
+    passert(wheel.popUntil(8) == nullptr && wheel.size() == 1, "Task 3 is not due at time 8.");
+
+    passert(wheel.popUntil(9) == &w3 && wheel.isEmpty(), "Task 3 is due at time 9.");
+
+    // Policy
+    Scheduler::Policies::ConstantBandwidth::PolicyWithReservations<Scheduler::Policies::PrioritizedSingleQueue::Normal::StableDaryHeapImp<SimpleReservedTask>, 64> policy;
+
+    SimpleReservedTask t1(1, 2, 10);
+
+    SimpleReservedTask t2(2, 4, 20);
+
+    SimpleReservedTask t3(3, 1, 8);
+
+    // Budget enforcement
+    policy.activate(&t1);
+
+    passert(t1.getServerDeadline() == 10 && t1.getRemainingBudget() == 2, "Task 1 receives a full budget and a deadline one period from now.");
+
+    passert(!policy.consume(&t1, 1) && t1.getRemainingBudget() == 1, "Task 1 has one tick left.");
+
+    passert(policy.consume(&t1, 1) && policy.isThrottled(&t1), "Task 1 has exhausted its budget.");
+
+    passert(t1.getReplenishmentTime() == 10 && policy.getNumberOfThrottledTasks() == 1, "Task 1 is throttled until its server deadline.");
+
+    passert(policy.advance(9) == 0 && policy.next() == nullptr, "Task 1 is still throttled at time 9.");
+
+    passert(policy.advance(1) == 1 && policy.getNumberOfThrottledTasks() == 0, "Task 1 is replenished at time 10.");
+
+    passert(t1.getServerDeadline() == 20 && t1.getRemainingBudget() == 2, "The deadline of Task 1 is postponed by one period.");
+
+    passert(policy.next() == &t1, "Task 1 is ready again.");
+
+    // Wakeup rule
+    policy.activate(&t2);
+
+    passert(t2.getServerDeadline() == 30 && t2.getRemainingBudget() == 4, "Task 2 is activated at time 10.");
+
+    policy.consume(&t2, 1);
+
+    policy.advance(2);
+
+    policy.activate(&t2);
+
+    passert(t2.getServerDeadline() == 30 && t2.getRemainingBudget() == 3, "Task 2 keeps its reservation since 3 ticks fit into its bandwidth before time 30.");
+
+    policy.advance(10);
+
+    policy.activate(&t2);
+
+    passert(t2.getServerDeadline() == 42 && t2.getRemainingBudget() == 4, "Task 2 receives a new reservation since 3 ticks exceed its bandwidth before time 30.");
+
+    // A task that exhausts its budget after its deadline is not throttled
+    policy.advance(30);
+
+    passert(!policy.consume(&t2, 4) && t2.getServerDeadline() == 72 && t2.getRemainingBudget() == 4, "Task 2 receives a new budget and a deadline one period from now.");
+
+    // Remove a throttled task
+    policy.activate(&t3);
+
+    passert(policy.consume(&t3, 1), "Task 3 has exhausted its budget.");
+
+    policy.remove(&t3);
+
+    passert(policy.getNumberOfThrottledTasks() == 0 && policy.advance(100) == 0, "Task 3 is no longer throttled.");
+}
+
+void ConstantBandwidthSchedulerTest::runTaskManagerDelegateTest()
+{
+    // Test Setup
+    SimpleReservedTask idleTask(0, 1, 1);
+
+    SimpleReservedTask t1(1, 2, 10);
+
+    SimpleReservedTask t2(2, 3, 15);
+
+    SimpleReservedTask t3(3, 1, 5);
+
+    ConstantBandwidthScheduler scheduler(&idleTask);
+
+    passert(scheduler.onTaskCreated(&idleTask, &t1)->getIdentifier() == 1, "Task 1 runs.");
+
+    passert(scheduler.onTaskCreated(&t1, &t2)->getIdentifier() == 1, "Task 1 has an earlier server deadline than Task 2.");
+
+    passert(scheduler.onTaskCreated(&t1, &t3)->getIdentifier() == 3, "Task 3 preempts Task 1.");
+
+    passert(scheduler.onTaskKilled(&t3, &t2)->getIdentifier() == 3, "Task 3 keeps running.");
+
+    passert(scheduler.onTaskBlocked(&t3)->getIdentifier() == 1, "Task 1 runs.");
+
+    passert(scheduler.onTaskUnblocked(&t1, &t3)->getIdentifier() == 3, "Task 3 preempts Task 1.");
+
+    passert(scheduler.onTaskFinished(&t3)->getIdentifier() == 1, "Task 1 runs.");
+
+    passert(scheduler.onTaskFinished(&t1) == &idleTask, "The idle task runs.");
+}
+
+void ConstantBandwidthSchedulerTest::runTimerInterruptDelegateTest()
+{
+    // Test Setup
+    SimpleReservedTask idleTask(0, 1, 1);
+
+    SimpleReservedTask t1(1, 2, 4);
+
+    SimpleReservedTask t2(2, 1, 4);
+
+    ConstantBandwidthScheduler scheduler(&idleTask);
+
+    passert(scheduler.onTimerInterrupt(&idleTask) == &idleTask, "The idle task keeps running.");
+
+    // Task 1 never blocks and would run forever without its reservation
+    SimpleReservedTask* current = scheduler.onTaskCreated(&idleTask, &t1);
+
+    current = scheduler.onTaskCreated(current, &t2);
+
+    passert(current == &t1, "Task 1 runs.");
+
+    uint32_t ticks[3] = {};
+
+    for (uint32_t tick = 0; tick < 4000; tick++)
+    {
+        ticks[current->getIdentifier()] += 1;
+
+        current = scheduler.onTimerInterrupt(current);
+    }
+
+    pinfo("Task 1 ran for %u ticks, Task 2 ran for %u ticks, the idle task ran for %u ticks.", ticks[1], ticks[2], ticks[0]);
+
+    passert(ticks[1] == 2000 && ticks[2] == 1000 && ticks[0] == 1000, "Each task receives exactly its reserved bandwidth.");
+
+    // Kill a throttled task
+    while (current != &idleTask)
+    {
+        current = scheduler.onTimerInterrupt(current);
+    }
+
+    passert(scheduler.getNumberOfThrottledTasks() == 2, "Both tasks are throttled.");
+
+    passert(scheduler.onTaskKilled(&idleTask, &t1) == &idleTask, "The idle task keeps running.");
+
+    passert(scheduler.getNumberOfThrottledTasks() == 1, "Task 1 is no longer throttled.");
+
+    passert(scheduler.onTimerInterrupt(&idleTask)->getIdentifier() == 2, "Task 2 is replenished.");
+
+    passert(scheduler.onTimerInterrupt(&t2) == &idleTask, "Task 2 is throttled again.");
+}
+
+void ConstantBandwidthSchedulerTest::runGroupOperationsTest()
+{
+    // Test Setup
+    SimpleReservedTask idleTask(0, 1, 1);
+
+    SimpleReservedTask t1(1, 1, 10);
+
+    SimpleReservedTask t2(2, 1, 5);
+
+    SimpleReservedTask t3(3, 5, 20);
+
+    ConstantBandwidthScheduler scheduler(&idleTask);
+
+    passert(scheduler.onTaskCreated(&idleTask, &t3)->getIdentifier() == 3, "Task 3 runs.");
+
+    // Task 1 and Task 2 are unblocked
+    passert(scheduler.onTaskUnblocked(nullptr, &t1) == nullptr, "Intermediate call");
+
+    passert(scheduler.onTaskUnblocked(nullptr, &t2) == nullptr, "Intermediate call");
+
+    passert(scheduler.onTaskUnblocked(&t3, nullptr)->getIdentifier() == 2, "Task 2 preempts Task 3.");
+
+    passert(scheduler.onTaskBlocked(&t2)->getIdentifier() == 1, "Task 1 runs.");
+
+    passert(scheduler.onTaskBlocked(&t1)->getIdentifier() == 3, "Task 3 runs.");
+
+    passert(scheduler.onTaskBlocked(&t3) == &idleTask, "The idle task runs.");
+}
@@ -0,0 +1,28 @@
+//
+//  ConstantBandwidthSchedulerTest.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef ConstantBandwidthSchedulerTest_hpp
+#define ConstantBandwidthSchedulerTest_hpp
+
+#include "SchedulerTest.hpp"
+
+class ConstantBandwidthSchedulerTest: public SchedulerTest
+{
+public:
+    ConstantBandwidthSchedulerTest() : SchedulerTest("Constant Bandwidth") {}
+
+private:
+    void runPrimitivesTest() override;
+
+    void runTaskManagerDelegateTest() override;
+
+    void runTimerInterruptDelegateTest() override;
+
+    void runGroupOperationsTest() override;
+};
+
+#endif /* ConstantBandwidthSchedulerTest_hpp */
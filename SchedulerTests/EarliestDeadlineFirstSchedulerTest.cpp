@@ -8,19 +8,324 @@
 
 #include "EarliestDeadlineFirstSchedulerTest.hpp"
 #include "SimpleRealtimeTask.hpp"
+#include "SimpleTask.hpp"
 #include "SampleSchedulers.hpp"
 #include <Debug.hpp>
+#include <span>
+#include <vector>
 
 namespace Schedulers = SampleSchedulers;
 
+// The sample scheduler satisfies the requirements of its components
+static_assert(Scheduler::Validation::validate<Schedulers::EarliestDeadlineFirst<SimpleRealtimeTask>>());
+
 void EarliestDeadlineFirstSchedulerTest::runPrimitivesTest()
 {
+    // Test Setup
+    Scheduler::Policies::PrioritizedSingleQueue::Normal::DaryHeapImp<SimpleRealtimeTask> policy;
+
+    SimpleRealtimeTask t1(1, 40);
+
+    SimpleRealtimeTask t2(2, 10);
+
+    SimpleRealtimeTask t3(3, 30);
+
+    SimpleRealtimeTask t4(4, 20);
+
+    SimpleRealtimeTask t5(5, 50);
+
+    SimpleRealtimeTask t6(6, 60);
+
+    // Empty ready queue
+    passert(policy.next() == nullptr, "Empty ready queue");
+
+    policy.ready(&t1);
+
+    policy.ready(&t2);
+
+    policy.ready(&t3);
+
+    policy.ready(&t4);
+
+    policy.ready(&t5);
+
+    policy.ready(&t6);
+
+    // Remove a task in the middle of the heap
+    policy.remove(&t3);
+
+    // Task 5 now has the earliest deadline
+    t5.setDeadline(5);
+
+    policy.adjustPosition(&t5, 50);
+
+    // Task 2 now has a later deadline than Task 1
+    t2.setDeadline(45);
+
+    policy.adjustPosition(&t2, 10);
+
+    passert(policy.next()->getIdentifier() == 5, "Task 5 has the earliest deadline.");
+
+    passert(policy.next()->getIdentifier() == 4, "Task 4 has the second earliest deadline.");
+
+    passert(policy.next()->getIdentifier() == 1, "Task 1 has the third earliest deadline.");
+
+    passert(policy.next()->getIdentifier() == 2, "Task 2 has the fourth earliest deadline.");
+
+    passert(policy.next()->getIdentifier() == 6, "Task 6 has the latest deadline.");
+
+    passert(policy.next() == nullptr, "Empty ready queue");
+
+    // Tasks that have the same deadline are served on a first-come, first-served basis
+    Scheduler::Policies::PrioritizedSingleQueue::Normal::StableDaryHeapImp<SimpleRealtimeTask> stablePolicy;
+
+    SimpleRealtimeTask t7(7, 10);
+
+    SimpleRealtimeTask t8(8, 10);
+
+    SimpleRealtimeTask t9(9, 10);
+
+    SimpleRealtimeTask t10(10, 5);
+
+    stablePolicy.ready(&t7);
+
+    stablePolicy.ready(&t8);
+
+    stablePolicy.ready(&t10);
+
+    stablePolicy.ready(&t9);
+
+    // Task 10 now has the same deadline as others and is placed after them
+    t10.setDeadline(10);
+
+    stablePolicy.adjustPosition(&t10, 5);
+
+    passert(stablePolicy.next()->getIdentifier() == 7, "Task 7 arrives first.");
+
+    stablePolicy.ready(&t7);
+
+    passert(stablePolicy.next()->getIdentifier() == 8, "Task 8 arrives second.");
+
+    passert(stablePolicy.next()->getIdentifier() == 9, "Task 9 arrives third.");
+
+    passert(stablePolicy.next()->getIdentifier() == 10, "Task 10 is moved after Task 9.");
+
+    passert(stablePolicy.next()->getIdentifier() == 7, "Task 7 is enqueued again after Task 10.");
+
+    passert(stablePolicy.next() == nullptr, "Empty ready queue");
+
+    // Tasks keyed by their absolute deadlines in a timing wheel that covers 16 ticks
+    Scheduler::Policies::TimingWheel::Normal::LinkedListImp<SimpleTask, 16> wheelPolicy;
+
+    SimpleTask d1(1, 100);
+
+    SimpleTask d2(2, 103);
+
+    SimpleTask d3(3, 100);
+
+    SimpleTask d4(4, 150);
+
+    SimpleTask d5(5, 90);
+
+    wheelPolicy.ready(&d1);
+
+    wheelPolicy.ready(&d2);
+
+    wheelPolicy.ready(&d3);
+
+    // Task 4 is beyond the window while Task 5 is behind the window
+    wheelPolicy.ready(&d4);
+
+    wheelPolicy.ready(&d5);
+
+    passert(wheelPolicy.next()->getIdentifier() == 5, "Task 5 has the earliest deadline.");
+
+    passert(wheelPolicy.next()->getIdentifier() == 1, "Task 1 arrives before Task 3.");
+
+    passert(wheelPolicy.next()->getIdentifier() == 3, "Task 3 has the same deadline as Task 1.");
+
+    wheelPolicy.remove(&d2);
+
+    passert(wheelPolicy.next()->getIdentifier() == 4, "Task 4 is moved into the wheel.");
+
+    passert(wheelPolicy.next() == nullptr, "Empty ready queue");
+
+    // A batch loaded into the sorted list is ordered as if its tasks were enqueued one by one
+    std::vector<SimpleRealtimeTask> batchTasks;
+
+    for (uint32_t index = 0; index < 37; index += 1)
+    {
+        batchTasks.emplace_back(100 + index, (index * 7) % 5);
+    }
+
+    std::vector<SimpleRealtimeTask*> batch;
+
+    for (auto& task : batchTasks)
+    {
+        batch.push_back(&task);
+    }
+
+    Scheduler::Policies::PrioritizedSingleQueue::Normal::LinkedListImp<SimpleRealtimeTask> sortedPolicy;
+
+    for (auto task : batch)
+    {
+        sortedPolicy.ready(task);
+    }
+
+    std::vector<uint32_t> expected;
+
+    while (auto task = sortedPolicy.next())
+    {
+        expected.push_back(task->getIdentifier());
+    }
+
+    sortedPolicy.readyBatch(std::span(batch).first(10));
+
+    sortedPolicy.readyBatch(std::span(batch).subspan(10));
+
+    for (uint32_t identifier : expected)
+    {
+        passert(sortedPolicy.next()->getIdentifier() == identifier, "Task %u is dequeued in the same order as enqueued one by one.", identifier);
+    }
+
+    passert(sortedPolicy.next() == nullptr, "Empty ready queue");
+
+    // A batch loaded into the binary heap is heapified in place
+    Scheduler::Policies::PrioritizedSingleQueue::Normal::StlPriorityQueueImp<SimpleRealtimeTask> heapPolicy;
+
+    heapPolicy.ready(&t6);
+
+    heapPolicy.readyBatch(std::span(batch));
+
+    uint32_t previous = 0;
+
+    for (size_t count = 0; count < batch.size(); count += 1)
+    {
+        auto task = heapPolicy.next();
+
+        passert(task->getIdentifier() >= 100 && task->getIdentifier() < 137, "Batch tasks have earlier deadlines than Task 6.");
+
+        uint32_t deadline = (task->getIdentifier() - 100) * 7 % 5;
 
+        passert(deadline >= previous, "Tasks are dequeued in the order of their deadlines.");
+
+        previous = deadline;
+    }
+
+    passert(heapPolicy.next() == &t6 && heapPolicy.next() == nullptr, "Task 6 has the latest deadline.");
 }
 
 void EarliestDeadlineFirstSchedulerTest::runTaskManagerDelegateTest()
 {
+    using namespace Scheduler::Policies::EarliestDeadlineFirst;
+
+    using Scheduler::Instrumentation::Event;
+
+    using Statistics = Scheduler::Instrumentation::Statistics<SimpleRealtimeTask, Scheduler::Instrumentation::CycleCounter>;
+
+    // Overloaded Task Set
+    // -------------------------------------------------------
+    // Task | Release Time | Execution Time | Deadline | Value |
+    // -------------------------------------------------------
+    //  T1  |      0       |        2       |     2    |   9   |
+    //  T2  |      0       |        2       |     3    |   9   |
+    //  T3  |      0       |        2       |     4    |   1   |
+    //  T4  |      0       |        2       |    10    |   9   |
+    // -------------------------------------------------------
+    // Task 3 misses its deadline at t = 4 since Task 1 and Task 2 occupy the processor until then.
+    SimpleRealtimeTask idleTask(0, UINT32_MAX);
+
+    SimpleRealtimeTask t1(1, 2, 0, 9);
+
+    SimpleRealtimeTask t2(2, 3, 0, 9);
+
+    SimpleRealtimeTask t3(3, 4, 8, 1);
+
+    SimpleRealtimeTask t4(4, 10, 0, 9);
+
+    // Run Late
+    Schedulers::OverloadAwareEarliestDeadlineFirst<SimpleRealtimeTask, RunLate, Statistics> scheduler(&idleTask);
+
+    passert(scheduler.onTaskCreated(&idleTask, &t1) == &t1, "Task 1 runs after it has been created.");
+
+    passert(scheduler.onTaskCreated(&t1, &t2) == &t1, "Task 1 has an earlier deadline than Task 2.");
+
+    passert(scheduler.onTaskCreated(&t1, &t3) == &t1, "Task 1 has an earlier deadline than Task 3.");
+
+    passert(scheduler.onTimerInterrupt(&t1, 2) == &t1, "Task 1 keeps running on a timer interrupt.");
+
+    passert(scheduler.onTaskFinished(&t1) == &t2 && !scheduler.isOverloaded(), "Task 2 meets its deadline at t = 2.");
+
+    passert(scheduler.onTimerInterrupt(&t2, 2) == &t2 && scheduler.getCurrentTime() == 4, "Task 2 finishes at t = 4.");
+
+    passert(scheduler.onTaskFinished(&t2) == &t3, "Task 3 runs late.");
+
+    passert(scheduler.isOverloaded() && scheduler.getDeadlineMissCount() == 1, "The deadline miss of Task 3 has been detected.");
+
+    passert(scheduler.getRecorder().getEventCount(Event::kDeadlineMissed) == 1, "The deadline miss has been reported.");
+
+    passert(scheduler.onTaskFinished(&t3) == &idleTask && !scheduler.isOverloaded(), "The overload ends once the ready queue runs empty.");
+
+    // Skip Over
+    t3.setDeadline(4);
+
+    Schedulers::OverloadAwareEarliestDeadlineFirst<SimpleRealtimeTask, SkipOver, Scheduler::Instrumentation::NullRecorder> skipping(&idleTask);
+
+    passert(skipping.onTaskCreated(&idleTask, &t2) == &t2, "Task 2 runs after it has been created.");
+
+    skipping.ready(&t3);
+
+    skipping.ready(&t4);
+
+    skipping.advance(4);
+
+    passert(skipping.onTaskFinished(&t2) == &t4, "The late job of Task 3 is skipped in favor of Task 4.");
+
+    passert(t3.getDeadline() == 12 && skipping.getSkippedJobCount() == 1, "Task 3 continues with its next job due at t = 12.");
+
+    passert(skipping.onTaskFinished(&t4) == &t3 && skipping.getDeadlineMissCount() == 1, "Task 3 runs its next job without missing it.");
+
+    // Shed Below Value
+    t3.setDeadline(4);
+
+    SimpleRealtimeTask t5(5, 20, 0, 1);
+
+    Schedulers::OverloadAwareEarliestDeadlineFirst<SimpleRealtimeTask, ShedBelowValue<5u>, Scheduler::Instrumentation::NullRecorder> shedding(&idleTask);
+
+    passert(shedding.onTaskCreated(&idleTask, &t2) == &t2, "Task 2 runs after it has been created.");
+
+    shedding.ready(&t3);
+
+    shedding.ready(&t4);
+
+    shedding.ready(&t5);
+
+    shedding.advance(4);
+
+    passert(shedding.onTaskFinished(&t2) == &t4, "Task 3 of a low value is shed once it misses its deadline.");
+
+    passert(shedding.onTaskFinished(&t4) == &idleTask, "Task 5 of a low value is shed while the scheduler is overloaded.");
+
+    passert(shedding.getShedTaskCount() == 2 && !shedding.isOverloaded(), "The overload ends once the ready queue runs empty.");
+
+    passert(shedding.reclaim() == &t3 && shedding.reclaim() == &t5 && shedding.reclaim() == nullptr, "Shed tasks are reclaimed in order.");
+
+    // Task 3 is killed before it is reclaimed
+    shedding.ready(&t3);
 
+    shedding.ready(&t5);
+
+    passert(shedding.next() == nullptr && shedding.getShedTaskCount() == 4, "Both tasks are shed again.");
+
+    shedding.remove(&t3);
+
+    passert(shedding.reclaim() == &t5 && shedding.reclaim() == nullptr, "A killed task is no longer reclaimed.");
+
+    shedding.ready(&t3);
+
+    shedding.remove(&t3);
+
+    passert(shedding.next() == nullptr, "A ready task is removed from the ready queue.");
 }
 
 void EarliestDeadlineFirstSchedulerTest::runTimerInterruptDelegateTest()
@@ -218,5 +523,90 @@ void EarliestDeadlineFirstSchedulerTest::runTimerInterruptDelegateTest()
 
 void EarliestDeadlineFirstSchedulerTest::runGroupOperationsTest()
 {
+    // Test Setup
+    SimpleRealtimeTask idleTask(0, UINT32_MAX);
+
+    Schedulers::EarliestDeadlineFirst<SimpleRealtimeTask> scheduler(&idleTask);
+
+    std::vector<SimpleRealtimeTask> tasks;
+
+    for (uint32_t identifier = 1; identifier <= 40; identifier++)
+    {
+        tasks.emplace_back(identifier, (identifier * 37) % 41 + 100);
+    }
+
+    SimpleRealtimeTask* pointers[40];
+
+    for (size_t index = 0; index < 40; index++)
+    {
+        pointers[index] = &tasks[index];
+    }
+
+    std::span<SimpleRealtimeTask* const> batch(pointers);
+
+    // Unblock the first half of tasks as an intermediate call
+    passert(scheduler.onTasksUnblocked(nullptr, batch.first(20)) == nullptr, "Intermediate calls return null.");
+
+    // Unblock the second half of tasks while the idle task is running
+    // Task 10 has the earliest deadline (10 * 37 % 41 = 1)
+    SimpleRealtimeTask* current = scheduler.onTasksUnblocked(&idleTask, batch.last(20));
+
+    passert(current->getIdentifier() == 10, "Task 10 has the earliest deadline.");
+
+    // Kill every task whose identifier is odd while Task 10 keeps running
+    SimpleRealtimeTask* killed[20];
+
+    for (size_t index = 0; index < 20; index++)
+    {
+        killed[index] = &tasks[index * 2];
+    }
+
+    passert(scheduler.onTasksKilled(current, killed) == current, "Task 10 keeps running after other tasks have been killed.");
+
+    // Remaining tasks run in the order of their deadline
+    uint32_t deadline = 0;
+
+    for (size_t count = 0; count < 19; count++)
+    {
+        current = scheduler.onTaskFinished(current);
+
+        passert(current->getIdentifier() % 2 == 0, "Killed tasks must not run.");
+
+        uint32_t next = (current->getIdentifier() * 37) % 41 + 100;
+
+        passert(next > deadline, "Tasks run in the order of their deadline.");
+
+        deadline = next;
+    }
+
+    passert(scheduler.onTaskFinished(current) == &idleTask, "Idle task runs after all tasks have finished.");
+
+    // Fetching the next task with an empty batch keeps the idle task running
+    passert(scheduler.onTasksUnblocked(&idleTask, {}) == &idleTask, "No task is ready.");
+
+    // Waking up tasks whose deadlines are not earlier than the current one does not cause a context switch
+    SimpleRealtimeTask t41(41, 20);
+
+    SimpleRealtimeTask t42(42, 30);
+
+    SimpleRealtimeTask t43(43, 10);
+
+    SimpleRealtimeTask t44(44, 20);
+
+    passert(scheduler.onTaskUnblocked(&t41, &t42) == &t41, "Task 41 keeps running since Task 42 has a later deadline.");
+
+    passert(scheduler.onTaskUnblocked(&t41, &t44) == &t41, "Task 41 keeps running since Task 44 has the same deadline.");
+
+    // Task 43 enqueued by an intermediate call has an earlier deadline than the current task
+    passert(scheduler.onTaskUnblocked(nullptr, &t43) == nullptr, "Intermediate calls return null.");
+
+    passert(scheduler.onTaskUnblocked(&t41, nullptr) == &t43, "Task 43 preempts Task 41 at the end of the group operation.");
+
+    passert(scheduler.onTaskFinished(&t43) == &t44, "Task 44 was ready before Task 41 was preempted.");
+
+    passert(scheduler.onTaskFinished(&t44) == &t41, "Task 41 has the next earliest deadline.");
+
+    passert(scheduler.onTaskFinished(&t41) == &t42, "Task 42 has the latest deadline.");
 
+    passert(scheduler.onTaskFinished(&t42) == &idleTask, "Idle task runs after all tasks have finished.");
 }
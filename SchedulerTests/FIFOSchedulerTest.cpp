@@ -8,11 +8,218 @@
 
 #include "FIFOSchedulerTest.hpp"
 #include "SimpleTask.hpp"
+#include "SimpleCoroutineTask.hpp"
 #include "SampleSchedulers.hpp"
 #include <Debug.hpp>
 
 namespace Schedulers = SampleSchedulers;
 
+/// A delegate that counts the tasks enqueued and dequeued by a policy
+struct CountingDelegate
+{
+    uint32_t enqueued = 0;
+
+    uint32_t dequeued = 0;
+
+    SimpleTask* lastDequeued = nullptr;
+
+    void taskWillEnqueue([[maybe_unused]] SimpleTask* task)
+    {
+        this->enqueued += 1;
+    }
+
+    void taskHasDequeued(SimpleTask* task)
+    {
+        this->dequeued += 1;
+
+        this->lastDequeued = task;
+    }
+};
+
+/// A delegate that only observes dequeued tasks and does not have any state
+struct StatelessDequeueDelegate
+{
+    void taskHasDequeued([[maybe_unused]] SimpleTask* task)
+    {
+        passert(task != nullptr, "The delegate is never notified of an empty ready queue.");
+    }
+};
+
+/// A FIFO policy that keeps a background task in its ready queue all the time, so it never runs out of ready tasks
+template <typename Task>
+struct BackgroundTaskFIFO: public Scheduler::Policies::FIFO::Normal::LinkedListImp<Task>
+{
+    static constexpr bool kNeverEmpty = true;
+};
+
+/// A FIFO policy that can neither remove an arbitrary task from the ready queue nor reposition a task
+template <typename Task>
+struct AppendOnlyFIFO: private Scheduler::Policies::FIFO::Normal::LinkedListImp<Task>
+{
+    using Scheduler::Policies::FIFO::Normal::LinkedListImp<Task>::SchedulableTask;
+
+    using Scheduler::Policies::FIFO::Normal::LinkedListImp<Task>::next;
+
+    using Scheduler::Policies::FIFO::Normal::LinkedListImp<Task>::ready;
+};
+
+/// An executor that runs coroutines on the sample FIFO scheduler
+using Executor = Scheduler::Coroutines::Executor<Schedulers::FIFO<SimpleCoroutineTask>>;
+
+/// A log of the identifiers recorded by coroutines in the order they run
+struct ExecutionLog
+{
+    uint32_t entries[16] = {};
+
+    uint32_t count = 0;
+
+    void record(uint32_t identifier)
+    {
+        passert(this->count < 16, "The log is full.");
+
+        this->entries[this->count] = identifier;
+
+        this->count += 1;
+    }
+};
+
+/// A coroutine that records the given identifier and then yields for the given number of rounds
+Scheduler::Coroutines::Routine worker(Executor& executor, ExecutionLog& log, uint32_t identifier, uint32_t rounds)
+{
+    for (uint32_t round = 0; round < rounds; round += 1)
+    {
+        log.record(identifier);
+
+        co_await executor.yield();
+    }
+}
+
+/// A coroutine that waits on the given queue until the given flag is set
+Scheduler::Coroutines::Routine consumer(Executor& executor, Scheduler::Coroutines::WaitQueue<SimpleCoroutineTask>& queue, const bool& available, ExecutionLog& log, uint32_t identifier)
+{
+    while (!available)
+    {
+        co_await executor.blockOn(queue);
+    }
+
+    log.record(identifier);
+}
+
+/// A coroutine that sets the given flag and wakes up a waiter on the given queue
+Scheduler::Coroutines::Routine producer(Executor& executor, Scheduler::Coroutines::WaitQueue<SimpleCoroutineTask>& queue, bool& available, ExecutionLog& log, uint32_t identifier)
+{
+    log.record(identifier);
+
+    available = true;
+
+    passert(executor.notifyOne(queue), "A consumer waits on the queue.");
+
+    co_await executor.yield();
+
+    log.record(identifier);
+}
+
+class BackgroundTaskScheduler;
+
+class MissingIdleTaskScheduler;
+
+class MissingRemovalScheduler;
+
+class MissingAdjustmentScheduler;
+
+class MissingQuantumHandlerScheduler;
+
+namespace Scheduler::Traits
+{
+    template <>
+    struct SchedulerTraits<BackgroundTaskScheduler>
+    {
+        using Task = SimpleTask;
+    };
+
+    template <>
+    struct SchedulerTraits<MissingIdleTaskScheduler>
+    {
+        using Task = SimpleTask;
+    };
+
+    template <>
+    struct SchedulerTraits<MissingRemovalScheduler>
+    {
+        using Task = SimpleTask;
+    };
+
+    template <>
+    struct SchedulerTraits<MissingAdjustmentScheduler>
+    {
+        using Task = SimpleTask;
+    };
+
+    template <>
+    struct SchedulerTraits<MissingQuantumHandlerScheduler>
+    {
+        using Task = SimpleTask;
+    };
+}
+
+/// A scheduler that takes the fast path when a task is blocked, since its ready queue is never empty
+class BackgroundTaskScheduler: public Scheduler::Assembler<
+        BackgroundTaskFIFO<SimpleTask>,
+        Scheduler::EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<BackgroundTaskScheduler>,
+        Scheduler::EventHandlers::TaskYielding::Common::RunNext<BackgroundTaskScheduler>>,
+                               public Scheduler::IdleTaskSupport<SimpleTask>
+{
+    using IdleTaskSupport::IdleTaskSupport;
+};
+
+/// A scheduler that uses handlers relying on the idle task without inheriting from `IdleTaskSupport`
+class MissingIdleTaskScheduler: public Scheduler::Assembler<
+        Scheduler::Policies::FIFO::Normal::LinkedListImp<SimpleTask>,
+        Scheduler::EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<MissingIdleTaskScheduler>> {};
+
+/// A scheduler that kills tasks with a policy that cannot remove them
+class MissingRemovalScheduler: public Scheduler::Assembler<
+        AppendOnlyFIFO<SimpleTask>,
+        Scheduler::EventHandlers::TaskKilled::Common::KeepRunningCurrent<MissingRemovalScheduler>> {};
+
+/// A scheduler that repositions tasks with a policy that cannot adjust their positions
+class MissingAdjustmentScheduler: public Scheduler::Assembler<
+        AppendOnlyFIFO<SimpleTask>,
+        Scheduler::EventHandlers::TaskPriorityChanged::Preemptive::Balance<MissingAdjustmentScheduler>> {};
+
+/// A scheduler that delegates to a quantum used up handler it does not have
+class MissingQuantumHandlerScheduler: public Scheduler::Assembler<
+        Scheduler::Policies::FIFO::Normal::LinkedListImp<SimpleTask>,
+        Scheduler::EventHandlers::TimerInterrupt::Preemptive::KeepRunningCurrentWithAnyQuantumUsedUpHandler<MissingQuantumHandlerScheduler>> {};
+
+// Sample schedulers satisfy the requirements of their components
+static_assert(Scheduler::Validation::validate<Schedulers::FIFO<SimpleTask>>());
+
+static_assert(Scheduler::Validation::validate<Schedulers::RoundRobin<SimpleTask>>());
+
+static_assert(Scheduler::Validation::validate<Schedulers::InstrumentedRoundRobin<SimpleTask, Scheduler::Instrumentation::NullRecorder>>());
+
+static_assert(Scheduler::Validation::validate<Schedulers::PrioritizedRoundRobin<SimpleTask, 9>>());
+
+static_assert(Scheduler::Validation::validate<Schedulers::MultilevelFeedbackQueue<SimpleTask, SimpleTask::QuantumSpecifier, 9>>());
+
+static_assert(Scheduler::Validation::validate<Schedulers::TicklessMultilevelFeedbackQueue<SimpleTask, SimpleTask::QuantumSpecifier, 9>>());
+
+static_assert(Scheduler::Validation::validate<BackgroundTaskScheduler>());
+
+// Invalid combinations are detected
+static_assert(!Scheduler::Validation::IdleTaskSupportSatisfied<MissingIdleTaskScheduler>);
+
+static_assert(!Scheduler::Validation::TaskKilledHandlerSatisfied<MissingRemovalScheduler>);
+
+static_assert(!Scheduler::Validation::TaskPriorityChangedHandlerSatisfied<MissingAdjustmentScheduler>);
+
+static_assert(!Scheduler::Validation::QuantumUsedUpHandlerSatisfied<MissingQuantumHandlerScheduler>);
+
+static_assert(!Scheduler::Validation::ValidScheduler<MissingRemovalScheduler>);
+
+static_assert(!Scheduler::Validation::Assembled<SimpleTask>);
+
 void FIFOSchedulerTest::runPrimitivesTest()
 {
     // Test Setup
@@ -49,6 +256,61 @@ void FIFOSchedulerTest::runPrimitivesTest()
 
     // Empty ready queue
     passert(scheduler.next() == nullptr, "Empty ready queue");
+
+    // Remove a task in the middle of the queue
+    scheduler.ready(&t1);
+
+    scheduler.ready(&t2);
+
+    scheduler.ready(&t3);
+
+    scheduler.remove(&t2);
+
+    passert(scheduler.next()->getIdentifier() == 1, "Task 1 is still at the head of the queue.");
+
+    passert(scheduler.next()->getIdentifier() == 3, "Task 3 follows Task 1 after Task 2 is removed.");
+
+    passert(scheduler.next() == nullptr, "Empty ready queue");
+
+    // Statically bound delegates
+    using Base = Scheduler::Policies::FIFO::Normal::LinkedListImp<SimpleTask>;
+
+    Scheduler::PolicyWithStaticDelegate<Base, CountingDelegate> observed;
+
+    passert(observed.next() == nullptr && observed.getDelegate().dequeued == 0, "An empty ready queue does not notify the delegate.");
+
+    observed.ready(&t1);
+
+    observed.ready(&t2);
+
+    passert(observed.getDelegate().enqueued == 2, "The delegate is notified of each enqueued task.");
+
+    passert(observed.next() == &t1 && observed.getDelegate().lastDequeued == &t1, "The delegate is notified of the dequeued task.");
+
+    observed.remove(&t2);
+
+    passert(observed.next() == nullptr && observed.getDelegate().dequeued == 1, "The base policy removes tasks without notifying the delegate.");
+
+    Scheduler::PolicyWithStaticDelegate<Base, StatelessDequeueDelegate> stateless;
+
+    static_assert(sizeof(stateless) == sizeof(Base), "A stateless delegate takes no space.");
+
+    stateless.ready(&t3);
+
+    passert(stateless.next() == &t3 && stateless.next() == nullptr, "A delegate may observe dequeued tasks only.");
+
+    // A ready queue that is never empty skips the fallback to the idle task
+    BackgroundTaskScheduler background(&idleTask);
+
+    background.ready(&t1);
+
+    background.ready(&t2);
+
+    passert(background.onTaskBlocked(&t3) == &t1, "Task 1 runs after Task 3 is blocked.");
+
+    passert(background.onTaskYielded(&t1) == &t2, "Task 2 runs after Task 1 yields.");
+
+    passert(background.onTaskBlocked(&t2) == &t1, "The background task keeps the ready queue non-empty.");
 }
 
 void FIFOSchedulerTest::runTaskManagerDelegateTest()
@@ -96,6 +358,69 @@ void FIFOSchedulerTest::runTaskManagerDelegateTest()
     // Task 1 yielded
     passert(scheduler.onTaskYielded(&t1)->getIdentifier() == 1,
             "Task 1 yielded but it is the only task ready to run.");
+
+    // Coroutines are resumed by the executor until the scheduler selects the idle task
+    SimpleCoroutineTask coroutineIdleTask(0);
+
+    SimpleCoroutineTask r1(1);
+
+    SimpleCoroutineTask r2(2);
+
+    SimpleCoroutineTask r3(3);
+
+    Schedulers::FIFO<SimpleCoroutineTask> runtime(&coroutineIdleTask);
+
+    Executor executor(runtime);
+
+    ExecutionLog log;
+
+    executor.spawn(&r1, worker(executor, log, 1, 2));
+
+    executor.spawn(&r2, worker(executor, log, 2, 1));
+
+    executor.run();
+
+    passert(log.count == 3 && log.entries[0] == 1 && log.entries[1] == 2 && log.entries[2] == 1, "Task 1 and Task 2 take turns after yielding.");
+
+    passert(r1.getHandle() == nullptr && r2.getHandle() == nullptr && executor.getCurrentTask() == nullptr, "Finished coroutines have been destroyed.");
+
+    // A blocked coroutine is resumed after another coroutine wakes it up
+    Scheduler::Coroutines::WaitQueue<SimpleCoroutineTask> queue;
+
+    bool available = false;
+
+    log = ExecutionLog();
+
+    executor.spawn(&r3, consumer(executor, queue, available, log, 3));
+
+    executor.run();
+
+    passert(log.count == 0 && !queue.isEmpty() && r3.getHandle() != nullptr, "Task 3 is blocked since nothing is available.");
+
+    executor.spawn(&r1, producer(executor, queue, available, log, 1));
+
+    executor.run();
+
+    passert(log.count == 3 && log.entries[0] == 1 && log.entries[1] == 3 && log.entries[2] == 1, "Task 3 runs after Task 1 yields.");
+
+    passert(queue.isEmpty() && r1.getHandle() == nullptr && r3.getHandle() == nullptr, "Both coroutines have finished.");
+
+    // A blocked coroutine can be woken up while the executor is not running
+    available = false;
+
+    log = ExecutionLog();
+
+    executor.spawn(&r2, consumer(executor, queue, available, log, 2));
+
+    executor.run();
+
+    available = true;
+
+    passert(executor.notifyAll(queue) == 1 && log.count == 0, "Task 2 is ready but has not run yet.");
+
+    executor.run();
+
+    passert(log.count == 1 && log.entries[0] == 2 && r2.getHandle() == nullptr, "Task 2 has finished.");
 }
 
 void FIFOSchedulerTest::runTimerInterruptDelegateTest()
@@ -0,0 +1,290 @@
+//
+//  FairShareSchedulerTest.cpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#include "FairShareSchedulerTest.hpp"
+#include "SimpleFairShareTask.hpp"
+#include "SampleSchedulers.hpp"
+#include <Debug.hpp>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace Schedulers = SampleSchedulers;
+
+using Weights = Scheduler::Policies::FairShare::NiceLevelWeights<SimpleFairShareTask>;
+
+static_assert(Scheduler::Validation::validate<Schedulers::FairShare<SimpleFairShareTask>>());
+
+void FairShareSchedulerTest::runPrimitivesTest()
+{
+    // The tree stays balanced and ordered under random insertions and removals
+    Scheduler::Containers::IntrusiveRedBlackTree<SimpleFairShareTask, Scheduler::Policies::FairShare::VirtualRuntimeComparator<SimpleFairShareTask>> tree;
+
+    std::vector<std::unique_ptr<SimpleFairShareTask>> tasks;
+
+    std::vector<SimpleFairShareTask*> linked;
+
+    std::mt19937 random(7);
+
+    passert(tree.isEmpty() && tree.first() == nullptr && tree.isValid(), "Empty tree");
+
+    for (uint32_t index = 0; index < 256; index++)
+    {
+        tasks.push_back(std::make_unique<SimpleFairShareTask>(index + 1, 19));
+
+        // Some tasks share the same virtual runtime
+        tasks.back()->setVirtualRuntime(random() % 64);
+
+        tree.insert(tasks.back().get());
+
+        linked.push_back(tasks.back().get());
+
+        // Remove a random task every now and then
+        if (index % 3 == 2)
+        {
+            auto victim = linked.begin() + static_cast<long>(random() % linked.size());
+
+            tree.remove(*victim);
+
+            linked.erase(victim);
+        }
+
+        passert(tree.isValid(), "The tree remains a valid red-black tree.");
+    }
+
+    passert(tree.size() == linked.size(), "The tree tracks the number of tasks.");
+
+    // Tasks leave the tree in the order of their virtual runtime and then in the order they have been inserted
+    std::stable_sort(linked.begin(), linked.end(), [](const SimpleFairShareTask* lhs, const SimpleFairShareTask* rhs) { return lhs->getVirtualRuntime() < rhs->getVirtualRuntime(); });
+
+    for (SimpleFairShareTask* expected : linked)
+    {
+        passert(tree.first() == expected, "The leftmost task is cached.");
+
+        passert(tree.pop() == expected, "Tasks are popped in order.");
+
+        passert(tree.isValid(), "The tree remains a valid red-black tree.");
+    }
+
+    passert(tree.isEmpty(), "All tasks have been popped.");
+
+    // Weights follow the nice levels
+    passert(Weights{}(19) == Scheduler::Policies::FairShare::kNiceZeroWeight, "Priority 19 has the default weight.");
+
+    passert(Weights{}(0) == 15 && Weights{}(39) == 88761 && Weights{}(100) == 88761, "Priority levels are mapped to nice levels from 19 to -20.");
+
+    // Policy
+    Scheduler::Policies::FairShare::Normal::RedBlackTreeImp<SimpleFairShareTask> policy;
+
+    SimpleFairShareTask t1(1, 19);
+
+    SimpleFairShareTask t2(2, 19);
+
+    SimpleFairShareTask t3(3, 24);
+
+    passert(policy.next() == nullptr, "Empty ready queue");
+
+    // Charge the default weight
+    policy.charge(&t1, 3);
+
+    passert(t1.getVirtualRuntime() == 3 * Scheduler::Policies::FairShare::kRuntimePerTick, "A task of the default weight is charged one unit per tick.");
+
+    // Charge a heavier task
+    policy.charge(&t3, 3);
+
+    passert(t3.getVirtualRuntime() == 3 * 1024 * 1024 / Weights{}(24), "A heavier task is charged less per tick.");
+
+    policy.ready(&t1);
+
+    policy.ready(&t2);
+
+    policy.ready(&t3);
+
+    passert(policy.next()->getIdentifier() == 2, "Task 2 has the smallest virtual runtime.");
+
+    passert(policy.next()->getIdentifier() == 3, "Task 3 has the second smallest virtual runtime.");
+
+    passert(policy.getMinimumRuntime() == t3.getVirtualRuntime(), "The minimum runtime follows dequeued tasks.");
+
+    // A task that falls behind is moved forward to the minimum runtime
+    policy.ready(&t2);
+
+    passert(t2.getVirtualRuntime() == policy.getMinimumRuntime(), "Task 2 starts at the minimum runtime.");
+
+    passert(policy.next()->getIdentifier() == 2, "Task 2 runs before Task 1.");
+
+    // Remove a task in the middle of the tree
+    policy.ready(&t2);
+
+    policy.ready(&t3);
+
+    policy.remove(&t3);
+
+    passert(policy.next()->getIdentifier() == 2, "Task 2 is enqueued first among tasks of the same runtime.");
+
+    passert(policy.next()->getIdentifier() == 1, "Task 1 has the largest virtual runtime.");
+
+    passert(policy.next() == nullptr, "Empty ready queue");
+
+    // Preemption
+    policy.ready(&t2);
+
+    passert(!policy.shouldPreempt(&t1), "Task 1 is within the granularity.");
+
+    policy.charge(&t1, 2);
+
+    passert(policy.shouldPreempt(&t1), "Task 1 has exceeded the granularity.");
+
+    // Taking a snapshot does not dequeue any task, so the virtual runtimes of a fair-share policy are left unchanged
+    static Scheduler::Containers::TaskArena<SimpleFairShareTask, 4> arena;
+
+    Scheduler::Persistence::ArenaCodec codec(arena);
+
+    Scheduler::Policies::FairShare::Normal::RedBlackTreeImp<SimpleFairShareTask> fair;
+
+    Scheduler::Containers::TaskHandle runtimes[3] = {arena.create(21, 0), arena.create(22, 0), arena.create(23, 0)};
+
+    for (size_t index = 0; index < 3; index += 1)
+    {
+        arena.get(runtimes[index])->setVirtualRuntime(1000 * (index + 1));
+
+        fair.ready(arena.get(runtimes[index]));
+    }
+
+    std::byte small[Scheduler::Persistence::getSnapshotSize(2)];
+
+    passert(Scheduler::Persistence::snapshot(fair, small, codec) == 0, "The buffer cannot hold three records.");
+
+    std::byte fairImage[Scheduler::Persistence::getSnapshotSize(3)];
+
+    passert(Scheduler::Persistence::snapshot(fair, fairImage, codec) == sizeof(fairImage), "The snapshot stores three records.");
+
+    passert(fair.getMinimumRuntime() == 0, "The snapshot does not advance the smallest virtual runtime.");
+
+    for (size_t index = 0; index < 3; index += 1)
+    {
+        passert(fair.next() == arena.get(runtimes[index]) && arena.get(runtimes[index])->getVirtualRuntime() == 1000 * (index + 1), "The virtual runtime is left unchanged.");
+
+        arena.destroy(runtimes[index]);
+    }
+}
+
+void FairShareSchedulerTest::runTaskManagerDelegateTest()
+{
+    // Test Setup
+    SimpleFairShareTask idleTask(0, 0);
+
+    SimpleFairShareTask t1(1, 19);
+
+    SimpleFairShareTask t2(2, 19);
+
+    SimpleFairShareTask t3(3, 19);
+
+    Schedulers::FairShare<SimpleFairShareTask> scheduler(&idleTask);
+
+    // Task 1 is created while the idle task is running
+    passert(scheduler.onTaskCreated(&idleTask, &t1)->getIdentifier() == 1, "Task 1 runs.");
+
+    // Task 2 and Task 3 are created while Task 1 is running
+    passert(scheduler.onTaskCreated(&t1, &t2)->getIdentifier() == 1, "Task 1 keeps running.");
+
+    passert(scheduler.onTaskCreated(&t1, &t3)->getIdentifier() == 1, "Task 1 keeps running.");
+
+    // Task 2 is killed
+    passert(scheduler.onTaskKilled(&t1, &t2)->getIdentifier() == 1, "Task 1 keeps running.");
+
+    // Task 1 is blocked
+    passert(scheduler.onTaskBlocked(&t1)->getIdentifier() == 3, "Task 3 runs.");
+
+    // Task 1 is unblocked and has not consumed more than Task 3
+    passert(scheduler.onTaskUnblocked(&t3, &t1)->getIdentifier() == 1, "Task 1 preempts Task 3.");
+
+    passert(scheduler.onTaskFinished(&t1)->getIdentifier() == 3, "Task 3 runs.");
+
+    passert(scheduler.onTaskFinished(&t3) == &idleTask, "The idle task runs.");
+}
+
+void FairShareSchedulerTest::runTimerInterruptDelegateTest()
+{
+    // Test Setup
+    SimpleFairShareTask idleTask(0, 0);
+
+    SimpleFairShareTask t1(1, 19);
+
+    SimpleFairShareTask t2(2, 19);
+
+    SimpleFairShareTask t3(3, 24);
+
+    Schedulers::FairShare<SimpleFairShareTask> scheduler(&idleTask);
+
+    passert(scheduler.onTimerInterrupt(&idleTask) == &idleTask, "The idle task keeps running.");
+
+    // Tasks of the same weight alternate once the current one exceeds the granularity
+    scheduler.ready(&t2);
+
+    passert(scheduler.onTimerInterrupt(&t1)->getIdentifier() == 1, "Task 1 keeps running after a tick.");
+
+    passert(scheduler.onTimerInterrupt(&t1)->getIdentifier() == 2, "Task 2 runs after Task 1 has exceeded the granularity.");
+
+    // Charge elapsed ticks in bulk
+    passert(scheduler.onTimerInterrupt(&t2, 4)->getIdentifier() == 1, "Task 1 runs after Task 2 has run for 4 ticks.");
+
+    // Tasks share the processor in proportion to their weights
+    scheduler.ready(&t3);
+
+    uint32_t ticks[4] = {};
+
+    SimpleFairShareTask* current = &t1;
+
+    for (uint32_t tick = 0; tick < 8000; tick++)
+    {
+        ticks[current->getIdentifier()] += 1;
+
+        current = scheduler.onTimerInterrupt(current);
+    }
+
+    double expected = static_cast<double>(Weights{}(24)) / Weights{}(19);
+
+    double ratio = static_cast<double>(ticks[3]) / ticks[1];
+
+    pinfo("Task 1 ran for %u ticks, Task 2 ran for %u ticks, Task 3 ran for %u ticks.", ticks[1], ticks[2], ticks[3]);
+
+    passert(ratio > expected * 0.95 && ratio < expected * 1.05, "Task 3 receives a share proportional to its weight.");
+
+    passert(ticks[1] >= ticks[2] - 4 && ticks[1] <= ticks[2] + 4, "Task 1 and Task 2 receive the same share.");
+}
+
+void FairShareSchedulerTest::runGroupOperationsTest()
+{
+    // Test Setup
+    SimpleFairShareTask idleTask(0, 0);
+
+    SimpleFairShareTask t1(1, 19);
+
+    SimpleFairShareTask t2(2, 19);
+
+    SimpleFairShareTask t3(3, 19);
+
+    Schedulers::FairShare<SimpleFairShareTask> scheduler(&idleTask);
+
+    // Task 3 has been running for a while
+    scheduler.charge(&t3, 10);
+
+    // Task 1 and Task 2 are unblocked
+    passert(scheduler.onTaskUnblocked(nullptr, &t1) == nullptr, "Intermediate call");
+
+    passert(scheduler.onTaskUnblocked(nullptr, &t2) == nullptr, "Intermediate call");
+
+    passert(scheduler.onTaskUnblocked(&t3, nullptr)->getIdentifier() == 1, "Task 1 preempts Task 3.");
+
+    passert(scheduler.onTaskBlocked(&t1)->getIdentifier() == 2, "Task 2 runs.");
+
+    passert(scheduler.onTaskBlocked(&t2)->getIdentifier() == 3, "Task 3 runs.");
+
+    passert(scheduler.onTaskBlocked(&t3) == &idleTask, "The idle task runs.");
+}
@@ -0,0 +1,28 @@
+//
+//  FairShareSchedulerTest.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef FairShareSchedulerTest_hpp
+#define FairShareSchedulerTest_hpp
+
+#include "SchedulerTest.hpp"
+
+class FairShareSchedulerTest: public SchedulerTest
+{
+public:
+    FairShareSchedulerTest() : SchedulerTest("Fair Share") {}
+
+private:
+    void runPrimitivesTest() override;
+
+    void runTaskManagerDelegateTest() override;
+
+    void runTimerInterruptDelegateTest() override;
+
+    void runGroupOperationsTest() override;
+};
+
+#endif /* FairShareSchedulerTest_hpp */
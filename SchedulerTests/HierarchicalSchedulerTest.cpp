@@ -0,0 +1,281 @@
+//
+//  HierarchicalSchedulerTest.cpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#include "HierarchicalSchedulerTest.hpp"
+#include "SimpleGroupedTask.hpp"
+#include "SampleSchedulers.hpp"
+#include <Debug.hpp>
+
+namespace Schedulers = SampleSchedulers;
+
+using Group = Scheduler::SchedulingGroup<SimpleGroupedTask>;
+
+using TaskPolicy = Scheduler::Policies::FIFO::Virtual::LinkedListImp<SimpleGroupedTask>;
+
+using GroupPolicy = Scheduler::Policies::FIFO::Virtual::LinkedListImp<Group>;
+
+static_assert(Scheduler::Validation::validate<Schedulers::Hierarchical<SimpleGroupedTask>>());
+
+void HierarchicalSchedulerTest::runPrimitivesTest()
+{
+    // Test Setup
+    Scheduler::Policies::Hierarchical::Normal::GroupTreeImp<SimpleGroupedTask> policy;
+
+    TaskPolicy aTasks, bTasks, c1Tasks, c2Tasks;
+
+    GroupPolicy cGroups;
+
+    Group a(policy.getRootGroup(), &aTasks);
+
+    Group b(policy.getRootGroup(), &bTasks);
+
+    Group c(policy.getRootGroup(), &cGroups);
+
+    Group c1(&c, &c1Tasks);
+
+    Group c2(&c, &c2Tasks);
+
+    SimpleGroupedTask t1(1), t2(2), t3(3), t4(4), t5(5);
+
+    t1.setGroup(&a);
+
+    t2.setGroup(&a);
+
+    t3.setGroup(&b);
+
+    t4.setGroup(&c1);
+
+    t5.setGroup(&c2);
+
+    passert(policy.next() == nullptr, "Empty hierarchy");
+
+    passert(a.isLeaf() && !c.isLeaf() && c1.getParent() == &c, "The hierarchy has two levels.");
+
+    policy.ready(&t1);
+
+    policy.ready(&t2);
+
+    policy.ready(&t3);
+
+    passert(policy.getRootGroup()->getNumberOfReadyTasks() == 3 && a.getNumberOfReadyTasks() == 2, "Ancestors count the ready tasks of their descendants.");
+
+    // The selected group keeps serving its tasks until it runs out of them
+    passert(policy.next()->getIdentifier() == 1, "Group A is selected.");
+
+    passert(policy.next()->getIdentifier() == 2, "Group A remains selected.");
+
+    passert(policy.next()->getIdentifier() == 3, "Group B is selected once Group A has no ready task.");
+
+    passert(policy.next() == nullptr, "Empty hierarchy");
+
+    // Remove a task
+    policy.ready(&t1);
+
+    policy.ready(&t3);
+
+    policy.remove(&t1);
+
+    passert(a.getNumberOfReadyTasks() == 0 && policy.next()->getIdentifier() == 3, "Group A is withdrawn once its only task is removed.");
+
+    // Inner groups select their child groups with their own policies
+    policy.ready(&t4);
+
+    policy.ready(&t5);
+
+    passert(c.getNumberOfReadyTasks() == 2, "Group C counts the tasks of Group C1 and Group C2.");
+
+    uint32_t visited = 0;
+
+    policy.forEach([&](SimpleGroupedTask* task) { visited = visited * 10 + task->getIdentifier(); });
+
+    passert(visited == 45, "Tasks are visited group by group without changing the hierarchy.");
+
+    passert(policy.next()->getIdentifier() == 4 && policy.next()->getIdentifier() == 5, "Group C serves Group C1 and then Group C2.");
+
+    // A group that ends its slice is charged and put back into the policy of its parent
+    policy.ready(&t1);
+
+    policy.ready(&t3);
+
+    SimpleGroupedTask* current = policy.next();
+
+    passert(current->getIdentifier() == 1, "Group A has the smallest virtual runtime.");
+
+    passert(!policy.charge(current, 3), "Group A is still within its slice.");
+
+    passert(policy.charge(current, 1), "Group A has ended its slice.");
+
+    policy.ready(current);
+
+    passert(policy.next()->getIdentifier() == 3, "Group B has a smaller virtual runtime than Group A.");
+
+    passert(policy.next()->getIdentifier() == 1, "Task 1 runs.");
+
+    // A group that exhausts its quota is throttled until the next period
+    b.setQuota(2);
+
+    policy.ready(&t3);
+
+    current = policy.next();
+
+    passert(current->getIdentifier() == 3 && policy.charge(current, 2) && b.isThrottled(), "Group B has exhausted its quota.");
+
+    policy.ready(current);
+
+    passert(policy.next() == nullptr && policy.getRootGroup()->getNumberOfReadyTasks() == 0, "Throttled groups cannot be selected.");
+
+    policy.advance(99);
+
+    passert(policy.next() == nullptr, "Group B is still throttled in the first period.");
+
+    policy.advance(1);
+
+    passert(!b.isThrottled() && policy.next()->getIdentifier() == 3, "Group B is brought back in the next period.");
+}
+
+void HierarchicalSchedulerTest::runTaskManagerDelegateTest()
+{
+    // Test Setup
+    SimpleGroupedTask idleTask(0);
+
+    SimpleGroupedTask t1(1), t2(2), t3(3);
+
+    Schedulers::Hierarchical<SimpleGroupedTask> scheduler(&idleTask);
+
+    TaskPolicy aTasks, bTasks;
+
+    Group a(scheduler.getRootGroup(), &aTasks);
+
+    Group b(scheduler.getRootGroup(), &bTasks);
+
+    t1.setGroup(&a);
+
+    t2.setGroup(&a);
+
+    t3.setGroup(&b);
+
+    passert(scheduler.onTaskCreated(&idleTask, &t1)->getIdentifier() == 1, "Task 1 runs.");
+
+    passert(scheduler.onTaskCreated(&t1, &t2)->getIdentifier() == 1, "Task 1 keeps running.");
+
+    passert(scheduler.onTaskCreated(&t1, &t3)->getIdentifier() == 1, "Task 1 keeps running.");
+
+    passert(scheduler.onTaskKilled(&t1, &t2)->getIdentifier() == 1, "Task 1 keeps running.");
+
+    passert(a.getNumberOfReadyTasks() == 0, "Group A no longer has any ready task.");
+
+    passert(scheduler.onTaskBlocked(&t1)->getIdentifier() == 3, "Task 3 runs.");
+
+    passert(scheduler.onTaskUnblocked(&t3, &t1)->getIdentifier() == 3, "Task 3 keeps running.");
+
+    passert(scheduler.onTaskFinished(&t3)->getIdentifier() == 1, "Task 1 runs.");
+
+    passert(scheduler.onTaskFinished(&t1) == &idleTask, "The idle task runs.");
+}
+
+void HierarchicalSchedulerTest::runTimerInterruptDelegateTest()
+{
+    // Test Setup
+    SimpleGroupedTask idleTask(0);
+
+    SimpleGroupedTask t1(1), t2(2), t3(3), t4(4);
+
+    Schedulers::Hierarchical<SimpleGroupedTask> scheduler(&idleTask);
+
+    TaskPolicy aTasks, bTasks, qTasks;
+
+    Group a(scheduler.getRootGroup(), &aTasks, 1024);
+
+    Group b(scheduler.getRootGroup(), &bTasks, 3072);
+
+    t1.setGroup(&a);
+
+    t2.setGroup(&b);
+
+    t3.setGroup(&b);
+
+    passert(scheduler.onTimerInterrupt(&idleTask) == &idleTask, "The idle task keeps running.");
+
+    // Group B has more tasks but its share is determined by its weight
+    scheduler.ready(&t2);
+
+    scheduler.ready(&t3);
+
+    uint32_t ticks[5] = {};
+
+    SimpleGroupedTask* current = &t1;
+
+    for (uint32_t tick = 0; tick < 8000; tick++)
+    {
+        ticks[current->getIdentifier()] += 1;
+
+        current = scheduler.onTimerInterrupt(current);
+    }
+
+    pinfo("Task 1 ran for %u ticks, Task 2 ran for %u ticks, Task 3 ran for %u ticks.", ticks[1], ticks[2], ticks[3]);
+
+    double ratio = static_cast<double>(ticks[2] + ticks[3]) / ticks[1];
+
+    passert(ratio > 3 * 0.95 && ratio < 3 * 1.05, "Group B receives a share proportional to its weight.");
+
+    passert(ticks[2] >= ticks[3] - 4 && ticks[2] <= ticks[3] + 4, "Tasks in Group B share its slices.");
+
+    // A group limited by its quota does not receive more than its quota in any period
+    Group q(scheduler.getRootGroup(), &qTasks, 3072, 10);
+
+    t4.setGroup(&q);
+
+    scheduler.ready(&t4);
+
+    uint32_t before = ticks[4];
+
+    for (uint32_t tick = 0; tick < 1000; tick++)
+    {
+        ticks[current->getIdentifier()] += 1;
+
+        current = scheduler.onTimerInterrupt(current);
+    }
+
+    pinfo("Task 4 ran for %u ticks in 10 periods.", ticks[4] - before);
+
+    passert(ticks[4] - before <= 100 && ticks[4] - before >= 90, "Group Q is limited by its quota.");
+}
+
+void HierarchicalSchedulerTest::runGroupOperationsTest()
+{
+    // Test Setup
+    SimpleGroupedTask idleTask(0);
+
+    SimpleGroupedTask t1(1), t2(2), t3(3);
+
+    Schedulers::Hierarchical<SimpleGroupedTask> scheduler(&idleTask);
+
+    TaskPolicy aTasks, bTasks;
+
+    Group a(scheduler.getRootGroup(), &aTasks);
+
+    Group b(scheduler.getRootGroup(), &bTasks);
+
+    t1.setGroup(&a);
+
+    t2.setGroup(&b);
+
+    t3.setGroup(&b);
+
+    // Task 1, Task 2 and Task 3 are unblocked
+    passert(scheduler.onTaskUnblocked(nullptr, &t1) == nullptr, "Intermediate call");
+
+    passert(scheduler.onTaskUnblocked(nullptr, &t2) == nullptr, "Intermediate call");
+
+    passert(scheduler.onTaskUnblocked(&idleTask, &t3)->getIdentifier() == 1, "Task 1 runs.");
+
+    passert(scheduler.onTaskBlocked(&t1)->getIdentifier() == 2, "Task 2 runs.");
+
+    passert(scheduler.onTaskBlocked(&t2)->getIdentifier() == 3, "Task 3 runs.");
+
+    passert(scheduler.onTaskBlocked(&t3) == &idleTask, "The idle task runs.");
+}
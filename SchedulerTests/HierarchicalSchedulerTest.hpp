@@ -0,0 +1,28 @@
+//
+//  HierarchicalSchedulerTest.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef HierarchicalSchedulerTest_hpp
+#define HierarchicalSchedulerTest_hpp
+
+#include "SchedulerTest.hpp"
+
+class HierarchicalSchedulerTest: public SchedulerTest
+{
+public:
+    HierarchicalSchedulerTest() : SchedulerTest("Hierarchical") {}
+
+private:
+    void runPrimitivesTest() override;
+
+    void runTaskManagerDelegateTest() override;
+
+    void runTimerInterruptDelegateTest() override;
+
+    void runGroupOperationsTest() override;
+};
+
+#endif /* HierarchicalSchedulerTest_hpp */
@@ -8,11 +8,16 @@
 
 #include "MultilevelFeedbackQueueSchedulerTest.hpp"
 #include "SimpleTask.hpp"
+#include "SimpleBoostableTask.hpp"
 #include "SampleSchedulers.hpp"
 #include <Debug.hpp>
 
 namespace Schedulers = SampleSchedulers;
 
+using BoostedScheduler = Schedulers::MultilevelFeedbackQueueWithPriorityBoost<SimpleBoostableTask, SimpleBoostableTask::QuantumSpecifier, 3, 4>;
+
+static_assert(Scheduler::Validation::validate<BoostedScheduler>());
+
 void MultilevelFeedbackQueueSchedulerTest::runPrimitivesTest()
 {
     // Test Setup
@@ -29,34 +34,18 @@ void MultilevelFeedbackQueueSchedulerTest::runPrimitivesTest()
     // Empty queue
     passert(scheduler.next() == nullptr, "Empty queue");
 
-    // Check quantum allocation: Task 1
-    passert(t1.hasUsedUpTimeAllotment(), "Before: Task 1 has 0 quantum.");
-
+    // Quantum is not allocated on enqueue
     scheduler.ready(&t1);
 
-    passert(!t1.hasUsedUpTimeAllotment(), "After: Task 1 has UINT32_MAX quantum.");
-
-    t1.print();
-
-    // Check quantum allocation: Task 2
-    passert(t2.hasUsedUpTimeAllotment(), "Before: Task 2 has 0 quantum.");
-
     scheduler.ready(&t2);
 
-    passert(!t2.hasUsedUpTimeAllotment(), "After: Task 2 has 2 quantum.");
-
-    t2.print();
-
-    // Check quantum allocation: Task 3
-    passert(t3.hasUsedUpTimeAllotment(), "Before: Task 3 has 0 quantum.");
-
     scheduler.ready(&t3);
 
-    passert(!t3.hasUsedUpTimeAllotment(), "After: Task 3 has 1 quantum.");
+    passert(t1.hasUsedUpTimeAllotment() && t2.hasUsedUpTimeAllotment() && t3.hasUsedUpTimeAllotment(), "Tasks have 0 quantum before they are dispatched.");
 
-    t3.print();
+    // Dequeue and check quantum allocation
+    static constexpr uint32_t kQuanta[] = { UINT32_MAX, 2, 1 };
 
-    // Dequeue
     for (uint32_t index = 1; index < 4; index += 1)
     {
         SimpleTask* task = scheduler.next();
@@ -65,6 +54,8 @@ void MultilevelFeedbackQueueSchedulerTest::runPrimitivesTest()
 
         passert(task->getPriority() == (4 - index), "Task %u should have priority level unchanged.", 4 - index);
 
+        passert(task->getRemainingTicks() == kQuanta[3 - index], "Task %u is allocated with its quantum when it is dispatched.", 4 - index);
+
         pinfo("Next()");
 
         task->print();
@@ -72,6 +63,56 @@ void MultilevelFeedbackQueueSchedulerTest::runPrimitivesTest()
 
     // Empty queue
     passert(scheduler.next() == nullptr, "Empty queue");
+
+    // Priority Boost Variant
+    SimpleBoostableTask boostedIdleTask(0, 0);
+
+    SimpleBoostableTask t4(4, 3);
+
+    SimpleBoostableTask t5(5, 1);
+
+    SimpleBoostableTask t6(6, 3);
+
+    SimpleBoostableTask t7(7, 1);
+
+    SimpleBoostableTask t8(8, 2);
+
+    BoostedScheduler boosted(&boostedIdleTask);
+
+    boosted.ready(&t7);
+
+    boosted.ready(&t8);
+
+    boosted.ready(&t5);
+
+    boosted.ready(&t4);
+
+    // Ready tasks are boosted without being moved
+    boosted.boost();
+
+    passert(t7.getPriority() == 1 && t8.getPriority() == 2, "Boosted tasks keep their priority levels until they are dispatched.");
+
+    // Task 6 arrives after the boost
+    boosted.ready(&t6);
+
+    // Task 5 is removed before it is dispatched
+    boosted.remove(&t5);
+
+    passert(boosted.next() == &t4, "Task 4 at the highest level is dispatched first.");
+
+    passert(boosted.next() == &t8, "Task 8 is dispatched before the task enqueued after the boost.");
+
+    passert(t8.getPriority() == 3 && t8.getRemainingTicks() == 1, "Task 8 is raised to level 3 and recharged with its quantum.");
+
+    passert(boosted.next() == &t7, "Task 7 is dispatched before the task enqueued after the boost.");
+
+    passert(t7.getPriority() == 3 && t7.getRemainingTicks() == 1, "Task 7 is raised to level 3 and recharged with its quantum.");
+
+    passert(boosted.next() == &t6, "Task 6 is dispatched after all boosted tasks.");
+
+    passert(t5.getPriority() == 1, "Task 5 is not boosted after it has been removed.");
+
+    passert(boosted.next() == nullptr, "Empty queue");
 }
 
 void MultilevelFeedbackQueueSchedulerTest::runTaskManagerDelegateTest()
@@ -186,6 +227,83 @@ void MultilevelFeedbackQueueSchedulerTest::runTimerInterruptDelegateTest()
     passert(t3.getPriority() == 1, "Task 3 is demoted to priority level 1.");
 
     // Tasks who have priority level 1 will run to completion.
+
+    // Tickless Variant
+    SimpleTask t4(4, 2);
+
+    SimpleTask t5(5, 2);
+
+    Schedulers::TicklessMultilevelFeedbackQueue<SimpleTask, SimpleTask::QuantumSpecifier, 3> tickless(&idleTask);
+
+    // No timer interrupt is needed while the idle task is running
+    passert(tickless.ticksUntilQuantumExpiry(&idleTask) == UINT32_MAX, "The idle task does not need a timer interrupt.");
+
+    // Task 4 starts to run and the caller programs the timer to fire after 2 ticks
+    tickless.ready(&t4);
+
+    tickless.ready(&t5);
+
+    running = tickless.onTimerInterrupt(&idleTask, 1);
+
+    passert(running == &t4, "Task 4 runs after the idle task.");
+
+    passert(tickless.ticksUntilQuantumExpiry(running) == 2, "Task 4 has 2 ticks left.");
+
+    // The one-shot timer fires early after 1 tick
+    running = tickless.onTimerInterrupt(running, 1);
+
+    passert(running == &t4 && tickless.ticksUntilQuantumExpiry(running) == 1, "Task 4 still runs because it has 1 tick left.");
+
+    // More ticks have elapsed than Task 4 has left, e.g. the timer interrupt was delivered late
+    running = tickless.onTimerInterrupt(running, 5);
+
+    passert(t4.getPriority() == 1, "Task 4 is demoted to priority level 1 since it has used up all ticks.");
+
+    passert(running == &t5, "Task 5 runs after Task 4 has been demoted.");
+
+    // Periodic timer interrupts still work
+    running = tickless.onTimerInterrupt(running);
+
+    passert(running == &t5 && tickless.ticksUntilQuantumExpiry(running) == 1, "Task 5 still runs because it has 1 tick left.");
+
+    // Priority Boost Variant: Boost every 4 timer interrupts
+    SimpleBoostableTask boostedIdleTask(0, 0);
+
+    SimpleBoostableTask t6(6, 1);
+
+    SimpleBoostableTask t7(7, 3);
+
+    BoostedScheduler boosted(&boostedIdleTask);
+
+    boosted.ready(&t6);
+
+    boosted.ready(&t7);
+
+    SimpleBoostableTask* current = boosted.next();
+
+    // Task 7 is demoted twice and then waits behind Task 6 that runs to completion
+    current = boosted.onTimerInterrupt(current);
+
+    passert(current == &t7 && t7.getPriority() == 2, "Task 7 keeps running after it has been demoted to level 2.");
+
+    current = boosted.onTimerInterrupt(current);
+
+    passert(current == &t7, "Task 7 still runs because it has 1 quantum left.");
+
+    current = boosted.onTimerInterrupt(current);
+
+    passert(current == &t6 && t7.getPriority() == 1, "Task 6 runs after Task 7 has been demoted to level 1.");
+
+    // The fourth timer interrupt boosts both tasks
+    current = boosted.onTimerInterrupt(current);
+
+    passert(t6.getPriority() == 2, "Task 6 is boosted to level 3 and then demoted to level 2 as it uses up the quantum of level 3.");
+
+    passert(current == &t7 && t7.getPriority() == 3, "Task 7 is boosted to level 3 and runs instead of starving behind Task 6.");
+
+    current = boosted.onTimerInterrupt(current);
+
+    passert(current == &t6 && t7.getPriority() == 2, "Task 6 runs after Task 7 has been demoted to level 2 again.");
 }
 
 void MultilevelFeedbackQueueSchedulerTest::runGroupOperationsTest()
@@ -0,0 +1,305 @@
+//
+//  NumaAwareRoundRobinSchedulerTest.cpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#include "NumaAwareRoundRobinSchedulerTest.hpp"
+#include "SimpleAffinityTask.hpp"
+#include "SampleSchedulers.hpp"
+#include <Debug.hpp>
+
+namespace Schedulers = SampleSchedulers;
+
+using Core = Scheduler::MultiCore::WorkStealing<Scheduler::Policies::FIFO::Normal::LinkedListImp<SimpleAffinityTask>, Scheduler::MultiCore::Balancers::NearestBusiest<>>;
+
+using NumaAwareScheduler = Schedulers::NumaAwareRoundRobin<SimpleAffinityTask>;
+
+static_assert(Scheduler::Validation::validate<NumaAwareScheduler>());
+
+///
+/// Attach four cores to the given domain, where cores 0 and 1 share a cache on node 0 and cores 2 and 3 share a cache on node 1
+///
+template <typename Domain, typename Core>
+static void attachTwoSockets(Domain& domain, Core& core0, Core& core1, Core& core2, Core& core3)
+{
+    domain.attach(0, core0, 0, 0);
+
+    domain.attach(1, core1, 0, 0);
+
+    domain.attach(2, core2, 1, 1);
+
+    domain.attach(3, core3, 1, 1);
+}
+
+void NumaAwareRoundRobinSchedulerTest::runPrimitivesTest()
+{
+    // Test Setup
+    SimpleAffinityTask idleTask0(0);
+
+    SimpleAffinityTask idleTask1(0);
+
+    SimpleAffinityTask idleTask2(0);
+
+    SimpleAffinityTask idleTask3(0);
+
+    SimpleAffinityTask t1(1);
+
+    SimpleAffinityTask t2(2);
+
+    SimpleAffinityTask t3(3);
+
+    SimpleAffinityTask t4(4);
+
+    SimpleAffinityTask t5(5);
+
+    SimpleAffinityTask t6(6);
+
+    NumaAwareScheduler core0(&idleTask0);
+
+    NumaAwareScheduler core1(&idleTask1);
+
+    NumaAwareScheduler core2(&idleTask2);
+
+    NumaAwareScheduler core3(&idleTask3);
+
+    Scheduler::MultiCore::Domain<Core, 4> domain;
+
+    attachTwoSockets(domain, core0, core1, core2, core3);
+
+    passert(core2.getNode() == 1 && core2.getCacheDomain() == 1 && core2.getCoreIndex() == 2, "The topology is recorded for each core.");
+
+    // Core 1 has one ready task while core 2 on the other node has three
+    core1.ready(&t1);
+
+    core2.ready(&t2);
+
+    core2.ready(&t3);
+
+    core2.ready(&t4);
+
+    passert(core0.next()->getIdentifier() == 1, "Core 0 steals Task 1 from core 1 that shares its cache.");
+
+    passert(t1.getLastCore() == 0, "Task 1 is about to run on core 0.");
+
+    passert(core0.next()->getIdentifier() == 2, "Core 0 crosses the socket since no closer core has any ready task.");
+
+    passert(core3.next()->getIdentifier() == 3, "Core 3 steals Task 3 from core 2 that shares its cache.");
+
+    passert(core0.next() == nullptr, "Core 0 leaves the only ready task on the other node alone.");
+
+    passert(core3.next()->getIdentifier() == 4, "Core 3 steals Task 4 from core 2.");
+
+    // Task 5 may only run on core 2
+    t5.setAffinityMask(1 << 2);
+
+    core2.ready(&t5);
+
+    core2.ready(&t6);
+
+    passert(core3.next()->getIdentifier() == 6, "Core 3 skips Task 5 that must not run on it.");
+
+    passert(core3.next() == nullptr, "Core 3 does not steal Task 5.");
+
+    passert(core2.getLoad() == 1, "Task 5 stays on core 2.");
+
+    passert(core2.next()->getIdentifier() == 5, "Core 2 runs Task 5.");
+
+    // Placement of a task that prefers node 1
+    t6.setHomeNode(1);
+
+    passert(core0.selectCoreFor(&t6, false) == 2, "Task 6 is placed on the first idle core of node 1.");
+
+    core2.ready(&t3);
+
+    passert(core0.selectCoreFor(&t6, false) == 3, "Task 6 is placed on the least loaded core of node 1.");
+
+    // The home node is excluded by the affinity mask of the task
+    t6.setAffinityMask(0b0011);
+
+    passert(core1.selectCoreFor(&t6, false) == 1, "Task 6 is placed on the current core, since node 1 is not allowed.");
+
+    // Placement of a task that ran on core 0 most recently
+    passert(core3.selectCoreFor(&t1, true) == 0, "Task 1 returns to core 0.");
+
+    t1.setAffinityMask(0b1000);
+
+    passert(core3.selectCoreFor(&t1, true) == 3, "Task 1 is placed on core 3, since it must not run on core 0 anymore.");
+
+    // Enqueue a task on another core
+    core3.readyOn(0, &t2);
+
+    passert(core0.getLoad() == 1 && core0.next()->getIdentifier() == 2, "Task 2 is enqueued on core 0.");
+
+    // Wakeup placement of a task that ran on core 2 most recently, while Task 3 is ready on core 2
+    SimpleAffinityTask t7(7);
+
+    t7.setLastCore(2);
+
+    passert(core0.selectWakeupCoreFor(&t7) == 3, "Task 7 is placed on the idle sibling of core 2.");
+
+    passert(core3.selectWakeupCoreFor(&t7) == 3, "Task 7 stays on core 3 that shares the cache with core 2 and is less loaded.");
+
+    core3.ready(&t4);
+
+    passert(core3.selectWakeupCoreFor(&t7) == 2, "Task 7 returns to core 2 if both cores are equally loaded.");
+
+    passert(core0.selectWakeupCoreFor(&t7) == 2, "Task 7 returns to core 2 since no sibling is idle.");
+
+    t7.setLastCore(1);
+
+    passert(core3.selectWakeupCoreFor(&t7) == 1, "Task 7 returns to core 1 that is idle.");
+}
+
+void NumaAwareRoundRobinSchedulerTest::runTaskManagerDelegateTest()
+{
+    // Test Setup
+    SimpleAffinityTask idleTask0(0);
+
+    SimpleAffinityTask idleTask1(0);
+
+    SimpleAffinityTask idleTask2(0);
+
+    SimpleAffinityTask idleTask3(0);
+
+    SimpleAffinityTask t1(1);
+
+    SimpleAffinityTask t2(2);
+
+    SimpleAffinityTask t3(3);
+
+    NumaAwareScheduler core0(&idleTask0);
+
+    NumaAwareScheduler core1(&idleTask1);
+
+    NumaAwareScheduler core2(&idleTask2);
+
+    NumaAwareScheduler core3(&idleTask3);
+
+    Scheduler::MultiCore::Domain<Core, 4> domain;
+
+    attachTwoSockets(domain, core0, core1, core2, core3);
+
+    // Task 1 runs on core 0 and creates Task 2 whose memory resides on node 1
+    t2.setHomeNode(1);
+
+    passert(core0.onTaskCreated(&t1, &t2)->getIdentifier() == 1, "Task 1 keeps running after Task 2 is created.");
+
+    passert(core0.getLoad() == 0 && core2.getLoad() == 1, "Task 2 is placed on core 2.");
+
+    // Task 1 creates Task 3 that may run anywhere
+    passert(core0.onTaskCreated(&t1, &t3)->getIdentifier() == 1, "Task 1 keeps running after Task 3 is created.");
+
+    passert(core0.getLoad() == 1, "Task 3 stays on core 0.");
+
+    // Core 2 is idle and runs Task 2 on a timer interrupt
+    passert(core2.onTimerInterrupt(core2.getIdleTask())->getIdentifier() == 2, "Core 2 runs Task 2.");
+
+    // Task 2 blocks on core 2, and the only ready task is on the other node
+    passert(core2.onTaskBlocked(&t2) == core2.getIdleTask(), "Core 2 does not steal Task 3 across the socket.");
+
+    // Task 1 wakes up Task 2 on core 0
+    passert(core0.onTaskUnblocked(&t1, &t2)->getIdentifier() == 1, "Task 1 keeps running after Task 2 is unblocked.");
+
+    passert(core2.getLoad() == 1, "Task 2 returns to core 2 where it ran most recently.");
+
+    passert(core0.onTaskFinished(&t1)->getIdentifier() == 3, "Core 0 runs Task 3 after Task 1 has finished.");
+
+    passert(core2.onTimerInterrupt(core2.getIdleTask())->getIdentifier() == 2, "Core 2 runs Task 2 again.");
+}
+
+void NumaAwareRoundRobinSchedulerTest::runTimerInterruptDelegateTest()
+{
+    // Test Setup
+    SimpleAffinityTask idleTask0(0);
+
+    SimpleAffinityTask idleTask1(0);
+
+    SimpleAffinityTask t1(1);
+
+    SimpleAffinityTask t2(2);
+
+    SimpleAffinityTask t3(3);
+
+    NumaAwareScheduler core0(&idleTask0);
+
+    NumaAwareScheduler core1(&idleTask1);
+
+    Scheduler::MultiCore::Domain<Core, 2> domain;
+
+    domain.attach(0, core0);
+
+    domain.attach(1, core1);
+
+    // Task 1 may only run on core 1
+    t1.setAffinityMask(0b10);
+
+    passert(core0.onTaskCreated(core0.getIdleTask(), &t1) == core0.getIdleTask(), "Task 1 is placed on core 1.");
+
+    passert(core0.onTaskCreated(core0.getIdleTask(), &t2)->getIdentifier() == 2, "Task 2 runs on core 0.");
+
+    passert(core1.onTimerInterrupt(core1.getIdleTask())->getIdentifier() == 1, "Core 1 runs Task 1.");
+
+    // Task 3 may only run on core 0
+    t3.setAffinityMask(0b01);
+
+    core0.ready(&t3);
+
+    passert(core1.onTimerInterrupt(&t1)->getIdentifier() == 1, "Task 1 keeps running on core 1, since it cannot steal Task 3.");
+
+    passert(core0.onTimerInterrupt(&t2)->getIdentifier() == 3, "Task 3 preempts Task 2 on core 0.");
+
+    // Task 1 blocks on core 1 and is now restricted to core 0
+    passert(core1.onTaskBlocked(&t1)->getIdentifier() == 2, "Core 1 steals Task 2 from core 0.");
+
+    t1.setAffinityMask(0b01);
+
+    passert(core1.onTaskUnblocked(&t2, &t1)->getIdentifier() == 2, "Task 2 keeps running on core 1.");
+
+    passert(core0.getLoad() == 1 && core1.getLoad() == 0, "Task 1 is placed on core 0.");
+
+    passert(core0.onTimerInterrupt(&t3)->getIdentifier() == 1, "Task 1 preempts Task 3 on core 0.");
+}
+
+void NumaAwareRoundRobinSchedulerTest::runGroupOperationsTest()
+{
+    // Test Setup
+    SimpleAffinityTask idleTask0(0);
+
+    SimpleAffinityTask idleTask1(0);
+
+    SimpleAffinityTask t1(1);
+
+    SimpleAffinityTask t2(2);
+
+    SimpleAffinityTask t3(3);
+
+    SimpleAffinityTask t4(4);
+
+    NumaAwareScheduler core0(&idleTask0);
+
+    NumaAwareScheduler core1(&idleTask1);
+
+    Scheduler::MultiCore::Domain<Core, 2> domain;
+
+    domain.attach(0, core0);
+
+    domain.attach(1, core1);
+
+    // Task 1 ran on core 1, while Task 2 and Task 3 have not run yet
+    t1.setLastCore(1);
+
+    // Task 4 is running on core 0 and wakes up Task 1, Task 2 and Task 3
+    passert(core0.onTaskUnblocked(nullptr, &t1) == nullptr, "Task 1 is placed on core 1.");
+
+    passert(core0.onTaskUnblocked(nullptr, &t2) == nullptr, "Task 2 is placed on core 0.");
+
+    passert(core0.onTaskUnblocked(&t4, &t3)->getIdentifier() == 4, "Task 4 keeps running on core 0.");
+
+    passert(core0.getLoad() == 2 && core1.getLoad() == 1, "Task 2 and Task 3 are ready on core 0, while Task 1 is ready on core 1.");
+
+    passert(core1.onTimerInterrupt(core1.getIdleTask())->getIdentifier() == 1, "Core 1 runs Task 1.");
+
+    passert(core0.onTimerInterrupt(&t4)->getIdentifier() == 2, "Task 2 preempts Task 4 on core 0.");
+}
@@ -0,0 +1,28 @@
+//
+//  NumaAwareRoundRobinSchedulerTest.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef NumaAwareRoundRobinSchedulerTest_hpp
+#define NumaAwareRoundRobinSchedulerTest_hpp
+
+#include "SchedulerTest.hpp"
+
+class NumaAwareRoundRobinSchedulerTest: public SchedulerTest
+{
+public:
+    NumaAwareRoundRobinSchedulerTest() : SchedulerTest("NUMA-Aware Round Robin") {}
+
+private:
+    void runPrimitivesTest() override;
+
+    void runTaskManagerDelegateTest() override;
+
+    void runTimerInterruptDelegateTest() override;
+
+    void runGroupOperationsTest() override;
+};
+
+#endif /* NumaAwareRoundRobinSchedulerTest_hpp */
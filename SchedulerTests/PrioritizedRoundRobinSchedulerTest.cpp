@@ -8,11 +8,27 @@
 
 #include "PrioritizedRoundRobinSchedulerTest.hpp"
 #include "SimpleTask.hpp"
+#include "SimpleHeapTask.hpp"
 #include "SampleSchedulers.hpp"
 #include <Debug.hpp>
+#include <type_traits>
+#include <vector>
 
 namespace Schedulers = SampleSchedulers;
 
+/// A scheduler for at most 4 tasks of priority levels up to 9 that never allocates memory dynamically
+using StaticScheduler = Schedulers::StaticPrioritizedRoundRobin<SimpleTask, 4, 9>;
+
+static_assert(Scheduler::Validation::validateStatic<StaticScheduler>());
+
+static_assert(!Scheduler::Validation::StaticPolicySatisfied<Schedulers::PrioritizedRoundRobin<SimpleTask, 9>>,
+              "The policy maker allocates the queue of each priority level dynamically.");
+
+static SimpleTask staticIdleTask(0, 0);
+
+/// The static scheduler lives in the data section and is ready before any constructor runs
+constinit static StaticScheduler staticScheduler(&staticIdleTask);
+
 void PrioritizedRoundRobinSchedulerTest::runPrimitivesTest()
 {
     // Test Setup
@@ -51,6 +67,462 @@ void PrioritizedRoundRobinSchedulerTest::runPrimitivesTest()
 
     // Empty ready queue
     passert(scheduler.next() == nullptr, "Empty ready queue");
+
+    // Remove and reposition tasks
+    scheduler.ready(&t1);
+
+    scheduler.ready(&t2);
+
+    scheduler.ready(&t3);
+
+    scheduler.remove(&t3);
+
+    t2.setPriority(1);
+
+    scheduler.adjustPosition(&t2, 4);
+
+    passert(scheduler.next()->getIdentifier() == 1, "Task 1 is now the first task at priority level 1.");
+
+    passert(scheduler.next()->getIdentifier() == 2, "Task 2 is moved to the end of priority level 1.");
+
+    passert(scheduler.next() == nullptr, "Empty ready queue");
+
+    t2.setPriority(4);
+
+    // Priority levels that span multiple bitmap words
+    SimpleTask t4(4, 63);
+
+    SimpleTask t5(5, 64);
+
+    SimpleTask t6(6, 299);
+
+    Schedulers::PrioritizedRoundRobin<SimpleTask, 299> widerScheduler(&idleTask);
+
+    widerScheduler.ready(&t4);
+
+    widerScheduler.ready(&t1);
+
+    widerScheduler.ready(&t6);
+
+    widerScheduler.ready(&t5);
+
+    passert(widerScheduler.next()->getIdentifier() == 6, "Task 6 has the highest priority.");
+
+    passert(widerScheduler.next()->getIdentifier() == 5, "Task 5 is at the lowest level of the second word.");
+
+    passert(widerScheduler.next()->getIdentifier() == 4, "Task 4 is at the highest level of the first word.");
+
+    passert(widerScheduler.next()->getIdentifier() == 1, "Task 1 has the lowest priority.");
+
+    passert(widerScheduler.next() == nullptr, "Empty ready queue");
+
+    // Sub-policies created eagerly from a static pool
+    using PooledFIFO = Scheduler::PolicyMakers::StaticFIFO<SimpleTask, 10, true>;
+
+    {
+        Scheduler::Policies::PrioritizedMultiQueue::Normal::BitmapArrayMapImp<SimpleTask, PooledFIFO, 9> pooledPolicy;
+
+        pooledPolicy.ready(&t1);
+
+        pooledPolicy.ready(&t3);
+
+        pooledPolicy.ready(&t2);
+
+        passert(pooledPolicy.next()->getIdentifier() == 3, "Task 3 has the highest priority.");
+
+        passert(pooledPolicy.next()->getIdentifier() == 2, "Task 2 has the second highest priority.");
+
+        passert(pooledPolicy.next()->getIdentifier() == 1, "Task 1 has the lowest priority.");
+
+        passert(pooledPolicy.next() == nullptr, "Empty ready queue");
+    }
+
+    // All policies are returned to the pool, so they can be created again
+    Scheduler::Policies::PrioritizedMultiQueue::Normal::ArrayMapImp<SimpleTask, PooledFIFO, 9> reusedPolicy;
+
+    reusedPolicy.ready(&t2);
+
+    passert(reusedPolicy.next()->getIdentifier() == 2, "Task 2 is the only task.");
+
+    passert(reusedPolicy.next() == nullptr, "Empty ready queue");
+
+    // FIFO queues for priority levels 0 to 3 and a heap for priority level 4, all dispatched at compile time
+    using TupleFIFO = Scheduler::Policies::FIFO::Normal::LinkedListImp<SimpleHeapTask>;
+
+    using TupleHeap = Scheduler::Policies::PrioritizedSingleQueue::Normal::StableDaryHeapImp<SimpleHeapTask>;
+
+    Scheduler::Policies::PrioritizedMultiQueue::Normal::TupleMapImp<SimpleHeapTask, TupleFIFO, TupleFIFO, TupleFIFO, TupleFIFO, TupleHeap> tuplePolicy;
+
+    SimpleHeapTask h1(1, 1);
+
+    SimpleHeapTask h2(2, 4);
+
+    SimpleHeapTask h7(7, 4);
+
+    SimpleHeapTask h8(8, 0);
+
+    tuplePolicy.ready(&h1);
+
+    tuplePolicy.ready(&h8);
+
+    tuplePolicy.ready(&h2);
+
+    tuplePolicy.ready(&h7);
+
+    tuplePolicy.remove(&h1);
+
+    h8.setPriority(3);
+
+    tuplePolicy.adjustPosition(&h8, 0);
+
+    passert(tuplePolicy.next()->getIdentifier() == 2, "Task 2 is the first task at the highest priority level.");
+
+    passert(tuplePolicy.next()->getIdentifier() == 7, "Task 7 is the second task at the highest priority level.");
+
+    passert(tuplePolicy.next()->getIdentifier() == 8, "Task 8 is moved to priority level 3.");
+
+    passert(tuplePolicy.next() == nullptr, "Empty ready queue");
+
+    // Priority levels that are sparse in the 32-bit space
+    using LevelFIFO = Scheduler::Policies::FIFO::Normal::LinkedListImp<SimpleTask>;
+
+    SimpleTask t7(7, 4);
+
+    SimpleTask t8(8, 3);
+
+    Scheduler::Policies::PrioritizedMultiQueue::Normal::SparseMapHomoImp<SimpleTask, LevelFIFO> sparsePolicy;
+
+    SimpleTask t9(9, 4000000000);
+
+    SimpleTask t10(10, 70000);
+
+    SimpleTask t11(11, 4000000000);
+
+    sparsePolicy.ready(&t10);
+
+    sparsePolicy.ready(&t9);
+
+    sparsePolicy.ready(&t11);
+
+    sparsePolicy.ready(&t8);
+
+    passert(sparsePolicy.next()->getIdentifier() == 9, "Task 9 is the first task at the highest priority level.");
+
+    sparsePolicy.remove(&t11);
+
+    // Priority level 70000 drains and is created again
+    passert(sparsePolicy.next()->getIdentifier() == 10, "Task 10 is at the second highest priority level.");
+
+    sparsePolicy.ready(&t10);
+
+    passert(sparsePolicy.next()->getIdentifier() == 10, "Task 10 is enqueued again.");
+
+    passert(sparsePolicy.next()->getIdentifier() == 8, "Task 8 has the lowest priority.");
+
+    passert(sparsePolicy.next() == nullptr, "Empty ready queue");
+
+    // Priority levels that switch between the sparse and the dense representations
+    Scheduler::Policies::PrioritizedMultiQueue::Normal::AdaptiveMapHomoImp<SimpleTask, LevelFIFO, 9, 1, 3> adaptivePolicy;
+
+    SimpleTask t12(12, 2);
+
+    SimpleTask t13(13, 2);
+
+    SimpleTask t14(14, 5);
+
+    SimpleTask t15(15, 7);
+
+    SimpleTask t16(16, 5);
+
+    adaptivePolicy.ready(&t12);
+
+    adaptivePolicy.ready(&t13);
+
+    adaptivePolicy.ready(&t14);
+
+    passert(!adaptivePolicy.usesDenseRepresentation() && adaptivePolicy.getNonEmptyLevelCount() == 2, "Two non-empty levels are kept in the sparse representation.");
+
+    passert(adaptivePolicy.getLevelSpread() == 4, "Priority levels 2 to 5 are spanned.");
+
+    adaptivePolicy.ready(&t15);
+
+    passert(adaptivePolicy.usesDenseRepresentation() && adaptivePolicy.getMigrationCount() == 1, "Three non-empty levels switch to the dense representation.");
+
+    adaptivePolicy.ready(&t16);
+
+    passert(adaptivePolicy.getLevelSpread() == 6, "Priority levels 2 to 7 are spanned.");
+
+    passert(adaptivePolicy.next()->getIdentifier() == 15, "Task 15 has the highest priority.");
+
+    passert(adaptivePolicy.usesDenseRepresentation(), "Two non-empty levels stay in the dense representation due to hysteresis.");
+
+    adaptivePolicy.remove(&t14);
+
+    passert(adaptivePolicy.next()->getIdentifier() == 16, "Task 16 is the only task left at priority level 5.");
+
+    passert(!adaptivePolicy.usesDenseRepresentation() && adaptivePolicy.getMigrationCount() == 2, "One non-empty level switches back to the sparse representation.");
+
+    passert(adaptivePolicy.getNonEmptyLevelCount() == 1 && adaptivePolicy.getLevelSpread() == 1, "Only priority level 2 is non-empty.");
+
+    passert(adaptivePolicy.next()->getIdentifier() == 12, "Task 12 keeps its position across both migrations.");
+
+    passert(adaptivePolicy.next()->getIdentifier() == 13, "Task 13 keeps its position across both migrations.");
+
+    passert(adaptivePolicy.next() == nullptr, "Empty ready queue");
+
+    // Priority levels scanned from a contiguous array
+    Scheduler::Policies::PrioritizedSingleQueue::Normal::PackedArrayImp<SimpleTask, 4> packedPolicy;
+
+    passert(packedPolicy.next() == nullptr, "Empty ready queue");
+
+    packedPolicy.ready(&t1);
+
+    packedPolicy.ready(&t2);
+
+    packedPolicy.ready(&t7);
+
+    packedPolicy.ready(&t3);
+
+    packedPolicy.remove(&t3);
+
+    passert(packedPolicy.next()->getIdentifier() == 2, "Task 2 is the first task at the highest priority level.");
+
+    packedPolicy.ready(&t2);
+
+    t1.setPriority(4);
+
+    packedPolicy.adjustPosition(&t1, 1);
+
+    passert(packedPolicy.next()->getIdentifier() == 7, "Task 7 is now the first task at the highest priority level.");
+
+    passert(packedPolicy.next()->getIdentifier() == 2, "Task 2 is enqueued again before Task 1 is repositioned.");
+
+    passert(packedPolicy.next()->getIdentifier() == 1, "Task 1 is moved to the end of the highest priority level.");
+
+    passert(packedPolicy.next() == nullptr, "Empty ready queue");
+
+    t1.setPriority(1);
+
+    // Tasks that embed the compact scheduling entity as their first base class
+    struct EntityTask: public Scheduler::SchedulingEntity<EntityTask>
+    {
+        uint32_t identifier;
+
+        /// Emulates the rest of a large task control block
+        uint8_t context[512];
+
+        EntityTask(uint32_t identifier, uint32_t priority) : SchedulingEntity(priority), identifier(identifier), context() {}
+    };
+
+    static_assert(alignof(EntityTask) == 32, "The scheduling entity aligns the task to half of a cache line.");
+
+    EntityTask e1(1, 1);
+
+    EntityTask e2(2, 9);
+
+    EntityTask e3(3, 4);
+
+    Scheduler::Policies::PrioritizedSingleQueue::Normal::LinkedListImp<EntityTask> entityListPolicy;
+
+    Scheduler::Policies::PrioritizedSingleQueue::Normal::DaryHeapImp<EntityTask> entityHeapPolicy;
+
+    for (EntityTask* task : {&e1, &e2, &e3})
+    {
+        entityListPolicy.ready(task);
+
+        entityHeapPolicy.ready(task);
+    }
+
+    e1.setPriority(10);
+
+    entityHeapPolicy.adjustPosition(&e1, 1u);
+
+    passert(entityHeapPolicy.next()->identifier == 1, "Task 1 is moved to the root of the heap.");
+
+    passert(entityHeapPolicy.next()->identifier == 2, "Task 2 has the second highest priority.");
+
+    passert(entityHeapPolicy.next()->identifier == 3, "Task 3 has the lowest priority.");
+
+    entityListPolicy.adjustPosition(&e1, 1u);
+
+    passert(entityListPolicy.next()->identifier == 1, "Task 1 is moved to the front of the list.");
+
+    passert(entityListPolicy.next()->identifier == 2, "Task 2 has the second highest priority.");
+
+    passert(entityListPolicy.next()->identifier == 3, "Task 3 has the lowest priority.");
+
+    passert(entityListPolicy.next() == nullptr, "Empty ready queue");
+
+    e1.allocateTicks(1);
+
+    e1.tick();
+
+    e1.tick();
+
+    passert(e1.hasUsedUpTimeAllotment() && e1.getRemainingTicks() == 0, "Remaining ticks saturate at zero.");
+
+    // Priority levels found by scanning an unsorted array that spans several blocks of keys
+    Scheduler::Policies::PrioritizedSingleQueue::Normal::UnsortedArrayImp<SimpleTask, 12> unsortedPolicy;
+
+    passert(unsortedPolicy.next() == nullptr, "Empty ready queue");
+
+    std::vector<SimpleTask> unsortedTasks;
+
+    unsortedTasks.reserve(12);
+
+    for (uint32_t index = 0; index < 12; index += 1)
+    {
+        unsortedTasks.emplace_back(100 + index, (index * 7) % 12);
+    }
+
+    for (SimpleTask& task : unsortedTasks)
+    {
+        unsortedPolicy.ready(&task);
+    }
+
+    // Task 105 at priority level 11 is removed, while Task 111 is raised from priority level 5
+    unsortedPolicy.remove(&unsortedTasks[5]);
+
+    unsortedTasks[11].setPriority(12);
+
+    unsortedPolicy.adjustPosition(&unsortedTasks[11], 5);
+
+    passert(unsortedPolicy.next()->getIdentifier() == 111, "Task 111 is raised to the highest priority level.");
+
+    for (uint32_t priority = 10; priority > 0; priority -= 1)
+    {
+        // Guard: No task is left at the previous priority level of Task 111
+        if (priority == 5)
+        {
+            continue;
+        }
+
+        SimpleTask* task = unsortedPolicy.next();
+
+        passert(task->getPriority() == priority, "Tasks are dequeued in the descending order of priority levels.");
+    }
+
+    passert(unsortedPolicy.next()->getPriority() == 0, "Task 100 has the lowest priority.");
+
+    passert(unsortedPolicy.next() == nullptr, "Empty ready queue");
+
+    // Scanners of signed and wide priority levels
+    Scheduler::Containers::PriorityArray<int32_t, 9> signedArray;
+
+    signedArray.push(-5);
+
+    signedArray.push(-3);
+
+    signedArray.push(-7);
+
+    passert(signedArray.findHighest() == 1, "Priority level -3 is the highest one.");
+
+    signedArray.remove(1);
+
+    passert(signedArray.get(1) == -7 && signedArray.findHighest() == 0, "Priority level -7 is moved into the slot of -3.");
+
+    Scheduler::Containers::PriorityArray<uint64_t, 4> wideArray;
+
+    wideArray.push(1);
+
+    wideArray.push(UINT64_MAX);
+
+    wideArray.push(UINT64_MAX);
+
+    passert(wideArray.findHighest() == 1, "The first occurrence of the highest priority level is found.");
+
+    // Snapshots of a stable heap keep the order of ties and can be loaded into another policy
+    using Heap = Scheduler::Policies::PrioritizedSingleQueue::Normal::StableDaryHeapImp<SimpleHeapTask>;
+
+    static Scheduler::Containers::TaskArena<SimpleHeapTask, 8> arena;
+
+    Scheduler::Persistence::ArenaCodec codec(arena);
+
+    Scheduler::Containers::TaskHandle handles[4] = {arena.create(11, 5), arena.create(12, 7), arena.create(13, 5), arena.create(14, 2)};
+
+    Heap source;
+
+    for (auto handle : handles)
+    {
+        arena.get(handle)->allocateTicks(handle.value);
+
+        source.ready(arena.get(handle));
+    }
+
+    std::byte image[Scheduler::Persistence::getSnapshotSize(4)];
+
+    passert(Scheduler::Persistence::snapshot(source, image, codec) == sizeof(image), "The snapshot stores four records.");
+
+    uint32_t order[4] = {12, 11, 13, 14};
+
+    for (uint32_t identifier : order)
+    {
+        passert(source.next()->getIdentifier() == identifier, "The snapshot leaves the order of the source policy unchanged.");
+    }
+
+    passert(source.next() == nullptr, "Empty ready queue");
+
+    // Task 13 is destroyed and the priority level and the ticks of the others are changed before they are restored
+    arena.destroy(handles[2]);
+
+    arena.get(handles[0])->setPriority(1);
+
+    arena.get(handles[1])->allocateTicks(0);
+
+    Heap target;
+
+    passert(Scheduler::Persistence::restore(target, image, codec), "The snapshot is well-formed.");
+
+    passert(target.next() == arena.get(handles[1]) && arena.get(handles[1])->getRemainingTicks() == handles[1].value, "Task 12 is restored with its ticks.");
+
+    passert(target.next() == arena.get(handles[0]) && arena.get(handles[0])->getPriority() == 5, "Task 11 is restored with its priority level.");
+
+    passert(target.next() == arena.get(handles[3]) && target.next() == nullptr, "Task 13 has been skipped since it no longer exists.");
+
+    // Malformed snapshots are rejected
+    image[0] = std::byte{0};
+
+    passert(!Scheduler::Persistence::restore(target, image, codec), "The magic number does not match.");
+
+    passert(!Scheduler::Persistence::restore(target, std::span<const std::byte>(image, 8), codec), "The header is truncated.");
+
+    passert(target.next() == nullptr, "Rejected snapshots do not change the policy.");
+
+    arena.destroy(handles[0]);
+
+    arena.destroy(handles[1]);
+
+    arena.destroy(handles[3]);
+
+    // Policies that map priority levels to virtual policies visit them through the virtual hook
+    Scheduler::Policies::PrioritizedMultiQueue::Normal::BitmapArrayMapImp<SimpleHeapTask, Scheduler::PolicyMakers::DynamicFIFO<SimpleHeapTask>, 9> levels;
+
+    Scheduler::Containers::TaskHandle leveled[3] = {arena.create(31, 2), arena.create(32, 9), arena.create(33, 2)};
+
+    for (auto handle : leveled)
+    {
+        levels.ready(arena.get(handle));
+    }
+
+    std::byte levelImage[Scheduler::Persistence::getSnapshotSize(3)];
+
+    passert(Scheduler::Persistence::snapshot(levels, levelImage, codec) == sizeof(levelImage), "The snapshot stores three records.");
+
+    Heap restored;
+
+    passert(Scheduler::Persistence::restore(restored, levelImage, codec), "The snapshot is well-formed.");
+
+    uint32_t levelOrder[3] = {32, 31, 33};
+
+    for (uint32_t identifier : levelOrder)
+    {
+        passert(levels.next()->getIdentifier() == identifier && restored.next()->getIdentifier() == identifier, "Both policies serve the tasks in the recorded order.");
+    }
+
+    for (auto handle : leveled)
+    {
+        arena.destroy(handle);
+    }
 }
 
 void PrioritizedRoundRobinSchedulerTest::runTaskManagerDelegateTest()
@@ -106,6 +578,49 @@ void PrioritizedRoundRobinSchedulerTest::runTaskManagerDelegateTest()
     // Task 3 yielded
     passert(scheduler.onTaskYielded(&t3)->getIdentifier() == 3,
             "Task 3 resumes after it yields.");
+
+    // Static Variant
+    SimpleTask t4(4, 4);
+
+    passert(staticScheduler.onTaskCreated(&staticIdleTask, &t2) == &t2, "Task 2 preempts the idle task.");
+
+    passert(staticScheduler.onTaskCreated(&t2, &t1) == &t2, "Task 1 cannot preempt Task 2 due to a lower priority.");
+
+    passert(staticScheduler.onTaskCreated(&t2, &t4) == &t2, "Task 4 cannot preempt Task 2 due to the same priority.");
+
+    passert(staticScheduler.onTaskCreated(&t2, &t3) == &t3, "Task 3 preempts Task 2 due to a higher priority.");
+
+    passert(staticScheduler.onTaskFinished(&t3) == &t4, "Task 4 runs in FIFO order after Task 3 has finished.");
+
+    passert(staticScheduler.onTimerInterrupt(&t4) == &t2, "Task 2 and Task 4 run in a round-robin fashion.");
+
+    passert(staticScheduler.onTaskFinished(&t2) == &t4 && staticScheduler.onTaskFinished(&t4) == &t1, "Task 1 runs after Task 2 and Task 4.");
+
+    passert(staticScheduler.onTaskFinished(&t1) == &staticIdleTask, "Idle task runs after all tasks have finished.");
+
+    // The ring buffer wraps around and keeps tasks in order when a task is removed
+    Scheduler::Policies::FIFO::Normal::RingBufferImp<SimpleTask, 4> ring;
+
+    static_assert(std::is_trivially_destructible_v<decltype(ring)>, "The ring buffer does not own any memory.");
+
+    SimpleTask* tasks[] = {&t1, &t2, &t3, &t4};
+
+    for (uint32_t round = 0; round < 3; round += 1)
+    {
+        for (SimpleTask* task : tasks)
+        {
+            ring.ready(task);
+        }
+
+        ring.remove(&t2);
+
+        passert(ring.size() == 3 && ring.next() == &t1 && ring.next() == &t3 && ring.next() == &t4 && ring.next() == nullptr,
+                "Tasks keep their order after Task 2 has been removed.");
+
+        ring.ready(&t2);
+
+        passert(ring.next() == &t2, "The buffer head advances across rounds.");
+    }
 }
 
 void PrioritizedRoundRobinSchedulerTest::runTimerInterruptDelegateTest()
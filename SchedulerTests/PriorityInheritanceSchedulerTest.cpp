@@ -0,0 +1,208 @@
+//
+//  PriorityInheritanceSchedulerTest.cpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#include "PriorityInheritanceSchedulerTest.hpp"
+#include "SimpleInheritableTask.hpp"
+#include "SampleSchedulers.hpp"
+#include <Debug.hpp>
+
+namespace Schedulers = SampleSchedulers;
+
+using Mutex = Scheduler::PriorityInheritanceMutex<SimpleInheritableTask>;
+
+static_assert(Scheduler::Validation::validate<Schedulers::PriorityInheritance<SimpleInheritableTask>>());
+
+void PriorityInheritanceSchedulerTest::runPrimitivesTest()
+{
+    // Test Setup
+    SimpleInheritableTask low(1, 1);
+
+    SimpleInheritableTask medium(2, 5);
+
+    SimpleInheritableTask high(3, 9);
+
+    Mutex mutex;
+
+    Mutex ceiling(7);
+
+    Scheduler::Policies::PriorityInheritance::PolicyWithPriorityInheritance<Scheduler::Policies::PrioritizedSingleQueue::Normal::StableDaryHeapImp<SimpleInheritableTask>> policy;
+
+    // Task 1 holds the mutex and is ready along with Task 2
+    passert(policy.tryAcquire(&low, &mutex), "The mutex is unlocked.");
+
+    passert(mutex.getOwner() == &low && low.getHeldMutexes() == &mutex, "Task 1 holds the mutex.");
+
+    policy.ready(&low);
+
+    policy.ready(&medium);
+
+    passert(low.isInReadyQueue() && medium.isInReadyQueue(), "Both tasks are ready.");
+
+    // Task 3 waits for the mutex and lends its priority to Task 1
+    passert(!policy.tryAcquire(&high, &mutex), "The mutex is held by Task 1.");
+
+    policy.wait(&high, &mutex);
+
+    passert(high.getBlockingMutex() == &mutex && mutex.hasWaiters(), "Task 3 waits for the mutex.");
+
+    passert(low.getPriority() == 9 && low.getBasePriority() == 1, "Task 1 inherits the priority of Task 3.");
+
+    passert(policy.next() == &low, "Task 1 now runs before Task 2.");
+
+    passert(!low.isInReadyQueue(), "Task 1 has been dequeued.");
+
+    // Task 1 releases the mutex, which is handed over to Task 3
+    passert(policy.release(&low, &mutex) == &high, "Task 3 receives the mutex.");
+
+    passert(low.getPriority() == 1 && low.getHeldMutexes() == nullptr, "Task 1 returns to its base priority.");
+
+    passert(mutex.getOwner() == &high && high.getBlockingMutex() == nullptr && !mutex.hasWaiters(), "Task 3 holds the mutex.");
+
+    passert(policy.release(&high, &mutex) == nullptr, "No task waits for the mutex.");
+
+    // Task 1 runs at the ceiling while it holds the mutex
+    passert(policy.tryAcquire(&low, &ceiling), "The mutex is unlocked.");
+
+    passert(low.getPriority() == 7, "Task 1 runs at the ceiling priority.");
+
+    passert(policy.release(&low, &ceiling) == nullptr, "No task waits for the mutex.");
+
+    passert(low.getPriority() == 1, "Task 1 returns to its base priority.");
+
+    passert(policy.next() == &medium, "Task 2 is the only ready task.");
+
+    passert(policy.next() == nullptr, "Empty ready queue");
+}
+
+void PriorityInheritanceSchedulerTest::runTaskManagerDelegateTest()
+{
+    // Test Setup
+    SimpleInheritableTask idleTask(0, 0);
+
+    SimpleInheritableTask low(1, 1);
+
+    SimpleInheritableTask medium(2, 5);
+
+    SimpleInheritableTask high(3, 9);
+
+    Mutex mutex;
+
+    Schedulers::PriorityInheritance<SimpleInheritableTask> scheduler(&idleTask);
+
+    passert(scheduler.onTaskCreated(&idleTask, &low) == &low, "Task 1 runs.");
+
+    passert(scheduler.onMutexLocked(&low, &mutex) == &low, "Task 1 locks the mutex.");
+
+    passert(scheduler.onTaskCreated(&low, &high) == &high, "Task 3 preempts Task 1.");
+
+    // Task 3 blocks on the mutex and Task 1 inherits its priority
+    passert(scheduler.onMutexLocked(&high, &mutex) == &low, "Task 1 runs while Task 3 waits for the mutex.");
+
+    passert(low.getPriority() == 9, "Task 1 inherits the priority of Task 3.");
+
+    // Task 2 cannot preempt Task 1 while Task 3 waits for the mutex
+    passert(scheduler.onTaskCreated(&low, &medium) == &low, "Task 1 keeps running after Task 2 is created.");
+
+    // Task 1 releases the mutex and loses its inherited priority
+    passert(scheduler.onMutexUnlocked(&low, &mutex) == &high, "Task 3 receives the mutex and runs.");
+
+    passert(low.getPriority() == 1, "Task 1 returns to its base priority.");
+
+    passert(scheduler.onMutexUnlocked(&high, &mutex) == &high, "Task 3 keeps running after unlocking the mutex.");
+
+    passert(scheduler.onTaskFinished(&high) == &medium, "Task 2 runs after Task 3 has finished.");
+
+    passert(scheduler.onTaskFinished(&medium) == &low, "Task 1 runs after Task 2 has finished.");
+
+    passert(scheduler.onTaskFinished(&low) == &idleTask, "Idle task runs after all tasks have finished.");
+}
+
+void PriorityInheritanceSchedulerTest::runTimerInterruptDelegateTest()
+{
+    // Test Setup
+    SimpleInheritableTask idleTask(0, 0);
+
+    SimpleInheritableTask low(1, 1);
+
+    SimpleInheritableTask medium(2, 5);
+
+    Mutex ceiling(7);
+
+    Schedulers::PriorityInheritance<SimpleInheritableTask> scheduler(&idleTask);
+
+    passert(scheduler.onTaskCreated(&idleTask, &low) == &low, "Task 1 runs.");
+
+    // Task 1 runs at the ceiling priority as soon as it locks the mutex
+    passert(scheduler.onMutexLocked(&low, &ceiling) == &low, "Task 1 locks the mutex.");
+
+    passert(scheduler.onTaskCreated(&low, &medium) == &low, "Task 2 cannot preempt Task 1 running at the ceiling priority.");
+
+    passert(scheduler.onTimerInterrupt(&low) == &low, "Task 1 keeps running on a timer interrupt.");
+
+    // Task 1 releases the mutex and Task 2 now has a higher priority
+    passert(scheduler.onMutexUnlocked(&low, &ceiling) == &medium, "Task 2 preempts Task 1 once it leaves the ceiling priority.");
+
+    passert(scheduler.onTaskFinished(&medium) == &low, "Task 1 runs after Task 2 has finished.");
+}
+
+void PriorityInheritanceSchedulerTest::runGroupOperationsTest()
+{
+    // Test Setup
+    SimpleInheritableTask idleTask(0, 0);
+
+    SimpleInheritableTask low(1, 1);
+
+    SimpleInheritableTask medium(2, 5);
+
+    SimpleInheritableTask high(3, 9);
+
+    Mutex m1;
+
+    Mutex m2;
+
+    Schedulers::PriorityInheritance<SimpleInheritableTask> scheduler(&idleTask);
+
+    // Task 1 holds M1 while Task 2 holds M2 and waits for M1
+    passert(scheduler.onTaskCreated(&idleTask, &low) == &low, "Task 1 runs.");
+
+    passert(scheduler.onMutexLocked(&low, &m1) == &low, "Task 1 locks M1.");
+
+    passert(scheduler.onTaskCreated(&low, &medium) == &medium, "Task 2 preempts Task 1.");
+
+    passert(scheduler.onMutexLocked(&medium, &m2) == &medium, "Task 2 locks M2.");
+
+    passert(scheduler.onMutexLocked(&medium, &m1) == &low, "Task 1 runs while Task 2 waits for M1.");
+
+    passert(low.getPriority() == 5, "Task 1 inherits the priority of Task 2.");
+
+    // Task 3 waits for M2, so its priority is propagated along the chain to Task 1
+    passert(scheduler.onTaskCreated(&low, &high) == &high, "Task 3 preempts Task 1.");
+
+    passert(scheduler.onMutexLocked(&high, &m2) == &low, "Task 1 runs while Task 3 waits for M2.");
+
+    passert(medium.getPriority() == 9 && low.getPriority() == 9, "Task 2 and Task 1 inherit the priority of Task 3.");
+
+    // Task 1 releases M1, which is handed over to Task 2
+    passert(scheduler.onMutexUnlocked(&low, &m1) == &medium, "Task 2 receives M1 and runs.");
+
+    passert(low.getPriority() == 1 && medium.getPriority() == 9, "Task 2 still inherits the priority of Task 3 through M2.");
+
+    // Task 2 releases M2, which is handed over to Task 3
+    passert(scheduler.onMutexUnlocked(&medium, &m2) == &high, "Task 3 receives M2 and runs.");
+
+    passert(medium.getPriority() == 5, "Task 2 returns to its base priority while it still holds M1.");
+
+    passert(scheduler.onMutexUnlocked(&high, &m2) == &high, "Task 3 keeps running after unlocking M2.");
+
+    passert(scheduler.onTaskFinished(&high) == &medium, "Task 2 runs after Task 3 has finished.");
+
+    passert(scheduler.onMutexUnlocked(&medium, &m1) == &medium, "Task 2 keeps running after unlocking M1.");
+
+    passert(scheduler.onTaskFinished(&medium) == &low, "Task 1 runs after Task 2 has finished.");
+
+    passert(scheduler.onTaskFinished(&low) == &idleTask, "Idle task runs after all tasks have finished.");
+}
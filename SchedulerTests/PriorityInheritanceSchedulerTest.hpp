@@ -0,0 +1,28 @@
+//
+//  PriorityInheritanceSchedulerTest.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef PriorityInheritanceSchedulerTest_hpp
+#define PriorityInheritanceSchedulerTest_hpp
+
+#include "SchedulerTest.hpp"
+
+class PriorityInheritanceSchedulerTest: public SchedulerTest
+{
+public:
+    PriorityInheritanceSchedulerTest() : SchedulerTest("Priority Inheritance") {}
+
+private:
+    void runPrimitivesTest() override;
+
+    void runTaskManagerDelegateTest() override;
+
+    void runTimerInterruptDelegateTest() override;
+
+    void runGroupOperationsTest() override;
+};
+
+#endif /* PriorityInheritanceSchedulerTest_hpp */
@@ -0,0 +1,226 @@
+//
+//  RateMonotonicSchedulerTest.cpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#include "RateMonotonicSchedulerTest.hpp"
+#include "SimplePeriodicTask.hpp"
+#include "SampleSchedulers.hpp"
+#include <Debug.hpp>
+#include <span>
+
+namespace Schedulers = SampleSchedulers;
+
+using RateMonotonicScheduler = Schedulers::RateMonotonic<SimplePeriodicTask, 63>;
+
+static_assert(Scheduler::Validation::validate<RateMonotonicScheduler>());
+
+static_assert(Scheduler::Validation::validate<Schedulers::RateMonotonic<SimplePeriodicTask, 63, Scheduler::Policies::RateMonotonic::HyperbolicBound>>());
+
+void RateMonotonicSchedulerTest::runPrimitivesTest()
+{
+    // Periods are mapped to priority levels
+    Scheduler::Policies::RateMonotonic::LinearPeriodBuckets<63> buckets;
+
+    passert(buckets(1u) == 63 && buckets(2u) == 62 && buckets(62u) == 2, "A shorter period has a higher priority level.");
+
+    passert(buckets(63u) == 1 && buckets(1000u) == 1, "Long periods share the lowest priority level.");
+
+    Scheduler::Policies::RateMonotonic::LinearPeriodBuckets<8, 10> wideBuckets;
+
+    passert(wideBuckets(1u) == 8 && wideBuckets(10u) == 8 && wideBuckets(11u) == 7, "Periods are divided into buckets of the given width.");
+
+    // Liu and Layland bound
+    Scheduler::Policies::RateMonotonic::LiuLaylandBound liuLayland;
+
+    passert(liuLayland.tryAdmit(0.5), "A single task is schedulable.");
+
+    passert(liuLayland.tryAdmit(0.3), "The total utilization 0.8 is below the bound 0.828 of two tasks.");
+
+    passert(!liuLayland.tryAdmit(0.1), "The total utilization 0.9 exceeds the bound 0.780 of three tasks.");
+
+    passert(liuLayland.size() == 2, "The rejected task is not counted.");
+
+    liuLayland.release(0.3);
+
+    passert(liuLayland.size() == 1 && liuLayland.getUtilization() > 0.49 && liuLayland.getUtilization() < 0.51, "The released task is forgotten.");
+
+    liuLayland.release(0.5);
+
+    passert(liuLayland.size() == 0 && liuLayland.getUtilization() == 0, "The bound is reset once no task is admitted.");
+
+    // The hyperbolic bound admits a task set rejected by the Liu and Layland bound
+    Scheduler::Policies::RateMonotonic::HyperbolicBound hyperbolic;
+
+    passert(liuLayland.tryAdmit(0.6) && !liuLayland.tryAdmit(0.24), "The total utilization 0.84 exceeds the bound 0.828 of two tasks.");
+
+    passert(hyperbolic.tryAdmit(0.6) && hyperbolic.tryAdmit(0.24), "The product 1.6 * 1.24 does not exceed 2.");
+
+    passert(!hyperbolic.tryAdmit(0.01), "The product 1.6 * 1.24 * 1.01 exceeds 2.");
+
+    // Policy
+    Scheduler::Policies::RateMonotonic::PolicyWithAdmissionControl<
+            Scheduler::Policies::PrioritizedMultiQueue::Normal::BitmapArrayMapImp<SimplePeriodicTask, Scheduler::PolicyMakers::DynamicFIFO<SimplePeriodicTask>, 63>,
+            Scheduler::Policies::RateMonotonic::LiuLaylandBound,
+            Scheduler::Policies::RateMonotonic::LinearPeriodBuckets<63>> policy;
+
+    SimplePeriodicTask t1(1, 10, 2);
+
+    SimplePeriodicTask t2(2, 20, 4);
+
+    SimplePeriodicTask t3(3, 5, 1);
+
+    SimplePeriodicTask t4(4, 40, 30);
+
+    SimplePeriodicTask t5(5, 0, 0);
+
+    passert(policy.admit(&t1) && policy.admit(&t2) && policy.admit(&t3), "The total utilization 0.6 is below the bound.");
+
+    passert(!policy.admit(&t4), "The total utilization 1.35 exceeds the bound.");
+
+    passert(!policy.admit(&t5), "A task must have a non-zero period.");
+
+    passert(policy.getNumberOfAdmittedTasks() == 3, "Three tasks have been admitted.");
+
+    passert(t3.getPriority() > t1.getPriority() && t1.getPriority() > t2.getPriority(), "Priority levels are assigned by periods.");
+
+    policy.ready(&t2);
+
+    policy.ready(&t1);
+
+    policy.ready(&t3);
+
+    passert(policy.next()->getIdentifier() == 3, "Task 3 has the shortest period.");
+
+    passert(policy.next()->getIdentifier() == 1, "Task 1 has the second shortest period.");
+
+    passert(policy.next()->getIdentifier() == 2, "Task 2 has the longest period.");
+
+    passert(policy.next() == nullptr, "Empty ready queue");
+
+    policy.release(&t3);
+
+    passert(policy.getNumberOfAdmittedTasks() == 2, "Task 3 has been released.");
+
+    passert(policy.admit(&t3), "Task 3 can be admitted again.");
+
+    // Distinct periods that share a priority level are rejected, since they would not be served in rate-monotonic order
+    Scheduler::Policies::RateMonotonic::PolicyWithAdmissionControl<
+            Scheduler::Policies::PrioritizedMultiQueue::Normal::BitmapArrayMapImp<SimplePeriodicTask, Scheduler::PolicyMakers::DynamicFIFO<SimplePeriodicTask>, 8>,
+            Scheduler::Policies::RateMonotonic::LiuLaylandBound,
+            Scheduler::Policies::RateMonotonic::LinearPeriodBuckets<8, 10>> bucketed;
+
+    SimplePeriodicTask t6(6, 12, 1);
+
+    SimplePeriodicTask t7(7, 15, 1);
+
+    SimplePeriodicTask t8(8, 12, 1);
+
+    SimplePeriodicTask t9(9, 500, 1);
+
+    SimplePeriodicTask t10(10, 900, 1);
+
+    passert(bucketed.admit(&t6) && !bucketed.admit(&t7), "Periods 12 and 15 fall into the same bucket.");
+
+    passert(bucketed.admit(&t8) && t8.getPriority() == t6.getPriority(), "Tasks of the same period share a priority level.");
+
+    passert(bucketed.admit(&t9) && !bucketed.admit(&t10), "Periods 500 and 900 are both clamped to the lowest priority level.");
+
+    bucketed.release(&t6);
+
+    passert(!bucketed.admit(&t7), "Task 8 still occupies the bucket.");
+
+    bucketed.release(&t8);
+
+    passert(bucketed.admit(&t7), "The bucket can be reused once it has no admitted task.");
+}
+
+void RateMonotonicSchedulerTest::runTaskManagerDelegateTest()
+{
+    // Test Setup
+    SimplePeriodicTask idleTask(0, 1, 0);
+
+    SimplePeriodicTask t1(1, 10, 2);
+
+    SimplePeriodicTask t2(2, 20, 4);
+
+    SimplePeriodicTask t3(3, 5, 1);
+
+    SimplePeriodicTask t4(4, 40, 30);
+
+    RateMonotonicScheduler scheduler(&idleTask);
+
+    passert(scheduler.onTaskCreated(&idleTask, &t2)->getIdentifier() == 2, "Task 2 runs.");
+
+    passert(scheduler.onTaskCreated(&t2, &t1)->getIdentifier() == 1, "Task 1 preempts Task 2.");
+
+    passert(scheduler.onTaskCreated(&t1, &t3)->getIdentifier() == 3 && scheduler.getLastRejectedTask() == nullptr, "Task 3 is admitted and preempts Task 1.");
+
+    passert(scheduler.onTaskCreated(&t3, &t4) == &t3 && scheduler.getLastRejectedTask() == &t4, "Task 4 is rejected and Task 3 keeps running.");
+
+    passert(scheduler.getNumberOfAdmittedTasks() == 3, "Task 4 has not been admitted.");
+
+    // Task 3 finishes its job and waits for its next period
+    passert(scheduler.onTaskBlocked(&t3)->getIdentifier() == 1, "Task 1 runs.");
+
+    passert(scheduler.onTaskBlocked(&t1)->getIdentifier() == 2, "Task 2 runs.");
+
+    // Task 3 is released again
+    passert(scheduler.onTaskUnblocked(&t2, &t3)->getIdentifier() == 3, "Task 3 preempts Task 2.");
+
+    // Task 3 leaves the task set
+    passert(scheduler.onTaskFinished(&t3)->getIdentifier() == 2, "Task 2 runs.");
+
+    passert(scheduler.getNumberOfAdmittedTasks() == 2, "Task 3 has been released.");
+
+    passert(scheduler.onTaskFinished(&t2) == &idleTask, "The idle task runs.");
+}
+
+void RateMonotonicSchedulerTest::runTimerInterruptDelegateTest()
+{
+    // Test Setup
+    SimplePeriodicTask idleTask(0, 1, 0);
+
+    SimplePeriodicTask t1(1, 10, 2);
+
+    SimplePeriodicTask t2(2, 20, 4);
+
+    RateMonotonicScheduler scheduler(&idleTask);
+
+    passert(scheduler.onTaskCreated(&idleTask, &t2)->getIdentifier() == 2, "Task 2 runs.");
+
+    passert(scheduler.admit(&t1), "Task 1 is admitted.");
+
+    scheduler.ready(&t1);
+
+    passert(scheduler.onTimerInterrupt(&t2)->getIdentifier() == 2, "Jobs are preempted by releases rather than timer interrupts.");
+}
+
+void RateMonotonicSchedulerTest::runGroupOperationsTest()
+{
+    // Test Setup
+    SimplePeriodicTask idleTask(0, 1, 0);
+
+    SimplePeriodicTask t1(1, 10, 2);
+
+    SimplePeriodicTask t2(2, 20, 4);
+
+    SimplePeriodicTask t3(3, 5, 1);
+
+    RateMonotonicScheduler scheduler(&idleTask);
+
+    passert(scheduler.admit(&t1) && scheduler.admit(&t2) && scheduler.admit(&t3), "All tasks are admitted.");
+
+    // Task 2 and Task 3 are released at the same time while Task 1 is running
+    SimplePeriodicTask* released[] = {&t2, &t3};
+
+    passert(scheduler.onTasksUnblocked(&t1, std::span<SimplePeriodicTask* const>(released))->getIdentifier() == 3, "Task 3 preempts Task 1.");
+
+    passert(scheduler.onTaskBlocked(&t3)->getIdentifier() == 1, "Task 1 runs.");
+
+    passert(scheduler.onTaskBlocked(&t1)->getIdentifier() == 2, "Task 2 runs.");
+
+    passert(scheduler.onTaskBlocked(&t2) == &idleTask, "The idle task runs.");
+}
@@ -0,0 +1,28 @@
+//
+//  RateMonotonicSchedulerTest.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef RateMonotonicSchedulerTest_hpp
+#define RateMonotonicSchedulerTest_hpp
+
+#include "SchedulerTest.hpp"
+
+class RateMonotonicSchedulerTest: public SchedulerTest
+{
+public:
+    RateMonotonicSchedulerTest() : SchedulerTest("Rate Monotonic") {}
+
+private:
+    void runPrimitivesTest() override;
+
+    void runTaskManagerDelegateTest() override;
+
+    void runTimerInterruptDelegateTest() override;
+
+    void runGroupOperationsTest() override;
+};
+
+#endif /* RateMonotonicSchedulerTest_hpp */
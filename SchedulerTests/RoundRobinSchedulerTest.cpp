@@ -8,19 +8,205 @@
 
 #include "RoundRobinSchedulerTest.hpp"
 #include "SimpleTask.hpp"
+#include "SimpleConcurrentTask.hpp"
+#include "SimpleInstrumentedTask.hpp"
 #include "SampleSchedulers.hpp"
 #include <Debug.hpp>
+#include <thread>
+#include <vector>
 
 namespace Schedulers = SampleSchedulers;
 
+/// A clock that is advanced by the test manually
+struct ManualClock
+{
+    static inline uint64_t time = 0;
+
+    static uint64_t now()
+    {
+        return time;
+    }
+};
+
+/// A clock that advances by a fixed step every time it is read
+struct TickingClock
+{
+    static inline uint64_t time = 0;
+
+    static inline uint64_t step = 1;
+
+    static uint64_t now()
+    {
+        time += step;
+
+        return time;
+    }
+};
+
 void RoundRobinSchedulerTest::runPrimitivesTest()
 {
-    pinfo("Same as FIFO scheduler.");
+    // Concurrent Variant
+    SimpleConcurrentTask idleTask(0);
+
+    SimpleConcurrentTask t1(1);
+
+    SimpleConcurrentTask t2(2);
+
+    SimpleConcurrentTask t3(3);
+
+    Schedulers::ConcurrentRoundRobin<SimpleConcurrentTask> scheduler(&idleTask);
+
+    passert(scheduler.next() == nullptr, "Empty queue");
+
+    scheduler.ready(&t1);
+
+    scheduler.ready(&t2);
+
+    passert(scheduler.next() == &t1, "Task 1 is the oldest task.");
+
+    scheduler.ready(&t3);
+
+    passert(scheduler.next() == &t2, "Task 2 is dequeued before Task 3.");
+
+    passert(scheduler.next() == &t3, "Task 3 is the last task.");
+
+    passert(scheduler.next() == nullptr, "Empty queue");
+
+    // Several threads enqueue tasks while the current thread dequeues them
+    static constexpr uint32_t kNumProducers = 4;
+
+    static constexpr uint32_t kNumTasksPerProducer = 1000;
+
+    std::vector<SimpleConcurrentTask> tasks;
+
+    tasks.reserve(kNumProducers * kNumTasksPerProducer);
+
+    for (uint32_t index = 0; index < kNumProducers * kNumTasksPerProducer; index++)
+    {
+        tasks.emplace_back(index);
+    }
+
+    std::vector<std::thread> producers;
+
+    for (uint32_t producer = 0; producer < kNumProducers; producer++)
+    {
+        producers.emplace_back([&scheduler, &tasks, producer]()
+        {
+            for (uint32_t index = 0; index < kNumTasksPerProducer; index++)
+            {
+                scheduler.ready(&tasks[producer * kNumTasksPerProducer + index]);
+            }
+        });
+    }
+
+    // Tasks enqueued by the same producer must be dequeued in order
+    uint32_t expected[kNumProducers] = {};
+
+    for (uint32_t dequeued = 0; dequeued < kNumProducers * kNumTasksPerProducer;)
+    {
+        SimpleConcurrentTask* task = scheduler.next();
+
+        // Guard: The queue is empty or a producer has not linked its task yet
+        if (task == nullptr)
+        {
+            std::this_thread::yield();
+
+            continue;
+        }
+
+        uint32_t producer = task->getIdentifier() / kNumTasksPerProducer;
+
+        passert(task->getIdentifier() % kNumTasksPerProducer == expected[producer], "Tasks of Producer %u are dequeued in order.", producer);
+
+        expected[producer] += 1;
+
+        dequeued += 1;
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    passert(scheduler.next() == nullptr, "All tasks have been dequeued.");
 }
 
 void RoundRobinSchedulerTest::runTaskManagerDelegateTest()
 {
-    pinfo("Same as FIFO scheduler.");
+    // Task control blocks are created in an arena and referred to by generational handles
+    using Arena = Scheduler::Containers::TaskArena<SimpleTask, 4>;
+
+    using Handle = Scheduler::Containers::TaskHandle;
+
+    static_assert(Arena::kIndexBits == 2, "Four slots are indexed by two bits.");
+
+    static Arena arena;
+
+    SimpleTask idleTask(0, 0);
+
+    Schedulers::RoundRobin<SimpleTask> scheduler(&idleTask);
+
+    Handle h1 = arena.create(1, 1);
+
+    Handle h2 = arena.create(2, 4);
+
+    Handle h3 = arena.create(3, 9);
+
+    passert(!h1.isNull() && !h2.isNull() && !h3.isNull() && arena.size() == 3, "Three tasks are alive.");
+
+    passert(reinterpret_cast<uintptr_t>(arena.get(h1)) % 64 == 0 && reinterpret_cast<uintptr_t>(arena.get(h2)) % 64 == 0, "Each task starts at a cache line.");
+
+    passert(arena.getHandle(arena.get(h3)) == h3, "A task maps back to its handle.");
+
+    // Task 1 is running, while Task 2 and Task 3 are created
+    passert(scheduler.onTaskCreated(arena.get(h1), arena.get(h2)) == arena.get(h1), "Task 1 keeps running after Task 2 is created.");
+
+    passert(scheduler.onTaskCreated(arena.get(h1), arena.get(h3)) == arena.get(h1), "Task 1 keeps running after Task 3 is created.");
+
+    // Task 1 has finished and its slot is reused by Task 4
+    passert(scheduler.onTaskFinished(arena.get(h1)) == arena.get(h2), "Task 2 runs after Task 1 has finished.");
+
+    arena.destroy(h1);
+
+    passert(!arena.isValid(h1) && arena.tryGet(h1) == nullptr, "The handle of Task 1 is stale once Task 1 has been destroyed.");
+
+    Handle h4 = arena.create(4, 16);
+
+    passert((h4.value & Arena::kIndexMask) == (h1.value & Arena::kIndexMask) && h4 != h1, "Task 4 reuses the slot of Task 1 with a new generation.");
+
+    passert(arena.tryGet(h1) == nullptr && arena.tryGet(h4)->getIdentifier() == 4, "The stale handle does not resolve to Task 4.");
+
+    passert(scheduler.onTaskCreated(arena.get(h2), arena.get(h4)) == arena.get(h2), "Task 2 keeps running after Task 4 is created.");
+
+    // The remaining tasks finish one after another
+    passert(scheduler.onTaskFinished(arena.get(h2)) == arena.get(h3), "Task 3 runs after Task 2 has finished.");
+
+    arena.destroy(h2);
+
+    passert(scheduler.onTaskFinished(arena.get(h3)) == arena.get(h4), "Task 4 runs after Task 3 has finished.");
+
+    arena.destroy(h3);
+
+    passert(scheduler.onTaskFinished(arena.get(h4)) == &idleTask, "The idle task runs after all tasks have finished.");
+
+    arena.destroy(h4);
+
+    passert(arena.size() == 0 && arena.tryGet(h3) == nullptr, "All tasks have been destroyed.");
+
+    // The arena reports exhaustion with a null handle
+    Handle handles[4];
+
+    for (auto& handle : handles)
+    {
+        handle = arena.create(5, 25);
+    }
+
+    passert(arena.create(6, 36).isNull() && arena.size() == 4, "The arena is exhausted.");
+
+    for (auto& handle : handles)
+    {
+        arena.destroy(handle);
+    }
 }
 
 void RoundRobinSchedulerTest::runTimerInterruptDelegateTest()
@@ -54,6 +240,191 @@ void RoundRobinSchedulerTest::runTimerInterruptDelegateTest()
 
     passert(scheduler.onTimerInterrupt(&t3)->getIdentifier() == 1,
             "Task 1 preempts Task 3 on a timer interrupt.");
+
+    // Instrumented Variant
+    static_assert(sizeof(Schedulers::InstrumentedRoundRobin<SimpleInstrumentedTask, Scheduler::Instrumentation::NullRecorder>) == sizeof(Schedulers::RoundRobin<SimpleInstrumentedTask>),
+                  "A disabled recorder must not occupy any storage.");
+
+    using Statistics = Scheduler::Instrumentation::Statistics<SimpleInstrumentedTask, ManualClock, 10>;
+
+    using Scheduler::Instrumentation::Event;
+
+    SimpleInstrumentedTask instrumentedIdleTask(0, 0);
+
+    SimpleInstrumentedTask t4(4, 1);
+
+    SimpleInstrumentedTask t5(5, 4);
+
+    SimpleInstrumentedTask t6(6, 9);
+
+    Schedulers::InstrumentedRoundRobin<SimpleInstrumentedTask, Statistics> instrumented(&instrumentedIdleTask);
+
+    Statistics& statistics = instrumented.getRecorder();
+
+    // At t = 0, Task 4 is created while the idle task is running, and then Task 5 and Task 6 are ready
+    ManualClock::time = 0;
+
+    passert(instrumented.onTaskCreated(&instrumentedIdleTask, &t4) == &t4, "Task 4 runs after it has been created.");
+
+    instrumented.ready(&t5);
+
+    instrumented.ready(&t6);
+
+    // At t = 5, Task 5 preempts Task 4
+    ManualClock::time = 5;
+
+    passert(instrumented.onTimerInterrupt(&t4) == &t5, "Task 5 preempts Task 4 on a timer interrupt.");
+
+    // At t = 8, Task 6 preempts Task 5
+    ManualClock::time = 8;
+
+    passert(instrumented.onTimerInterrupt(&t5) == &t6, "Task 6 preempts Task 5 on a timer interrupt.");
+
+    // At t = 10, Task 6 finishes and Task 4 runs again
+    ManualClock::time = 10;
+
+    passert(instrumented.onTaskFinished(&t6) == &t4, "Task 4 runs after Task 6 has finished.");
+
+    // Event counters
+    passert(statistics.getEventCount(Event::kTaskCreated) == 1, "1 task creation event.");
+
+    passert(statistics.getEventCount(Event::kTimerInterrupt) == 2, "2 timer interrupt events.");
+
+    passert(statistics.getEventCount(Event::kTaskFinished) == 1, "1 task termination event.");
+
+    passert(statistics.getContextSwitchCount() == 4, "Every event has switched to another task.");
+
+    // Ready queue counters
+    passert(statistics.getEnqueueCount(1) == 1 && statistics.getEnqueueCount(4) == 2 && statistics.getEnqueueCount(9) == 1, "Task 5 has been enqueued twice.");
+
+    passert(statistics.getDequeueCount(1) == 1 && statistics.getDequeueCount(4) == 1 && statistics.getDequeueCount(9) == 1, "1 dequeue per priority level.");
+
+    passert(statistics.getHighWaterMark() == 3, "At most 3 tasks are ready at the same time.");
+
+    // Runnable-wait times and run times
+    passert(t4.getTotalWaitTime() == 5 && t5.getTotalWaitTime() == 5 && t6.getTotalWaitTime() == 8, "Per-task wait times.");
+
+    passert(statistics.getTotalWaitTime() == 18 && statistics.getMaxWaitTime() == 8, "Aggregated wait times.");
+
+    passert(t4.getTotalRunTime() == 5 && t5.getTotalRunTime() == 3 && t6.getTotalRunTime() == 2, "Per-task run times.");
+
+    passert(statistics.getTotalRunTime() == 10, "Aggregated run times.");
+
+    // Traced Variant
+    using Trace = Scheduler::Instrumentation::TraceRecorder<SimpleInstrumentedTask, ManualClock, 4>;
+
+    using Scheduler::Instrumentation::TraceRecord;
+
+    Schedulers::InstrumentedRoundRobin<SimpleInstrumentedTask, Scheduler::Instrumentation::CompositeRecorder<Statistics, Trace>> traced(&instrumentedIdleTask);
+
+    Trace& trace = traced.getRecorder().get<Trace>();
+
+    TraceRecord records[4];
+
+    // At t = 20, Task 4 is unblocked as an intermediate call, and then Task 5 is unblocked while the idle task is running
+    ManualClock::time = 20;
+
+    passert(traced.onTaskUnblocked(nullptr, &t4) == nullptr, "Intermediate unblock call.");
+
+    passert(traced.onTaskUnblocked(&instrumentedIdleTask, &t5) == &t4, "Task 4 runs after the idle task.");
+
+    passert(trace.drain(records) == 2, "2 decisions have been traced.");
+
+    passert(records[0].timestamp == 20 && records[0].event == Event::kTaskUnblocked, "The first record is the intermediate unblock call.");
+
+    passert(records[0].current == TraceRecord::kNoTask && records[0].next == TraceRecord::kNoTask, "The intermediate call does not select a task.");
+
+    passert(records[1].current == 0 && records[1].next == 4 && records[1].priority == 1, "Task 4 of priority level 1 is selected.");
+
+    passert(trace.drain(records) == 0, "All records have been drained.");
+
+    // Six timer interrupts overwrite the two oldest records in the buffer of four records
+    for (uint32_t index = 0; index < 6; index++)
+    {
+        ManualClock::time = 21 + index;
+
+        traced.onTimerInterrupt(index % 2 == 0 ? &t4 : &t5);
+    }
+
+    passert(trace.snapshot(records) == 4 && records[0].timestamp == 23 && records[3].timestamp == 26, "The snapshot holds the latest four records.");
+
+    passert(trace.drain(records) == 4 && records[0].timestamp == 23, "The drain starts with the oldest record that is still available.");
+
+    passert(trace.getDroppedCount() == 2, "The two oldest records have been overwritten.");
+
+    passert(traced.getRecorder().get<Statistics>().getEventCount(Event::kTimerInterrupt) == 6, "The statistics recorder receives the events as well.");
+
+    // Latency Variant
+    using Histogram = Scheduler::Instrumentation::LatencyHistogram<4>;
+
+    static_assert(Histogram::indexOf(15) == 15 && Histogram::indexOf(16) == 16 && Histogram::indexOf(31) == 31 && Histogram::indexOf(32) == 32 && Histogram::indexOf(33) == 32,
+                  "Values below 32 are counted exactly, while 32 and 33 share a bucket of width 2.");
+
+    static_assert(Histogram::upperBoundOf(Histogram::indexOf(1000)) >= 1000 && Histogram::upperBoundOf(Histogram::indexOf(1000)) - 1000 < 1000 / 16,
+                  "The bucket of a value is at most 1/16 of the value wide.");
+
+    static_assert(Histogram::indexOf(UINT64_MAX) == Histogram::kBucketCount - 1 && Histogram::upperBoundOf(Histogram::kBucketCount - 1) == UINT64_MAX,
+                  "The last bucket ends at the largest 64-bit value.");
+
+    using Latency = Scheduler::Instrumentation::LatencyRecorder<TickingClock>;
+
+    Schedulers::InstrumentedRoundRobin<SimpleInstrumentedTask, Latency> timed(&instrumentedIdleTask);
+
+    Latency& latency = timed.getRecorder();
+
+    // Each timer interrupt handler takes 100 cycles
+    TickingClock::step = 100;
+
+    timed.ready(&t5);
+
+    for (uint32_t index = 0; index < 90; index++)
+    {
+        timed.onTimerInterrupt(index % 2 == 0 ? &t4 : &t5);
+    }
+
+    // A few slow timer interrupt handlers take 5000 cycles
+    TickingClock::step = 5000;
+
+    for (uint32_t index = 0; index < 10; index++)
+    {
+        timed.onTimerInterrupt(index % 2 == 0 ? &t4 : &t5);
+    }
+
+    const Histogram& interrupts = latency.getHistogram(Event::kTimerInterrupt);
+
+    passert(interrupts.getCount() == 100 && interrupts.getMaximum() == 5000, "100 timer interrupts have been timed.");
+
+    passert(interrupts.getValueAtPercentile(50) >= 100 && interrupts.getValueAtPercentile(50) < 100 + 100 / 16, "The median is close to 100 cycles.");
+
+    passert(interrupts.getValueAtPercentile(99) == 5000, "The 99th percentile is clamped to the maximum.");
+
+    passert(latency.getHistogram(Event::kTaskCreated).getCount() == 0, "No task has been created.");
+
+    // Merge the recorder of another core
+    Latency other;
+
+    TickingClock::step = 10;
+
+    other.eventFinished(Event::kTimerInterrupt, other.eventStarted());
+
+    latency.merge(other);
+
+    passert(interrupts.getCount() == 101 && interrupts.getValueAtPercentile(0) == 10, "The merged histogram includes the fastest interrupt of the other core.");
+
+    latency.reset();
+
+    passert(interrupts.getCount() == 0 && interrupts.getValueAtPercentile(99) == 0, "All histograms have been cleared.");
+
+    // A composite recorder measures latencies if any of its members does
+    Schedulers::InstrumentedRoundRobin<SimpleInstrumentedTask, Scheduler::Instrumentation::CompositeRecorder<Statistics, Latency>> combined(&instrumentedIdleTask);
+
+    combined.ready(&t5);
+
+    combined.onTimerInterrupt(&t4);
+
+    passert(combined.getRecorder().get<Latency>().getHistogram(Event::kTimerInterrupt).getValueAtPercentile(100) == 10, "The composite recorder forwards the latency.");
+
+    passert(combined.getRecorder().get<Statistics>().getEventCount(Event::kTimerInterrupt) == 1, "The composite recorder forwards the event.");
 }
 
 void RoundRobinSchedulerTest::runGroupOperationsTest()
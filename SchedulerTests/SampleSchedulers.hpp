@@ -49,13 +49,121 @@ namespace SampleSchedulers
         using IdleTaskSupport<Task>::IdleTaskSupport;
     };
 
+    ///
+    /// A simple preemptive scheduler that manages tasks in a round-robin fashion,
+    /// where any thread may enqueue a ready task without taking the lock that protects the scheduling decisions
+    ///
+    template<typename Task>
+    class ConcurrentRoundRobin : public Assembler<
+            Policies::FIFO::Normal::IntrusiveMpscQueueImp<Task>,
+            EventHandlers::TaskCreation::Cooperative::KeepRunningCurrentWithIdleTaskSupport<ConcurrentRoundRobin<Task>>,
+            EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<ConcurrentRoundRobin<Task>>,
+            EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<ConcurrentRoundRobin<Task>>,
+            EventHandlers::TaskUnblocked::Cooperative::KeepRunningCurrentWithIdleTaskSupport<ConcurrentRoundRobin<Task>>,
+            EventHandlers::TaskYielding::Common::RunNext<ConcurrentRoundRobin<Task>>,
+            EventHandlers::TimerInterrupt::Preemptive::RunNextWithIdleTaskSupport<ConcurrentRoundRobin<Task>>>,
+                                 public IdleTaskSupport<Task>
+    {
+        using IdleTaskSupport<Task>::IdleTaskSupport;
+    };
+
+    ///
+    /// A simple preemptive scheduler that manages tasks in a round-robin fashion and reports its activity to the given recorder
+    ///
+    template<typename Task, typename Recorder>
+    class InstrumentedRoundRobin : public Assembler<
+            PolicyWithInstrumentation<Policies::FIFO::Normal::LinkedListImp<Task>, Recorder>,
+            EventHandlers::Instrumented<InstrumentedRoundRobin<Task, Recorder>,
+                    EventHandlers::TaskCreation::Cooperative::KeepRunningCurrentWithIdleTaskSupport<InstrumentedRoundRobin<Task, Recorder>>,
+                    EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<InstrumentedRoundRobin<Task, Recorder>>,
+                    EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<InstrumentedRoundRobin<Task, Recorder>>,
+                    EventHandlers::TaskUnblocked::Cooperative::KeepRunningCurrentWithIdleTaskSupport<InstrumentedRoundRobin<Task, Recorder>>,
+                    EventHandlers::TaskYielding::Common::RunNext<InstrumentedRoundRobin<Task, Recorder>>,
+                    EventHandlers::TimerInterrupt::Preemptive::RunNextWithIdleTaskSupport<InstrumentedRoundRobin<Task, Recorder>>>>,
+                                   public IdleTaskSupport<Task>
+    {
+        using IdleTaskSupport<Task>::IdleTaskSupport;
+    };
+
+    ///
+    /// A preemptive scheduler that runs on one core of a multi-core system and manages tasks in a round-robin fashion,
+    /// stealing ready tasks from other cores before it runs the idle task and accepting tasks woken up by other cores
+    ///
+    template<typename Task>
+    class WorkStealingRoundRobin : public Assembler<
+            MultiCore::PolicyWithWakeupInbox<MultiCore::WorkStealing<Policies::FIFO::Normal::LinkedListImp<Task>>>,
+            EventHandlers::TaskCreation::Cooperative::KeepRunningCurrentWithIdleTaskSupport<WorkStealingRoundRobin<Task>>,
+            EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<WorkStealingRoundRobin<Task>>,
+            EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<WorkStealingRoundRobin<Task>>,
+            EventHandlers::TaskUnblocked::Cooperative::KeepRunningCurrentWithIdleTaskSupport<WorkStealingRoundRobin<Task>>,
+            EventHandlers::TaskYielding::Common::RunNext<WorkStealingRoundRobin<Task>>,
+            EventHandlers::TimerInterrupt::Preemptive::RunNextWithIdleTaskSupport<WorkStealingRoundRobin<Task>>>,
+                                   public IdleTaskSupport<Task>
+    {
+        using IdleTaskSupport<Task>::IdleTaskSupport;
+    };
+
+    ///
+    /// A preemptive scheduler that runs on one core of a multi-core system and manages tasks in a round-robin fashion,
+    /// placing tasks on the cores allowed by their affinity and stealing from the nearest cores in the cache hierarchy first
+    ///
+    template<typename Task>
+    class NumaAwareRoundRobin : public Assembler<
+            MultiCore::PolicyWithWakeupInbox<MultiCore::WorkStealing<Policies::FIFO::Normal::LinkedListImp<Task>, MultiCore::Balancers::NearestBusiest<>>>,
+            EventHandlers::Placement::PlaceOnCreation<NumaAwareRoundRobin<Task>, EventHandlers::TaskCreation::Cooperative::KeepRunningCurrentWithIdleTaskSupport<NumaAwareRoundRobin<Task>>>,
+            EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<NumaAwareRoundRobin<Task>>,
+            EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<NumaAwareRoundRobin<Task>>,
+            EventHandlers::Placement::PlaceOnUnblock<NumaAwareRoundRobin<Task>, EventHandlers::TaskUnblocked::Cooperative::KeepRunningCurrentWithIdleTaskSupport<NumaAwareRoundRobin<Task>>>,
+            EventHandlers::TaskYielding::Common::RunNext<NumaAwareRoundRobin<Task>>,
+            EventHandlers::TimerInterrupt::Preemptive::RunNextWithIdleTaskSupport<NumaAwareRoundRobin<Task>>>,
+                                   public IdleTaskSupport<Task>
+    {
+        using IdleTaskSupport<Task>::IdleTaskSupport;
+    };
+
+    ///
+    /// A preemptive scheduler that runs on one core of a multi-core system and manages tasks in a round-robin fashion,
+    /// co-scheduling the members of a gang on other cores whenever the leader of the gang is dispatched
+    ///
+    template<typename Task>
+    class GangRoundRobin : public Assembler<
+            MultiCore::PolicyWithWakeupInbox<MultiCore::PolicyWithGangScheduling<Policies::FIFO::Normal::LinkedListImp<Task>>>,
+            EventHandlers::TaskCreation::Cooperative::KeepRunningCurrentWithIdleTaskSupport<GangRoundRobin<Task>>,
+            EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<GangRoundRobin<Task>>,
+            EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<GangRoundRobin<Task>>,
+            EventHandlers::TaskUnblocked::Cooperative::KeepRunningCurrentWithIdleTaskSupport<GangRoundRobin<Task>>,
+            EventHandlers::TaskYielding::Common::RunNext<GangRoundRobin<Task>>,
+            EventHandlers::TimerInterrupt::Preemptive::RunNextWithIdleTaskSupport<GangRoundRobin<Task>>>,
+                             public IdleTaskSupport<Task>
+    {
+        using IdleTaskSupport<Task>::IdleTaskSupport;
+    };
+
+    ///
+    /// A preemptive scheduler that runs on one core of a multi-core system and manages tasks in a round-robin fashion,
+    /// packing tasks onto the cores that are already busy and selecting an idle state for the predicted idle duration
+    ///
+    template<typename Task, typename Governor>
+    class EnergyAwareRoundRobin : public Assembler<
+            MultiCore::PolicyWithWakeupInbox<MultiCore::WorkStealing<Policies::FIFO::Normal::LinkedListImp<Task>, MultiCore::Balancers::Packing<>>>,
+            EventHandlers::TaskCreation::Cooperative::KeepRunningCurrentWithIdleTaskSupport<EnergyAwareRoundRobin<Task, Governor>>,
+            EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<EnergyAwareRoundRobin<Task, Governor>>,
+            EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<EnergyAwareRoundRobin<Task, Governor>>,
+            EventHandlers::TaskUnblocked::Cooperative::KeepRunningCurrentWithIdleTaskSupport<EnergyAwareRoundRobin<Task, Governor>>,
+            EventHandlers::TaskYielding::Common::RunNext<EnergyAwareRoundRobin<Task, Governor>>,
+            EventHandlers::TimerInterrupt::Preemptive::RunNextWithIdleTaskSupport<EnergyAwareRoundRobin<Task, Governor>>>,
+                                    public IdleTaskSupportWithGovernor<Task, Governor>
+    {
+        using IdleTaskSupportWithGovernor<Task, Governor>::IdleTaskSupportWithGovernor;
+    };
+
     ///
     /// A fixed priority preemptive scheduler where tasks are prioritized
     /// by their defined priority and executed in a round-robin fashion
     ///
     template<typename Task, size_t MaxPriorityLevel>
     class PrioritizedRoundRobin : public Assembler<
-            Policies::PrioritizedMultiQueue::Normal::ArrayMapImp<Task, PolicyMakers::DynamicFIFO<Task>, MaxPriorityLevel>,
+            Policies::PrioritizedMultiQueue::Normal::BitmapArrayMapImp<Task, PolicyMakers::DynamicFIFO<Task>, MaxPriorityLevel>,
             EventHandlers::TaskCreation::Preemptive::RunHigherPriorityWithIdleTaskSupport<PrioritizedRoundRobin<Task, MaxPriorityLevel>>,
             EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<PrioritizedRoundRobin<Task, MaxPriorityLevel>>,
             EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<PrioritizedRoundRobin<Task, MaxPriorityLevel>>,
@@ -67,14 +175,37 @@ namespace SampleSchedulers
         using IdleTaskSupport<Task>::IdleTaskSupport;
     };
 
+    ///
+    /// A fixed priority preemptive scheduler that is sized by its template arguments and never allocates memory dynamically
+    ///
+    /// @note Each priority level has a ring buffer large enough for all tasks,
+    ///       so the ready queue never overflows as long as there are at most `MaxTasks` tasks.
+    ///
+    template<typename Task, size_t MaxTasks, size_t MaxPriorityLevel>
+    class StaticPrioritizedRoundRobin : public Assembler<
+            Policies::PrioritizedMultiQueue::Normal::BitmapArrayMapHomoImp<Task, Policies::FIFO::Normal::RingBufferImp<Task, std::bit_ceil(MaxTasks)>, MaxPriorityLevel>,
+            EventHandlers::TaskCreation::Preemptive::RunHigherPriorityWithIdleTaskSupport<StaticPrioritizedRoundRobin<Task, MaxTasks, MaxPriorityLevel>>,
+            EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<StaticPrioritizedRoundRobin<Task, MaxTasks, MaxPriorityLevel>>,
+            EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<StaticPrioritizedRoundRobin<Task, MaxTasks, MaxPriorityLevel>>,
+            EventHandlers::TaskUnblocked::Preemptive::RunNextWithIdleTaskSupport<StaticPrioritizedRoundRobin<Task, MaxTasks, MaxPriorityLevel>>,
+            EventHandlers::TaskYielding::Common::RunNext<StaticPrioritizedRoundRobin<Task, MaxTasks, MaxPriorityLevel>>,
+            EventHandlers::TimerInterrupt::Preemptive::RunNextWithIdleTaskSupport<StaticPrioritizedRoundRobin<Task, MaxTasks, MaxPriorityLevel>>>,
+                                        public IdleTaskSupport<Task>
+    {
+        using IdleTaskSupport<Task>::IdleTaskSupport;
+    };
+
     ///
     /// Represents a multilevel feedback queue scheduler
     ///
+    /// @note The quantum of a task is allocated from a precomputed table when the task is dispatched,
+    ///       where the priority level 0 is reserved for the idle task.
+    ///
     template<typename Task, typename QuantumSpecifier, size_t MaxPriorityLevel>
     class MultilevelFeedbackQueue : public Assembler<
-            PolicyWithEnqueueExtensions<
+            PolicyWithDequeueExtensions<
                     Policies::PrioritizedMultiQueue::Normal::ArrayMapImp<Task, PolicyMakers::DynamicFIFO<Task>, MaxPriorityLevel>,
-                    Policies::Extensions::PriorityBasedTaskQuantumAllocator<Task, QuantumSpecifier>
+                    Policies::Extensions::PriorityBasedTaskQuantumAllocator<Task, Policies::Extensions::TabulatedQuantumSpecifier<Task, QuantumSpecifier, MaxPriorityLevel, 1>>
                     >,
             EventHandlers::TaskCreation::Preemptive::RunHigherPriorityWithIdleTaskSupport<MultilevelFeedbackQueue<Task, QuantumSpecifier, MaxPriorityLevel>>,
             EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<MultilevelFeedbackQueue<Task, QuantumSpecifier, MaxPriorityLevel>>,
@@ -87,24 +218,198 @@ namespace SampleSchedulers
         using IdleTaskSupport<Task>::IdleTaskSupport;
     };
 
+    ///
+    /// Represents a multilevel feedback queue scheduler that boosts all tasks to the highest priority level periodically
+    ///
+    /// @note Boosted tasks are recharged with the quantum of the highest priority level when they are dispatched,
+    ///       so that CPU-bound tasks demoted to the lowest level are not starved by interactive tasks at the higher levels.
+    /// @note The policy also recharges the running task as it is boosted, since it is not dispatched again until it is preempted.
+    ///
+    template<typename Task, typename QuantumSpecifier, size_t MaxPriorityLevel, uint32_t BoostPeriod>
+    class MultilevelFeedbackQueueWithPriorityBoost : public Assembler<
+            PolicyWithDequeueExtensions<
+                    Policies::PrioritizedMultiQueue::Normal::BoostableBitmapArrayMapImp<Task, PolicyMakers::DynamicFIFO<Task>, MaxPriorityLevel, Policies::Extensions::PriorityBasedTaskQuantumAllocator<Task, Policies::Extensions::TabulatedQuantumSpecifier<Task, QuantumSpecifier, MaxPriorityLevel, 1>>>,
+                    Policies::Extensions::PriorityBasedTaskQuantumAllocator<Task, Policies::Extensions::TabulatedQuantumSpecifier<Task, QuantumSpecifier, MaxPriorityLevel, 1>>
+                    >,
+            EventHandlers::TaskCreation::Preemptive::RunHigherPriorityWithIdleTaskSupport<MultilevelFeedbackQueueWithPriorityBoost<Task, QuantumSpecifier, MaxPriorityLevel, BoostPeriod>>,
+            EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<MultilevelFeedbackQueueWithPriorityBoost<Task, QuantumSpecifier, MaxPriorityLevel, BoostPeriod>>,
+            EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<MultilevelFeedbackQueueWithPriorityBoost<Task, QuantumSpecifier, MaxPriorityLevel, BoostPeriod>>,
+            EventHandlers::TaskUnblocked::Preemptive::RunNextWithIdleTaskSupport<MultilevelFeedbackQueueWithPriorityBoost<Task, QuantumSpecifier, MaxPriorityLevel, BoostPeriod>>,
+            EventHandlers::TaskYielding::Common::RunNext<MultilevelFeedbackQueueWithPriorityBoost<Task, QuantumSpecifier, MaxPriorityLevel, BoostPeriod>>,
+            EventHandlers::TimerInterrupt::Preemptive::WithPeriodicPriorityBoost<MultilevelFeedbackQueueWithPriorityBoost<Task, QuantumSpecifier, MaxPriorityLevel, BoostPeriod>,
+                    EventHandlers::TimerInterrupt::Preemptive::KeepRunningCurrentWithAutoDemotionOnQuantumUsedUpAndIdleTaskSupport<MultilevelFeedbackQueueWithPriorityBoost<Task, QuantumSpecifier, MaxPriorityLevel, BoostPeriod>>,
+                    BoostPeriod>>,
+                                                     public IdleTaskSupport<Task>
+    {
+        using IdleTaskSupport<Task>::IdleTaskSupport;
+    };
+
+    ///
+    /// Represents a multilevel feedback queue scheduler driven by a one-shot timer instead of a periodic timer tick
+    ///
+    template<typename Task, typename QuantumSpecifier, size_t MaxPriorityLevel>
+    class TicklessMultilevelFeedbackQueue : public Assembler<
+            PolicyWithDequeueExtensions<
+                    Policies::PrioritizedMultiQueue::Normal::ArrayMapImp<Task, PolicyMakers::DynamicFIFO<Task>, MaxPriorityLevel>,
+                    Policies::Extensions::PriorityBasedTaskQuantumAllocator<Task, Policies::Extensions::TabulatedQuantumSpecifier<Task, QuantumSpecifier, MaxPriorityLevel, 1>>
+                    >,
+            EventHandlers::TaskCreation::Preemptive::RunHigherPriorityWithIdleTaskSupport<TicklessMultilevelFeedbackQueue<Task, QuantumSpecifier, MaxPriorityLevel>>,
+            EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<TicklessMultilevelFeedbackQueue<Task, QuantumSpecifier, MaxPriorityLevel>>,
+            EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<TicklessMultilevelFeedbackQueue<Task, QuantumSpecifier, MaxPriorityLevel>>,
+            EventHandlers::TaskUnblocked::Preemptive::RunNextWithIdleTaskSupport<TicklessMultilevelFeedbackQueue<Task, QuantumSpecifier, MaxPriorityLevel>>,
+            EventHandlers::TaskYielding::Common::RunNext<TicklessMultilevelFeedbackQueue<Task, QuantumSpecifier, MaxPriorityLevel>>,
+            EventHandlers::TimerInterrupt::Tickless::KeepRunningCurrentWithAutoDemotionOnQuantumUsedUpAndIdleTaskSupport<TicklessMultilevelFeedbackQueue<Task, QuantumSpecifier, MaxPriorityLevel>>>,
+                                            public IdleTaskSupport<Task>
+    {
+        using IdleTaskSupport<Task>::IdleTaskSupport;
+    };
+
     ///
     /// A scheduler that arranges real-time tasks based on their deadline,
     /// where a task that has the earliest deadline has the highest priority
     ///
     template<typename Task>
     class EarliestDeadlineFirst: public Assembler<
-            Policies::PrioritizedSingleQueue::Normal::LinkedListImp<Task>,
+            Policies::PrioritizedSingleQueue::Normal::StableDaryHeapImp<Task>,
             EventHandlers::TaskCreation::Preemptive::RunHigherPriorityWithIdleTaskSupport<EarliestDeadlineFirst<Task>>,
             EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<EarliestDeadlineFirst<Task>>,
-            EventHandlers::TimerInterrupt::Cooperative::KeepRunningCurrent<EarliestDeadlineFirst<Task>>>,
+            EventHandlers::TimerInterrupt::Cooperative::KeepRunningCurrent<EarliestDeadlineFirst<Task>>,
+            EventHandlers::TaskUnblocked::Preemptive::RunHigherPriorityWithIdleTaskSupport<EarliestDeadlineFirst<Task>>,
+            EventHandlers::TaskUnblocked::Common::BatchAdapter<EarliestDeadlineFirst<Task>>,
+            EventHandlers::TaskKilled::Common::KeepRunningCurrent<EarliestDeadlineFirst<Task>>,
+            EventHandlers::TaskKilled::Common::BatchAdapter<EarliestDeadlineFirst<Task>>>,
+                                 public IdleTaskSupport<Task>
+    {
+        using IdleTaskSupport<Task>::IdleTaskSupport;
+    };
+
+    ///
+    /// An earliest-deadline-first scheduler that detects deadline misses, applies the given overload strategy
+    /// and reports each miss to the given instrumentation recorder
+    ///
+    template <typename Task, typename Strategy, typename Recorder>
+    class OverloadAwareEarliestDeadlineFirst: public Assembler<
+            Policies::EarliestDeadlineFirst::PolicyWithOverloadDetection<PolicyWithInstrumentation<Policies::PrioritizedSingleQueue::Normal::StableDaryHeapImp<Task>, Recorder>, Strategy>,
+            EventHandlers::TaskCreation::Preemptive::RunHigherPriorityWithIdleTaskSupport<OverloadAwareEarliestDeadlineFirst<Task, Strategy, Recorder>>,
+            EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<OverloadAwareEarliestDeadlineFirst<Task, Strategy, Recorder>>,
+            EventHandlers::TimerInterrupt::EarliestDeadlineFirst::AdvanceClockAndKeepRunningCurrent<OverloadAwareEarliestDeadlineFirst<Task, Strategy, Recorder>>,
+            EventHandlers::TaskUnblocked::Preemptive::RunHigherPriorityWithIdleTaskSupport<OverloadAwareEarliestDeadlineFirst<Task, Strategy, Recorder>>>,
+                                              public IdleTaskSupport<Task>
+    {
+        using IdleTaskSupport<Task>::IdleTaskSupport;
+    };
+
+    ///
+    /// A fixed priority preemptive scheduler where the owner of a mutex inherits the priority of the tasks that wait for it,
+    /// so that a high priority task is never delayed by medium priority tasks while a low priority task holds the mutex it needs
+    ///
+    template<typename Task>
+    class PriorityInheritance: public Assembler<
+            Policies::PriorityInheritance::PolicyWithPriorityInheritance<Policies::PrioritizedSingleQueue::Normal::StableDaryHeapImp<Task>>,
+            EventHandlers::TaskCreation::Preemptive::RunHigherPriorityWithIdleTaskSupport<PriorityInheritance<Task>>,
+            EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<PriorityInheritance<Task>>,
+            EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<PriorityInheritance<Task>>,
+            EventHandlers::TaskUnblocked::Preemptive::RunHigherPriorityWithIdleTaskSupport<PriorityInheritance<Task>>,
+            EventHandlers::TimerInterrupt::Cooperative::KeepRunningCurrent<PriorityInheritance<Task>>,
+            EventHandlers::PriorityInheritance::LockMutex<PriorityInheritance<Task>>,
+            EventHandlers::PriorityInheritance::UnlockMutex<PriorityInheritance<Task>>>,
                                  public IdleTaskSupport<Task>
     {
         using IdleTaskSupport<Task>::IdleTaskSupport;
     };
 
+    ///
+    /// A preemptive scheduler that shares the processor among tasks in proportion to their weights derived from their priority,
+    /// where a task that has the smallest virtual runtime runs next
+    ///
+    template<typename Task>
+    class FairShare: public Assembler<
+            Policies::FairShare::Normal::RedBlackTreeImp<Task>,
+            EventHandlers::TaskCreation::Cooperative::KeepRunningCurrentWithIdleTaskSupport<FairShare<Task>>,
+            EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<FairShare<Task>>,
+            EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<FairShare<Task>>,
+            EventHandlers::TaskUnblocked::Preemptive::RunNextWithIdleTaskSupport<FairShare<Task>>,
+            EventHandlers::TaskYielding::Common::RunNext<FairShare<Task>>,
+            EventHandlers::TaskKilled::Common::KeepRunningCurrent<FairShare<Task>>,
+            EventHandlers::TimerInterrupt::FairShare::ChargeCurrentAndRunFairestWithIdleTaskSupport<FairShare<Task>>>,
+                     public IdleTaskSupport<Task>
+    {
+        using IdleTaskSupport<Task>::IdleTaskSupport;
+    };
+
+    ///
     /// A scheduler that arranges periodic real-time tasks based on their periods,
     /// where a task that has the lowest period has the highest priority
-    // `RateMonotonicScheduler`
+    ///
+    /// @note A new task is admitted only if the task set remains schedulable under the given bound,
+    ///       otherwise the current task keeps running and `getLastRejectedTask()` reports the new task.
+    ///       A periodic task blocks once it finishes its job and is unblocked at the start of its next period.
+    ///
+    template<typename Task, size_t MaxPriorityLevel, typename Bound = Policies::RateMonotonic::LiuLaylandBound>
+    class RateMonotonic: public Assembler<
+            Policies::RateMonotonic::PolicyWithAdmissionControl<
+                    Policies::PrioritizedMultiQueue::Normal::BitmapArrayMapImp<Task, PolicyMakers::DynamicFIFO<Task>, MaxPriorityLevel>,
+                    Bound,
+                    Policies::RateMonotonic::LinearPeriodBuckets<MaxPriorityLevel>
+                    >,
+            EventHandlers::AdmissionControl::AdmitOnCreation<RateMonotonic<Task, MaxPriorityLevel, Bound>,
+                    EventHandlers::TaskCreation::Preemptive::RunHigherPriorityWithIdleTaskSupport<RateMonotonic<Task, MaxPriorityLevel, Bound>>>,
+            EventHandlers::AdmissionControl::ReleaseOnTermination<RateMonotonic<Task, MaxPriorityLevel, Bound>,
+                    EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<RateMonotonic<Task, MaxPriorityLevel, Bound>>>,
+            EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<RateMonotonic<Task, MaxPriorityLevel, Bound>>,
+            EventHandlers::TaskUnblocked::Preemptive::RunNextWithIdleTaskSupport<RateMonotonic<Task, MaxPriorityLevel, Bound>>,
+            EventHandlers::TaskUnblocked::Common::BatchAdapter<RateMonotonic<Task, MaxPriorityLevel, Bound>>,
+            EventHandlers::TimerInterrupt::Cooperative::KeepRunningCurrent<RateMonotonic<Task, MaxPriorityLevel, Bound>>>,
+                         public IdleTaskSupport<Task>
+    {
+        using IdleTaskSupport<Task>::IdleTaskSupport;
+    };
+
+    ///
+    /// A preemptive scheduler that serves each real-time task by a constant bandwidth server,
+    /// where a task that has the earliest server deadline has the highest priority
+    ///
+    /// @note Each task runs at most its reserved runtime in every reservation period.
+    ///       A task that exhausts its budget is throttled until the budget is replenished at its server deadline,
+    ///       so an overrunning task cannot starve other real-time tasks.
+    ///
+    template<typename Task, size_t NumberOfSlots = 1024>
+    class ConstantBandwidth: public Assembler<
+            Policies::ConstantBandwidth::PolicyWithReservations<Policies::PrioritizedSingleQueue::Normal::StableDaryHeapImp<Task>, NumberOfSlots>,
+            EventHandlers::Reservation::ActivateOnCreation<ConstantBandwidth<Task, NumberOfSlots>,
+                    EventHandlers::TaskCreation::Preemptive::RunHigherPriorityWithIdleTaskSupport<ConstantBandwidth<Task, NumberOfSlots>>>,
+            EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<ConstantBandwidth<Task, NumberOfSlots>>,
+            EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<ConstantBandwidth<Task, NumberOfSlots>>,
+            EventHandlers::Reservation::ActivateOnUnblock<ConstantBandwidth<Task, NumberOfSlots>,
+                    EventHandlers::TaskUnblocked::Preemptive::RunNextWithIdleTaskSupport<ConstantBandwidth<Task, NumberOfSlots>>>,
+            EventHandlers::TaskKilled::Common::KeepRunningCurrent<ConstantBandwidth<Task, NumberOfSlots>>,
+            EventHandlers::TaskKilled::Common::BatchAdapter<ConstantBandwidth<Task, NumberOfSlots>>,
+            EventHandlers::TimerInterrupt::ConstantBandwidth::ChargeCurrentAndRunEarliestWithIdleTaskSupport<ConstantBandwidth<Task, NumberOfSlots>>>,
+                             public IdleTaskSupport<Task>
+    {
+        using IdleTaskSupport<Task>::IdleTaskSupport;
+    };
+
+    ///
+    /// A preemptive scheduler that divides the processor among a hierarchy of scheduling groups,
+    /// where top-level groups share the processor in proportion to their weights
+    ///
+    /// @note Each task must belong to a leaf group created under `getRootGroup()` before it is enqueued.
+    ///
+    template<typename Task>
+    class Hierarchical: public Assembler<
+            Policies::Hierarchical::Normal::GroupTreeImp<Task>,
+            EventHandlers::TaskCreation::Cooperative::KeepRunningCurrentWithIdleTaskSupport<Hierarchical<Task>>,
+            EventHandlers::TaskTermination::Common::RunNextWithIdleTaskSupport<Hierarchical<Task>>,
+            EventHandlers::TaskBlocked::Common::RunNextWithIdleTaskSupport<Hierarchical<Task>>,
+            EventHandlers::TaskUnblocked::Cooperative::KeepRunningCurrentWithIdleTaskSupport<Hierarchical<Task>>,
+            EventHandlers::TaskYielding::Common::RunNext<Hierarchical<Task>>,
+            EventHandlers::TaskKilled::Common::KeepRunningCurrent<Hierarchical<Task>>,
+            EventHandlers::TimerInterrupt::Hierarchical::ChargeCurrentAndRunNextWithIdleTaskSupport<Hierarchical<Task>>>,
+                        public IdleTaskSupport<Task>
+    {
+        using IdleTaskSupport<Task>::IdleTaskSupport;
+    };
 }
 
 namespace Scheduler::Traits
@@ -121,23 +426,113 @@ namespace Scheduler::Traits
         using Task = T;
     };
 
+    template <typename T>
+    struct SchedulerTraits<SampleSchedulers::ConcurrentRoundRobin<T>>
+    {
+        using Task = T;
+    };
+
+    template <typename T, typename Recorder>
+    struct SchedulerTraits<SampleSchedulers::InstrumentedRoundRobin<T, Recorder>>
+    {
+        using Task = T;
+    };
+
+    template <typename T>
+    struct SchedulerTraits<SampleSchedulers::WorkStealingRoundRobin<T>>
+    {
+        using Task = T;
+    };
+
+    template <typename T>
+    struct SchedulerTraits<SampleSchedulers::NumaAwareRoundRobin<T>>
+    {
+        using Task = T;
+    };
+
+    template <typename T>
+    struct SchedulerTraits<SampleSchedulers::GangRoundRobin<T>>
+    {
+        using Task = T;
+    };
+
+    template <typename T, typename Governor>
+    struct SchedulerTraits<SampleSchedulers::EnergyAwareRoundRobin<T, Governor>>
+    {
+        using Task = T;
+    };
+
     template<typename T, size_t MaxPriorityLevel>
     struct SchedulerTraits<SampleSchedulers::PrioritizedRoundRobin<T, MaxPriorityLevel>>
     {
         using Task = T;
     };
 
+    template<typename T, size_t MaxTasks, size_t MaxPriorityLevel>
+    struct SchedulerTraits<SampleSchedulers::StaticPrioritizedRoundRobin<T, MaxTasks, MaxPriorityLevel>>
+    {
+        using Task = T;
+    };
+
     template<typename T, typename QuantumSpecifier, size_t MaxPriorityLevel>
     struct SchedulerTraits<SampleSchedulers::MultilevelFeedbackQueue<T, QuantumSpecifier, MaxPriorityLevel>>
     {
         using Task = T;
     };
 
+    template<typename T, typename QuantumSpecifier, size_t MaxPriorityLevel, uint32_t BoostPeriod>
+    struct SchedulerTraits<SampleSchedulers::MultilevelFeedbackQueueWithPriorityBoost<T, QuantumSpecifier, MaxPriorityLevel, BoostPeriod>>
+    {
+        using Task = T;
+    };
+
+    template<typename T, typename QuantumSpecifier, size_t MaxPriorityLevel>
+    struct SchedulerTraits<SampleSchedulers::TicklessMultilevelFeedbackQueue<T, QuantumSpecifier, MaxPriorityLevel>>
+    {
+        using Task = T;
+    };
+
     template <typename T>
     struct SchedulerTraits<SampleSchedulers::EarliestDeadlineFirst<T>>
     {
         using Task = T;
     };
+
+    template <typename T, typename Strategy, typename Recorder>
+    struct SchedulerTraits<SampleSchedulers::OverloadAwareEarliestDeadlineFirst<T, Strategy, Recorder>>
+    {
+        using Task = T;
+    };
+
+    template <typename T>
+    struct SchedulerTraits<SampleSchedulers::PriorityInheritance<T>>
+    {
+        using Task = T;
+    };
+
+    template <typename T>
+    struct SchedulerTraits<SampleSchedulers::FairShare<T>>
+    {
+        using Task = T;
+    };
+
+    template <typename T, size_t MaxPriorityLevel, typename Bound>
+    struct SchedulerTraits<SampleSchedulers::RateMonotonic<T, MaxPriorityLevel, Bound>>
+    {
+        using Task = T;
+    };
+
+    template <typename T, size_t NumberOfSlots>
+    struct SchedulerTraits<SampleSchedulers::ConstantBandwidth<T, NumberOfSlots>>
+    {
+        using Task = T;
+    };
+
+    template <typename T>
+    struct SchedulerTraits<SampleSchedulers::Hierarchical<T>>
+    {
+        using Task = T;
+    };
 }
 
 #endif /* SampleSchedulers_hpp */
@@ -14,6 +14,13 @@
 #include "PrioritizedRoundRobinSchedulerTest.hpp"
 #include "MultilevelFeedbackQueueSchedulerTest.hpp"
 #include "EarliestDeadlineFirstSchedulerTest.hpp"
+#include "WorkStealingRoundRobinSchedulerTest.hpp"
+#include "FairShareSchedulerTest.hpp"
+#include "RateMonotonicSchedulerTest.hpp"
+#include "ConstantBandwidthSchedulerTest.hpp"
+#include "HierarchicalSchedulerTest.hpp"
+#include "NumaAwareRoundRobinSchedulerTest.hpp"
+#include "PriorityInheritanceSchedulerTest.hpp"
 #include <Debug.hpp>
 
 class SchedulerTestDriver
@@ -28,14 +35,35 @@ private:
     MultilevelFeedbackQueueSchedulerTest multilevelFeedbackQueueSchedulerTest;
 
     EarliestDeadlineFirstSchedulerTest earliestDeadlineFirstSchedulerTest;
+
+    WorkStealingRoundRobinSchedulerTest workStealingRoundRobinSchedulerTest;
+
+    FairShareSchedulerTest fairShareSchedulerTest;
+
+    RateMonotonicSchedulerTest rateMonotonicSchedulerTest;
+
+    ConstantBandwidthSchedulerTest constantBandwidthSchedulerTest;
+
+    HierarchicalSchedulerTest hierarchicalSchedulerTest;
+
+    NumaAwareRoundRobinSchedulerTest numaAwareRoundRobinSchedulerTest;
+
+    PriorityInheritanceSchedulerTest priorityInheritanceSchedulerTest;
     
-    SchedulerTest* tests[5] =
+    SchedulerTest* tests[12] =
     {
         &fifoSchedulerTest,
         &roundRobinSchedulerTest,
         &prioritizedRoundRobinSchedulerTest,
         &multilevelFeedbackQueueSchedulerTest,
-        &earliestDeadlineFirstSchedulerTest
+        &earliestDeadlineFirstSchedulerTest,
+        &workStealingRoundRobinSchedulerTest,
+        &fairShareSchedulerTest,
+        &rateMonotonicSchedulerTest,
+        &constantBandwidthSchedulerTest,
+        &hierarchicalSchedulerTest,
+        &numaAwareRoundRobinSchedulerTest,
+        &priorityInheritanceSchedulerTest
     };
     
 public:
@@ -0,0 +1,33 @@
+//
+//  SimpleAffinityTask.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef SimpleAffinityTask_hpp
+#define SimpleAffinityTask_hpp
+
+#include <Types.hpp>
+#include <LinkedList.hpp>
+#include <Scheduler/Scheduler.hpp>
+
+/// Task that is placed on the cores allowed by its affinity mask and preferably on its home node
+class SimpleAffinityTask: public Listable<SimpleAffinityTask>, public Scheduler::Schedulable, public Scheduler::WakeupLinkable<SimpleAffinityTask>, public Scheduler::Affinity
+{
+private:
+    uint32_t identifier;
+
+public:
+    // MARK: Constructor
+    explicit SimpleAffinityTask(uint32_t identifier) :
+        Listable(), identifier(identifier) {}
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+};
+
+#endif /* SimpleAffinityTask_hpp */
@@ -0,0 +1,105 @@
+//
+//  SimpleBoostableTask.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef SimpleBoostableTask_hpp
+#define SimpleBoostableTask_hpp
+
+#include "SimpleTask.hpp"
+#include <Types.hpp>
+#include <LinkedList.hpp>
+#include <Scheduler/Scheduler.hpp>
+#include <Debug.hpp>
+#include <algorithm>
+
+/// Task that is demoted as it uses up its quantum and is moved back to the top priority level by a periodic priority boost
+class SimpleBoostableTask: public Listable<SimpleBoostableTask>, public Scheduler::Schedulable, public Scheduler::Boostable
+{
+private:
+    uint32_t identifier;
+
+    uint32_t priority;
+
+    uint32_t ticks;
+
+public:
+    // MARK: Constructor
+    SimpleBoostableTask(uint32_t identifier, uint32_t priority) :
+        Listable(), identifier(identifier), priority(priority), ticks(0) {}
+
+    // MARK: Prioritizable By Mutable Priority IMP
+    using Priority = uint32_t;
+
+    [[nodiscard]]
+    const uint32_t& getPriority() const
+    {
+        return this->priority;
+    }
+
+    void setPriority(const uint32_t& priority)
+    {
+        this->priority = priority;
+
+        pinfo("SimpleBoostableTask%u: Now has a priority of %u.", this->identifier, this->priority);
+    }
+
+    void demote()
+    {
+        if (this->priority > 1)
+        {
+            this->priority -= 1;
+        }
+    }
+
+    void promote()
+    {
+        pinfo("Not supported.");
+    }
+
+    // MARK: Quantizable IMP
+    using Tick = uint32_t;
+
+    void tick()
+    {
+        this->ticks -= 1;
+
+        pinfo("SimpleBoostableTask%u: Remaining ticks is %u after tick.", this->identifier, this->ticks);
+    }
+
+    void consumeTicks(uint32_t ticks)
+    {
+        this->ticks -= std::min(ticks, this->ticks);
+    }
+
+    [[nodiscard]]
+    uint32_t getRemainingTicks() const
+    {
+        return this->ticks;
+    }
+
+    bool hasUsedUpTimeAllotment()
+    {
+        return this->ticks == 0;
+    }
+
+    void allocateTicks(uint32_t ticks)
+    {
+        this->ticks = ticks;
+
+        pinfo("SimpleBoostableTask%u: Allocated ticks = %u.", this->identifier, this->ticks);
+    }
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+
+    // Quantum Specifier
+    using QuantumSpecifier = SimpleTask::QuantumSpecifier;
+};
+
+#endif /* SimpleBoostableTask_hpp */
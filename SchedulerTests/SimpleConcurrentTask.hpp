@@ -0,0 +1,31 @@
+//
+//  SimpleConcurrentTask.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef SimpleConcurrentTask_hpp
+#define SimpleConcurrentTask_hpp
+
+#include <Types.hpp>
+#include <Scheduler/Scheduler.hpp>
+
+/// Task that can be enqueued by several threads at the same time
+class SimpleConcurrentTask: public Scheduler::Schedulable, public Scheduler::WakeupLinkable<SimpleConcurrentTask>
+{
+private:
+    uint32_t identifier;
+
+public:
+    // MARK: Constructor
+    explicit SimpleConcurrentTask(uint32_t identifier) : identifier(identifier) {}
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+};
+
+#endif /* SimpleConcurrentTask_hpp */
@@ -0,0 +1,33 @@
+//
+//  SimpleCoroutineTask.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef SimpleCoroutineTask_hpp
+#define SimpleCoroutineTask_hpp
+
+#include <Types.hpp>
+#include <LinkedList.hpp>
+#include <Scheduler/Scheduler.hpp>
+
+/// Task whose body is a coroutine resumed by the executor whenever the scheduler selects the task
+class SimpleCoroutineTask: public Listable<SimpleCoroutineTask>, public Scheduler::Schedulable, public Scheduler::Resumable
+{
+private:
+    uint32_t identifier;
+
+public:
+    // MARK: Constructor
+    explicit SimpleCoroutineTask(uint32_t identifier) :
+        Listable(), identifier(identifier) {}
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+};
+
+#endif /* SimpleCoroutineTask_hpp */
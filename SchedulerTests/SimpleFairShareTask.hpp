@@ -0,0 +1,43 @@
+//
+//  SimpleFairShareTask.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef SimpleFairShareTask_hpp
+#define SimpleFairShareTask_hpp
+
+#include <Types.hpp>
+#include <Scheduler/Scheduler.hpp>
+
+/// Task that has the smallest virtual runtime runs next, where its priority level is mapped to its weight
+class SimpleFairShareTask: public Scheduler::Schedulable, public Scheduler::TreeLinkable<SimpleFairShareTask>, public Scheduler::WeightedRuntime
+{
+private:
+    uint32_t identifier;
+
+    uint32_t priority;
+
+public:
+    // MARK: Constructor
+    SimpleFairShareTask(uint32_t identifier, uint32_t priority) :
+        identifier(identifier), priority(priority) {}
+
+    // MARK: Prioritizable By Priority IMP
+    using Priority = uint32_t;
+
+    [[nodiscard]]
+    const uint32_t& getPriority() const
+    {
+        return this->priority;
+    }
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+};
+
+#endif /* SimpleFairShareTask_hpp */
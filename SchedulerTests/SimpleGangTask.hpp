@@ -0,0 +1,33 @@
+//
+//  SimpleGangTask.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef SimpleGangTask_hpp
+#define SimpleGangTask_hpp
+
+#include <Types.hpp>
+#include <LinkedList.hpp>
+#include <Scheduler/Scheduler.hpp>
+
+/// Task that can be enrolled in a gang and co-scheduled on other cores with its leader
+class SimpleGangTask: public Listable<SimpleGangTask>, public Scheduler::Schedulable, public Scheduler::WakeupLinkable<SimpleGangTask>, public Scheduler::GangSchedulable<SimpleGangTask>
+{
+private:
+    uint32_t identifier;
+
+public:
+    // MARK: Constructor
+    explicit SimpleGangTask(uint32_t identifier) :
+        Listable(), identifier(identifier) {}
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+};
+
+#endif /* SimpleGangTask_hpp */
@@ -0,0 +1,33 @@
+//
+//  SimpleGroupedTask.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef SimpleGroupedTask_hpp
+#define SimpleGroupedTask_hpp
+
+#include <Types.hpp>
+#include <LinkedList.hpp>
+#include <Scheduler/Scheduler.hpp>
+
+/// Task that belongs to a scheduling group and shares the processor time of the group with its siblings
+class SimpleGroupedTask: public Listable<SimpleGroupedTask>, public Scheduler::Schedulable, public Scheduler::Groupable<SimpleGroupedTask>
+{
+private:
+    uint32_t identifier;
+
+public:
+    // MARK: Constructor
+    explicit SimpleGroupedTask(uint32_t identifier) :
+        Listable(), identifier(identifier) {}
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+};
+
+#endif /* SimpleGroupedTask_hpp */
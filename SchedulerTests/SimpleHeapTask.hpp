@@ -0,0 +1,81 @@
+//
+//  SimpleHeapTask.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef SimpleHeapTask_hpp
+#define SimpleHeapTask_hpp
+
+#include <Types.hpp>
+#include <LinkedList.hpp>
+#include <Scheduler/Scheduler.hpp>
+#include <algorithm>
+
+/// Task that records its position in a heap-based ready queue
+class SimpleHeapTask: public Listable<SimpleHeapTask>, public Scheduler::Schedulable, public Scheduler::StableHeapIndexable
+{
+private:
+    uint32_t identifier;
+
+    uint32_t priority;
+
+    uint32_t ticks;
+
+public:
+    // MARK: Constructor
+    SimpleHeapTask(uint32_t identifier, uint32_t priority) :
+            Listable(), identifier(identifier), priority(priority), ticks(0) {}
+
+    // MARK: Prioritizable By Mutable Priority IMP
+    using Priority = uint32_t;
+
+    [[nodiscard]]
+    const uint32_t& getPriority() const
+    {
+        return this->priority;
+    }
+
+    void setPriority(const uint32_t& priority)
+    {
+        this->priority = priority;
+    }
+
+    // MARK: Quantizable IMP
+    using Tick = uint32_t;
+
+    void tick()
+    {
+        this->ticks -= 1;
+    }
+
+    void consumeTicks(uint32_t ticks)
+    {
+        this->ticks -= std::min(ticks, this->ticks);
+    }
+
+    [[nodiscard]]
+    uint32_t getRemainingTicks() const
+    {
+        return this->ticks;
+    }
+
+    bool hasUsedUpTimeAllotment()
+    {
+        return this->ticks == 0;
+    }
+
+    void allocateTicks(uint32_t ticks)
+    {
+        this->ticks = ticks;
+    }
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+};
+
+#endif /* SimpleHeapTask_hpp */
@@ -0,0 +1,52 @@
+//
+//  SimpleInheritableTask.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef SimpleInheritableTask_hpp
+#define SimpleInheritableTask_hpp
+
+#include <Types.hpp>
+#include <LinkedList.hpp>
+#include <Scheduler/Scheduler.hpp>
+#include <Debug.hpp>
+
+/// Task that inherits the priority of the tasks that wait for the mutexes it holds
+class SimpleInheritableTask: public Listable<SimpleInheritableTask>, public Scheduler::Schedulable, public Scheduler::StableHeapIndexable, public Scheduler::PriorityInheritable<SimpleInheritableTask, uint32_t>
+{
+private:
+    uint32_t identifier;
+
+    uint32_t priority;
+
+public:
+    // MARK: Constructor
+    SimpleInheritableTask(uint32_t identifier, uint32_t priority) :
+        Listable(), identifier(identifier), priority(priority) {}
+
+    // MARK: Prioritizable By Mutable Priority IMP
+    using Priority = uint32_t;
+
+    [[nodiscard]]
+    const uint32_t& getPriority() const
+    {
+        return this->priority;
+    }
+
+    void setPriority(const uint32_t& priority)
+    {
+        this->priority = priority;
+
+        pinfo("SimpleInheritableTask%u: Now has a priority of %u.", this->identifier, this->priority);
+    }
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+};
+
+#endif /* SimpleInheritableTask_hpp */
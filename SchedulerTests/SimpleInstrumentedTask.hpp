@@ -0,0 +1,44 @@
+//
+//  SimpleInstrumentedTask.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef SimpleInstrumentedTask_hpp
+#define SimpleInstrumentedTask_hpp
+
+#include <Types.hpp>
+#include <LinkedList.hpp>
+#include <Scheduler/Scheduler.hpp>
+
+/// Task that accumulates the time it has spent waiting in the ready queue and running on the processor
+class SimpleInstrumentedTask: public Listable<SimpleInstrumentedTask>, public Scheduler::Schedulable, public Scheduler::Instrumentable
+{
+private:
+    uint32_t identifier;
+
+    uint32_t priority;
+
+public:
+    // MARK: Constructor
+    SimpleInstrumentedTask(uint32_t identifier, uint32_t priority) :
+        Listable(), identifier(identifier), priority(priority) {}
+
+    // MARK: Prioritizable By Priority IMP
+    using Priority = uint32_t;
+
+    [[nodiscard]]
+    const uint32_t& getPriority() const
+    {
+        return this->priority;
+    }
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+};
+
+#endif /* SimpleInstrumentedTask_hpp */
@@ -0,0 +1,68 @@
+//
+//  SimplePeriodicTask.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef SimplePeriodicTask_hpp
+#define SimplePeriodicTask_hpp
+
+#include <Types.hpp>
+#include <LinkedList.hpp>
+#include <Scheduler/Scheduler.hpp>
+
+/// Task that has a shorter period has a higher priority
+class SimplePeriodicTask: public Listable<SimplePeriodicTask>, public Scheduler::Schedulable
+{
+private:
+    uint32_t identifier;
+
+    uint32_t priority;
+
+    uint32_t period;
+
+    uint32_t executionTime;
+
+public:
+    // MARK: Constructor
+    SimplePeriodicTask(uint32_t identifier, uint32_t period, uint32_t executionTime) :
+        Listable(), identifier(identifier), priority(0), period(period), executionTime(executionTime) {}
+
+    // MARK: Prioritizable By Mutable Priority IMP
+    using Priority = uint32_t;
+
+    [[nodiscard]]
+    const uint32_t& getPriority() const
+    {
+        return this->priority;
+    }
+
+    void setPriority(const uint32_t& priority)
+    {
+        this->priority = priority;
+    }
+
+    // MARK: Periodic IMP
+    using Tick = uint32_t;
+
+    [[nodiscard]]
+    uint32_t getPeriod() const
+    {
+        return this->period;
+    }
+
+    [[nodiscard]]
+    uint32_t getExecutionTime() const
+    {
+        return this->executionTime;
+    }
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+};
+
+#endif /* SimplePeriodicTask_hpp */
@@ -14,17 +14,25 @@
 #include <Scheduler/Scheduler.hpp>
 
 /// Task that has the earliest deadline has the highest priority
-class SimpleRealtimeTask: public Listable<SimpleRealtimeTask>, public Scheduler::Schedulable
+class SimpleRealtimeTask: public Listable<SimpleRealtimeTask>, public Scheduler::Schedulable, public Scheduler::StableHeapIndexable
 {
 private:
     uint32_t identifier;
 
     uint32_t deadline;
 
+    uint32_t period;
+
+    uint32_t value;
+
 public:
+    using Tick = uint32_t;
+
+    using Value = uint32_t;
+
     // MARK: Constructor
-    SimpleRealtimeTask(uint32_t identifier, uint32_t deadline) :
-        Listable(), identifier(identifier), deadline(deadline) {}
+    SimpleRealtimeTask(uint32_t identifier, uint32_t deadline, uint32_t period = 0, uint32_t value = 0) :
+        Listable(), identifier(identifier), deadline(deadline), period(period), value(value) {}
 
     // MARK: Prioritizable IMP
     friend bool operator<(const SimpleRealtimeTask& lhs, const SimpleRealtimeTask& rhs)
@@ -52,6 +60,32 @@ public:
     {
         return this->identifier;
     }
+
+    // MARK: Deadlined IMP
+    [[nodiscard]]
+    uint32_t getDeadline() const
+    {
+        return this->deadline;
+    }
+
+    void setDeadline(uint32_t deadline)
+    {
+        this->deadline = deadline;
+    }
+
+    // MARK: Skippable IMP
+    [[nodiscard]]
+    uint32_t getPeriod() const
+    {
+        return this->period;
+    }
+
+    // MARK: Valuable IMP
+    [[nodiscard]]
+    uint32_t getValue() const
+    {
+        return this->value;
+    }
 };
 
 #endif /* SimpleRealtimeTask_hpp */
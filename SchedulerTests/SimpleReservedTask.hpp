@@ -0,0 +1,54 @@
+//
+//  SimpleReservedTask.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef SimpleReservedTask_hpp
+#define SimpleReservedTask_hpp
+
+#include <Types.hpp>
+#include <LinkedList.hpp>
+#include <Scheduler/Scheduler.hpp>
+
+/// Task that has the earliest server deadline has the highest priority
+class SimpleReservedTask: public Listable<SimpleReservedTask>, public Scheduler::Schedulable, public Scheduler::StableHeapIndexable, public Scheduler::Reservable
+{
+private:
+    uint32_t identifier;
+
+public:
+    // MARK: Constructor
+    SimpleReservedTask(uint32_t identifier, uint64_t runtime, uint64_t period) :
+        Listable(), Reservable(runtime, period), identifier(identifier) {}
+
+    // MARK: Prioritizable IMP
+    friend bool operator<(const SimpleReservedTask& lhs, const SimpleReservedTask& rhs)
+    {
+        return lhs.getServerDeadline() > rhs.getServerDeadline();
+    }
+
+    friend bool operator>(const SimpleReservedTask& lhs, const SimpleReservedTask& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const SimpleReservedTask& lhs, const SimpleReservedTask& rhs)
+    {
+        return !(lhs > rhs);
+    }
+
+    friend bool operator>=(const SimpleReservedTask& lhs, const SimpleReservedTask& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+};
+
+#endif /* SimpleReservedTask_hpp */
@@ -13,6 +13,7 @@
 #include <LinkedList.hpp>
 #include <Scheduler/Scheduler.hpp>
 #include <Debug.hpp>
+#include <algorithm>
 
 class SimpleTask: public Listable<SimpleTask>, public Scheduler::Schedulable
 {
@@ -67,6 +68,19 @@ public:
         pinfo("SimpleTask%u: Remaining ticks is %u after tick.", this->identifier, this->ticks);
     }
 
+    void consumeTicks(uint32_t ticks)
+    {
+        this->ticks -= std::min(ticks, this->ticks);
+
+        pinfo("SimpleTask%u: Remaining ticks is %u after consuming %u ticks.", this->identifier, this->ticks, ticks);
+    }
+
+    [[nodiscard]]
+    uint32_t getRemainingTicks() const
+    {
+        return this->ticks;
+    }
+
     bool hasUsedUpTimeAllotment()
     {
         return this->ticks == 0;
@@ -94,7 +108,7 @@ public:
     // Quantum Specifier
     struct QuantumSpecifier
     {
-        uint32_t operator()(const uint32_t& priority)
+        constexpr uint32_t operator()(const uint32_t& priority)
         {
             switch (priority)
             {
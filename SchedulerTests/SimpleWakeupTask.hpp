@@ -0,0 +1,33 @@
+//
+//  SimpleWakeupTask.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef SimpleWakeupTask_hpp
+#define SimpleWakeupTask_hpp
+
+#include <Types.hpp>
+#include <LinkedList.hpp>
+#include <Scheduler/Scheduler.hpp>
+
+/// Task that can be woken up by other cores through the wakeup inbox of the core where it runs
+class SimpleWakeupTask: public Listable<SimpleWakeupTask>, public Scheduler::Schedulable, public Scheduler::WakeupLinkable<SimpleWakeupTask>
+{
+private:
+    uint32_t identifier;
+
+public:
+    // MARK: Constructor
+    explicit SimpleWakeupTask(uint32_t identifier) :
+        Listable(), identifier(identifier) {}
+
+    [[nodiscard]]
+    uint32_t getIdentifier() const
+    {
+        return this->identifier;
+    }
+};
+
+#endif /* SimpleWakeupTask_hpp */
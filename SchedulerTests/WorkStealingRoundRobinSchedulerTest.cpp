@@ -0,0 +1,449 @@
+//
+//  WorkStealingRoundRobinSchedulerTest.cpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#include "WorkStealingRoundRobinSchedulerTest.hpp"
+#include "SimpleWakeupTask.hpp"
+#include "SimpleGangTask.hpp"
+#include "SampleSchedulers.hpp"
+#include <Debug.hpp>
+#include <array>
+
+namespace Schedulers = SampleSchedulers;
+
+using Core = Scheduler::MultiCore::WorkStealing<Scheduler::Policies::FIFO::Normal::LinkedListImp<SimpleWakeupTask>>;
+
+using PackingCore = Scheduler::MultiCore::WorkStealing<Scheduler::Policies::FIFO::Normal::LinkedListImp<SimpleWakeupTask>, Scheduler::MultiCore::Balancers::Packing<>>;
+
+using IdleGovernor = Scheduler::Power::Governors::Menu<3>;
+
+using GangCore = Scheduler::MultiCore::PolicyWithGangScheduling<Scheduler::Policies::FIFO::Normal::LinkedListImp<SimpleGangTask>>;
+
+static_assert(Scheduler::Validation::validate<Schedulers::WorkStealingRoundRobin<SimpleWakeupTask>>());
+
+void WorkStealingRoundRobinSchedulerTest::runPrimitivesTest()
+{
+    // Test Setup
+    SimpleWakeupTask idleTask0(0);
+
+    SimpleWakeupTask idleTask1(0);
+
+    SimpleWakeupTask idleTask2(0);
+
+    SimpleWakeupTask t1(1);
+
+    SimpleWakeupTask t2(2);
+
+    SimpleWakeupTask t3(3);
+
+    SimpleWakeupTask t4(4);
+
+    Schedulers::WorkStealingRoundRobin<SimpleWakeupTask> core0(&idleTask0);
+
+    Schedulers::WorkStealingRoundRobin<SimpleWakeupTask> core1(&idleTask1);
+
+    Schedulers::WorkStealingRoundRobin<SimpleWakeupTask> core2(&idleTask2);
+
+    // A core that has not joined a domain behaves like a regular scheduler
+    core0.ready(&t1);
+
+    passert(core0.next()->getIdentifier() == 1, "Task 1 is the only task.");
+
+    passert(core0.next() == nullptr, "Empty ready queue");
+
+    Scheduler::MultiCore::Domain<Core, 3> domain;
+
+    domain.attach(0, core0);
+
+    domain.attach(1, core1);
+
+    domain.attach(2, core2);
+
+    // Core 1 has one ready task while core 2 has two
+    core1.ready(&t1);
+
+    core2.ready(&t2);
+
+    core2.ready(&t3);
+
+    passert(core0.getLoad() == 0 && core1.getLoad() == 1 && core2.getLoad() == 2, "Loads are tracked for each core.");
+
+    // Core 0 steals from the busiest core
+    passert(core0.next()->getIdentifier() == 2, "Core 0 steals Task 2 from core 2.");
+
+    passert(core2.getLoad() == 1, "Task 2 is removed from core 2.");
+
+    // Local tasks are preferred
+    core0.ready(&t4);
+
+    passert(core0.next()->getIdentifier() == 4, "Core 0 runs its own Task 4.");
+
+    // Both cores have one ready task, so the first one is chosen
+    passert(core0.next()->getIdentifier() == 1, "Core 0 steals Task 1 from core 1.");
+
+    passert(core0.next()->getIdentifier() == 3, "Core 0 steals Task 3 from core 2.");
+
+    passert(core0.next() == nullptr, "No core has any ready task.");
+
+    // Steal from a specific core
+    core1.ready(&t1);
+
+    passert(core2.stealFrom(core1)->getIdentifier() == 1, "Core 2 steals Task 1 from core 1.");
+
+    passert(core2.stealFrom(core1) == nullptr, "Core 1 does not have any ready task.");
+}
+
+void WorkStealingRoundRobinSchedulerTest::runTaskManagerDelegateTest()
+{
+    // Test Setup
+    SimpleWakeupTask idleTask0(0);
+
+    SimpleWakeupTask idleTask1(0);
+
+    SimpleWakeupTask t1(1);
+
+    SimpleWakeupTask t2(2);
+
+    SimpleWakeupTask t3(3);
+
+    Schedulers::WorkStealingRoundRobin<SimpleWakeupTask> core0(&idleTask0);
+
+    Schedulers::WorkStealingRoundRobin<SimpleWakeupTask> core1(&idleTask1);
+
+    Scheduler::MultiCore::Domain<Core, 2> domain;
+
+    domain.attach(0, core0);
+
+    domain.attach(1, core1);
+
+    // Task 1 runs on core 0 and creates Task 2 and Task 3
+    passert(core0.onTaskCreated(&t1, &t2)->getIdentifier() == 1, "Task 1 keeps running after Task 2 is created.");
+
+    passert(core0.onTaskCreated(&t1, &t3)->getIdentifier() == 1, "Task 1 keeps running after Task 3 is created.");
+
+    // Core 1 is idle and steals Task 2 from core 0 on a timer interrupt
+    passert(core1.onTimerInterrupt(core1.getIdleTask())->getIdentifier() == 2, "Core 1 steals Task 2 from core 0.");
+
+    // Task 2 has finished on core 1, so core 1 steals Task 3
+    passert(core1.onTaskFinished(&t2)->getIdentifier() == 3, "Core 1 steals Task 3 from core 0.");
+
+    // Task 1 has finished on core 0 and no core has any ready task
+    passert(core0.onTaskFinished(&t1) == core0.getIdleTask(), "Core 0 runs its idle task.");
+
+    // Task 3 has finished on core 1
+    passert(core1.onTaskFinished(&t3) == core1.getIdleTask(), "Core 1 runs its idle task.");
+}
+
+void WorkStealingRoundRobinSchedulerTest::runTimerInterruptDelegateTest()
+{
+    // Test Setup
+    SimpleWakeupTask idleTask0(0);
+
+    SimpleWakeupTask idleTask1(0);
+
+    SimpleWakeupTask t1(1);
+
+    SimpleWakeupTask t2(2);
+
+    SimpleWakeupTask t3(3);
+
+    Schedulers::WorkStealingRoundRobin<SimpleWakeupTask> core0(&idleTask0);
+
+    Schedulers::WorkStealingRoundRobin<SimpleWakeupTask> core1(&idleTask1);
+
+    Scheduler::MultiCore::Domain<Core, 2> domain;
+
+    domain.attach(0, core0);
+
+    domain.attach(1, core1);
+
+    // Task 1 is running on core 0, Task 2 is running on core 1, and Task 3 is ready on core 0
+    core0.ready(&t3);
+
+    passert(core0.onTimerInterrupt(&t1)->getIdentifier() == 3, "Task 3 preempts Task 1 on core 0.");
+
+    passert(core0.onTimerInterrupt(&t3)->getIdentifier() == 1, "Task 1 preempts Task 3 on core 0.");
+
+    // Core 1 runs Task 2 again since its own queue only has Task 2 after preemption
+    passert(core1.onTimerInterrupt(&t2)->getIdentifier() == 2, "Task 2 resumes on core 1.");
+
+    // Task 2 blocks, so core 1 steals Task 3 from core 0
+    passert(core1.onTaskBlocked(&t2)->getIdentifier() == 3, "Core 1 steals Task 3 from core 0.");
+
+    passert(core0.onTimerInterrupt(&t1)->getIdentifier() == 1, "Task 1 keeps running on core 0.");
+
+    // Energy awareness: A shallow state, a state that pays off after 4 ticks and a deep state that pays off after 40 ticks
+    IdleGovernor governor({ Scheduler::Power::IdleState{ 0, 0 }, Scheduler::Power::IdleState{ 2, 4 }, Scheduler::Power::IdleState{ 10, 40 } });
+
+    SimpleWakeupTask energyIdleTask0(0);
+
+    SimpleWakeupTask energyIdleTask1(0);
+
+    SimpleWakeupTask t4(4);
+
+    SimpleWakeupTask t5(5);
+
+    Schedulers::EnergyAwareRoundRobin<SimpleWakeupTask, IdleGovernor> energyCore0(&energyIdleTask0, governor);
+
+    Schedulers::EnergyAwareRoundRobin<SimpleWakeupTask, IdleGovernor> energyCore1(&energyIdleTask1, governor);
+
+    Scheduler::MultiCore::Domain<PackingCore, 2> energyDomain;
+
+    energyDomain.attach(0, energyCore0);
+
+    energyDomain.attach(1, energyCore1);
+
+    // Core 1 leaves a single ready task on core 0 and sleeps as deeply as possible without any history or timer event
+    energyCore0.ready(&t4);
+
+    passert(energyCore1.onTimerInterrupt(energyCore1.getIdleTask()) == energyCore1.getIdleTask(), "Core 1 does not steal the only ready task of core 0.");
+
+    passert(energyCore1.getIdleState() == 2, "Core 1 enters the deepest state when its idle duration is unknown.");
+
+    // The next timer event bounds the predicted idle duration
+    energyCore1.setNextWakeup(5);
+
+    passert(energyCore1.onTimerInterrupt(energyCore1.getIdleTask()) == energyCore1.getIdleTask(), "Core 1 stays idle.");
+
+    passert(energyCore1.getIdleState() == 1, "Core 1 enters the intermediate state since its timer fires in 5 ticks.");
+
+    // Core 1 steals once core 0 has a backlog
+    energyCore0.ready(&t5);
+
+    passert(energyCore1.onTimerInterrupt(energyCore1.getIdleTask())->getIdentifier() == 4, "Core 1 steals Task 4 from core 0.");
+
+    // Core 1 has been woken up every 3 ticks recently, so a deeper state would not pay off
+    energyCore1.setNextWakeup(UINT64_MAX);
+
+    for (int index = 0; index < 8; index += 1)
+    {
+        energyCore1.exitIdle(3);
+    }
+
+    passert(energyCore1.onTaskFinished(&t4) == energyCore1.getIdleTask(), "Core 1 does not steal the only ready task of core 0.");
+
+    passert(energyCore1.getIdleState() == 0, "Core 1 enters the shallowest state since it is typically idle for 3 ticks.");
+
+    // A single outlier is discarded
+    energyCore1.exitIdle(100);
+
+    energyCore1.enterIdle();
+
+    passert(energyCore1.getIdleState() == 0, "The outlier does not change the typical idle duration.");
+
+    // Idle periods that do not agree fall back to the next timer event
+    for (uint64_t residency : { 1, 50, 2, 80, 3, 60, 4, 90 })
+    {
+        energyCore1.exitIdle(residency);
+    }
+
+    energyCore1.enterIdle();
+
+    passert(energyCore1.getIdleState() == 2, "Core 1 enters the deepest state when its idle periods do not agree.");
+
+    // The latency limit excludes the deepest state
+    energyCore1.getGovernor().setLatencyLimit(5);
+
+    energyCore1.enterIdle();
+
+    passert(energyCore1.getIdleState() == 1, "The deepest state takes too long to leave.");
+}
+
+void WorkStealingRoundRobinSchedulerTest::runGroupOperationsTest()
+{
+    // Test Setup
+    SimpleWakeupTask idleTask0(0);
+
+    SimpleWakeupTask idleTask1(0);
+
+    SimpleWakeupTask t1(1);
+
+    SimpleWakeupTask t2(2);
+
+    SimpleWakeupTask t3(3);
+
+    SimpleWakeupTask t4(4);
+
+    Schedulers::WorkStealingRoundRobin<SimpleWakeupTask> core0(&idleTask0);
+
+    Schedulers::WorkStealingRoundRobin<SimpleWakeupTask> core1(&idleTask1);
+
+    Scheduler::MultiCore::Domain<Core, 2> domain;
+
+    domain.attach(0, core0);
+
+    domain.attach(1, core1);
+
+    // Task 1 is running on core 0 while core 1 is idle
+    // Core 1 wakes up Task 2, Task 3 and Task 4 that belong to core 0
+    core0.post(&t2);
+
+    core0.post(&t3);
+
+    core0.post(&t4);
+
+    passert(core0.getLoad() == 0, "Posted tasks are not in the ready queue until core 0 drains its inbox.");
+
+    // Core 0 drains its inbox on the next timer interrupt
+    passert(core0.onTimerInterrupt(&t1)->getIdentifier() == 2, "Task 2 preempts Task 1 in the order tasks were woken up.");
+
+    passert(core0.getLoad() == 3, "Task 3, Task 4 and Task 1 are ready on core 0.");
+
+    // Core 1 steals from core 0
+    passert(core1.onTimerInterrupt(core1.getIdleTask())->getIdentifier() == 3, "Core 1 steals Task 3 from core 0.");
+
+    passert(core0.onTimerInterrupt(&t2)->getIdentifier() == 4, "Task 4 preempts Task 2 on core 0.");
+
+    passert(core0.onTimerInterrupt(&t4)->getIdentifier() == 1, "Task 1 preempts Task 4 on core 0.");
+
+    // Gang scheduling: Task 5 leads a gang with Task 6 and Task 7 on three cores
+    SimpleGangTask gangIdleTask0(0);
+
+    SimpleGangTask gangIdleTask1(0);
+
+    SimpleGangTask gangIdleTask2(0);
+
+    SimpleGangTask t5(5);
+
+    SimpleGangTask t6(6);
+
+    SimpleGangTask t7(7);
+
+    SimpleGangTask t8(8);
+
+    Schedulers::GangRoundRobin<SimpleGangTask> gangCore0(&gangIdleTask0);
+
+    Schedulers::GangRoundRobin<SimpleGangTask> gangCore1(&gangIdleTask1);
+
+    Schedulers::GangRoundRobin<SimpleGangTask> gangCore2(&gangIdleTask2);
+
+    Scheduler::MultiCore::Domain<GangCore, 3> gangDomain;
+
+    gangDomain.attach(0, gangCore0);
+
+    gangDomain.attach(1, gangCore1);
+
+    gangDomain.attach(2, gangCore2);
+
+    Scheduler::MultiCore::Gang<SimpleGangTask> gang;
+
+    std::array<SimpleGangTask*, 3> members = { &t5, &t6, &t7 };
+
+    gang.enroll(members);
+
+    passert(gang.getLeader() == &t5 && gang.getSize() == 3, "Task 5 leads a gang of three tasks.");
+
+    // Members are parked until their leader is dispatched
+    gangCore0.ready(&t5);
+
+    gangCore1.ready(&t6);
+
+    gangCore1.ready(&t8);
+
+    gangCore2.ready(&t7);
+
+    passert(gangCore1.onTimerInterrupt(gangCore1.getIdleTask())->getIdentifier() == 8, "Task 6 is parked, so core 1 runs Task 8.");
+
+    passert(gangCore2.onTimerInterrupt(gangCore2.getIdleTask()) == gangCore2.getIdleTask(), "Task 7 is parked, so core 2 stays idle.");
+
+    // Core 0 dispatches the leader and signals the other cores
+    passert(gangCore0.onTimerInterrupt(gangCore0.getIdleTask())->getIdentifier() == 5, "Core 0 dispatches Task 5.");
+
+    passert(gang.isRunning() && gangCore0.getLaunchCount() == 1, "The gang is launched by core 0.");
+
+    passert(gangCore1.onTimerInterrupt(&t8)->getIdentifier() == 6, "Task 6 preempts Task 8 on core 1 at the tick boundary.");
+
+    passert(gangCore2.onTimerInterrupt(gangCore2.getIdleTask())->getIdentifier() == 7, "Task 7 runs on core 2 at the tick boundary.");
+
+    // Members keep running as long as their leader does, regardless of the order in which cores handle the tick
+    passert(gangCore1.onTimerInterrupt(&t6)->getIdentifier() == 6, "Task 6 keeps running on core 1.");
+
+    passert(gangCore0.onTimerInterrupt(&t5)->getIdentifier() == 5, "Task 5 keeps running on core 0.");
+
+    passert(gangCore2.onTimerInterrupt(&t7)->getIdentifier() == 7, "Task 7 keeps running on core 2.");
+
+    // Members are parked again once their leader stops running
+    passert(gangCore0.onTaskBlocked(&t5) == gangCore0.getIdleTask(), "Core 0 runs its idle task after Task 5 blocks.");
+
+    passert(!gang.isRunning(), "The gang stops running with its leader.");
+
+    passert(gangCore1.onTimerInterrupt(&t6)->getIdentifier() == 8, "Task 6 is parked, so core 1 runs Task 8.");
+
+    passert(gangCore2.onTimerInterrupt(&t7) == gangCore2.getIdleTask(), "Task 7 is parked, so core 2 stays idle.");
+
+    // The whole gang runs again once the leader is unblocked and dispatched
+    passert(gangCore0.onTaskUnblocked(gangCore0.getIdleTask(), &t5)->getIdentifier() == 5, "Task 5 preempts the idle task of core 0.");
+
+    passert(gangCore1.onTimerInterrupt(&t8)->getIdentifier() == 6, "Task 6 preempts Task 8 on core 1.");
+
+    passert(gangCore2.onTimerInterrupt(gangCore2.getIdleTask())->getIdentifier() == 7, "Task 7 runs on core 2.");
+
+    passert(gangCore0.getLaunchCount() == 3 && gangCore0.getFallbackCount() == 0, "The gang is launched every time Task 5 is dispatched.");
+
+    // Members can be removed wherever they wait
+    passert(gangCore0.onTaskBlocked(&t5) == gangCore0.getIdleTask(), "Core 0 runs its idle task after Task 5 blocks.");
+
+    passert(gangCore1.onTimerInterrupt(&t6)->getIdentifier() == 8 && gangCore2.onTimerInterrupt(&t7) == gangCore2.getIdleTask(), "Task 6 and Task 7 are parked.");
+
+    gangCore1.remove(&t6);
+
+    passert(gangCore0.onTaskUnblocked(gangCore0.getIdleTask(), &t5)->getIdentifier() == 5, "Task 5 preempts the idle task of core 0.");
+
+    passert(gangCore1.hasPendingMembers() && !gangCore2.hasPendingMembers(), "Only Task 7 is co-scheduled, on core 1, since Task 6 has been removed from the gang.");
+
+    gangCore1.remove(&t7);
+
+    passert(gangCore1.onTimerInterrupt(&t8)->getIdentifier() == 8, "Task 7 has been removed from the inbox of core 1.");
+
+    // Fallback: A gang of three tasks on two cores shares the core of its leader
+    SimpleGangTask smallIdleTask0(0);
+
+    SimpleGangTask smallIdleTask1(0);
+
+    SimpleGangTask t9(9);
+
+    SimpleGangTask t10(10);
+
+    SimpleGangTask t11(11);
+
+    Schedulers::GangRoundRobin<SimpleGangTask> smallCore0(&smallIdleTask0);
+
+    Schedulers::GangRoundRobin<SimpleGangTask> smallCore1(&smallIdleTask1);
+
+    Scheduler::MultiCore::Domain<GangCore, 2> smallDomain;
+
+    smallDomain.attach(0, smallCore0);
+
+    smallDomain.attach(1, smallCore1);
+
+    Scheduler::MultiCore::Gang<SimpleGangTask> largeGang;
+
+    std::array<SimpleGangTask*, 3> largeMembers = { &t9, &t10, &t11 };
+
+    largeGang.enroll(largeMembers);
+
+    smallCore0.ready(&t9);
+
+    smallCore1.ready(&t10);
+
+    smallCore1.ready(&t11);
+
+    passert(smallCore0.onTimerInterrupt(smallCore0.getIdleTask())->getIdentifier() == 9, "Core 0 dispatches Task 9.");
+
+    passert(!largeGang.isRunning() && smallCore0.getFallbackCount() == 1 && smallCore0.getLaunchCount() == 0, "Two cores cannot run a gang of three tasks.");
+
+    passert(smallCore1.onTimerInterrupt(smallCore1.getIdleTask()) == smallCore1.getIdleTask(), "Core 1 is not signalled.");
+
+    passert(smallCore0.onTimerInterrupt(&t9)->getIdentifier() == 10, "Task 10 shares core 0 with its leader.");
+
+    passert(smallCore0.onTimerInterrupt(&t10)->getIdentifier() == 11, "Task 11 shares core 0 with its leader.");
+
+    passert(smallCore0.onTimerInterrupt(&t11)->getIdentifier() == 9, "Task 9 runs again and the members are enqueued again.");
+
+    passert(smallCore0.getFallbackCount() == 2, "The members are enqueued on core 0 every time Task 9 is dispatched.");
+
+    passert(smallCore0.onTimerInterrupt(&t9)->getIdentifier() == 10, "Task 10 shares core 0 with its leader again.");
+}
@@ -0,0 +1,28 @@
+//
+//  WorkStealingRoundRobinSchedulerTest.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef WorkStealingRoundRobinSchedulerTest_hpp
+#define WorkStealingRoundRobinSchedulerTest_hpp
+
+#include "SchedulerTest.hpp"
+
+class WorkStealingRoundRobinSchedulerTest: public SchedulerTest
+{
+public:
+    WorkStealingRoundRobinSchedulerTest() : SchedulerTest("Work Stealing Round Robin") {}
+
+private:
+    void runPrimitivesTest() override;
+
+    void runTaskManagerDelegateTest() override;
+
+    void runTimerInterruptDelegateTest() override;
+
+    void runGroupOperationsTest() override;
+};
+
+#endif /* WorkStealingRoundRobinSchedulerTest_hpp */
@@ -0,0 +1,159 @@
+//
+//  Affinity.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_Affinity_hpp
+#define Scheduler_Affinity_hpp
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    ///
+    /// Provide the placement constraints of a task on a multicore system
+    ///
+    /// @note Classes inherited from `Affinity` can only run on the cores allowed by their affinity masks,
+    ///       prefer the cores on their home NUMA nodes and remember the core where they ran most recently,
+    ///       so that a task woken up later can be placed on a core whose caches are still warm.
+    /// @note The mask has one bit per core, so it covers the first 64 cores.
+    ///
+    struct Affinity
+    {
+    public:
+        /// A core index indicating that the task has not run on any core yet
+        static constexpr uint32_t kNoCore = UINT32_MAX;
+
+        /// A node index indicating that the task does not prefer any NUMA node
+        static constexpr uint32_t kAnyNode = UINT32_MAX;
+
+    private:
+        /// The cores on which the task may run, one bit per core
+        uint64_t affinityMask = UINT64_MAX;
+
+        /// The NUMA node where the memory of the task resides
+        uint32_t homeNode = kAnyNode;
+
+        /// The core where the task ran most recently
+        uint32_t lastCore = kNoCore;
+
+    public:
+        ///
+        /// Get the affinity mask of the task
+        ///
+        /// @return The cores on which the task may run, one bit per core.
+        ///
+        [[nodiscard]]
+        uint64_t getAffinityMask() const
+        {
+            return this->affinityMask;
+        }
+
+        ///
+        /// Set the affinity mask of the task
+        ///
+        /// @param mask A non-zero mask of the cores on which the task may run
+        /// @note The new mask takes effect the next time the task is placed or stolen,
+        ///       so the caller should migrate a ready task that resides on a core excluded by the new mask.
+        ///
+        void setAffinityMask(uint64_t mask)
+        {
+            this->affinityMask = mask;
+        }
+
+        ///
+        /// Get the home NUMA node of the task
+        ///
+        /// @return The node where the memory of the task resides, `kAnyNode` if the task does not prefer any node.
+        ///
+        [[nodiscard]]
+        uint32_t getHomeNode() const
+        {
+            return this->homeNode;
+        }
+
+        ///
+        /// Set the home NUMA node of the task
+        ///
+        /// @param node The node where the memory of the task resides, `kAnyNode` if the task does not prefer any node
+        ///
+        void setHomeNode(uint32_t node)
+        {
+            this->homeNode = node;
+        }
+
+        ///
+        /// Get the core where the task ran most recently
+        ///
+        /// @return The index of the core, `kNoCore` if the task has not run on any core yet.
+        ///
+        [[nodiscard]]
+        uint32_t getLastCore() const
+        {
+            return this->lastCore;
+        }
+
+        ///
+        /// Set the core where the task ran most recently
+        ///
+        /// @param core The index of the core
+        /// @note This method is invoked by the scheduler only.
+        ///
+        void setLastCore(uint32_t core)
+        {
+            this->lastCore = core;
+        }
+    };
+}
+
+/// A namespace where task constraints related to the scheduler are defined
+namespace TaskConstraints
+{
+    /// A type that restricts the cores on which it may run and prefers a NUMA node
+    template <typename Task>
+    concept HasAffinity = requires(Task& task, uint32_t core)
+    {
+        /// The task must report the cores on which it may run, one bit per core
+        { static_cast<const Task&>(task).getAffinityMask() } -> std::same_as<uint64_t>;
+
+        /// The task must report its home NUMA node
+        { static_cast<const Task&>(task).getHomeNode() } -> std::same_as<uint32_t>;
+
+        /// The task must report the core where it ran most recently
+        { static_cast<const Task&>(task).getLastCore() } -> std::same_as<uint32_t>;
+
+        /// The scheduler must be able to record the core where the task runs
+        { task.setLastCore(core) } -> std::same_as<void>;
+    };
+}
+
+/// Defines utilities related to task affinity
+namespace Scheduler::Utilities
+{
+    ///
+    /// Check whether the given task may run on the given core
+    ///
+    /// @param task A non-null task
+    /// @param core The index of a core
+    /// @return `true` if the affinity mask of the task allows the core, `true` if the task does not have any affinity, `false` otherwise.
+    ///
+    template <typename Task>
+    bool isAllowedOn(const Task* task, size_t core)
+    {
+        if constexpr (TaskConstraints::HasAffinity<Task>)
+        {
+            return core < 64 && ((task->getAffinityMask() >> core) & 1) != 0;
+        }
+        else
+        {
+            return true;
+        }
+    }
+}
+
+#endif /* Scheduler_Affinity_hpp */
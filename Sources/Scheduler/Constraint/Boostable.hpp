@@ -0,0 +1,71 @@
+//
+//  Boostable.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_Boostable_hpp
+#define Scheduler_Boostable_hpp
+
+#include <Scheduler/Constraint/Prioritizable.hpp>
+#include <concepts>
+#include <cstdint>
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    ///
+    /// Provide the storage for the boost epoch of a task that is moved to the top priority level by a periodic priority boost
+    ///
+    /// @note Classes inherited from `Boostable` remember the boost epoch in which they were enqueued,
+    ///       so that the policy can tell whether a ready task was enqueued before the most recent boost
+    ///       without visiting every ready task when the boost occurs.
+    ///
+    struct Boostable
+    {
+    private:
+        /// The boost epoch in which the task was enqueued
+        uint32_t boostEpoch = 0;
+
+    public:
+        ///
+        /// Get the boost epoch in which the task was enqueued
+        ///
+        /// @return The boost epoch recorded by the policy when the task was enqueued.
+        ///
+        [[nodiscard]]
+        uint32_t getBoostEpoch() const
+        {
+            return this->boostEpoch;
+        }
+
+        ///
+        /// Set the boost epoch in which the task is enqueued
+        ///
+        /// @param epoch The current boost epoch of the policy
+        /// @note This method is invoked by the policy only.
+        ///
+        void setBoostEpoch(uint32_t epoch)
+        {
+            this->boostEpoch = epoch;
+        }
+    };
+}
+
+/// A namespace where task constraints related to the scheduler are defined
+namespace TaskConstraints
+{
+    /// A type that can be moved to the top priority level by a periodic priority boost
+    template <typename Task>
+    concept Boostable = PrioritizableByMutablePriority<Task> && requires(Task& task, uint32_t epoch)
+    {
+        /// The task must report the boost epoch in which it was enqueued
+        { static_cast<const Task&>(task).getBoostEpoch() } -> std::same_as<uint32_t>;
+
+        /// The policy must be able to record the boost epoch when the task is enqueued
+        { task.setBoostEpoch(epoch) } -> std::same_as<void>;
+    };
+}
+
+#endif /* Scheduler_Boostable_hpp */
@@ -0,0 +1,56 @@
+//
+//  Deadline.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef Scheduler_Deadline_hpp
+#define Scheduler_Deadline_hpp
+
+#include <concepts>
+
+/// A namespace where task constraints related to the scheduler are defined
+namespace TaskConstraints
+{
+    /// A type that must finish its current job by an absolute deadline
+    template <typename Task>
+    concept Deadlined = requires(const Task& task)
+    {
+        /// The task must explicitly define its tick type
+        typename Task::Tick;
+
+        /// The tick type must be an unsigned integer
+        requires std::unsigned_integral<typename Task::Tick>;
+
+        /// The task should report the absolute deadline of its current job in ticks
+        { task.getDeadline() } -> std::same_as<typename Task::Tick>;
+    };
+
+    /// A type that releases a job every period, so a job that cannot meet its deadline can be skipped in favor of the next one
+    template <typename Task>
+    concept Skippable = Deadlined<Task> && requires(Task& task, typename Task::Tick deadline)
+    {
+        /// The task should report its period in ticks
+        { static_cast<const Task&>(task).getPeriod() } -> std::same_as<typename Task::Tick>;
+
+        /// The task should accept the deadline of a later job
+        { task.setDeadline(deadline) } -> std::same_as<void>;
+    };
+
+    /// A type that reports how valuable it is to the system, so less valuable tasks can be shed first under overload
+    template <typename Task>
+    concept Valuable = requires(const Task& task)
+    {
+        /// The task must explicitly define its value type
+        typename Task::Value;
+
+        /// Values must be totally ordered
+        requires std::totally_ordered<typename Task::Value>;
+
+        /// The task should report its value
+        { task.getValue() } -> std::same_as<typename Task::Value>;
+    };
+}
+
+#endif /* Scheduler_Deadline_hpp */
@@ -0,0 +1,78 @@
+//
+//  GangSchedulable.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef Scheduler_GangSchedulable_hpp
+#define Scheduler_GangSchedulable_hpp
+
+#include <concepts>
+
+/// Defines components that allow schedulers on different cores to cooperate
+namespace Scheduler::MultiCore
+{
+    /// A set of tasks that run simultaneously on different cores
+    template <typename Task>
+    class Gang;
+}
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    ///
+    /// Provide the storage for the gang of a task
+    ///
+    /// @tparam Task Specify the type of the task that belongs to the gang
+    /// @note Classes inherited from `GangSchedulable` can be enrolled in a gang,
+    ///       so that they are dispatched on different cores at the same time as the leader of the gang.
+    ///
+    template <typename Task>
+    struct GangSchedulable
+    {
+    private:
+        /// The gang of the task, `NULL` if the task does not belong to any gang
+        MultiCore::Gang<Task>* gang = nullptr;
+
+    public:
+        ///
+        /// Get the gang of the task
+        ///
+        /// @return The gang where the task has been enrolled, `NULL` if the task does not belong to any gang.
+        ///
+        [[nodiscard]]
+        MultiCore::Gang<Task>* getGang() const
+        {
+            return this->gang;
+        }
+
+        ///
+        /// Enroll the task in the given gang
+        ///
+        /// @param gang The gang, `NULL` to leave the current one
+        /// @note This method is invoked by the gang only.
+        ///
+        void setGang(MultiCore::Gang<Task>* gang)
+        {
+            this->gang = gang;
+        }
+    };
+}
+
+/// A namespace where task constraints related to the scheduler are defined
+namespace TaskConstraints
+{
+    /// A type that can be enrolled in a gang
+    template <typename Task>
+    concept GangSchedulable = requires(Task& task, Scheduler::MultiCore::Gang<Task>* gang)
+    {
+        /// The task must report its gang
+        { static_cast<const Task&>(task).getGang() } -> std::same_as<Scheduler::MultiCore::Gang<Task>*>;
+
+        /// The gang must be able to enroll the task
+        { task.setGang(gang) } -> std::same_as<void>;
+    };
+}
+
+#endif /* Scheduler_GangSchedulable_hpp */
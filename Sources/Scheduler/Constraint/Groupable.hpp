@@ -0,0 +1,71 @@
+//
+//  Groupable.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_Groupable_hpp
+#define Scheduler_Groupable_hpp
+
+#include <concepts>
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    /// A scheduling group that is defined by hierarchical scheduling policies
+    template <typename Task>
+    class SchedulingGroup;
+
+    ///
+    /// Provide the storage for the scheduling group of a task
+    ///
+    /// @tparam Task Specify the type of the task that belongs to the group
+    /// @note Classes inherited from `Groupable` can be managed by hierarchical scheduling policies,
+    ///       which enqueue a task into the child policy of its group.
+    ///
+    template <typename Task>
+    struct Groupable
+    {
+    private:
+        /// The leaf group where the task is scheduled
+        SchedulingGroup<Task>* group = nullptr;
+
+    public:
+        ///
+        /// Get the scheduling group of the task
+        ///
+        /// @return The leaf group where the task is scheduled.
+        ///
+        [[nodiscard]]
+        SchedulingGroup<Task>* getGroup() const
+        {
+            return this->group;
+        }
+
+        ///
+        /// Move the task to the given scheduling group
+        ///
+        /// @param group A non-null leaf group
+        /// @warning The caller must not move a task that resides in a ready queue.
+        ///
+        void setGroup(SchedulingGroup<Task>* group)
+        {
+            this->group = group;
+        }
+    };
+}
+
+/// A namespace where task constraints related to the scheduler are defined
+namespace TaskConstraints
+{
+    /// A type that belongs to a scheduling group
+    template <typename Task>
+    concept Groupable = requires(const Task& task)
+    {
+        /// The task must report the leaf group where it is scheduled
+        { task.getGroup() } -> std::same_as<Scheduler::SchedulingGroup<Task>*>;
+    };
+}
+
+#endif /* Scheduler_Groupable_hpp */
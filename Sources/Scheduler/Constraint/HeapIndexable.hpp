@@ -0,0 +1,118 @@
+//
+//  HeapIndexable.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_HeapIndexable_hpp
+#define Scheduler_HeapIndexable_hpp
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    ///
+    /// Provide the storage for the position of a task in an intrusive heap
+    ///
+    /// @note Classes inherited from `HeapIndexable` can be managed by heap-based scheduling policies,
+    ///       which use the stored position to remove or reposition a task without searching the heap.
+    ///
+    struct HeapIndexable
+    {
+    private:
+        /// The index of the task in the heap that currently holds it
+        size_t heapIndex = 0;
+
+    public:
+        ///
+        /// Get the position of the task in the heap
+        ///
+        /// @return The index of the task in its heap.
+        /// @warning The returned value is meaningful only if the task resides in a heap.
+        ///
+        [[nodiscard]]
+        size_t getHeapIndex() const
+        {
+            return this->heapIndex;
+        }
+
+        ///
+        /// Set the position of the task in the heap
+        ///
+        /// @param index The new index of the task in its heap
+        /// @note This method is invoked by the heap only.
+        ///
+        void setHeapIndex(size_t index)
+        {
+            this->heapIndex = index;
+        }
+    };
+
+    ///
+    /// Provide the storage for the position and the enqueue sequence number of a task in an intrusive heap
+    ///
+    /// @note Classes inherited from `StableHeapIndexable` can be managed by stable heap-based scheduling policies,
+    ///       which use the sequence number to dequeue tasks of the same priority level in the order they are enqueued.
+    ///
+    struct StableHeapIndexable: public HeapIndexable
+    {
+    private:
+        /// The sequence number assigned by the policy when the task is enqueued
+        uint64_t heapSequence = 0;
+
+    public:
+        ///
+        /// Get the sequence number assigned to the task when it is enqueued
+        ///
+        /// @return The enqueue sequence number of the task.
+        ///
+        [[nodiscard]]
+        uint64_t getHeapSequence() const
+        {
+            return this->heapSequence;
+        }
+
+        ///
+        /// Set the sequence number of the task
+        ///
+        /// @param sequence The enqueue sequence number
+        /// @note This method is invoked by the policy only.
+        ///
+        void setHeapSequence(uint64_t sequence)
+        {
+            this->heapSequence = sequence;
+        }
+    };
+}
+
+/// A namespace where task constraints related to the scheduler are defined
+namespace TaskConstraints
+{
+    /// A type that records its own position in an intrusive heap
+    template <typename Task>
+    concept HeapIndexable = requires(Task& task, size_t index)
+    {
+        /// The task must be able to report its position in the heap
+        { static_cast<const Task&>(task).getHeapIndex() } -> std::same_as<size_t>;
+
+        /// The heap must be able to update the position of the task
+        { task.setHeapIndex(index) } -> std::same_as<void>;
+    };
+
+    /// A type that records its own position and enqueue sequence number in an intrusive heap
+    template <typename Task>
+    concept StableHeapIndexable = HeapIndexable<Task> && requires(Task& task, uint64_t sequence)
+    {
+        /// The task must be able to report its enqueue sequence number
+        { static_cast<const Task&>(task).getHeapSequence() } -> std::same_as<uint64_t>;
+
+        /// The policy must be able to assign an enqueue sequence number to the task
+        { task.setHeapSequence(sequence) } -> std::same_as<void>;
+    };
+}
+
+#endif /* Scheduler_HeapIndexable_hpp */
@@ -0,0 +1,154 @@
+//
+//  Instrumentable.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_Instrumentable_hpp
+#define Scheduler_Instrumentable_hpp
+
+#include <concepts>
+#include <cstdint>
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    ///
+    /// Provide the storage for the timestamps and the accumulated times recorded by an instrumentation recorder
+    ///
+    /// @note Classes inherited from `Instrumentable` let a recorder measure how long each task waits in the ready queue
+    ///       and how long each task runs once it has been selected, without keeping a side table indexed by task.
+    /// @note All values are measured in the unit of the clock used by the recorder.
+    ///
+    struct Instrumentable
+    {
+    private:
+        /// The time when the task was last enqueued
+        uint64_t readyTimestamp = 0;
+
+        /// The time when the task was last selected to run
+        uint64_t dispatchTimestamp = 0;
+
+        /// The total amount of time the task has spent in the ready queue
+        uint64_t totalWaitTime = 0;
+
+        /// The total amount of time the task has spent running
+        uint64_t totalRunTime = 0;
+
+    public:
+        ///
+        /// Get the time when the task was last enqueued
+        ///
+        /// @return The timestamp recorded when the task was last passed to `ready()`.
+        ///
+        [[nodiscard]]
+        uint64_t getReadyTimestamp() const
+        {
+            return this->readyTimestamp;
+        }
+
+        ///
+        /// Set the time when the task is enqueued
+        ///
+        /// @param timestamp The current time
+        /// @note This method is invoked by the recorder only.
+        ///
+        void setReadyTimestamp(uint64_t timestamp)
+        {
+            this->readyTimestamp = timestamp;
+        }
+
+        ///
+        /// Get the time when the task was last selected to run
+        ///
+        /// @return The timestamp recorded when the task was last returned by an event handler.
+        ///
+        [[nodiscard]]
+        uint64_t getDispatchTimestamp() const
+        {
+            return this->dispatchTimestamp;
+        }
+
+        ///
+        /// Set the time when the task is selected to run
+        ///
+        /// @param timestamp The current time
+        /// @note This method is invoked by the recorder only.
+        ///
+        void setDispatchTimestamp(uint64_t timestamp)
+        {
+            this->dispatchTimestamp = timestamp;
+        }
+
+        ///
+        /// Get the total amount of time the task has spent in the ready queue
+        ///
+        /// @return The accumulated runnable-wait time of the task.
+        ///
+        [[nodiscard]]
+        uint64_t getTotalWaitTime() const
+        {
+            return this->totalWaitTime;
+        }
+
+        ///
+        /// Charge the task for the given amount of time spent in the ready queue
+        ///
+        /// @param time The amount of time the task has waited since it was last enqueued
+        /// @note This method is invoked by the recorder only.
+        ///
+        void addWaitTime(uint64_t time)
+        {
+            this->totalWaitTime += time;
+        }
+
+        ///
+        /// Get the total amount of time the task has spent running
+        ///
+        /// @return The accumulated run time of the task.
+        ///
+        [[nodiscard]]
+        uint64_t getTotalRunTime() const
+        {
+            return this->totalRunTime;
+        }
+
+        ///
+        /// Charge the task for the given amount of time spent running
+        ///
+        /// @param time The amount of time the task has run since it was last selected
+        /// @note This method is invoked by the recorder only.
+        ///
+        void addRunTime(uint64_t time)
+        {
+            this->totalRunTime += time;
+        }
+    };
+}
+
+/// A namespace where task constraints related to the scheduler are defined
+namespace TaskConstraints
+{
+    /// A type that stores the timestamps and the accumulated times recorded by an instrumentation recorder
+    template <typename Task>
+    concept Instrumentable = requires(Task& task, uint64_t value)
+    {
+        /// The task must provide the storage for the time when it is enqueued
+        { task.getReadyTimestamp() } -> std::same_as<uint64_t>;
+
+        { task.setReadyTimestamp(value) } -> std::same_as<void>;
+
+        /// The task must provide the storage for the time when it is selected to run
+        { task.getDispatchTimestamp() } -> std::same_as<uint64_t>;
+
+        { task.setDispatchTimestamp(value) } -> std::same_as<void>;
+
+        /// The task must accumulate the time it spends in the ready queue and the time it spends running
+        { task.addWaitTime(value) } -> std::same_as<void>;
+
+        { task.addRunTime(value) } -> std::same_as<void>;
+    };
+}
+
+#endif /* Scheduler_Instrumentable_hpp */
@@ -0,0 +1,34 @@
+//
+//  Periodic.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_Periodic_hpp
+#define Scheduler_Periodic_hpp
+
+#include <concepts>
+
+/// A namespace where task constraints related to the scheduler are defined
+namespace TaskConstraints
+{
+    /// A type that releases a job at the start of each period and needs at most a fixed number of ticks to finish each job
+    template <typename Task>
+    concept Periodic = requires(const Task& task)
+    {
+        /// The task must explicitly define its tick type
+        typename Task::Tick;
+
+        /// The tick type must be an unsigned integer
+        requires std::unsigned_integral<typename Task::Tick>;
+
+        /// The task should report its period in ticks, which does not change while the task is admitted
+        { task.getPeriod() } -> std::same_as<typename Task::Tick>;
+
+        /// The task should report the worst-case number of ticks needed by each job, which does not exceed its period
+        { task.getExecutionTime() } -> std::same_as<typename Task::Tick>;
+    };
+}
+
+#endif /* Scheduler_Periodic_hpp */
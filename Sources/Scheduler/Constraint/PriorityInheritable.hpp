@@ -0,0 +1,192 @@
+//
+//  PriorityInheritable.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_PriorityInheritable_hpp
+#define Scheduler_PriorityInheritable_hpp
+
+#include <Scheduler/Constraint/Prioritizable.hpp>
+#include <concepts>
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    /// A mutex whose owner inherits the priority of its waiters, which is defined by the priority inheritance policy
+    template <typename Task>
+    class PriorityInheritanceMutex;
+
+    ///
+    /// Provide the storage for the mutexes held or awaited by a task under the priority inheritance protocol
+    ///
+    /// @tparam Task Specify the type of the task
+    /// @tparam Priority Specify the type of the priority level of the task
+    /// @note Classes inherited from `PriorityInheritable` can be boosted by the tasks that wait for the mutexes they hold.
+    ///       The priority reported by `getPriority()` is the effective priority of the task,
+    ///       while the base priority is recorded when the task acquires its first mutex and restored when it releases its last one.
+    ///
+    template <typename Task, typename Priority>
+    struct PriorityInheritable
+    {
+    private:
+        /// The priority of the task before it inherits any priority
+        Priority basePriority = {};
+
+        /// The mutex that the task waits for, `NULL` if the task does not wait for any mutex
+        PriorityInheritanceMutex<Task>* blockingMutex = nullptr;
+
+        /// The most recently acquired mutex held by the task, `NULL` if the task does not hold any mutex
+        PriorityInheritanceMutex<Task>* heldMutexes = nullptr;
+
+        /// The next task that waits for the same mutex
+        Task* nextWaiter = nullptr;
+
+        /// `true` if the task resides in the ready queue
+        bool inReadyQueue = false;
+
+    public:
+        ///
+        /// Get the base priority of the task
+        ///
+        /// @return The priority before the task inherits any priority, valid only if the task holds any mutex.
+        ///
+        [[nodiscard]]
+        const Priority& getBasePriority() const
+        {
+            return this->basePriority;
+        }
+
+        ///
+        /// Set the base priority of the task
+        ///
+        /// @param priority The priority before the task inherits any priority
+        /// @note This method is invoked by the scheduler only.
+        ///
+        void setBasePriority(const Priority& priority)
+        {
+            this->basePriority = priority;
+        }
+
+        ///
+        /// Get the mutex that the task waits for
+        ///
+        /// @return The mutex that the task waits for, `NULL` if the task does not wait for any mutex.
+        ///
+        [[nodiscard]]
+        PriorityInheritanceMutex<Task>* getBlockingMutex() const
+        {
+            return this->blockingMutex;
+        }
+
+        ///
+        /// Set the mutex that the task waits for
+        ///
+        /// @param mutex The mutex that the task waits for, `NULL` if the task does not wait for any mutex
+        /// @note This method is invoked by the scheduler only.
+        ///
+        void setBlockingMutex(PriorityInheritanceMutex<Task>* mutex)
+        {
+            this->blockingMutex = mutex;
+        }
+
+        ///
+        /// Get the most recently acquired mutex held by the task
+        ///
+        /// @return The head of the list of mutexes held by the task, `NULL` if the task does not hold any mutex.
+        ///
+        [[nodiscard]]
+        PriorityInheritanceMutex<Task>* getHeldMutexes() const
+        {
+            return this->heldMutexes;
+        }
+
+        ///
+        /// Set the most recently acquired mutex held by the task
+        ///
+        /// @param mutex The head of the list of mutexes held by the task
+        /// @note This method is invoked by the scheduler only.
+        ///
+        void setHeldMutexes(PriorityInheritanceMutex<Task>* mutex)
+        {
+            this->heldMutexes = mutex;
+        }
+
+        ///
+        /// Get the next task that waits for the same mutex
+        ///
+        /// @return The next waiter, `NULL` if the task is the last one.
+        ///
+        [[nodiscard]]
+        Task* getNextWaiter() const
+        {
+            return this->nextWaiter;
+        }
+
+        ///
+        /// Set the next task that waits for the same mutex
+        ///
+        /// @param task The next waiter
+        /// @note This method is invoked by the scheduler only.
+        ///
+        void setNextWaiter(Task* task)
+        {
+            this->nextWaiter = task;
+        }
+
+        ///
+        /// Check whether the task resides in the ready queue
+        ///
+        /// @return `true` if the task has been enqueued and not yet dequeued, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool isInReadyQueue() const
+        {
+            return this->inReadyQueue;
+        }
+
+        ///
+        /// Record whether the task resides in the ready queue
+        ///
+        /// @param ready `true` if the task has been enqueued, `false` if it has been dequeued or removed
+        /// @note This method is invoked by the scheduler only.
+        ///
+        void setInReadyQueue(bool ready)
+        {
+            this->inReadyQueue = ready;
+        }
+    };
+}
+
+/// A namespace where task constraints related to the scheduler are defined
+namespace TaskConstraints
+{
+    /// A type whose priority can be boosted by the tasks that wait for the mutexes it holds
+    template <typename Task>
+    concept PriorityInheritable = PrioritizableByMutablePriority<Task> &&
+                                  requires(Task& task, const typename Task::Priority& priority, Scheduler::PriorityInheritanceMutex<Task>* mutex, bool ready)
+    {
+        /// The task must store its base priority
+        { static_cast<const Task&>(task).getBasePriority() } -> std::same_as<const typename Task::Priority&>;
+        { task.setBasePriority(priority) } -> std::same_as<void>;
+
+        /// The task must store the mutex it waits for
+        { static_cast<const Task&>(task).getBlockingMutex() } -> std::same_as<Scheduler::PriorityInheritanceMutex<Task>*>;
+        { task.setBlockingMutex(mutex) } -> std::same_as<void>;
+
+        /// The task must store the list of mutexes it holds
+        { static_cast<const Task&>(task).getHeldMutexes() } -> std::same_as<Scheduler::PriorityInheritanceMutex<Task>*>;
+        { task.setHeldMutexes(mutex) } -> std::same_as<void>;
+
+        /// The task must be linkable into the list of waiters of a mutex
+        { static_cast<const Task&>(task).getNextWaiter() } -> std::same_as<Task*>;
+        { task.setNextWaiter(&task) } -> std::same_as<void>;
+
+        /// The task must record whether it resides in the ready queue
+        { static_cast<const Task&>(task).isInReadyQueue() } -> std::same_as<bool>;
+        { task.setInReadyQueue(ready) } -> std::same_as<void>;
+    };
+}
+
+#endif /* Scheduler_PriorityInheritable_hpp */
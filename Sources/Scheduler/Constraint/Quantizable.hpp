@@ -33,6 +33,19 @@ namespace TaskConstraints
         /// Other entity should be able to allocate a certain number of ticks to the task
         { task.allocateTicks(ticks) } -> std::same_as<void>;
     };
+
+    /// A type that has time ticks allocated and can be charged for elapsed ticks in bulk,
+    /// so that the caller may program a one-shot timer instead of a periodic timer tick
+    template <typename Task>
+    concept TicklessQuantizable = Quantizable<Task> && requires(Task& task, typename Task::Tick ticks)
+    {
+        /// The task should deduct the given number of elapsed ticks from its remaining ticks,
+        /// saturating at zero if more ticks have elapsed than the task has left
+        { task.consumeTicks(ticks) } -> std::same_as<void>;
+
+        /// The task should report the number of ticks left in its time allotment
+        { task.getRemainingTicks() } -> std::same_as<typename Task::Tick>;
+    };
 }
 
 #endif /* Scheduler_Quantizable_hpp */
@@ -0,0 +1,192 @@
+//
+//  Reservable.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_Reservable_hpp
+#define Scheduler_Reservable_hpp
+
+#include <concepts>
+#include <cstdint>
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    ///
+    /// Provide the storage for the bandwidth reservation of a task
+    ///
+    /// @note Classes inherited from `Reservable` can be served by a constant bandwidth server,
+    ///       which grants a task at most `runtime` ticks in every `period` ticks,
+    ///       and orders ready tasks by their server deadlines rather than the deadlines of their jobs.
+    /// @note All times are measured in ticks of the timer that drives the scheduler.
+    ///
+    struct Reservable
+    {
+    private:
+        /// The maximum number of ticks the task may run in each period
+        uint64_t runtime = 0;
+
+        /// The length of each reservation period
+        uint64_t period = 0;
+
+        /// The number of ticks left in the current reservation period
+        uint64_t remainingBudget = 0;
+
+        /// The absolute deadline assigned by the server
+        uint64_t serverDeadline = 0;
+
+        /// The absolute time when a throttled task receives its next budget
+        uint64_t replenishmentTime = 0;
+
+    public:
+        ///
+        /// Create a task that does not have a reservation yet
+        ///
+        Reservable() = default;
+
+        ///
+        /// Create a task that reserves the given bandwidth
+        ///
+        /// @param runtime The maximum number of ticks the task may run in each period
+        /// @param period The length of each reservation period, which must not be less than `runtime`
+        ///
+        Reservable(uint64_t runtime, uint64_t period) :
+            runtime(runtime), period(period) {}
+
+        ///
+        /// Get the maximum number of ticks the task may run in each period
+        ///
+        /// @return The reserved runtime.
+        ///
+        [[nodiscard]]
+        uint64_t getReservedRuntime() const
+        {
+            return this->runtime;
+        }
+
+        ///
+        /// Get the length of each reservation period
+        ///
+        /// @return The reservation period.
+        ///
+        [[nodiscard]]
+        uint64_t getReservationPeriod() const
+        {
+            return this->period;
+        }
+
+        ///
+        /// Set the bandwidth reserved by the task
+        ///
+        /// @param runtime The maximum number of ticks the task may run in each period
+        /// @param period The length of each reservation period, which must not be less than `runtime`
+        /// @note The new reservation takes effect the next time the task receives its budget.
+        ///
+        void setReservation(uint64_t runtime, uint64_t period)
+        {
+            this->runtime = runtime;
+
+            this->period = period;
+        }
+
+        ///
+        /// Get the number of ticks left in the current reservation period
+        ///
+        /// @return The remaining budget, 0 if the task has been throttled.
+        ///
+        [[nodiscard]]
+        uint64_t getRemainingBudget() const
+        {
+            return this->remainingBudget;
+        }
+
+        ///
+        /// Set the number of ticks left in the current reservation period
+        ///
+        /// @param budget The new remaining budget
+        /// @note This method is invoked by the server only.
+        ///
+        void setRemainingBudget(uint64_t budget)
+        {
+            this->remainingBudget = budget;
+        }
+
+        ///
+        /// Get the absolute deadline assigned by the server
+        ///
+        /// @return The server deadline that orders the task among ready tasks.
+        ///
+        [[nodiscard]]
+        uint64_t getServerDeadline() const
+        {
+            return this->serverDeadline;
+        }
+
+        ///
+        /// Set the absolute deadline assigned by the server
+        ///
+        /// @param deadline The new server deadline
+        /// @note This method is invoked by the server only.
+        /// @warning The server deadline of a task must not change while the task resides in a ready queue.
+        ///
+        void setServerDeadline(uint64_t deadline)
+        {
+            this->serverDeadline = deadline;
+        }
+
+        ///
+        /// Get the absolute time when a throttled task receives its next budget
+        ///
+        /// @return The replenishment time, meaningful only if the task has been throttled.
+        ///
+        [[nodiscard]]
+        uint64_t getReplenishmentTime() const
+        {
+            return this->replenishmentTime;
+        }
+
+        ///
+        /// Set the absolute time when a throttled task receives its next budget
+        ///
+        /// @param time The new replenishment time
+        /// @note This method is invoked by the server only.
+        ///
+        void setReplenishmentTime(uint64_t time)
+        {
+            this->replenishmentTime = time;
+        }
+    };
+}
+
+/// A namespace where task constraints related to the scheduler are defined
+namespace TaskConstraints
+{
+    /// A type that reserves a fraction of the processor bandwidth as a budget of ticks replenished every period
+    template <typename Task>
+    concept Reservable = requires(Task& task, uint64_t ticks)
+    {
+        /// The task should report its reservation
+        { static_cast<const Task&>(task).getReservedRuntime() } -> std::same_as<uint64_t>;
+
+        { static_cast<const Task&>(task).getReservationPeriod() } -> std::same_as<uint64_t>;
+
+        /// The server should be able to track the budget of the task
+        { static_cast<const Task&>(task).getRemainingBudget() } -> std::same_as<uint64_t>;
+
+        { task.setRemainingBudget(ticks) } -> std::same_as<void>;
+
+        /// The server should be able to assign a deadline to the task
+        { static_cast<const Task&>(task).getServerDeadline() } -> std::same_as<uint64_t>;
+
+        { task.setServerDeadline(ticks) } -> std::same_as<void>;
+
+        /// The server should be able to record when a throttled task receives its next budget
+        { static_cast<const Task&>(task).getReplenishmentTime() } -> std::same_as<uint64_t>;
+
+        { task.setReplenishmentTime(ticks) } -> std::same_as<void>;
+    };
+}
+
+#endif /* Scheduler_Reservable_hpp */
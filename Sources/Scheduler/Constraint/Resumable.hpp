@@ -0,0 +1,70 @@
+//
+//  Resumable.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_Resumable_hpp
+#define Scheduler_Resumable_hpp
+
+#include <concepts>
+#include <coroutine>
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    ///
+    /// Provide the storage for the coroutine that implements the body of a task
+    ///
+    /// @note Classes inherited from `Resumable` can be run by `Coroutines::Executor`,
+    ///       which resumes the coroutine directly instead of switching to another stack.
+    /// @note The handle is owned by the executor while the task has been spawned and has not finished yet.
+    ///
+    struct Resumable
+    {
+    private:
+        /// The coroutine that implements the body of the task, `NULL` if the task has not been spawned
+        std::coroutine_handle<> handle = nullptr;
+
+    public:
+        ///
+        /// Get the coroutine that implements the body of the task
+        ///
+        /// @return The coroutine handle, `NULL` if the task has not been spawned or has finished.
+        ///
+        [[nodiscard]]
+        std::coroutine_handle<> getHandle() const
+        {
+            return this->handle;
+        }
+
+        ///
+        /// Set the coroutine that implements the body of the task
+        ///
+        /// @param handle The coroutine handle
+        /// @note This method is invoked by the executor only.
+        ///
+        void setHandle(std::coroutine_handle<> handle)
+        {
+            this->handle = handle;
+        }
+    };
+}
+
+/// A namespace where task constraints related to the scheduler are defined
+namespace TaskConstraints
+{
+    /// A type whose body is a coroutine that can be resumed by an executor
+    template <typename Task>
+    concept Resumable = requires(Task& task, std::coroutine_handle<> handle)
+    {
+        /// The task must report its coroutine
+        { static_cast<const Task&>(task).getHandle() } -> std::same_as<std::coroutine_handle<>>;
+
+        /// The executor must be able to attach a coroutine to the task
+        { task.setHandle(handle) } -> std::same_as<void>;
+    };
+}
+
+#endif /* Scheduler_Resumable_hpp */
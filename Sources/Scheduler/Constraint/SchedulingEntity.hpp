@@ -0,0 +1,173 @@
+//
+//  SchedulingEntity.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_SchedulingEntity_hpp
+#define Scheduler_SchedulingEntity_hpp
+
+#include <Scheduler/Constraint/Schedulable.hpp>
+#include <LinkedList.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    ///
+    /// A compact header that packs the state read by scheduling policies into half of a cache line
+    ///
+    /// @tparam Task Specify the type of the task that embeds this header
+    /// @note The header provides the intrusive queue links, the priority level, the remaining ticks and the heap index of a task,
+    ///       so a policy that walks a ready queue or sifts a heap touches the header only instead of the whole task control block.
+    ///       A task derived from `SchedulingEntity` satisfies `ListableItem`, `PrioritizableByMutablePriority`,
+    ///       `TicklessQuantizable` and `HeapIndexable` without defining any of them.
+    /// @note The heap index is stored in 32 bits, which limits a heap to 4 billion tasks.
+    ///       The header leaves no room for an enqueue sequence number, so it does not satisfy `StableHeapIndexable`.
+    /// @warning The header should be the first base class of the task, so that it starts at the beginning of the task control block
+    ///          and the alignment requirement keeps it within a single cache line.
+    ///
+    template <typename Task>
+    struct alignas(32) SchedulingEntity: public Listable<Task>, public Schedulable
+    {
+    public:
+        /// The type of the priority level
+        using Priority = uint32_t;
+
+        /// The type of the time ticks
+        using Tick = uint32_t;
+
+    private:
+        /// The current priority level, the larger the value, the higher the priority
+        uint32_t priority;
+
+        /// The number of ticks left in the current time allotment
+        uint32_t ticks;
+
+        /// The index of the task in the heap that currently holds it
+        uint32_t heapIndex;
+
+    public:
+        ///
+        /// Initialize the header with the given priority level
+        ///
+        /// @param priority The initial priority level of the task
+        ///
+        explicit SchedulingEntity(uint32_t priority = 0) : Listable<Task>(), priority(priority), ticks(0), heapIndex(0) {}
+
+        // MARK: Prioritizable By Mutable Priority IMP
+
+        ///
+        /// Get the current priority level of the task
+        ///
+        /// @return The priority level.
+        ///
+        [[nodiscard]]
+        const uint32_t& getPriority() const
+        {
+            return this->priority;
+        }
+
+        ///
+        /// Set the priority level of the task
+        ///
+        /// @param priority The new priority level
+        /// @warning The caller must adjust the position of the task if it resides in a ready queue.
+        ///
+        void setPriority(const uint32_t& priority)
+        {
+            this->priority = priority;
+        }
+
+        // MARK: Tickless Quantizable IMP
+
+        ///
+        /// Deduct one tick from the remaining ticks on a timer tick
+        ///
+        /// @note The remaining ticks saturate at zero,
+        ///       since a task selected to run without being enqueued may not have been allocated a quantum.
+        ///
+        void tick()
+        {
+            if (this->ticks > 0)
+            {
+                this->ticks -= 1;
+            }
+        }
+
+        ///
+        /// Deduct the given number of elapsed ticks from the remaining ticks
+        ///
+        /// @param ticks The number of elapsed ticks
+        /// @note The remaining ticks saturate at zero.
+        ///
+        void consumeTicks(uint32_t ticks)
+        {
+            this->ticks -= std::min(ticks, this->ticks);
+        }
+
+        ///
+        /// Get the number of ticks left in the current time allotment
+        ///
+        /// @return The remaining ticks.
+        ///
+        [[nodiscard]]
+        uint32_t getRemainingTicks() const
+        {
+            return this->ticks;
+        }
+
+        ///
+        /// Check whether the task has used up its time allotment
+        ///
+        /// @return `true` if no tick is left, `false` otherwise.
+        ///
+        bool hasUsedUpTimeAllotment()
+        {
+            return this->ticks == 0;
+        }
+
+        ///
+        /// Allocate the given number of ticks to the task
+        ///
+        /// @param ticks The new time allotment
+        ///
+        void allocateTicks(uint32_t ticks)
+        {
+            this->ticks = ticks;
+        }
+
+        // MARK: Heap Indexable IMP
+
+        ///
+        /// Get the position of the task in the heap
+        ///
+        /// @return The index of the task in its heap.
+        /// @warning The returned value is meaningful only if the task resides in a heap.
+        ///
+        [[nodiscard]]
+        size_t getHeapIndex() const
+        {
+            return this->heapIndex;
+        }
+
+        ///
+        /// Set the position of the task in the heap
+        ///
+        /// @param index The new index of the task in its heap
+        /// @note This method is invoked by the heap only.
+        ///
+        void setHeapIndex(size_t index)
+        {
+            this->heapIndex = static_cast<uint32_t>(index);
+        }
+    };
+
+    // The layout does not depend on the task type, since the header stores pointers to the task only
+    static_assert(sizeof(SchedulingEntity<struct SchedulingEntityLayoutProbe>) == 32, "The scheduling entity must fit in 32 bytes.");
+}
+
+#endif /* Scheduler_SchedulingEntity_hpp */
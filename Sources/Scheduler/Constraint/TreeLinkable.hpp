@@ -0,0 +1,158 @@
+//
+//  TreeLinkable.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_TreeLinkable_hpp
+#define Scheduler_TreeLinkable_hpp
+
+#include <concepts>
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    ///
+    /// Provide the links and the color of a task as a node in an intrusive red-black tree
+    ///
+    /// @tparam Task Specify the type of the task that owns the links
+    /// @note Classes inherited from `TreeLinkable` can be managed by tree-based scheduling policies without allocating memory dynamically.
+    ///       The links are separate from the ones provided by `Listable`, so a task may reside in a tree and a wait queue at the same time.
+    ///
+    template <typename Task>
+    struct TreeLinkable
+    {
+    private:
+        /// The parent node, `NULL` if the task is the root
+        Task* treeParent = nullptr;
+
+        /// The left child
+        Task* treeLeft = nullptr;
+
+        /// The right child
+        Task* treeRight = nullptr;
+
+        /// `true` if the node is red, `false` if it is black
+        bool treeRed = false;
+
+    public:
+        ///
+        /// Get the parent node in the tree
+        ///
+        /// @return The parent node, `NULL` if the task is the root.
+        ///
+        [[nodiscard]]
+        Task* getTreeParent() const
+        {
+            return this->treeParent;
+        }
+
+        ///
+        /// Set the parent node in the tree
+        ///
+        /// @param parent The parent node
+        /// @note This method is invoked by the tree only.
+        ///
+        void setTreeParent(Task* parent)
+        {
+            this->treeParent = parent;
+        }
+
+        ///
+        /// Get the left child in the tree
+        ///
+        /// @return The left child, `NULL` if the task does not have one.
+        ///
+        [[nodiscard]]
+        Task* getTreeLeft() const
+        {
+            return this->treeLeft;
+        }
+
+        ///
+        /// Set the left child in the tree
+        ///
+        /// @param left The left child
+        /// @note This method is invoked by the tree only.
+        ///
+        void setTreeLeft(Task* left)
+        {
+            this->treeLeft = left;
+        }
+
+        ///
+        /// Get the right child in the tree
+        ///
+        /// @return The right child, `NULL` if the task does not have one.
+        ///
+        [[nodiscard]]
+        Task* getTreeRight() const
+        {
+            return this->treeRight;
+        }
+
+        ///
+        /// Set the right child in the tree
+        ///
+        /// @param right The right child
+        /// @note This method is invoked by the tree only.
+        ///
+        void setTreeRight(Task* right)
+        {
+            this->treeRight = right;
+        }
+
+        ///
+        /// Check whether the node is red
+        ///
+        /// @return `true` if the node is red, `false` if it is black.
+        ///
+        [[nodiscard]]
+        bool isTreeRed() const
+        {
+            return this->treeRed;
+        }
+
+        ///
+        /// Set the color of the node
+        ///
+        /// @param red `true` to paint the node red, `false` to paint it black
+        /// @note This method is invoked by the tree only.
+        ///
+        void setTreeRed(bool red)
+        {
+            this->treeRed = red;
+        }
+    };
+}
+
+/// A namespace where task constraints related to the scheduler are defined
+namespace TaskConstraints
+{
+    /// A type that can be linked into an intrusive red-black tree
+    template <typename Task>
+    concept TreeLinkable = requires(Task& task, const Task& constTask, Task* node, bool red)
+    {
+        /// The tree must be able to read the links of the task
+        { constTask.getTreeParent() } -> std::same_as<Task*>;
+
+        { constTask.getTreeLeft() } -> std::same_as<Task*>;
+
+        { constTask.getTreeRight() } -> std::same_as<Task*>;
+
+        /// The tree must be able to relink the task
+        { task.setTreeParent(node) } -> std::same_as<void>;
+
+        { task.setTreeLeft(node) } -> std::same_as<void>;
+
+        { task.setTreeRight(node) } -> std::same_as<void>;
+
+        /// The tree must be able to read and paint the color of the task
+        { constTask.isTreeRed() } -> std::same_as<bool>;
+
+        { task.setTreeRed(red) } -> std::same_as<void>;
+    };
+}
+
+#endif /* Scheduler_TreeLinkable_hpp */
@@ -0,0 +1,83 @@
+//
+//  WakeupLinkable.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_WakeupLinkable_hpp
+#define Scheduler_WakeupLinkable_hpp
+
+#include <atomic>
+#include <concepts>
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    ///
+    /// Provide the atomic link that chains a task into a lock-free queue shared by several cores
+    ///
+    /// @tparam Task Specify the type of the task that owns the link
+    /// @note Classes inherited from `WakeupLinkable` can be handed to another core without any lock,
+    ///       e.g. through `MultiCore::WakeupInbox` or `Policies::FIFO::Normal::IntrusiveMpscQueueImp`.
+    ///       The link is separate from the one provided by `Listable`, since the latter is not safe to publish to other cores,
+    ///       so a task can be pushed into an inbox while the waker has not yet finished with the wait queue where the task was blocked.
+    /// @note The link refers to the base class rather than to the task, so that a queue can chain a stub node that is not a task.
+    /// @note A copy of a task starts unlinked, so that tasks can still be stored in containers by value.
+    /// @warning A task can reside in at most one of these queues at a time, since it has a single link.
+    ///
+    template <typename Task>
+    struct WakeupLinkable
+    {
+    private:
+        /// The next node in the queue
+        std::atomic<WakeupLinkable*> wakeupNext = nullptr;
+
+    public:
+        /// Create an unlinked node
+        WakeupLinkable() = default;
+
+        /// Create an unlinked node, since the link of the given node belongs to the queue where it resides
+        WakeupLinkable([[maybe_unused]] const WakeupLinkable& other) {}
+
+        /// Keep the link of this node, since it belongs to the queue where this node resides
+        WakeupLinkable& operator=([[maybe_unused]] const WakeupLinkable& other)
+        {
+            return *this;
+        }
+
+        ///
+        /// Get the next node in the queue
+        ///
+        /// @param order Specify the memory order of the load
+        /// @return The next node, `NULL` if this is the last node or its successor has not been published yet.
+        ///
+        [[nodiscard]]
+        WakeupLinkable* getWakeupNext(std::memory_order order = std::memory_order_relaxed) const
+        {
+            return this->wakeupNext.load(order);
+        }
+
+        ///
+        /// Set the next node in the queue
+        ///
+        /// @param next The next node
+        /// @param order Specify the memory order of the store
+        /// @note This method is invoked by the queue only.
+        ///
+        void setWakeupNext(WakeupLinkable* next, std::memory_order order = std::memory_order_relaxed)
+        {
+            this->wakeupNext.store(next, order);
+        }
+    };
+}
+
+/// A namespace where task constraints related to the scheduler are defined
+namespace TaskConstraints
+{
+    /// A type that can be chained into a lock-free queue shared by several cores
+    template <typename Task>
+    concept WakeupLinkable = std::derived_from<Task, Scheduler::WakeupLinkable<Task>>;
+}
+
+#endif /* Scheduler_WakeupLinkable_hpp */
@@ -0,0 +1,101 @@
+//
+//  WeightedRuntime.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_WeightedRuntime_hpp
+#define Scheduler_WeightedRuntime_hpp
+
+#include <concepts>
+#include <cstdint>
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    ///
+    /// Provide the storage for the virtual runtime of a task
+    ///
+    /// @note Classes inherited from `WeightedRuntime` can be managed by fair-share scheduling policies,
+    ///       which charge the time consumed by a task to its virtual runtime at a rate inversely proportional to its weight
+    ///       and always run the task that has the smallest virtual runtime.
+    ///
+    struct WeightedRuntime
+    {
+    public:
+        /// The type of the virtual runtime
+        using Runtime = uint64_t;
+
+    private:
+        /// The weighted amount of time consumed by the task
+        uint64_t virtualRuntime = 0;
+
+    public:
+        ///
+        /// Get the virtual runtime of the task
+        ///
+        /// @return The weighted amount of time consumed by the task.
+        ///
+        [[nodiscard]]
+        uint64_t getVirtualRuntime() const
+        {
+            return this->virtualRuntime;
+        }
+
+        ///
+        /// Set the virtual runtime of the task
+        ///
+        /// @param runtime The new virtual runtime
+        /// @warning The caller must not change the virtual runtime of a task that resides in a ready queue.
+        ///
+        void setVirtualRuntime(uint64_t runtime)
+        {
+            this->virtualRuntime = runtime;
+        }
+    };
+}
+
+/// A namespace where task constraints related to the scheduler are defined
+namespace TaskConstraints
+{
+    /// A type that accumulates a virtual runtime, which is the amount of time it has consumed scaled by its weight
+    template <typename Task>
+    concept WeightedRuntime = requires(Task& task, typename Task::Runtime runtime)
+    {
+        /// The task must explicitly define its runtime type
+        typename Task::Runtime;
+
+        /// The runtime type must be an unsigned integer
+        requires std::unsigned_integral<typename Task::Runtime>;
+
+        /// The task should report its virtual runtime
+        { static_cast<const Task&>(task).getVirtualRuntime() } -> std::same_as<typename Task::Runtime>;
+
+        /// Other entity should be able to charge the task by updating its virtual runtime
+        { task.setVirtualRuntime(runtime) } -> std::same_as<void>;
+    };
+}
+
+/// Defines concepts related to scheduler components
+namespace Scheduler::Concepts
+{
+    /// A callable type that maps a task priority level to a weight that determines its share of the processor
+    template <typename Specifier, typename Task>
+    concept WeightSpecifier = requires(const typename Task::Priority& priority)
+    {
+        ///
+        /// The weight specifier can be initialized with zero arguments
+        ///
+        requires std::default_initializable<Specifier>;
+
+        ///
+        /// The weight specifier must implement the operator () to consume a priority level and return a non-zero weight
+        ///
+        /// @note Signature: `uint32_t operator()(const typename Task::Priority& priority)`.
+        ///
+        { Specifier{}(priority) } -> std::same_as<uint32_t>;
+    };
+}
+
+#endif /* Scheduler_WeightedRuntime_hpp */
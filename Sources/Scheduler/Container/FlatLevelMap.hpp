@@ -0,0 +1,175 @@
+//
+//  FlatLevelMap.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_FlatLevelMap_hpp
+#define Scheduler_FlatLevelMap_hpp
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/// Defines containers that are used by scheduling policies internally
+namespace Scheduler::Containers
+{
+    ///
+    /// A sorted flat map that keeps track of non-empty priority levels and the queue of each level
+    ///
+    /// @tparam Priority Specify the type of priority levels
+    /// @tparam Queue Specify the type of queues associated with priority levels
+    /// @note Levels are stored contiguously in ascending order, so the highest level is always the last one
+    ///       and is found or removed in constant time, while an arbitrary level is found by a binary search.
+    /// @note The map does not own any queue. The caller creates a queue when it inserts a level and releases it when it erases the level.
+    ///
+    template <typename Priority, typename Queue>
+    struct FlatLevelMap
+    {
+    public:
+        /// A non-empty priority level
+        struct Level
+        {
+            /// The priority level
+            Priority priority;
+
+            /// The queue that holds tasks at this level
+            Queue* queue;
+
+            /// The number of tasks at this level
+            size_t count;
+        };
+
+    private:
+        /// Non-empty priority levels sorted in ascending order
+        std::vector<Level> levels;
+
+        ///
+        /// [Helper] Find the position where the given priority level is or should be stored
+        ///
+        /// @param priority The priority level
+        /// @return The iterator to the first level that is not lower than the given one.
+        ///
+        auto lowerBound(const Priority& priority)
+        {
+            return std::lower_bound(this->levels.begin(), this->levels.end(), priority, [](const Level& level, const Priority& priority) { return level.priority < priority; });
+        }
+
+    public:
+        ///
+        /// Check whether the map has any priority level
+        ///
+        /// @return `true` if there is no level, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool isEmpty() const
+        {
+            return this->levels.empty();
+        }
+
+        ///
+        /// Get the number of priority levels
+        ///
+        /// @return The number of non-empty priority levels in the map.
+        ///
+        [[nodiscard]]
+        size_t size() const
+        {
+            return this->levels.size();
+        }
+
+        ///
+        /// Get the highest priority level
+        ///
+        /// @return The level that has the highest priority.
+        /// @warning The caller must ensure that the map is not empty.
+        ///
+        Level& highest()
+        {
+            return this->levels.back();
+        }
+
+        ///
+        /// Find the given priority level
+        ///
+        /// @param priority The priority level
+        /// @return The level if it exists, `NULL` otherwise.
+        ///
+        Level* find(const Priority& priority)
+        {
+            auto iterator = this->lowerBound(priority);
+
+            return iterator != this->levels.end() && !(priority < iterator->priority) ? &*iterator : nullptr;
+        }
+
+        ///
+        /// Find the given priority level or insert it with a new queue if it does not exist
+        ///
+        /// @param priority The priority level
+        /// @param maker A callable object that creates the queue of a new priority level
+        /// @return The level of the given priority.
+        /// @note The returned reference is invalidated by the next insertion or erasure.
+        ///
+        template <typename Maker>
+        Level& findOrInsert(const Priority& priority, Maker&& maker)
+        {
+            auto iterator = this->lowerBound(priority);
+
+            // Guard: Check whether the level already exists
+            if (iterator != this->levels.end() && !(priority < iterator->priority))
+            {
+                return *iterator;
+            }
+
+            return *this->levels.insert(iterator, Level{priority, maker(priority), 0});
+        }
+
+        ///
+        /// Erase the given priority level
+        ///
+        /// @param level A level returned by this map
+        /// @note The caller is responsible for releasing the queue of the erased level.
+        ///
+        void erase(Level& level)
+        {
+            this->levels.erase(this->levels.begin() + (&level - this->levels.data()));
+        }
+
+        ///
+        /// Reserve the storage for the given number of non-empty priority levels
+        ///
+        /// @param capacity The expected maximum number of non-empty priority levels
+        ///
+        void reserve(size_t capacity)
+        {
+            this->levels.reserve(capacity);
+        }
+
+        /// Iterate through all priority levels in ascending order
+        auto begin()
+        {
+            return this->levels.begin();
+        }
+
+        /// Iterate through all priority levels in ascending order
+        auto end()
+        {
+            return this->levels.end();
+        }
+
+        /// Iterate through all priority levels in descending order
+        auto rbegin()
+        {
+            return this->levels.rbegin();
+        }
+
+        /// Iterate through all priority levels in descending order
+        auto rend()
+        {
+            return this->levels.rend();
+        }
+    };
+}
+
+#endif /* Scheduler_FlatLevelMap_hpp */
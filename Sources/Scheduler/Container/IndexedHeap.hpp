@@ -0,0 +1,404 @@
+//
+//  IndexedHeap.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_IndexedHeap_hpp
+#define Scheduler_IndexedHeap_hpp
+
+#include <Scheduler/Constraint/HeapIndexable.hpp>
+#include <Debug.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+/// Defines containers that are used by scheduling policies internally
+namespace Scheduler::Containers
+{
+    ///
+    /// An intrusive d-ary heap that records the position of each element in the element itself
+    ///
+    /// @tparam Task Specify the type of elements managed by the heap
+    /// @tparam Comparator Specify the comparator that returns `true` if the first task should be closer to the root
+    /// @tparam Arity Specify the number of children of each node, 4 by default
+    /// @note Since every task knows its own position, the heap removes or repositions a task in logarithmic time
+    ///       without searching for it. A wider node halves the height of the heap compared to a binary one,
+    ///       and the children of a node are adjacent in memory, so sifting a task down touches fewer cache lines.
+    ///
+    template <typename Task, typename Comparator, size_t Arity = 4>
+    requires TaskConstraints::HeapIndexable<Task> && (Arity >= 2)
+    struct IndexedDaryHeap
+    {
+    private:
+        /// The tasks organized as an implicit d-ary tree
+        std::vector<Task*> elements;
+
+        /// The comparator that orders the tasks
+        Comparator comparator;
+
+        ///
+        /// [Helper] Store the given task at the given index and record the index in the task
+        ///
+        /// @param task A non-null task
+        /// @param index The new index of the task
+        ///
+        void place(Task* task, size_t index)
+        {
+            this->elements[index] = task;
+
+            task->setHeapIndex(index);
+        }
+
+        ///
+        /// [Helper] Move the task at the given index towards the root until the heap property is restored
+        ///
+        /// @param index The index of the task to be moved
+        ///
+        void siftUp(size_t index)
+        {
+            Task* task = this->elements[index];
+
+            while (index > 0)
+            {
+                size_t parent = (index - 1) / Arity;
+
+                // Guard: Stop once the parent should stay above the task
+                if (!this->comparator(task, this->elements[parent]))
+                {
+                    break;
+                }
+
+                this->place(this->elements[parent], index);
+
+                index = parent;
+            }
+
+            this->place(task, index);
+        }
+
+        ///
+        /// [Helper] Move the task at the given index towards the leaves until the heap property is restored
+        ///
+        /// @param index The index of the task to be moved
+        ///
+        void siftDown(size_t index)
+        {
+            Task* task = this->elements[index];
+
+            size_t count = this->elements.size();
+
+            while (true)
+            {
+                size_t first = index * Arity + 1;
+
+                // Guard: Stop once the task reaches a leaf
+                if (first >= count)
+                {
+                    break;
+                }
+
+                // Find the child that should be closest to the root
+                size_t best = first;
+
+                size_t last = std::min(first + Arity, count);
+
+                for (size_t child = first + 1; child < last; child++)
+                {
+                    if (this->comparator(this->elements[child], this->elements[best]))
+                    {
+                        best = child;
+                    }
+                }
+
+                // Guard: Stop once the task should stay above all of its children
+                if (!this->comparator(this->elements[best], task))
+                {
+                    break;
+                }
+
+                this->place(this->elements[best], index);
+
+                index = best;
+            }
+
+            this->place(task, index);
+        }
+
+        ///
+        /// [Helper] Restore the heap property after the task at the given index has been replaced or re-keyed
+        ///
+        /// @param index The index of the task to be moved
+        ///
+        void restore(size_t index)
+        {
+            if (index > 0 && this->comparator(this->elements[index], this->elements[(index - 1) / Arity]))
+            {
+                this->siftUp(index);
+            }
+            else
+            {
+                this->siftDown(index);
+            }
+        }
+
+        ///
+        /// [Helper] Rebuild the heap property of all tasks from the bottom up in linear time
+        ///
+        void heapify()
+        {
+            // Guard: A heap with at most one task is always valid
+            if (this->elements.size() < 2)
+            {
+                return;
+            }
+
+            // Sift down every task that has at least one child, starting from the parent of the last task
+            for (size_t index = (this->elements.size() - 2) / Arity + 1; index-- > 0;)
+            {
+                this->siftDown(index);
+            }
+        }
+
+        ///
+        /// [Helper] Check whether rebuilding the heap is cheaper than sifting the given number of tasks one by one
+        ///
+        /// @param count The number of tasks that have been added or removed
+        /// @return `true` if the heap should be rebuilt, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool prefersHeapify(size_t count) const
+        {
+            // Sifting costs about `count * height` steps while rebuilding costs about `size` steps
+            size_t height = 1;
+
+            for (size_t capacity = Arity; capacity < this->elements.size(); capacity *= Arity)
+            {
+                height += 1;
+            }
+
+            return count * height >= this->elements.size();
+        }
+
+    public:
+        ///
+        /// Check whether the heap is empty
+        ///
+        /// @return `true` if the heap does not have any task, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool isEmpty() const
+        {
+            return this->elements.empty();
+        }
+
+        ///
+        /// Get the number of tasks in the heap
+        ///
+        /// @return The number of tasks.
+        ///
+        [[nodiscard]]
+        size_t size() const
+        {
+            return this->elements.size();
+        }
+
+        ///
+        /// Reserve the storage for the given number of tasks
+        ///
+        /// @param capacity The expected maximum number of tasks
+        /// @note Reserving the storage beforehand avoids reallocating the heap when tasks arrive in bursts.
+        ///
+        void reserve(size_t capacity)
+        {
+            this->elements.reserve(capacity);
+        }
+
+        ///
+        /// Get the task at the root of the heap
+        ///
+        /// @return The task that should be closest to the root.
+        /// @warning The caller must ensure that the heap is not empty.
+        ///
+        [[nodiscard]]
+        Task* top() const
+        {
+            return this->elements.front();
+        }
+
+        ///
+        /// Visit every task in the heap in the order they would be popped
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note This method sorts a copy of the heap, so it takes `O(n log n)` time and allocates memory dynamically,
+        ///       which suits occasional inspections such as snapshots rather than the scheduling path.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) const
+        {
+            std::vector<Task*> sorted(this->elements);
+
+            std::sort(sorted.begin(), sorted.end(), this->comparator);
+
+            for (Task* task : sorted)
+            {
+                visitor(task);
+            }
+        }
+
+        ///
+        /// Insert the given task into the heap
+        ///
+        /// @param task A non-null task that does not reside in the heap
+        ///
+        void push(Task* task)
+        {
+            this->elements.push_back(task);
+
+            this->siftUp(this->elements.size() - 1);
+        }
+
+        ///
+        /// Insert the given tasks into the heap
+        ///
+        /// @param tasks Non-null tasks that do not reside in the heap
+        /// @note The heap is rebuilt in linear time if that is cheaper than inserting tasks one by one.
+        ///
+        void pushBatch(std::span<Task* const> tasks)
+        {
+            size_t first = this->elements.size();
+
+            for (Task* task : tasks)
+            {
+                task->setHeapIndex(this->elements.size());
+
+                this->elements.push_back(task);
+            }
+
+            // Guard: Rebuild the whole heap if the batch is large
+            if (this->prefersHeapify(tasks.size()))
+            {
+                this->heapify();
+
+                return;
+            }
+
+            for (size_t index = first; index < this->elements.size(); index++)
+            {
+                this->siftUp(index);
+            }
+        }
+
+        ///
+        /// Remove the task at the root of the heap
+        ///
+        /// @return The task that was closest to the root.
+        /// @warning The caller must ensure that the heap is not empty.
+        ///
+        Task* pop()
+        {
+            Task* task = this->elements.front();
+
+            Task* last = this->elements.back();
+
+            this->elements.pop_back();
+
+            // Guard: Move the last task to the root if the heap still has tasks
+            if (!this->elements.empty())
+            {
+                this->place(last, 0);
+
+                this->siftDown(0);
+            }
+
+            return task;
+        }
+
+        ///
+        /// Remove the given task from the heap
+        ///
+        /// @param task A non-null task that resides in the heap
+        ///
+        void remove(Task* task)
+        {
+            size_t index = task->getHeapIndex();
+
+            passert(index < this->elements.size() && this->elements[index] == task, "The task to be removed should reside in the heap.");
+
+            Task* last = this->elements.back();
+
+            this->elements.pop_back();
+
+            // Guard: Move the last task to the vacant slot unless the removed task was the last one
+            if (index < this->elements.size())
+            {
+                this->place(last, index);
+
+                this->restore(index);
+            }
+        }
+
+        ///
+        /// Remove the given tasks from the heap
+        ///
+        /// @param tasks Non-null tasks that reside in the heap
+        /// @note The heap is compacted and rebuilt in linear time if that is cheaper than removing tasks one by one.
+        ///
+        void removeBatch(std::span<Task* const> tasks)
+        {
+            // Guard: Remove tasks one by one if the batch is small
+            if (!this->prefersHeapify(tasks.size()))
+            {
+                for (Task* task : tasks)
+                {
+                    this->remove(task);
+                }
+
+                return;
+            }
+
+            // Mark the slots of removed tasks as vacant
+            for (Task* task : tasks)
+            {
+                size_t index = task->getHeapIndex();
+
+                passert(index < this->elements.size() && this->elements[index] == task, "The task to be removed should reside in the heap.");
+
+                this->elements[index] = nullptr;
+            }
+
+            // Compact the remaining tasks and rebuild the heap
+            size_t count = 0;
+
+            for (Task* task : this->elements)
+            {
+                if (task != nullptr)
+                {
+                    this->place(task, count++);
+                }
+            }
+
+            this->elements.resize(count);
+
+            this->heapify();
+        }
+
+        ///
+        /// Restore the position of the given task after its key has been changed
+        ///
+        /// @param task A non-null task that resides in the heap
+        ///
+        void update(Task* task)
+        {
+            size_t index = task->getHeapIndex();
+
+            passert(index < this->elements.size() && this->elements[index] == task, "The task to be updated should reside in the heap.");
+
+            this->restore(index);
+        }
+    };
+}
+
+#endif /* Scheduler_IndexedHeap_hpp */
@@ -0,0 +1,343 @@
+//
+//  PriorityArray.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_PriorityArray_hpp
+#define Scheduler_PriorityArray_hpp
+
+#include <Debug.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+/// Defines containers that are used by scheduling policies internally
+namespace Scheduler::Containers
+{
+    ///
+    /// Finds the highest key in an array of keys padded to a multiple of `kLanes` with the lowest representable key
+    ///
+    /// @tparam Key Specify the integral type of keys
+    /// @note The generic scanner runs a scalar loop.
+    ///       Scanners of 32-bit keys use AVX2 on x86-64 and NEON on AArch64 if the target supports them.
+    ///
+    template <std::integral Key>
+    struct PriorityScanner
+    {
+        /// The number of keys compared at once
+        static constexpr size_t kLanes = 8;
+
+        ///
+        /// Find the first position of the highest key
+        ///
+        /// @param keys A non-empty array of keys aligned to 32 bytes
+        /// @param count The number of keys in use
+        /// @return The smallest index of the highest key.
+        ///
+        static size_t findHighest(const Key* keys, size_t count)
+        {
+            const Key* end = keys + count;
+
+            // Reduce the keys to the highest level first, which the compiler can vectorize, and then locate its first occurrence
+            Key highest = *keys;
+
+            for (const Key* iterator = keys; iterator != end; iterator++)
+            {
+                highest = std::max(highest, *iterator);
+            }
+
+            return static_cast<size_t>(std::find(keys, end, highest) - keys);
+        }
+    };
+
+#if defined(__AVX2__)
+    ///
+    /// [SPEC] Finds the highest 32-bit key with AVX2 instructions
+    ///
+    /// @tparam Key Specify `int32_t` or `uint32_t`
+    /// @note The scanner reduces eight keys at a time to the highest key broadcast to all lanes,
+    ///       and then compares each block with the highest key and extracts the first match from the mask of lanes.
+    ///
+    template <std::integral Key>
+    requires (sizeof(Key) == 4)
+    struct PriorityScanner<Key>
+    {
+        /// The number of keys compared at once
+        static constexpr size_t kLanes = 8;
+
+        ///
+        /// [Helper] Get the lane-wise maximum of two vectors
+        ///
+        static __m256i max(__m256i lhs, __m256i rhs)
+        {
+            if constexpr (std::is_signed_v<Key>)
+            {
+                return _mm256_max_epi32(lhs, rhs);
+            }
+            else
+            {
+                return _mm256_max_epu32(lhs, rhs);
+            }
+        }
+
+        ///
+        /// Find the first position of the highest key
+        ///
+        /// @param keys A non-empty array of keys aligned to 32 bytes
+        /// @param count The number of keys in use, which is rounded up to a multiple of `kLanes`
+        /// @return The smallest index of the highest key.
+        ///
+        static size_t findHighest(const Key* keys, size_t count)
+        {
+            const auto* blocks = reinterpret_cast<const __m256i*>(keys);
+
+            size_t numberOfBlocks = (count + kLanes - 1) / kLanes;
+
+            __m256i highest = _mm256_load_si256(blocks);
+
+            for (size_t block = 1; block < numberOfBlocks; block++)
+            {
+                highest = max(highest, _mm256_load_si256(blocks + block));
+            }
+
+            // Broadcast the highest key to all lanes
+            highest = max(highest, _mm256_permute2x128_si256(highest, highest, 0x01));
+
+            highest = max(highest, _mm256_shuffle_epi32(highest, _MM_SHUFFLE(1, 0, 3, 2)));
+
+            highest = max(highest, _mm256_shuffle_epi32(highest, _MM_SHUFFLE(2, 3, 0, 1)));
+
+            for (size_t block = 0; block < numberOfBlocks; block++)
+            {
+                auto mask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_load_si256(blocks + block), highest))));
+
+                if (mask != 0)
+                {
+                    return block * kLanes + std::countr_zero(mask);
+                }
+            }
+
+            return 0;
+        }
+    };
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    ///
+    /// [SPEC] Finds the highest 32-bit key with NEON instructions
+    ///
+    /// @tparam Key Specify `int32_t` or `uint32_t`
+    /// @note The scanner reduces four keys at a time and then takes the maximum across lanes,
+    ///       and then compares each block with the highest key and extracts the first match from the narrowed mask of lanes.
+    ///
+    template <std::integral Key>
+    requires (sizeof(Key) == 4)
+    struct PriorityScanner<Key>
+    {
+        /// The number of keys compared at once, twice the width of a vector to match the padding of other targets
+        static constexpr size_t kLanes = 8;
+
+        /// The number of keys in a vector
+        static constexpr size_t kVectorLanes = 4;
+
+        ///
+        /// Find the first position of the highest key
+        ///
+        /// @param keys A non-empty array of keys aligned to 32 bytes
+        /// @param count The number of keys in use, which is rounded up to a multiple of `kLanes`
+        /// @return The smallest index of the highest key.
+        ///
+        static size_t findHighest(const Key* keys, size_t count)
+        {
+            const auto* words = reinterpret_cast<const uint32_t*>(keys);
+
+            size_t numberOfBlocks = (count + kVectorLanes - 1) / kVectorLanes;
+
+            uint32x4_t target;
+
+            if constexpr (std::is_signed_v<Key>)
+            {
+                const auto* signedWords = reinterpret_cast<const int32_t*>(keys);
+
+                int32x4_t highest = vld1q_s32(signedWords);
+
+                for (size_t block = 1; block < numberOfBlocks; block++)
+                {
+                    highest = vmaxq_s32(highest, vld1q_s32(signedWords + block * kVectorLanes));
+                }
+
+                target = vreinterpretq_u32_s32(vdupq_n_s32(vmaxvq_s32(highest)));
+            }
+            else
+            {
+                uint32x4_t highest = vld1q_u32(words);
+
+                for (size_t block = 1; block < numberOfBlocks; block++)
+                {
+                    highest = vmaxq_u32(highest, vld1q_u32(words + block * kVectorLanes));
+                }
+
+                target = vdupq_n_u32(vmaxvq_u32(highest));
+            }
+
+            for (size_t block = 0; block < numberOfBlocks; block++)
+            {
+                // Each lane of the narrowed mask occupies 16 bits
+                uint64_t mask = vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(vceqq_u32(vld1q_u32(words + block * kVectorLanes), target))), 0);
+
+                if (mask != 0)
+                {
+                    return block * kVectorLanes + std::countr_zero(mask) / 16;
+                }
+            }
+
+            return 0;
+        }
+    };
+#endif
+
+    ///
+    /// An unsorted array of a fixed capacity that stores integral priority levels contiguously and finds the highest one by scanning
+    ///
+    /// @tparam Priority Specify the integral type of priority levels
+    /// @tparam Capacity Specify the maximum number of priority levels stored in the array
+    /// @note Appending a priority level and removing one by moving the last one into its slot run in constant time.
+    ///       Finding the highest priority level runs in linear time without branches other than the loop bounds,
+    ///       which outperforms sorted lists and heaps on arrays with a few dozen priority levels.
+    /// @note Unused slots are filled with the lowest representable priority level,
+    ///       so the scanner always compares whole blocks of keys without handling a remainder.
+    ///
+    template <std::integral Priority, size_t Capacity>
+    requires (Capacity > 0)
+    struct PriorityArray
+    {
+    private:
+        /// The scanner that finds the highest priority level
+        using Scanner = PriorityScanner<Priority>;
+
+        /// The number of slots, rounded up to a multiple of the number of keys compared at once
+        static constexpr size_t kNumberOfSlots = (Capacity + Scanner::kLanes - 1) / Scanner::kLanes * Scanner::kLanes;
+
+        /// The value of unused slots
+        static constexpr Priority kPadding = std::numeric_limits<Priority>::min();
+
+        /// Priority levels in use followed by padding
+        alignas(32) std::array<Priority, kNumberOfSlots> keys;
+
+        /// The number of priority levels in use
+        size_t count;
+
+    public:
+        /// Create an empty array
+        PriorityArray() : count(0)
+        {
+            this->keys.fill(kPadding);
+        }
+
+        ///
+        /// Get the number of priority levels in the array
+        ///
+        /// @return The number of priority levels.
+        ///
+        [[nodiscard]]
+        size_t size() const
+        {
+            return this->count;
+        }
+
+        ///
+        /// Check whether the array is empty
+        ///
+        /// @return `true` if the array does not store any priority level, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool isEmpty() const
+        {
+            return this->count == 0;
+        }
+
+        ///
+        /// Get the priority level at the given position
+        ///
+        /// @param index The position of a priority level in the array
+        /// @return The priority level.
+        ///
+        [[nodiscard]]
+        Priority get(size_t index) const
+        {
+            return this->keys[index];
+        }
+
+        ///
+        /// Replace the priority level at the given position
+        ///
+        /// @param index The position of a priority level in the array
+        /// @param priority The new priority level
+        ///
+        void set(size_t index, Priority priority)
+        {
+            this->keys[index] = priority;
+        }
+
+        ///
+        /// Append the given priority level
+        ///
+        /// @param priority The priority level
+        /// @return The position of the priority level in the array.
+        /// @warning The array must not be full.
+        ///
+        size_t push(Priority priority)
+        {
+            passert(this->count < Capacity, "The priority array must not be full.");
+
+            this->keys[this->count] = priority;
+
+            return this->count++;
+        }
+
+        ///
+        /// Remove the priority level at the given position by moving the last priority level into its slot
+        ///
+        /// @param index The position of a priority level in the array
+        /// @return The previous position of the priority level that now occupies the given position,
+        ///         which is identical to the given position if the last priority level has been removed.
+        ///
+        size_t remove(size_t index)
+        {
+            this->count -= 1;
+
+            this->keys[index] = this->keys[this->count];
+
+            this->keys[this->count] = kPadding;
+
+            return this->count;
+        }
+
+        ///
+        /// Find the position of the highest priority level
+        ///
+        /// @return The smallest position of the highest priority level.
+        /// @warning The array must not be empty.
+        ///
+        [[nodiscard]]
+        size_t findHighest() const
+        {
+            passert(this->count > 0, "The priority array must not be empty.");
+
+            return Scanner::findHighest(this->keys.data(), this->count);
+        }
+    };
+}
+
+#endif /* Scheduler_PriorityArray_hpp */
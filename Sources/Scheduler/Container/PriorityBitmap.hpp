@@ -0,0 +1,239 @@
+//
+//  PriorityBitmap.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_PriorityBitmap_hpp
+#define Scheduler_PriorityBitmap_hpp
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+/// Defines containers that are used by scheduling policies internally
+namespace Scheduler::Containers
+{
+    ///
+    /// A bitmap that keeps track of non-empty priority levels and finds the highest one in constant time
+    ///
+    /// @tparam NumberOfBits Specify the number of priority levels tracked by the bitmap
+    /// @note Bitmaps that have at most 64 bits are backed by a single machine word.
+    ///       Larger bitmaps are backed by an array of words plus a summary bitmap which records the non-empty words,
+    ///       so the highest set bit is found by one count-leading-zeros instruction per level of the hierarchy,
+    ///       i.e. two instructions for up to 4096 priority levels.
+    ///
+    template <size_t NumberOfBits>
+    struct PriorityBitmap;
+
+    ///
+    /// [SPEC] A bitmap that keeps track of at most 64 non-empty priority levels
+    ///
+    /// @tparam NumberOfBits Specify the number of priority levels tracked by the bitmap
+    ///
+    template <size_t NumberOfBits>
+    requires (NumberOfBits > 0 && NumberOfBits <= 64)
+    struct PriorityBitmap<NumberOfBits>
+    {
+    private:
+        /// The occupancy word
+        uint64_t word = 0;
+
+    public:
+        ///
+        /// Mark the given priority level as non-empty
+        ///
+        /// @param index The priority level
+        ///
+        constexpr void set(size_t index)
+        {
+            this->word |= (uint64_t{1} << index);
+        }
+
+        ///
+        /// Mark the given priority level as empty
+        ///
+        /// @param index The priority level
+        ///
+        constexpr void clear(size_t index)
+        {
+            this->word &= ~(uint64_t{1} << index);
+        }
+
+        ///
+        /// Check whether the given priority level is non-empty
+        ///
+        /// @param index The priority level
+        /// @return `true` if the bit is set, `false` otherwise.
+        ///
+        [[nodiscard]]
+        constexpr bool test(size_t index) const
+        {
+            return (this->word >> index) & 1;
+        }
+
+        ///
+        /// Check whether all priority levels are empty
+        ///
+        /// @return `true` if no bit is set, `false` otherwise.
+        ///
+        [[nodiscard]]
+        constexpr bool isEmpty() const
+        {
+            return this->word == 0;
+        }
+
+        ///
+        /// Find the highest non-empty priority level
+        ///
+        /// @return The index of the highest set bit.
+        /// @warning The caller must ensure that the bitmap is not empty.
+        ///
+        [[nodiscard]]
+        constexpr size_t highest() const
+        {
+            return 63 - std::countl_zero(this->word);
+        }
+
+        ///
+        /// Find the lowest non-empty priority level that is not below the given one
+        ///
+        /// @param index The priority level where the search starts
+        /// @return The index of the lowest set bit at or above `index`, `NumberOfBits` if there is no such bit.
+        ///
+        [[nodiscard]]
+        constexpr size_t nextFrom(size_t index) const
+        {
+            // Guard: Check whether the search starts beyond the last bit
+            if (index >= NumberOfBits)
+            {
+                return NumberOfBits;
+            }
+
+            uint64_t remaining = this->word & (~uint64_t{0} << index);
+
+            return remaining == 0 ? NumberOfBits : std::countr_zero(remaining);
+        }
+    };
+
+    ///
+    /// [SPEC] A bitmap that keeps track of more than 64 non-empty priority levels
+    ///
+    /// @tparam NumberOfBits Specify the number of priority levels tracked by the bitmap
+    ///
+    template <size_t NumberOfBits>
+    requires (NumberOfBits > 64)
+    struct PriorityBitmap<NumberOfBits>
+    {
+    private:
+        /// The number of occupancy words
+        static constexpr size_t kNumberOfWords = (NumberOfBits + 63) / 64;
+
+        /// The occupancy words
+        std::array<uint64_t, kNumberOfWords> words = {};
+
+        /// A summary bitmap where each bit indicates whether the corresponding word is non-zero
+        PriorityBitmap<kNumberOfWords> summary;
+
+    public:
+        ///
+        /// Mark the given priority level as non-empty
+        ///
+        /// @param index The priority level
+        ///
+        constexpr void set(size_t index)
+        {
+            this->words[index / 64] |= (uint64_t{1} << (index % 64));
+
+            this->summary.set(index / 64);
+        }
+
+        ///
+        /// Mark the given priority level as empty
+        ///
+        /// @param index The priority level
+        ///
+        constexpr void clear(size_t index)
+        {
+            uint64_t& word = this->words[index / 64];
+
+            word &= ~(uint64_t{1} << (index % 64));
+
+            // Guard: Update the summary if the word no longer has any bit set
+            if (word == 0)
+            {
+                this->summary.clear(index / 64);
+            }
+        }
+
+        ///
+        /// Check whether the given priority level is non-empty
+        ///
+        /// @param index The priority level
+        /// @return `true` if the bit is set, `false` otherwise.
+        ///
+        [[nodiscard]]
+        constexpr bool test(size_t index) const
+        {
+            return (this->words[index / 64] >> (index % 64)) & 1;
+        }
+
+        ///
+        /// Check whether all priority levels are empty
+        ///
+        /// @return `true` if no bit is set, `false` otherwise.
+        ///
+        [[nodiscard]]
+        constexpr bool isEmpty() const
+        {
+            return this->summary.isEmpty();
+        }
+
+        ///
+        /// Find the highest non-empty priority level
+        ///
+        /// @return The index of the highest set bit.
+        /// @warning The caller must ensure that the bitmap is not empty.
+        ///
+        [[nodiscard]]
+        constexpr size_t highest() const
+        {
+            size_t index = this->summary.highest();
+
+            return index * 64 + 63 - std::countl_zero(this->words[index]);
+        }
+
+        ///
+        /// Find the lowest non-empty priority level that is not below the given one
+        ///
+        /// @param index The priority level where the search starts
+        /// @return The index of the lowest set bit at or above `index`, `NumberOfBits` if there is no such bit.
+        ///
+        [[nodiscard]]
+        constexpr size_t nextFrom(size_t index) const
+        {
+            // Guard: Check whether the search starts beyond the last bit
+            if (index >= NumberOfBits)
+            {
+                return NumberOfBits;
+            }
+
+            // Guard: Check the remaining bits in the word where the search starts
+            uint64_t remaining = this->words[index / 64] & (~uint64_t{0} << (index % 64));
+
+            if (remaining != 0)
+            {
+                return (index / 64) * 64 + std::countr_zero(remaining);
+            }
+
+            // Find the next non-zero word through the summary
+            size_t next = this->summary.nextFrom(index / 64 + 1);
+
+            return next >= kNumberOfWords ? NumberOfBits : next * 64 + std::countr_zero(this->words[next]);
+        }
+    };
+}
+
+#endif /* Scheduler_PriorityBitmap_hpp */
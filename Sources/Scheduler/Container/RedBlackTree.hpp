@@ -0,0 +1,652 @@
+//
+//  RedBlackTree.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_RedBlackTree_hpp
+#define Scheduler_RedBlackTree_hpp
+
+#include <Scheduler/Constraint/TreeLinkable.hpp>
+#include <Debug.hpp>
+#include <cstddef>
+
+/// Defines containers that are used by scheduling policies internally
+namespace Scheduler::Containers
+{
+    ///
+    /// An intrusive red-black tree that caches its leftmost node
+    ///
+    /// @tparam Task Specify the type of elements managed by the tree
+    /// @tparam Comparator Specify the comparator that returns `true` if the first task should be placed to the left of the second one
+    /// @note Each task embeds its own links, so the tree inserts and removes a task in logarithmic time without allocating memory.
+    ///       The leftmost node is maintained on each insertion and removal, so the smallest task is found in constant time.
+    /// @note Tasks that compare equal are placed to the right of existing ones,
+    ///       so they leave the tree on a first-come, first-served basis.
+    ///
+    template <typename Task, typename Comparator>
+    requires TaskConstraints::TreeLinkable<Task>
+    struct IntrusiveRedBlackTree
+    {
+    private:
+        /// The root node
+        Task* root = nullptr;
+
+        /// The leftmost node, i.e. the smallest task
+        Task* leftmost = nullptr;
+
+        /// The number of tasks in the tree
+        size_t count = 0;
+
+        /// The comparator that orders the tasks
+        Comparator comparator;
+
+        ///
+        /// [Helper] Check whether the given node is red
+        ///
+        /// @param node A node or `NULL` that represents a black leaf
+        /// @return `true` if the node is red, `false` otherwise.
+        ///
+        static bool isRed(const Task* node)
+        {
+            return node != nullptr && node->isTreeRed();
+        }
+
+        ///
+        /// [Helper] Find the leftmost node in the subtree rooted at the given node
+        ///
+        /// @param node The non-null root of a subtree
+        /// @return The leftmost node in the subtree.
+        ///
+        static Task* minimum(Task* node)
+        {
+            while (node->getTreeLeft() != nullptr)
+            {
+                node = node->getTreeLeft();
+            }
+
+            return node;
+        }
+
+        ///
+        /// [Helper] Find the node that follows the given node in order
+        ///
+        /// @param node A non-null node in the tree
+        /// @return The next node, `NULL` if the given node is the rightmost one.
+        ///
+        static Task* successor(Task* node)
+        {
+            if (node->getTreeRight() != nullptr)
+            {
+                return minimum(node->getTreeRight());
+            }
+
+            Task* parent = node->getTreeParent();
+
+            while (parent != nullptr && node == parent->getTreeRight())
+            {
+                node = parent;
+
+                parent = parent->getTreeParent();
+            }
+
+            return parent;
+        }
+
+        ///
+        /// [Helper] Replace a child of the given parent node
+        ///
+        /// @param parent The parent node, `NULL` if the child is the root
+        /// @param child The current child of the parent node
+        /// @param replacement The new child or `NULL`
+        ///
+        void replaceChild(Task* parent, Task* child, Task* replacement)
+        {
+            if (replacement != nullptr)
+            {
+                replacement->setTreeParent(parent);
+            }
+
+            if (parent == nullptr)
+            {
+                this->root = replacement;
+            }
+            else if (parent->getTreeLeft() == child)
+            {
+                parent->setTreeLeft(replacement);
+            }
+            else
+            {
+                parent->setTreeRight(replacement);
+            }
+        }
+
+        ///
+        /// [Helper] Rotate the subtree rooted at the given node to the left
+        ///
+        /// @param node A node that has a right child
+        ///
+        void rotateLeft(Task* node)
+        {
+            Task* pivot = node->getTreeRight();
+
+            this->replaceChild(node->getTreeParent(), node, pivot);
+
+            node->setTreeRight(pivot->getTreeLeft());
+
+            if (pivot->getTreeLeft() != nullptr)
+            {
+                pivot->getTreeLeft()->setTreeParent(node);
+            }
+
+            pivot->setTreeLeft(node);
+
+            node->setTreeParent(pivot);
+        }
+
+        ///
+        /// [Helper] Rotate the subtree rooted at the given node to the right
+        ///
+        /// @param node A node that has a left child
+        ///
+        void rotateRight(Task* node)
+        {
+            Task* pivot = node->getTreeLeft();
+
+            this->replaceChild(node->getTreeParent(), node, pivot);
+
+            node->setTreeLeft(pivot->getTreeRight());
+
+            if (pivot->getTreeRight() != nullptr)
+            {
+                pivot->getTreeRight()->setTreeParent(node);
+            }
+
+            pivot->setTreeRight(node);
+
+            node->setTreeParent(pivot);
+        }
+
+        ///
+        /// [Helper] Restore the red-black properties after the given red node has been linked into the tree
+        ///
+        /// @param node The newly inserted node
+        ///
+        void repairAfterInsertion(Task* node)
+        {
+            while (isRed(node->getTreeParent()))
+            {
+                Task* parent = node->getTreeParent();
+
+                // The root is black, so a red parent always has a parent
+                Task* grandparent = parent->getTreeParent();
+
+                if (parent == grandparent->getTreeLeft())
+                {
+                    Task* uncle = grandparent->getTreeRight();
+
+                    // Guard: Push the red color up if the uncle is also red
+                    if (isRed(uncle))
+                    {
+                        parent->setTreeRed(false);
+
+                        uncle->setTreeRed(false);
+
+                        grandparent->setTreeRed(true);
+
+                        node = grandparent;
+
+                        continue;
+                    }
+
+                    // Turn the inner grandchild into an outer one
+                    if (node == parent->getTreeRight())
+                    {
+                        this->rotateLeft(parent);
+
+                        node = parent;
+
+                        parent = node->getTreeParent();
+                    }
+
+                    parent->setTreeRed(false);
+
+                    grandparent->setTreeRed(true);
+
+                    this->rotateRight(grandparent);
+                }
+                else
+                {
+                    Task* uncle = grandparent->getTreeLeft();
+
+                    // Guard: Push the red color up if the uncle is also red
+                    if (isRed(uncle))
+                    {
+                        parent->setTreeRed(false);
+
+                        uncle->setTreeRed(false);
+
+                        grandparent->setTreeRed(true);
+
+                        node = grandparent;
+
+                        continue;
+                    }
+
+                    // Turn the inner grandchild into an outer one
+                    if (node == parent->getTreeLeft())
+                    {
+                        this->rotateRight(parent);
+
+                        node = parent;
+
+                        parent = node->getTreeParent();
+                    }
+
+                    parent->setTreeRed(false);
+
+                    grandparent->setTreeRed(true);
+
+                    this->rotateLeft(grandparent);
+                }
+            }
+
+            this->root->setTreeRed(false);
+        }
+
+        ///
+        /// [Helper] Restore the red-black properties after a black node has been unlinked from the tree
+        ///
+        /// @param node The node that took the place of the removed node, `NULL` if it is a leaf
+        /// @param parent The parent of the given node
+        ///
+        void repairAfterRemoval(Task* node, Task* parent)
+        {
+            while (node != this->root && !isRed(node))
+            {
+                // The subtree rooted at `node` is short of one black node,
+                // so its sibling subtree contains at least one black node and is never empty
+                if (node == parent->getTreeLeft())
+                {
+                    Task* sibling = parent->getTreeRight();
+
+                    if (isRed(sibling))
+                    {
+                        sibling->setTreeRed(false);
+
+                        parent->setTreeRed(true);
+
+                        this->rotateLeft(parent);
+
+                        sibling = parent->getTreeRight();
+                    }
+
+                    // Guard: Move the shortage up if both nephews are black
+                    if (!isRed(sibling->getTreeLeft()) && !isRed(sibling->getTreeRight()))
+                    {
+                        sibling->setTreeRed(true);
+
+                        node = parent;
+
+                        parent = node->getTreeParent();
+
+                        continue;
+                    }
+
+                    // Turn the inner red nephew into an outer one
+                    if (!isRed(sibling->getTreeRight()))
+                    {
+                        sibling->getTreeLeft()->setTreeRed(false);
+
+                        sibling->setTreeRed(true);
+
+                        this->rotateRight(sibling);
+
+                        sibling = parent->getTreeRight();
+                    }
+
+                    sibling->setTreeRed(parent->isTreeRed());
+
+                    parent->setTreeRed(false);
+
+                    sibling->getTreeRight()->setTreeRed(false);
+
+                    this->rotateLeft(parent);
+                }
+                else
+                {
+                    Task* sibling = parent->getTreeLeft();
+
+                    if (isRed(sibling))
+                    {
+                        sibling->setTreeRed(false);
+
+                        parent->setTreeRed(true);
+
+                        this->rotateRight(parent);
+
+                        sibling = parent->getTreeLeft();
+                    }
+
+                    // Guard: Move the shortage up if both nephews are black
+                    if (!isRed(sibling->getTreeLeft()) && !isRed(sibling->getTreeRight()))
+                    {
+                        sibling->setTreeRed(true);
+
+                        node = parent;
+
+                        parent = node->getTreeParent();
+
+                        continue;
+                    }
+
+                    // Turn the inner red nephew into an outer one
+                    if (!isRed(sibling->getTreeLeft()))
+                    {
+                        sibling->getTreeRight()->setTreeRed(false);
+
+                        sibling->setTreeRed(true);
+
+                        this->rotateLeft(sibling);
+
+                        sibling = parent->getTreeLeft();
+                    }
+
+                    sibling->setTreeRed(parent->isTreeRed());
+
+                    parent->setTreeRed(false);
+
+                    sibling->getTreeLeft()->setTreeRed(false);
+
+                    this->rotateRight(parent);
+                }
+
+                // The shortage has been resolved
+                node = this->root;
+            }
+
+            if (node != nullptr)
+            {
+                node->setTreeRed(false);
+            }
+        }
+
+        ///
+        /// [Helper] Count the black nodes on every path from the given node to a leaf
+        ///
+        /// @param node The root of a subtree or `NULL`
+        /// @param parent The expected parent of the given node
+        /// @return The black height of the subtree, or `-1` if any property of a red-black tree is violated.
+        ///
+        long blackHeight(const Task* node, const Task* parent) const
+        {
+            if (node == nullptr)
+            {
+                return 1;
+            }
+
+            if (node->getTreeParent() != parent || (isRed(node) && (isRed(node->getTreeLeft()) || isRed(node->getTreeRight()))))
+            {
+                return -1;
+            }
+
+            long left = this->blackHeight(node->getTreeLeft(), node);
+
+            long right = this->blackHeight(node->getTreeRight(), node);
+
+            if (left < 0 || left != right)
+            {
+                return -1;
+            }
+
+            return left + (isRed(node) ? 0 : 1);
+        }
+
+    public:
+        ///
+        /// Get the number of tasks in the tree
+        ///
+        /// @return The number of tasks.
+        ///
+        [[nodiscard]]
+        size_t size() const
+        {
+            return this->count;
+        }
+
+        ///
+        /// Check whether the tree is empty
+        ///
+        /// @return `true` if the tree does not have any task, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool isEmpty() const
+        {
+            return this->count == 0;
+        }
+
+        ///
+        /// Get the smallest task in the tree
+        ///
+        /// @return The leftmost task, `NULL` if the tree is empty.
+        /// @note This method runs in constant time.
+        ///
+        [[nodiscard]]
+        Task* first() const
+        {
+            return this->leftmost;
+        }
+
+        ///
+        /// Visit every task in the tree in ascending order
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note This method walks the tree through the links stored in the tasks without allocating memory dynamically.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) const
+        {
+            for (Task* task = this->leftmost; task != nullptr; task = successor(task))
+            {
+                visitor(task);
+            }
+        }
+
+        ///
+        /// Insert the given task into the tree
+        ///
+        /// @param task A non-null task that does not reside in the tree
+        ///
+        void insert(Task* task)
+        {
+            Task* parent = nullptr;
+
+            Task* cursor = this->root;
+
+            bool isLeftmost = true;
+
+            bool isLeftChild = false;
+
+            while (cursor != nullptr)
+            {
+                parent = cursor;
+
+                isLeftChild = this->comparator(task, cursor);
+
+                if (isLeftChild)
+                {
+                    cursor = cursor->getTreeLeft();
+                }
+                else
+                {
+                    cursor = cursor->getTreeRight();
+
+                    isLeftmost = false;
+                }
+            }
+
+            task->setTreeParent(parent);
+
+            task->setTreeLeft(nullptr);
+
+            task->setTreeRight(nullptr);
+
+            task->setTreeRed(true);
+
+            if (parent == nullptr)
+            {
+                this->root = task;
+            }
+            else if (isLeftChild)
+            {
+                parent->setTreeLeft(task);
+            }
+            else
+            {
+                parent->setTreeRight(task);
+            }
+
+            if (isLeftmost)
+            {
+                this->leftmost = task;
+            }
+
+            this->count += 1;
+
+            this->repairAfterInsertion(task);
+        }
+
+        ///
+        /// Remove the given task from the tree
+        ///
+        /// @param task A non-null task that resides in the tree
+        ///
+        void remove(Task* task)
+        {
+            passert(this->count > 0, "The tree must not be empty.");
+
+            if (task == this->leftmost)
+            {
+                this->leftmost = successor(task);
+            }
+
+            // The node that takes the place of the unlinked node and its parent
+            Task* child = nullptr;
+
+            Task* parent = nullptr;
+
+            bool hasRemovedBlack = false;
+
+            if (task->getTreeLeft() == nullptr || task->getTreeRight() == nullptr)
+            {
+                // Unlink the task directly since it has at most one child
+                child = task->getTreeLeft() != nullptr ? task->getTreeLeft() : task->getTreeRight();
+
+                parent = task->getTreeParent();
+
+                hasRemovedBlack = !task->isTreeRed();
+
+                this->replaceChild(parent, task, child);
+            }
+            else
+            {
+                // Move the successor of the task, which does not have a left child, into the place of the task
+                Task* next = minimum(task->getTreeRight());
+
+                hasRemovedBlack = !next->isTreeRed();
+
+                child = next->getTreeRight();
+
+                if (next->getTreeParent() == task)
+                {
+                    parent = next;
+                }
+                else
+                {
+                    parent = next->getTreeParent();
+
+                    this->replaceChild(parent, next, child);
+
+                    next->setTreeRight(task->getTreeRight());
+
+                    task->getTreeRight()->setTreeParent(next);
+                }
+
+                this->replaceChild(task->getTreeParent(), task, next);
+
+                next->setTreeLeft(task->getTreeLeft());
+
+                task->getTreeLeft()->setTreeParent(next);
+
+                next->setTreeRed(task->isTreeRed());
+            }
+
+            task->setTreeParent(nullptr);
+
+            task->setTreeLeft(nullptr);
+
+            task->setTreeRight(nullptr);
+
+            this->count -= 1;
+
+            if (hasRemovedBlack)
+            {
+                this->repairAfterRemoval(child, parent);
+            }
+        }
+
+        ///
+        /// Remove the smallest task from the tree
+        ///
+        /// @return The leftmost task.
+        /// @warning The tree must not be empty.
+        ///
+        Task* pop()
+        {
+            Task* task = this->leftmost;
+
+            this->remove(task);
+
+            return task;
+        }
+
+        ///
+        /// Check whether the tree satisfies the properties of a red-black tree
+        ///
+        /// @return `true` if the links, the colors, the cached leftmost node and the order of tasks are consistent, `false` otherwise.
+        /// @note This method visits every task and is intended for tests and debugging only.
+        ///
+        [[nodiscard]]
+        bool isValid() const
+        {
+            if (this->root == nullptr)
+            {
+                return this->count == 0 && this->leftmost == nullptr;
+            }
+
+            if (isRed(this->root) || this->blackHeight(this->root, nullptr) < 0 || this->leftmost != minimum(this->root))
+            {
+                return false;
+            }
+
+            Comparator comparator = this->comparator;
+
+            size_t visited = 1;
+
+            for (Task* previous = this->leftmost, *current = successor(previous); current != nullptr; previous = current, current = successor(current))
+            {
+                if (comparator(current, previous))
+                {
+                    return false;
+                }
+
+                visited += 1;
+            }
+
+            return visited == this->count;
+        }
+    };
+}
+
+#endif /* Scheduler_RedBlackTree_hpp */
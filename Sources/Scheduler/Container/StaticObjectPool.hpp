@@ -0,0 +1,99 @@
+//
+//  StaticObjectPool.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_StaticObjectPool_hpp
+#define Scheduler_StaticObjectPool_hpp
+
+#include <Debug.hpp>
+#include <array>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+/// Defines containers that are used by scheduling policies internally
+namespace Scheduler::Containers
+{
+    ///
+    /// A fixed-capacity pool that constructs objects in its own storage without allocating memory dynamically
+    ///
+    /// @tparam Object Specify the type of objects managed by the pool
+    /// @tparam Capacity Specify the maximum number of objects that can be alive at the same time
+    /// @note The pool hands out slots that have never been used in order and recycles released slots in LIFO order.
+    ///       Both operations take constant time.
+    /// @note A zero-initialized pool is ready to use, so it can be defined as a static variable without a constructor running at startup.
+    /// @warning The pool is not thread-safe.
+    ///
+    template <typename Object, size_t Capacity>
+    requires (Capacity > 0)
+    struct StaticObjectPool
+    {
+    private:
+        /// The storage of all objects
+        alignas(Object) std::byte storage[Capacity * sizeof(Object)];
+
+        /// The number of slots that have been handed out at least once
+        size_t watermark = 0;
+
+        /// Slots that have been released and can be reused
+        std::array<Object*, Capacity> released = {};
+
+        /// The number of released slots
+        size_t numberOfReleased = 0;
+
+    public:
+        ///
+        /// Construct an object in the pool
+        ///
+        /// @param args Arguments passed to the constructor of the object
+        /// @return A non-null pointer to the newly constructed object.
+        /// @warning The pool must not be exhausted.
+        ///
+        template <typename... Args>
+        Object* construct(Args&&... args)
+        {
+            void* slot = nullptr;
+
+            if (this->numberOfReleased > 0)
+            {
+                slot = this->released[--this->numberOfReleased];
+            }
+            else
+            {
+                passert(this->watermark < Capacity, "The object pool should not be exhausted.");
+
+                slot = this->storage + sizeof(Object) * this->watermark++;
+            }
+
+            return new (slot) Object(std::forward<Args>(args)...);
+        }
+
+        ///
+        /// Destroy an object that is constructed by the pool
+        ///
+        /// @param object A non-null object returned by `construct()`
+        ///
+        void destroy(Object* object)
+        {
+            object->~Object();
+
+            this->released[this->numberOfReleased++] = object;
+        }
+
+        ///
+        /// Get the number of objects that are currently alive
+        ///
+        /// @return The number of live objects.
+        ///
+        [[nodiscard]]
+        size_t size() const
+        {
+            return this->watermark - this->numberOfReleased;
+        }
+    };
+}
+
+#endif /* Scheduler_StaticObjectPool_hpp */
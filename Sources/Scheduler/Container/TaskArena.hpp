@@ -0,0 +1,247 @@
+//
+//  TaskArena.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef Scheduler_TaskArena_hpp
+#define Scheduler_TaskArena_hpp
+
+#include <Debug.hpp>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+/// Defines containers that are used by scheduling policies internally
+namespace Scheduler::Containers
+{
+    ///
+    /// A compact 32-bit reference to a task control block that lives in a task arena
+    ///
+    /// @note The low bits store the index of the slot and the high bits store the generation of the slot,
+    ///       so a handle that refers to a destroyed task no longer matches the generation recorded by the arena.
+    /// @note The value zero is reserved for the null handle, since a generation never wraps around to zero.
+    ///
+    struct TaskHandle
+    {
+        /// The packed index and generation, zero if the handle is null
+        uint32_t value = 0;
+
+        ///
+        /// Check whether the handle is null
+        ///
+        /// @return `true` if the handle does not refer to any task, `false` otherwise.
+        ///
+        [[nodiscard]]
+        constexpr bool isNull() const
+        {
+            return this->value == 0;
+        }
+
+        friend constexpr bool operator==(const TaskHandle& lhs, const TaskHandle& rhs) = default;
+    };
+
+    ///
+    /// A fixed-capacity arena that constructs task control blocks in cache-aligned slots and refers to them by generational handles
+    ///
+    /// @tparam Task Specify the type of task control blocks managed by the arena
+    /// @tparam Capacity Specify the maximum number of tasks that can be alive at the same time
+    /// @tparam Alignment Specify the alignment of each slot, a cache line by default so that two tasks never share a line
+    /// @note Each arena serves a single size class, so a system that has task control blocks of different sizes defines one arena per type.
+    /// @note Creating and destroying a task take constant time. Slots that have never been used are handed out in order,
+    ///       while destroyed slots are recycled in LIFO order so that the most recently touched line is reused first.
+    /// @note The generations live in a table separate from the slots, so validating a handle never touches the task control block.
+    ///       `get()` validates the handle with `passert()` only, which costs nothing in release builds,
+    ///       while `tryGet()` always validates the handle for callers that may race with the destruction of the task.
+    /// @note A zero-initialized arena is ready to use, so it can be defined as a static variable without a constructor running at startup.
+    /// @warning The arena is not thread-safe.
+    ///
+    template <typename Task, size_t Capacity, size_t Alignment = 64>
+    requires (Capacity > 0) && (Capacity < (size_t{1} << 24)) && (std::has_single_bit(Alignment)) && (Alignment >= alignof(Task))
+    struct TaskArena
+    {
+    public:
+        /// The number of low bits of a handle that store the slot index
+        static constexpr uint32_t kIndexBits = static_cast<uint32_t>(std::bit_width(Capacity - 1) == 0 ? 1 : std::bit_width(Capacity - 1));
+
+        /// The mask that extracts the slot index from a handle
+        static constexpr uint32_t kIndexMask = (uint32_t{1} << kIndexBits) - 1;
+
+        /// The largest generation that fits in the remaining high bits of a handle
+        static constexpr uint32_t kMaxGeneration = UINT32_MAX >> kIndexBits;
+
+    private:
+        /// A slot that holds a single task control block
+        struct alignas(Alignment) Slot
+        {
+            alignas(Task) std::byte storage[sizeof(Task)];
+        };
+
+        /// The storage of all task control blocks
+        Slot slots[Capacity];
+
+        /// The generation of each slot, odd while the slot holds a live task and even while it is free
+        std::array<uint32_t, Capacity> generations = {};
+
+        /// The number of slots that have been handed out at least once
+        uint32_t watermark = 0;
+
+        /// Indices of slots that have been released and can be reused
+        std::array<uint32_t, Capacity> released = {};
+
+        /// The number of released slots
+        uint32_t numberOfReleased = 0;
+
+        ///
+        /// Pack the given slot index and generation into a handle
+        ///
+        /// @param index The index of the slot
+        /// @param generation The current generation of the slot
+        /// @return The handle that refers to the task in the slot.
+        ///
+        static constexpr TaskHandle pack(uint32_t index, uint32_t generation)
+        {
+            return TaskHandle{(generation << kIndexBits) | index};
+        }
+
+        ///
+        /// Get the task control block stored in the given slot
+        ///
+        /// @param index The index of the slot
+        /// @return The non-null task in the slot.
+        ///
+        Task* at(uint32_t index)
+        {
+            return std::launder(reinterpret_cast<Task*>(this->slots[index].storage));
+        }
+
+    public:
+        ///
+        /// Construct a task in the arena
+        ///
+        /// @param args Arguments passed to the constructor of the task
+        /// @return The handle that refers to the newly constructed task, or the null handle if the arena is exhausted.
+        ///
+        template <typename... Args>
+        TaskHandle create(Args&&... args)
+        {
+            uint32_t index = 0;
+
+            if (this->numberOfReleased > 0)
+            {
+                index = this->released[--this->numberOfReleased];
+            }
+            else
+            {
+                // Guard: Check whether the arena is exhausted
+                if (this->watermark == Capacity)
+                {
+                    return TaskHandle();
+                }
+
+                index = this->watermark++;
+            }
+
+            // A live generation is odd, so it is never zero and the handle is never null
+            uint32_t generation = (this->generations[index] + 1) & kMaxGeneration;
+
+            this->generations[index] = generation;
+
+            new (this->slots[index].storage) Task(std::forward<Args>(args)...);
+
+            return pack(index, generation);
+        }
+
+        ///
+        /// Destroy the task referred to by the given handle
+        ///
+        /// @param handle A handle returned by `create()` that refers to a live task
+        /// @note The handle and all copies of it become stale once the task has been destroyed.
+        ///
+        void destroy(TaskHandle handle)
+        {
+            passert(this->isValid(handle), "The handle should refer to a live task.");
+
+            uint32_t index = handle.value & kIndexMask;
+
+            this->at(index)->~Task();
+
+            // An even generation marks the slot as free, so stale handles fail validation until the slot is reused
+            this->generations[index] = (this->generations[index] + 1) & kMaxGeneration;
+
+            this->released[this->numberOfReleased++] = index;
+        }
+
+        ///
+        /// Check whether the given handle refers to a live task
+        ///
+        /// @param handle A handle returned by `create()`
+        /// @return `true` if the task has not been destroyed, `false` if the handle is null or stale.
+        ///
+        [[nodiscard]]
+        bool isValid(TaskHandle handle) const
+        {
+            uint32_t index = handle.value & kIndexMask;
+
+            return !handle.isNull() && index < this->watermark && this->generations[index] == handle.value >> kIndexBits;
+        }
+
+        ///
+        /// Get the task referred to by the given handle
+        ///
+        /// @param handle A handle that refers to a live task
+        /// @return The non-null task.
+        /// @note A stale handle, e.g. one that refers to a task that has been killed, is detected by `passert()` in debug builds only.
+        ///
+        Task* get(TaskHandle handle)
+        {
+            passert(this->isValid(handle), "Use after destroy: the handle refers to a task that is no longer alive.");
+
+            return this->at(handle.value & kIndexMask);
+        }
+
+        ///
+        /// Get the task referred to by the given handle if it is still alive
+        ///
+        /// @param handle A handle returned by `create()`
+        /// @return The task referred to by the handle, `NULL` if the handle is null or stale.
+        ///
+        Task* tryGet(TaskHandle handle)
+        {
+            return this->isValid(handle) ? this->at(handle.value & kIndexMask) : nullptr;
+        }
+
+        ///
+        /// Get the handle that refers to the given task
+        ///
+        /// @param task A non-null live task constructed by this arena
+        /// @return The handle that refers to the task.
+        /// @note This allows a policy that receives task pointers to store compact handles instead.
+        ///
+        TaskHandle getHandle(const Task* task) const
+        {
+            auto index = static_cast<uint32_t>(reinterpret_cast<const Slot*>(task) - this->slots);
+
+            passert(index < this->watermark && (this->generations[index] & 1) == 1, "The task should be alive and belong to this arena.");
+
+            return pack(index, this->generations[index]);
+        }
+
+        ///
+        /// Get the number of tasks that are currently alive
+        ///
+        /// @return The number of live tasks.
+        ///
+        [[nodiscard]]
+        size_t size() const
+        {
+            return this->watermark - this->numberOfReleased;
+        }
+    };
+}
+
+#endif /* Scheduler_TaskArena_hpp */
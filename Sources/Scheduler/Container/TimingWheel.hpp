@@ -0,0 +1,343 @@
+//
+//  TimingWheel.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_TimingWheel_hpp
+#define Scheduler_TimingWheel_hpp
+
+#include <Scheduler/Container/PriorityBitmap.hpp>
+#include <LinkedList.hpp>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+/// Defines containers that are used by scheduling policies internally
+namespace Scheduler::Containers
+{
+    ///
+    /// A timing wheel that keeps tasks keyed by a point in time and returns the task that has the earliest one
+    ///
+    /// @tparam Task Specify the type of elements managed by the wheel
+    /// @tparam KeyOf Specify the functor that returns the unsigned integral time key of a task
+    /// @tparam NumberOfSlots Specify the number of slots in the wheel, which must be a power of two
+    /// @note The wheel covers a window of `NumberOfSlots` consecutive keys starting from the earliest key seen so far.
+    ///       Each slot holds the tasks of exactly one key in the window in FIFO order,
+    ///       and an occupancy bitmap locates the next non-empty slot, so tasks within the window are inserted and removed in constant time.
+    ///       Tasks beyond the window are parked in a sorted overflow list and moved into the wheel once the window reaches them,
+    ///       while tasks whose keys are already behind the window are kept in a sorted list that is served first.
+    ///       Both lists are linear to insert into, so the window should be wide enough to cover the typical spread of keys.
+    /// @note Tasks that have the same key are returned in the order they are inserted.
+    /// @warning Keys are compared as plain unsigned integers and must not wrap around while tasks reside in the wheel.
+    ///
+    template <typename Task, typename KeyOf, size_t NumberOfSlots>
+    requires ListableItem<Task> && std::unsigned_integral<std::remove_cvref_t<std::invoke_result_t<KeyOf, const Task&>>> && (std::has_single_bit(NumberOfSlots))
+    struct TimingWheel
+    {
+    public:
+        /// The type of time keys
+        using Key = std::remove_cvref_t<std::invoke_result_t<KeyOf, const Task&>>;
+
+    private:
+        /// The comparator that sorts tasks in ascending order of their keys while preserving the insertion order of equal keys
+        struct EarlierComparator
+        {
+            bool operator()(Task* const& lhs, Task* const& rhs)
+            {
+                return KeyOf{}(*lhs) < KeyOf{}(*rhs);
+            }
+        };
+
+        /// The slots where each one holds the tasks of a single key in the current window
+        std::array<LinkedList<Task>, NumberOfSlots> slots;
+
+        /// Records the slots that have tasks
+        PriorityBitmap<NumberOfSlots> bitmap;
+
+        /// Tasks whose keys are behind the current window sorted by their keys
+        LinkedList<Task> late;
+
+        /// Tasks whose keys are beyond the current window sorted by their keys
+        LinkedList<Task> overflow;
+
+        /// The first key in the current window
+        Key base = 0;
+
+        /// The total number of tasks in the wheel
+        size_t count = 0;
+
+        ///
+        /// [Helper] Get the slot that holds tasks of the given key
+        ///
+        /// @param key A key in the current window
+        /// @return The index of the slot.
+        ///
+        static constexpr size_t slotOf(Key key)
+        {
+            return static_cast<size_t>(key) & (NumberOfSlots - 1);
+        }
+
+        ///
+        /// [Helper] Check whether the given key is in the current window
+        ///
+        /// @param key A time key that is not behind the current window
+        /// @return `true` if the key is in the window, `false` if it is beyond the window.
+        ///
+        [[nodiscard]]
+        bool isInWindow(Key key) const
+        {
+            return key - this->base < NumberOfSlots;
+        }
+
+        ///
+        /// [Helper] Insert the given task into the slot of its key
+        ///
+        /// @param task A non-null task whose key is in the current window
+        ///
+        void insertIntoSlot(Task* task)
+        {
+            size_t slot = slotOf(KeyOf{}(*task));
+
+            this->slots[slot].enqueue(task);
+
+            this->bitmap.set(slot);
+        }
+
+        ///
+        /// [Helper] Move the tasks that fall into the current window from the overflow list to their slots
+        ///
+        void migrateOverflow()
+        {
+            while (!this->overflow.isEmpty())
+            {
+                Task* task = this->overflow.dequeue();
+
+                // Guard: The overflow list is sorted, so stop at the first task that is still beyond the window
+                if (!this->isInWindow(KeyOf{}(*task)))
+                {
+                    // Put the task back to the front of the list
+                    this->overflow.insertFirst(task);
+
+                    break;
+                }
+
+                this->insertIntoSlot(task);
+            }
+        }
+
+    public:
+        ///
+        /// Check whether the wheel is empty
+        ///
+        /// @return `true` if the wheel does not have any task, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool isEmpty() const
+        {
+            return this->count == 0;
+        }
+
+        ///
+        /// Get the number of tasks in the wheel
+        ///
+        /// @return The number of tasks.
+        ///
+        [[nodiscard]]
+        size_t size() const
+        {
+            return this->count;
+        }
+
+        ///
+        /// Insert the given task into the wheel
+        ///
+        /// @param task A non-null task that does not reside in the wheel
+        ///
+        void insert(Task* task)
+        {
+            Key key = KeyOf{}(*task);
+
+            // Guard: Start a new window at the given key if the wheel is empty
+            if (this->count == 0)
+            {
+                this->base = key;
+            }
+
+            this->count += 1;
+
+            if (key < this->base)
+            {
+                this->late.template insert(task, EarlierComparator{});
+            }
+            else if (this->isInWindow(key))
+            {
+                this->insertIntoSlot(task);
+            }
+            else
+            {
+                this->overflow.template insert(task, EarlierComparator{});
+            }
+        }
+
+        ///
+        /// Remove the task that has the earliest key from the wheel
+        ///
+        /// @return The task that has the earliest key, `NULL` if the wheel is empty.
+        ///
+        Task* pop()
+        {
+            // Guard: Check whether the wheel is empty
+            if (this->count == 0)
+            {
+                return nullptr;
+            }
+
+            this->count -= 1;
+
+            // Guard: Tasks behind the window are always the earliest ones
+            if (!this->late.isEmpty())
+            {
+                return this->late.dequeue();
+            }
+
+            // Guard: Start a new window at the earliest overflow task if all slots are empty
+            if (this->bitmap.isEmpty())
+            {
+                Task* earliest = this->overflow.dequeue();
+
+                this->base = KeyOf{}(*earliest);
+
+                this->insertIntoSlot(earliest);
+
+                this->migrateOverflow();
+            }
+
+            // Find the first non-empty slot starting from the beginning of the window
+            size_t cursor = slotOf(this->base);
+
+            size_t slot = this->bitmap.nextFrom(cursor);
+
+            if (slot == NumberOfSlots)
+            {
+                slot = this->bitmap.nextFrom(0);
+            }
+
+            // Guard: Move the window forward and pull in the overflow tasks that fall into it
+            size_t distance = (slot - cursor) & (NumberOfSlots - 1);
+
+            if (distance != 0)
+            {
+                this->base += static_cast<Key>(distance);
+
+                this->migrateOverflow();
+            }
+
+            Task* task = this->slots[slot].dequeue();
+
+            if (this->slots[slot].isEmpty())
+            {
+                this->bitmap.clear(slot);
+            }
+
+            return task;
+        }
+
+        ///
+        /// Remove the task that has the earliest key from the wheel if its key does not come after the given one
+        ///
+        /// @param limit The latest key of a task that can be removed
+        /// @return The task that has the earliest key if the key does not exceed `limit`, `NULL` otherwise.
+        /// @note The earliest task is put back to the front of its list if it is not due yet,
+        ///       so tasks that have the same key are still returned in the order they are inserted.
+        ///
+        Task* popUntil(Key limit)
+        {
+            Task* task = this->pop();
+
+            // Guard: Check whether the wheel is empty or the earliest task is due
+            if (task == nullptr || KeyOf{}(*task) <= limit)
+            {
+                return task;
+            }
+
+            // The window has been moved to the key of the task, so it is either behind or in the window
+            Key key = KeyOf{}(*task);
+
+            this->count += 1;
+
+            if (key < this->base)
+            {
+                this->late.insertFirst(task);
+            }
+            else
+            {
+                size_t slot = slotOf(key);
+
+                this->slots[slot].insertFirst(task);
+
+                this->bitmap.set(slot);
+            }
+
+            return nullptr;
+        }
+
+        ///
+        /// Remove the given task from the wheel
+        ///
+        /// @param task A non-null task that resides in the wheel
+        /// @param key The key of the task when it was inserted into the wheel
+        ///
+        void remove(Task* task, Key key)
+        {
+            this->count -= 1;
+
+            if (key < this->base)
+            {
+                this->late.remove(task);
+            }
+            else if (this->isInWindow(key))
+            {
+                size_t slot = slotOf(key);
+
+                this->slots[slot].remove(task);
+
+                if (this->slots[slot].isEmpty())
+                {
+                    this->bitmap.clear(slot);
+                }
+            }
+            else
+            {
+                this->overflow.remove(task);
+            }
+        }
+
+        ///
+        /// Visit every task in the wheel in the order they would be removed by `pop()`
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Tasks behind the window are visited first, followed by the slots from the beginning of the window and then tasks beyond the window.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor)
+        {
+            this->late.forEach(visitor);
+
+            // The window may wrap around the end of the array of slots
+            size_t cursor = slotOf(this->base);
+
+            for (size_t offset = 0; offset < NumberOfSlots; offset += 1)
+            {
+                this->slots[(cursor + offset) & (NumberOfSlots - 1)].forEach(visitor);
+            }
+
+            this->overflow.forEach(visitor);
+        }
+    };
+}
+
+#endif /* Scheduler_TimingWheel_hpp */
@@ -0,0 +1,392 @@
+//
+//  Executor.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_Executor_hpp
+#define Scheduler_Executor_hpp
+
+#include <Scheduler/Scheduler.hpp>
+#include <Scheduler/Constraint/Resumable.hpp>
+#include <LinkedList.hpp>
+#include <Debug.hpp>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <utility>
+
+///
+/// Defines components that run tasks implemented as C++20 coroutines on a scheduler assembled from a policy and event handlers
+///
+/// @note A task suspends itself by awaiting the executor, which then asks the scheduler for the next task and resumes its coroutine,
+///       so switching between tasks costs a function return plus a function call instead of a switch between two stacks.
+/// @note Tasks are scheduled cooperatively, since a coroutine can only be suspended at an explicit `co_await`.
+///
+namespace Scheduler::Coroutines
+{
+    ///
+    /// The return type of a coroutine that implements the body of a task
+    ///
+    /// @note The coroutine does not start until the executor selects the task to which it is attached.
+    /// @note The routine owns the coroutine until it is passed to `Executor::spawn()`,
+    ///       and destroys a coroutine that has never been spawned.
+    ///
+    struct Routine
+    {
+    public:
+        /// The promise of the coroutine
+        struct promise_type
+        {
+            Routine get_return_object()
+            {
+                return Routine(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            /// The coroutine is suspended until the task is selected for the first time
+            std::suspend_always initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            /// The coroutine is suspended after it finishes, so that the executor can detect its completion and destroy it
+            std::suspend_always final_suspend() noexcept
+            {
+                return {};
+            }
+
+            void return_void() {}
+
+            /// A task must not leak an exception into the scheduler
+            void unhandled_exception()
+            {
+                std::terminate();
+            }
+        };
+
+    private:
+        /// The coroutine, `NULL` if it has been released to the executor
+        std::coroutine_handle<promise_type> handle;
+
+        /// Create a routine that owns the given coroutine
+        explicit Routine(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+
+    public:
+        /// Transfer the ownership of the coroutine
+        Routine(Routine&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+        /// A routine cannot be copied since it owns the coroutine
+        Routine(const Routine&) = delete;
+
+        /// A routine cannot be assigned since it owns the coroutine
+        Routine& operator=(const Routine&) = delete;
+
+        /// Destroy the coroutine if it has not been released
+        ~Routine()
+        {
+            if (this->handle != nullptr)
+            {
+                this->handle.destroy();
+            }
+        }
+
+        ///
+        /// Release the ownership of the coroutine
+        ///
+        /// @return The coroutine handle, `NULL` if it has already been released.
+        ///
+        std::coroutine_handle<> release()
+        {
+            return std::exchange(this->handle, nullptr);
+        }
+    };
+
+    ///
+    /// A queue of tasks that wait for the same event
+    ///
+    /// @tparam Task Specify the type of the task
+    /// @note A blocked task does not reside in the ready queue, so the queue reuses the intrusive links provided by `Listable`.
+    ///
+    template <typename Task>
+    requires ListableItem<Task>
+    struct WaitQueue
+    {
+    private:
+        /// Tasks that wait for the event in the order they started waiting
+        LinkedList<Task> waiters;
+
+    public:
+        ///
+        /// Check whether any task waits for the event
+        ///
+        /// @return `true` if no task waits for the event, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool isEmpty() const
+        {
+            return this->waiters.isEmpty();
+        }
+
+        ///
+        /// Record that the given task waits for the event
+        ///
+        /// @param task A non-null task that has been blocked
+        ///
+        void wait(Task* task)
+        {
+            this->waiters.enqueue(task);
+        }
+
+        ///
+        /// Take the task that has waited for the event for the longest time
+        ///
+        /// @return The task that should be unblocked, `NULL` if no task waits for the event.
+        ///
+        Task* wake()
+        {
+            return this->waiters.dequeue();
+        }
+    };
+
+    ///
+    /// An executor that runs tasks implemented as coroutines on the given scheduler
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler, which must support the idle task
+    /// @note `co_await executor.yield()` and `co_await executor.blockOn(queue)` are mapped onto `onTaskYielded()` and `onTaskBlocked()`,
+    ///       while waking up a blocked task is mapped onto an intermediate `onTaskUnblocked()` call,
+    ///       so the scheduler reconsiders the current task at its next suspension point.
+    ///       A task that returns from its coroutine is mapped onto `onTaskFinished()`.
+    /// @note The executor never resumes the idle task. `run()` returns once the scheduler selects the idle task,
+    ///       i.e. no task is ready, and the caller may wake up blocked tasks and call `run()` again later.
+    /// @warning Coroutines must suspend only by awaiting the executor.
+    ///
+    template <typename ConcreteScheduler>
+    requires TaskConstraints::Resumable<Traits::ScheduledTask<ConcreteScheduler>> &&
+             ListableItem<Traits::ScheduledTask<ConcreteScheduler>> &&
+             SupportsIdleTask<ConcreteScheduler> &&
+             ProvidesTaskYieldingHandler<ConcreteScheduler> &&
+             ProvidesTaskBlockedHandler<ConcreteScheduler> &&
+             ProvidesTaskUnblockedHandler<ConcreteScheduler> &&
+             ProvidesTaskTerminationHandler<ConcreteScheduler>
+    struct Executor
+    {
+    public:
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+    private:
+        /// The reason why the current task has suspended its coroutine
+        enum class Suspension
+        {
+            kNone,
+            kYielded,
+            kBlocked,
+        };
+
+        /// The scheduler that selects the next task to run
+        ConcreteScheduler& scheduler;
+
+        /// The task whose coroutine is being resumed, `NULL` if the executor is not running
+        Task* current = nullptr;
+
+        /// The reason why the current task has suspended its coroutine
+        Suspension suspension = Suspension::kNone;
+
+    public:
+        /// An awaitable object that suspends the current task and puts it back into the ready queue
+        struct YieldAwaiter
+        {
+            /// The executor that runs the current task
+            Executor* executor;
+
+            [[nodiscard]]
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend([[maybe_unused]] std::coroutine_handle<> handle) const noexcept
+            {
+                this->executor->suspension = Suspension::kYielded;
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        /// An awaitable object that blocks the current task until it is woken up from the given queue
+        struct BlockAwaiter
+        {
+            /// The executor that runs the current task
+            Executor* executor;
+
+            /// The queue where the current task waits
+            WaitQueue<Task>* queue;
+
+            [[nodiscard]]
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend([[maybe_unused]] std::coroutine_handle<> handle) const noexcept
+            {
+                this->queue->wait(this->executor->current);
+
+                this->executor->suspension = Suspension::kBlocked;
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        ///
+        /// Create an executor that runs tasks on the given scheduler
+        ///
+        /// @param scheduler The scheduler that selects the next task to run
+        ///
+        explicit Executor(ConcreteScheduler& scheduler) : scheduler(scheduler) {}
+
+        ///
+        /// Get the task whose coroutine is being resumed
+        ///
+        /// @return The current running task, `NULL` if the executor is not running.
+        ///
+        [[nodiscard]]
+        Task* getCurrentTask() const
+        {
+            return this->current;
+        }
+
+        ///
+        /// Attach the given coroutine to the given task and put the task into the ready queue
+        ///
+        /// @param task A non-null task that has not been spawned or has finished
+        /// @param routine The coroutine that implements the body of the task
+        /// @note This method can be invoked by the current running task or while the executor is not running.
+        ///
+        void spawn(Task* task, Routine routine)
+        {
+            passert(task->getHandle() == nullptr, "The task should not have a coroutine that has not finished yet.");
+
+            task->setHandle(routine.release());
+
+            this->scheduler.ready(task);
+        }
+
+        ///
+        /// Suspend the current task so that the scheduler may select another task to run
+        ///
+        /// @return An object that must be awaited by the current running task immediately.
+        ///
+        [[nodiscard]]
+        YieldAwaiter yield()
+        {
+            passert(this->current != nullptr, "Only the current running task can yield.");
+
+            return YieldAwaiter{this};
+        }
+
+        ///
+        /// Block the current task until another task or the caller of the executor wakes it up from the given queue
+        ///
+        /// @param queue The queue where the current task waits
+        /// @return An object that must be awaited by the current running task immediately.
+        /// @note As with a condition variable, the task should check the condition it waits for again after it is woken up.
+        ///
+        [[nodiscard]]
+        BlockAwaiter blockOn(WaitQueue<Task>& queue)
+        {
+            passert(this->current != nullptr, "Only the current running task can be blocked.");
+
+            return BlockAwaiter{this, &queue};
+        }
+
+        ///
+        /// Wake up the task that has waited on the given queue for the longest time
+        ///
+        /// @param queue The queue where tasks wait
+        /// @return `true` if a task has been woken up, `false` if no task waits on the queue.
+        /// @note This method can be invoked by the current running task or while the executor is not running.
+        ///
+        bool notifyOne(WaitQueue<Task>& queue)
+        {
+            Task* task = queue.wake();
+
+            // Guard: Check whether any task waits on the queue
+            if (task == nullptr)
+            {
+                return false;
+            }
+
+            this->scheduler.onTaskUnblocked(nullptr, task);
+
+            return true;
+        }
+
+        ///
+        /// Wake up all tasks that wait on the given queue
+        ///
+        /// @param queue The queue where tasks wait
+        /// @return The number of tasks that have been woken up.
+        /// @note This method can be invoked by the current running task or while the executor is not running.
+        ///
+        size_t notifyAll(WaitQueue<Task>& queue)
+        {
+            size_t count = 0;
+
+            while (this->notifyOne(queue))
+            {
+                count += 1;
+            }
+
+            return count;
+        }
+
+        ///
+        /// Run the ready tasks until the scheduler selects the idle task
+        ///
+        /// @note This method must not be invoked by a task run by this executor.
+        ///
+        void run()
+        {
+            passert(this->current == nullptr, "The executor should not be running.");
+
+            Task* idle = this->scheduler.getIdleTask();
+
+            Task* next = Utilities::nextOrIdleTask(this->scheduler);
+
+            while (next != idle)
+            {
+                this->current = next;
+
+                this->suspension = Suspension::kNone;
+
+                std::coroutine_handle<> handle = next->getHandle();
+
+                passert(handle != nullptr, "The task selected to run should have a coroutine.");
+
+                handle.resume();
+
+                // Guard: Check whether the task has returned from its coroutine
+                if (handle.done())
+                {
+                    handle.destroy();
+
+                    next->setHandle(nullptr);
+
+                    next = this->scheduler.onTaskFinished(next);
+
+                    continue;
+                }
+
+                passert(this->suspension != Suspension::kNone, "The task should suspend itself by awaiting the executor.");
+
+                next = this->suspension == Suspension::kYielded ? this->scheduler.onTaskYielded(next) : this->scheduler.onTaskBlocked(next);
+            }
+
+            this->current = nullptr;
+        }
+    };
+}
+
+#endif /* Scheduler_Executor_hpp */
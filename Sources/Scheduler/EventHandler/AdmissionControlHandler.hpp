@@ -0,0 +1,142 @@
+//
+//  AdmissionControlHandler.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_AdmissionControlHandler_hpp
+#define Scheduler_AdmissionControlHandler_hpp
+
+#include <Scheduler/Misc/Traits.hpp>
+
+///
+/// Defines adapters that keep the admission control component of the policy in sync with the task set
+///
+/// @note Each adapter wraps another event handler and consults the policy before or after the wrapped handler makes its decision.
+///       The policy must provide `bool admit(Task*)` and `void release(Task*)`,
+///       e.g. `Policies::RateMonotonic::PolicyWithAdmissionControl`.
+///
+namespace Scheduler::EventHandlers::AdmissionControl
+{
+    ///
+    /// A task creation handler that admits a new task before the wrapped handler enqueues it
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @tparam CreationHandler Specify the task creation handler that deals with admitted tasks
+    ///
+    template <typename ConcreteScheduler, typename CreationHandler>
+    struct AdmitOnCreation: public CreationHandler
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+    private:
+        /// The task rejected by the most recent call to `onTaskCreated()`, `NULL` if that task has been admitted
+        Task* rejected = nullptr;
+
+    public:
+        ///
+        /// Notify the delegate that a new task has been created
+        ///
+        /// @param current The current running task
+        /// @param task The newly created task
+        /// @returns The non-null task that is selected to run.
+        /// @note If the new task is rejected, it is not enqueued and the current task keeps running.
+        ///       Call `getLastRejectedTask()` to tell whether the new task has been admitted.
+        /// @note This method does NOT support group operations.
+        ///
+        Task* onTaskCreated(Task* current, Task* task)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // Guard: Reject the task if admitting it could make the task set unschedulable
+            if (!self->admit(task))
+            {
+                this->rejected = task;
+
+                return current;
+            }
+
+            this->rejected = nullptr;
+
+            return CreationHandler::onTaskCreated(current, task);
+        }
+
+        ///
+        /// Get the task rejected by the most recent call to `onTaskCreated()`
+        ///
+        /// @return The rejected task, `NULL` if the most recently created task has been admitted.
+        ///
+        [[nodiscard]]
+        Task* getLastRejectedTask() const
+        {
+            return this->rejected;
+        }
+    };
+
+    ///
+    /// A task termination handler that releases the finished task before the wrapped handler selects the next task
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @tparam TerminationHandler Specify the task termination handler that selects the next task
+    ///
+    template <typename ConcreteScheduler, typename TerminationHandler>
+    struct ReleaseOnTermination: public TerminationHandler
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        ///
+        /// Notify the delegate that the current running task has finished
+        ///
+        /// @param current The current running task that just finished
+        /// @returns The task that is selected to run by the wrapped handler.
+        /// @note This method does NOT support group operations.
+        ///
+        Task* onTaskFinished(Task* current)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            self->release(current);
+
+            return TerminationHandler::onTaskFinished(current);
+        }
+    };
+
+    ///
+    /// A task killed handler that releases the killed task before the wrapped handler removes it from the ready queue
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @tparam KilledHandler Specify the task killed handler that removes the task and selects the next task
+    ///
+    template <typename ConcreteScheduler, typename KilledHandler>
+    struct ReleaseOnKill: public KilledHandler
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        ///
+        /// Notify the delegate that a task has been killed
+        ///
+        /// @param current The current running task
+        /// @param task The task that just got killed
+        /// @return The task that is selected to run by the wrapped handler if requested.
+        /// @note This method supports group operations in the same way as the wrapped handler.
+        ///
+        Task* onTaskKilled(Task* current, Task* task)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // Guard: [Special] Check whether the caller only wants to fetch the next task
+            if (task != nullptr)
+            {
+                self->release(task);
+            }
+
+            return KilledHandler::onTaskKilled(current, task);
+        }
+    };
+}
+
+#endif /* Scheduler_AdmissionControlHandler_hpp */
@@ -0,0 +1,117 @@
+//
+//  PlacementHandler.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_PlacementHandler_hpp
+#define Scheduler_PlacementHandler_hpp
+
+#include <Scheduler/Misc/Traits.hpp>
+
+///
+/// Defines adapters that place a task that becomes ready on a core allowed by its affinity
+///
+/// @note Each adapter wraps another event handler, which deals with the task if it is placed on the current core.
+///       A task placed on another core is enqueued there under the lock of that core.
+///       The policy must provide `selectCoreFor()`, `selectWakeupCoreFor()`, `getCoreIndex()` and `readyOn()`, e.g. `MultiCore::WorkStealing`.
+///
+namespace Scheduler::EventHandlers::Placement
+{
+    ///
+    /// A task creation handler that places a new task on the least loaded core of its home node allowed by its affinity mask
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @tparam CreationHandler Specify the task creation handler that deals with a new task placed on the current core
+    ///
+    template <typename ConcreteScheduler, typename CreationHandler>
+    struct PlaceOnCreation: public CreationHandler
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        ///
+        /// Notify the delegate that a new task has been created
+        ///
+        /// @param current The current running task
+        /// @param task The newly created task
+        /// @returns The task that is selected to run by the wrapped handler, `current` if the new task is placed on another core.
+        /// @note This method does NOT support group operations.
+        ///
+        Task* onTaskCreated(Task* current, Task* task)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            size_t core = self->selectCoreFor(task, false);
+
+            // Guard: Check whether the new task is placed on the current core
+            if (core == self->getCoreIndex())
+            {
+                return CreationHandler::onTaskCreated(current, task);
+            }
+
+            self->readyOn(core, task);
+
+            return current;
+        }
+    };
+
+    ///
+    /// A task unblocked handler that places an unblocked task on a core whose caches are likely to hold its working set
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @tparam UnblockedHandler Specify the task unblocked handler that deals with an unblocked task placed on the current core
+    /// @note The core is chosen among the core where the task ran most recently, the current core that wakes it up
+    ///       and an idle core that shares the last level cache with the former by `selectWakeupCoreFor()`.
+    ///       A preemptive wrapped handler such as `TaskUnblocked::Preemptive::RunHigherPriority` then decides
+    ///       whether a task placed on the current core preempts the current one.
+    ///
+    template <typename ConcreteScheduler, typename UnblockedHandler>
+    struct PlaceOnUnblock: public UnblockedHandler
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        ///
+        /// Notify the delegate that a task has been unblocked
+        ///
+        /// @param current The current running task
+        /// @param task The task that just got unblocked
+        /// @returns The task that is selected to run by the wrapped handler if requested.
+        /// @note This method supports group operations in the same way as the wrapped handler.
+        ///       If the unblocked task is placed on another core, the wrapped handler is asked to fetch the next task only,
+        ///       so tasks enqueued on the current core by previous intermediate calls are taken into account.
+        ///
+        Task* onTaskUnblocked(Task* current, Task* task)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // Guard: [Special] Check whether the caller only wants to fetch the next task
+            if (task == nullptr)
+            {
+                return UnblockedHandler::onTaskUnblocked(current, task);
+            }
+
+            size_t core = self->selectWakeupCoreFor(task);
+
+            // Guard: Check whether the unblocked task is placed on the current core
+            if (core == self->getCoreIndex())
+            {
+                return UnblockedHandler::onTaskUnblocked(current, task);
+            }
+
+            self->readyOn(core, task);
+
+            // Guard: [Special] Check whether the caller performs an intermediate call
+            if (current == nullptr)
+            {
+                return nullptr;
+            }
+
+            return UnblockedHandler::onTaskUnblocked(current, nullptr);
+        }
+    };
+}
+
+#endif /* Scheduler_PlacementHandler_hpp */
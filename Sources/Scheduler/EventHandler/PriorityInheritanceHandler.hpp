@@ -0,0 +1,108 @@
+//
+//  PriorityInheritanceHandler.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_PriorityInheritanceHandler_hpp
+#define Scheduler_PriorityInheritanceHandler_hpp
+
+#include <Scheduler/Constraint/PriorityInheritable.hpp>
+#include <Scheduler/Misc/Traits.hpp>
+
+///
+/// Defines the handlers that lock and unlock mutexes under the priority inheritance protocol
+///
+/// @note The policy must provide `tryAcquire()`, `wait()` and `release()`,
+///       e.g. `Policies::PriorityInheritance::PolicyWithPriorityInheritance`.
+///
+namespace Scheduler::EventHandlers::PriorityInheritance
+{
+    ///
+    /// A handler that locks a mutex on behalf of the current task or blocks the task until the mutex is handed over to it
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @note The concrete scheduler must also provide a task blocked handler, which selects the next task to run if the mutex is held by another task.
+    ///
+    template <typename ConcreteScheduler>
+    struct LockMutex
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        ///
+        /// Notify the delegate that the current task attempts to lock a mutex
+        ///
+        /// @param current The non-null current running task
+        /// @param mutex A non-null mutex that is not held by the current task
+        /// @returns The current task if it now holds the mutex, otherwise the task that is selected to run while the current one waits.
+        /// @note This method does NOT support group operations.
+        ///
+        Task* onMutexLocked(Task* current, PriorityInheritanceMutex<Task>* mutex)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // Guard: Check whether the mutex is unlocked
+            if (self->tryAcquire(current, mutex))
+            {
+                // The current running task keeps running, since its priority has not been lowered
+                return current;
+            }
+
+            // The owner has been boosted, so it runs before any task of a lower priority than the current one
+            self->wait(current, mutex);
+
+            return self->onTaskBlocked(current);
+        }
+    };
+
+    ///
+    /// A handler that unlocks a mutex held by the current task and unblocks the waiter that receives the mutex
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @note The concrete scheduler must also provide a task unblocked handler, which decides whether the new owner preempts the current task.
+    ///
+    template <typename ConcreteScheduler>
+    struct UnlockMutex
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        ///
+        /// Notify the delegate that the current task unlocks a mutex
+        ///
+        /// @param current The non-null current running task
+        /// @param mutex A non-null mutex held by the current task
+        /// @returns The task that is selected to run.
+        /// @note This method does NOT support group operations.
+        /// @note If the current task loses its inherited priority, a ready task may now outrank it,
+        ///       so the current task is enqueued and the next task is selected as if the task had changed its own priority.
+        ///
+        Task* onMutexUnlocked(Task* current, PriorityInheritanceMutex<Task>* mutex)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            auto oldPriority = current->getPriority();
+
+            Task* owner = self->release(current, mutex);
+
+            // Guard: Check whether the current task keeps its priority
+            if (!(current->getPriority() < oldPriority))
+            {
+                return owner == nullptr ? current : self->onTaskUnblocked(current, owner);
+            }
+
+            if (owner != nullptr)
+            {
+                self->ready(owner);
+            }
+
+            self->ready(current);
+
+            return self->next();
+        }
+    };
+}
+
+#endif /* Scheduler_PriorityInheritanceHandler_hpp */
@@ -0,0 +1,86 @@
+//
+//  ReservationHandler.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_ReservationHandler_hpp
+#define Scheduler_ReservationHandler_hpp
+
+#include <Scheduler/Misc/Traits.hpp>
+
+///
+/// Defines adapters that keep the bandwidth reservation of a task up to date when it becomes ready
+///
+/// @note Each adapter wraps another event handler and activates the task before the wrapped handler enqueues it.
+///       The policy must provide `void activate(Task*)`, e.g. `Policies::ConstantBandwidth::PolicyWithReservations`.
+///
+namespace Scheduler::EventHandlers::Reservation
+{
+    ///
+    /// A task creation handler that activates the reservation of a new task before the wrapped handler enqueues it
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @tparam CreationHandler Specify the task creation handler that deals with the new task
+    ///
+    template <typename ConcreteScheduler, typename CreationHandler>
+    struct ActivateOnCreation: public CreationHandler
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        ///
+        /// Notify the delegate that a new task has been created
+        ///
+        /// @param current The current running task
+        /// @param task The newly created task
+        /// @returns The task that is selected to run by the wrapped handler.
+        /// @note This method does NOT support group operations.
+        ///
+        Task* onTaskCreated(Task* current, Task* task)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            self->activate(task);
+
+            return CreationHandler::onTaskCreated(current, task);
+        }
+    };
+
+    ///
+    /// A task unblocked handler that activates the reservation of an unblocked task before the wrapped handler enqueues it
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @tparam UnblockedHandler Specify the task unblocked handler that deals with the unblocked task
+    ///
+    template <typename ConcreteScheduler, typename UnblockedHandler>
+    struct ActivateOnUnblock: public UnblockedHandler
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        ///
+        /// Notify the delegate that a task has been unblocked
+        ///
+        /// @param current The current running task
+        /// @param task The task that just got unblocked
+        /// @returns The task that is selected to run by the wrapped handler if requested.
+        /// @note This method supports group operations in the same way as the wrapped handler.
+        ///
+        Task* onTaskUnblocked(Task* current, Task* task)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // Guard: [Special] Check whether the caller only wants to fetch the next task
+            if (task != nullptr)
+            {
+                self->activate(task);
+            }
+
+            return UnblockedHandler::onTaskUnblocked(current, task);
+        }
+    };
+}
+
+#endif /* Scheduler_ReservationHandler_hpp */
@@ -10,6 +10,7 @@
 #define Scheduler_TaskBlockedHandler_hpp
 
 #include <Scheduler/Misc/Traits.hpp>
+#include <Scheduler/Misc/Utils.hpp>
 
 /// Defines the common task termination handler
 namespace Scheduler::EventHandlers::TaskBlocked::Common
@@ -55,6 +56,9 @@ namespace Scheduler::EventHandlers::TaskBlocked::Common
         /// Type of the task managed by the scheduler
         using Task = Traits::ScheduledTask<ConcreteScheduler>;
 
+        /// This handler relies on the idle task support component
+        static constexpr bool kRequiresIdleTaskSupport = true;
+
         ///
         /// Notify the delegate that the current running task has been blocked
         ///
@@ -67,9 +71,7 @@ namespace Scheduler::EventHandlers::TaskBlocked::Common
             // Dequeue the next ready task
             auto self = static_cast<ConcreteScheduler*>(this);
 
-            Task* next = self->next();
-
-            return next == nullptr ? self->getIdleTask() : next;
+            return Utilities::nextOrIdleTask(*self);
         }
     };
 }
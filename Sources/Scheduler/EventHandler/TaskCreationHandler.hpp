@@ -68,6 +68,9 @@ namespace Scheduler::EventHandlers::TaskCreation::Preemptive
         /// Type of the task managed by the scheduler
         using Task = Traits::ScheduledTask<ConcreteScheduler>;
 
+        /// This handler relies on the idle task support component
+        static constexpr bool kRequiresIdleTaskSupport = true;
+
         ///
         /// Notify the delegate that a new task has been created
         ///
@@ -147,6 +150,9 @@ namespace Scheduler::EventHandlers::TaskCreation::Cooperative
         /// Type of the task managed by the scheduler
         using Task = Traits::ScheduledTask<ConcreteScheduler>;
 
+        /// This handler relies on the idle task support component
+        static constexpr bool kRequiresIdleTaskSupport = true;
+
         ///
         /// Notify the delegate that a new task has been created
         ///
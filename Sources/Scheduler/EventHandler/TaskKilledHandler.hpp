@@ -10,6 +10,8 @@
 #define Scheduler_TaskKilledHandler_hpp
 
 #include <Scheduler/Misc/Traits.hpp>
+#include <Scheduler/Misc/Utils.hpp>
+#include <span>
 
 /// Defines the common task killed handler
 namespace Scheduler::EventHandlers::TaskKilled::Common
@@ -71,6 +73,63 @@ namespace Scheduler::EventHandlers::TaskKilled::Common
             return current;
         }
     };
+
+    ///
+    /// A handler that removes a batch of killed tasks from the ready queue at once and then lets the task killed handler select the next task to run
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @note The concrete scheduler must also provide a task killed handler,
+    ///       which makes the final scheduling decision with the last task in the batch.
+    /// @note Tasks in the batch are removed by the batch primitive of the scheduling policy if available.
+    ///
+    template <typename ConcreteScheduler>
+    struct BatchAdapter
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        ///
+        /// Notify the delegate that a batch of tasks has been killed
+        ///
+        /// @param current The current running task
+        /// @param tasks Non-null tasks that just got killed
+        /// @return The task that is selected to run if requested.
+        /// @warning None of the tasks being killed may be identical to the current running task.
+        /// @warning Since the scheduler is only responsible for ready tasks,
+        ///          all tasks being killed must be ready and reside in the ready queue.
+        /// @note This method supports group operations.
+        ///       1) Pass `nullptr` to `current` to remove `tasks` from the ready queue only.
+        ///          In this case, this method returns `nullptr` back to the caller.
+        ///       2) Pass an empty span to `tasks` to fetch the next task.
+        ///       3) Pass a non-null task to `current` and a non-empty span to `tasks` to remove all tasks and fetch the next task.
+        ///          In the above two cases, this method returns the task selected by the task killed handler,
+        ///          indicating that group operations are completed. The caller should not have any subsequent calls.
+        ///
+        Task* onTasksKilled(Task* current, std::span<Task* const> tasks)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // Guard: [Special] Check whether the caller performs an intermediate call
+            if (current == nullptr)
+            {
+                // Intermediate call
+                Utilities::removeBatch(*self, tasks);
+
+                return nullptr;
+            }
+
+            // Guard: [Special] Check whether the caller only wants to fetch the next task
+            if (tasks.empty())
+            {
+                return self->onTaskKilled(current, nullptr);
+            }
+
+            // Default: Remove all but the last task and let the handler decide with the last one
+            Utilities::removeBatch(*self, tasks.first(tasks.size() - 1));
+
+            return self->onTaskKilled(current, tasks.back());
+        }
+    };
 }
 
 #endif /* Scheduler_TaskKilledHandler_hpp */
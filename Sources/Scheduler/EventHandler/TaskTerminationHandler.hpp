@@ -10,6 +10,7 @@
 #define Scheduler_TaskTerminationHandler_hpp
 
 #include <Scheduler/Misc/Traits.hpp>
+#include <Scheduler/Misc/Utils.hpp>
 
 /// Defines the common task termination handler
 namespace Scheduler::EventHandlers::TaskTermination::Common
@@ -55,6 +56,9 @@ namespace Scheduler::EventHandlers::TaskTermination::Common
         /// Type of the task managed by the scheduler
         using Task = Traits::ScheduledTask<ConcreteScheduler>;
 
+        /// This handler relies on the idle task support component
+        static constexpr bool kRequiresIdleTaskSupport = true;
+
         ///
         /// Notify the delegate that the current running task has finished
         ///
@@ -67,9 +71,7 @@ namespace Scheduler::EventHandlers::TaskTermination::Common
             // Dequeue the next ready task
             auto self = static_cast<ConcreteScheduler*>(this);
 
-            Task* next = self->next();
-
-            return next == nullptr ? self->getIdleTask() : next;
+            return Utilities::nextOrIdleTask(*self);
         }
     };
 }
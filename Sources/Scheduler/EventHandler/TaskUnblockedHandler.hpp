@@ -9,7 +9,10 @@
 #ifndef Scheduler_TaskUnblockedHandler_hpp
 #define Scheduler_TaskUnblockedHandler_hpp
 
+#include <Scheduler/Constraint/Prioritizable.hpp>
 #include <Scheduler/Misc/Traits.hpp>
+#include <Scheduler/Misc/Utils.hpp>
+#include <span>
 
 /// Defines all preemptive task unblocked handler
 namespace Scheduler::EventHandlers::TaskUnblocked::Preemptive
@@ -81,6 +84,9 @@ namespace Scheduler::EventHandlers::TaskUnblocked::Preemptive
         /// Type of the task managed by the scheduler
         using Task = Traits::ScheduledTask<ConcreteScheduler>;
 
+        /// This handler relies on the idle task support component
+        static constexpr bool kRequiresIdleTaskSupport = true;
+
         ///
         /// Notify the delegate that a task has been unblocked
         ///
@@ -121,9 +127,246 @@ namespace Scheduler::EventHandlers::TaskUnblocked::Preemptive
                 self->ready(current);
             }
 
-            Task* next = self->next();
+            return Utilities::nextOrIdleTask(*self);
+        }
+    };
+
+    ///
+    /// A handler that compares the priority of the current task against the unblocked one,
+    /// and preempts the current task only if the unblocked task has a higher priority
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @warning This handler does not take the idle task into consideration.
+    /// @seealso `RunHigherPriorityWithIdleTaskSupport` to deal with the idle task properly.
+    /// @note Unlike `RunNext`, this handler does not put the current task into the ready queue and take the next one out
+    ///       if the unblocked task cannot preempt it, so waking up a task of lower or equal priority never causes a context switch.
+    /// @note The handler remembers the unblocked task of the highest priority among those enqueued by intermediate calls,
+    ///       so the final call of a group operation can decide whether the whole group preempts the current task.
+    ///
+    template <typename ConcreteScheduler>
+    requires TaskConstraints::AnyPrioritizable<Traits::ScheduledTask<ConcreteScheduler>>
+    struct RunHigherPriority
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+    private:
+        /// The enqueued task of the highest priority in the current group operation, `NULL` if there is none
+        Task* contender = nullptr;
 
-            return next == nullptr ? self->getIdleTask() : next;
+    public:
+        ///
+        /// Record the given tasks that have been enqueued as part of a group operation
+        ///
+        /// @param tasks Non-null tasks that have been unblocked and enqueued
+        /// @note This method is invoked by `Common::BatchAdapter`, which enqueues tasks without calling this handler.
+        ///
+        void noteUnblocked(std::span<Task* const> tasks)
+        {
+            for (Task* task : tasks)
+            {
+                this->contender = this->contender == nullptr ? task : Utilities::orderByPriority(this->contender, task).first;
+            }
+        }
+
+        ///
+        /// Notify the delegate that a task has been unblocked
+        ///
+        /// @param current The current running task
+        /// @param task The task that just got unblocked
+        /// @returns The non-null task that is selected to run if requested.
+        /// @note This method supports group operations.
+        ///       1) Pass `nullptr` to `current` to enqueue `task` only.
+        ///          In this case, this method returns `nullptr` back to the caller.
+        ///       2) Pass `nullptr` to `task` to fetch the next task.
+        ///       3) Pass a non-null task to both parameters to enqueue the unblocked task and fetch the next task.
+        ///          In the above two cases, this method returns a non-null task that is ready to run,
+        ///          indicating that group operations are completed. The caller should not have any subsequent calls.
+        /// @warning The caller must complete a group operation before any task enqueued by it leaves the ready queue.
+        ///
+        Task* onTaskUnblocked(Task* current, Task* task)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // Guard: [Special] Check whether the caller performs an intermediate call
+            if (current == nullptr)
+            {
+                // Intermediate call
+                self->ready(task);
+
+                this->noteUnblocked(std::span<Task* const>(&task, 1));
+
+                return nullptr;
+            }
+
+            // Find the unblocked task that has the highest priority in the group
+            Task* candidate = task;
+
+            if (this->contender != nullptr)
+            {
+                candidate = task == nullptr ? this->contender : Utilities::orderByPriority(this->contender, task).first;
+
+                this->contender = nullptr;
+            }
+
+            // Guard: Check whether any unblocked task has a higher priority than the current one
+            if (candidate == nullptr || Utilities::orderByPriority(current, candidate).first == current)
+            {
+                if (task != nullptr)
+                {
+                    self->ready(task);
+                }
+
+                // The current running task keeps running
+                return current;
+            }
+
+            // Guard: Check whether the given task preempts the current one, so it can run without being enqueued
+            if (candidate == task)
+            {
+                self->ready(current);
+
+                return task;
+            }
+
+            // The task that preempts the current one has been enqueued by an intermediate call
+            if (task != nullptr)
+            {
+                self->ready(task);
+            }
+
+            self->ready(current);
+
+            return self->next();
+        }
+    };
+
+    ///
+    /// A handler that compares the priority of the current task against the unblocked one,
+    /// and preempts the current task only if the unblocked task has a higher priority
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @warning This handler takes the idle task into consideration.
+    /// @note Unlike `RunNextWithIdleTaskSupport`, this handler does not put the current task into the ready queue and take the next one out
+    ///       if the unblocked task cannot preempt it, so waking up a task of lower or equal priority never causes a context switch.
+    /// @note The handler remembers the unblocked task of the highest priority among those enqueued by intermediate calls,
+    ///       so the final call of a group operation can decide whether the whole group preempts the current task.
+    ///
+    template <typename ConcreteScheduler>
+    requires TaskConstraints::AnyPrioritizable<Traits::ScheduledTask<ConcreteScheduler>>
+    struct RunHigherPriorityWithIdleTaskSupport
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        /// This handler relies on the idle task support component
+        static constexpr bool kRequiresIdleTaskSupport = true;
+
+    private:
+        /// The enqueued task of the highest priority in the current group operation, `NULL` if there is none
+        Task* contender = nullptr;
+
+    public:
+        ///
+        /// Record the given tasks that have been enqueued as part of a group operation
+        ///
+        /// @param tasks Non-null tasks that have been unblocked and enqueued
+        /// @note This method is invoked by `Common::BatchAdapter`, which enqueues tasks without calling this handler.
+        ///
+        void noteUnblocked(std::span<Task* const> tasks)
+        {
+            for (Task* task : tasks)
+            {
+                this->contender = this->contender == nullptr ? task : Utilities::orderByPriority(this->contender, task).first;
+            }
+        }
+
+        ///
+        /// Notify the delegate that a task has been unblocked
+        ///
+        /// @param current The current running task
+        /// @param task The task that just got unblocked
+        /// @returns The non-null task that is selected to run if requested.
+        /// @note This method supports group operations.
+        ///       1) Pass `nullptr` to `current` to enqueue `task` only.
+        ///          In this case, this method returns `nullptr` back to the caller.
+        ///       2) Pass `nullptr` to `task` to fetch the next task.
+        ///       3) Pass a non-null task to both parameters to enqueue the unblocked task and fetch the next task.
+        ///          In the above two cases, this method returns a non-null task that is ready to run,
+        ///          indicating that group operations are completed. The caller should not have any subsequent calls.
+        /// @warning The caller must complete a group operation before any task enqueued by it leaves the ready queue.
+        ///
+        Task* onTaskUnblocked(Task* current, Task* task)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // Guard: [Special] Check whether the caller performs an intermediate call
+            if (current == nullptr)
+            {
+                // Intermediate call
+                self->ready(task);
+
+                this->noteUnblocked(std::span<Task* const>(&task, 1));
+
+                return nullptr;
+            }
+
+            // Find the unblocked task that has the highest priority in the group
+            Task* candidate = task;
+
+            if (this->contender != nullptr)
+            {
+                candidate = task == nullptr ? this->contender : Utilities::orderByPriority(this->contender, task).first;
+
+                this->contender = nullptr;
+            }
+
+            // Guard: Check whether the current running task is the idle task
+            if (current == self->getIdleTask())
+            {
+                // Guard: Run the given task directly if no enqueued task has a higher priority
+                if (candidate != nullptr && candidate == task)
+                {
+                    return task;
+                }
+
+                if (task != nullptr)
+                {
+                    self->ready(task);
+                }
+
+                return Utilities::nextOrIdleTask(*self);
+            }
+
+            // Guard: Check whether any unblocked task has a higher priority than the current one
+            if (candidate == nullptr || Utilities::orderByPriority(current, candidate).first == current)
+            {
+                if (task != nullptr)
+                {
+                    self->ready(task);
+                }
+
+                // The current running task keeps running
+                return current;
+            }
+
+            // Guard: Check whether the given task preempts the current one, so it can run without being enqueued
+            if (candidate == task)
+            {
+                self->ready(current);
+
+                return task;
+            }
+
+            // The task that preempts the current one has been enqueued by an intermediate call
+            if (task != nullptr)
+            {
+                self->ready(task);
+            }
+
+            self->ready(current);
+
+            return self->next();
         }
     };
 }
@@ -195,6 +438,9 @@ namespace Scheduler::EventHandlers::TaskUnblocked::Cooperative
         /// Type of the task managed by the scheduler
         using Task = Traits::ScheduledTask<ConcreteScheduler>;
 
+        /// This handler relies on the idle task support component
+        static constexpr bool kRequiresIdleTaskSupport = true;
+
         ///
         /// Notify the delegate that a task has been unblocked
         ///
@@ -248,4 +494,83 @@ namespace Scheduler::EventHandlers::TaskUnblocked::Cooperative
     };
 }
 
+/// Defines handlers that can be combined with any task unblocked handler
+namespace Scheduler::EventHandlers::TaskUnblocked::Common
+{
+    ///
+    /// A handler that enqueues a batch of unblocked tasks at once and then lets the task unblocked handler select the next task to run
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @note The concrete scheduler must also provide a task unblocked handler,
+    ///       which makes the final scheduling decision with the last task in the batch,
+    ///       so preemption and idle task checks behave as if tasks were unblocked one by one.
+    /// @note Tasks in the batch are enqueued by the batch primitive of the scheduling policy if available.
+    ///       If the task unblocked handler provides `noteUnblocked()`, e.g. `Preemptive::RunHigherPriority`,
+    ///       it is notified of the tasks enqueued without its involvement.
+    ///
+    template <typename ConcreteScheduler>
+    struct BatchAdapter
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+    private:
+        ///
+        /// [Helper] Enqueue the given tasks and notify the task unblocked handler if it tracks enqueued tasks
+        ///
+        /// @param self The concrete scheduler
+        /// @param tasks Non-null tasks that just got unblocked
+        ///
+        static void enqueue(ConcreteScheduler* self, std::span<Task* const> tasks)
+        {
+            Utilities::readyBatch(*self, tasks);
+
+            if constexpr (requires { self->noteUnblocked(tasks); })
+            {
+                self->noteUnblocked(tasks);
+            }
+        }
+
+    public:
+        ///
+        /// Notify the delegate that a batch of tasks has been unblocked
+        ///
+        /// @param current The current running task
+        /// @param tasks Non-null tasks that just got unblocked
+        /// @returns The task that is selected to run if requested.
+        /// @note This method supports group operations.
+        ///       1) Pass `nullptr` to `current` to enqueue `tasks` only.
+        ///          In this case, this method returns `nullptr` back to the caller.
+        ///       2) Pass an empty span to `tasks` to fetch the next task.
+        ///       3) Pass a non-null task to `current` and a non-empty span to `tasks` to enqueue all tasks and fetch the next task.
+        ///          In the above two cases, this method returns the task selected by the task unblocked handler,
+        ///          indicating that group operations are completed. The caller should not have any subsequent calls.
+        ///
+        Task* onTasksUnblocked(Task* current, std::span<Task* const> tasks)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // Guard: [Special] Check whether the caller performs an intermediate call
+            if (current == nullptr)
+            {
+                // Intermediate call
+                enqueue(self, tasks);
+
+                return nullptr;
+            }
+
+            // Guard: [Special] Check whether the caller only wants to fetch the next task
+            if (tasks.empty())
+            {
+                return self->onTaskUnblocked(current, nullptr);
+            }
+
+            // Default: Enqueue all but the last task and let the handler decide with the last one
+            enqueue(self, tasks.first(tasks.size() - 1));
+
+            return self->onTaskUnblocked(current, tasks.back());
+        }
+    };
+}
+
 #endif /* Scheduler_TaskUnblockedHandler_hpp */
@@ -10,6 +10,10 @@
 #define Scheduler_TimerInterruptHandler_hpp
 
 #include <Scheduler/Misc/Traits.hpp>
+#include <Scheduler/Misc/Utils.hpp>
+#include <Scheduler/Constraint/Quantizable.hpp>
+#include <cstdint>
+#include <limits>
 
 /// Defines all preemptive timer interrupt handlers
 namespace Scheduler::EventHandlers::TimerInterrupt::Preemptive
@@ -55,6 +59,9 @@ namespace Scheduler::EventHandlers::TimerInterrupt::Preemptive
         /// Type of the task managed by the scheduler
         using Task = Traits::ScheduledTask<ConcreteScheduler>;
 
+        /// This handler relies on the idle task support component
+        static constexpr bool kRequiresIdleTaskSupport = true;
+
         ///
         /// Notify the delegate that a timer interrupt has occurred
         ///
@@ -74,9 +81,7 @@ namespace Scheduler::EventHandlers::TimerInterrupt::Preemptive
             }
 
             // Get the next ready task from the queue
-            Task* nextTask = self->next();
-
-            return nextTask == nullptr ? self->getIdleTask() : nextTask;
+            return Utilities::nextOrIdleTask(*self);
         }
     };
 
@@ -93,6 +98,9 @@ namespace Scheduler::EventHandlers::TimerInterrupt::Preemptive
         /// Type of the task managed by the scheduler
         using Task = Traits::ScheduledTask<ConcreteScheduler>;
 
+        /// This handler relies on the task quantum used up handler
+        static constexpr bool kRequiresQuantumUsedUpHandler = true;
+
         ///
         /// Notify the delegate that a timer interrupt has occurred
         ///
@@ -129,6 +137,12 @@ namespace Scheduler::EventHandlers::TimerInterrupt::Preemptive
         /// Type of the task managed by the scheduler
         using Task = Traits::ScheduledTask<ConcreteScheduler>;
 
+        /// This handler relies on the task quantum used up handler
+        static constexpr bool kRequiresQuantumUsedUpHandler = true;
+
+        /// This handler relies on the idle task support component
+        static constexpr bool kRequiresIdleTaskSupport = true;
+
         ///
         /// Notify the delegate that a timer interrupt has occurred
         ///
@@ -143,9 +157,7 @@ namespace Scheduler::EventHandlers::TimerInterrupt::Preemptive
             // Guard: Check whether the current task is the idle task
             if (current == self->getIdleTask())
             {
-                Task* next = self->next();
-
-                return next == nullptr ? self->getIdleTask() : next;
+                return Utilities::nextOrIdleTask(*self);
             }
 
             // The current running task has run for a tick
@@ -213,6 +225,603 @@ namespace Scheduler::EventHandlers::TimerInterrupt::Preemptive
     struct KeepRunningCurrentWithAutoRechargeOnQuantumUsedUpAndIdleTaskSupport:
             public KeepRunningCurrentWithAnyQuantumUsedUpHandlerAndIdleTaskSupport<ConcreteScheduler>,
             public TaskQuantumUsedUp::Preemptive::RunNextWithQuantumRecharged<ConcreteScheduler, CustomQuantumSpecifier> {};
+
+    ///
+    /// A handler that boosts all tasks to the highest priority level periodically and then processes the timer interrupt with the given handler
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @tparam BaseHandler Specify the timer interrupt handler that processes every timer interrupt,
+    ///                     e.g. `KeepRunningCurrentWithAutoDemotionOnQuantumUsedUpAndIdleTaskSupport`
+    /// @tparam BoostPeriod Specify the number of timer interrupts between two consecutive boosts
+    /// @note The policy must provide `boost()`, e.g. `Policies::PrioritizedMultiQueue::Normal::BoostableBitmapArrayMapImp`.
+    /// @note The current running task is boosted as well unless it is the idle task,
+    ///       so that tasks demoted to the lowest priority level cannot be starved by tasks that keep returning to the higher levels.
+    ///
+    template <typename ConcreteScheduler, typename BaseHandler, uint32_t BoostPeriod>
+    requires (BoostPeriod > 0)
+    struct WithPeriodicPriorityBoost: public BaseHandler
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+    private:
+        /// The number of timer interrupts until the next boost
+        uint32_t ticksUntilBoost = BoostPeriod;
+
+    public:
+        ///
+        /// Notify the delegate that a timer interrupt has occurred
+        ///
+        /// @param current The current running task
+        /// @returns The non-null task that is selected to run.
+        ///
+        Task* onTimerInterrupt(Task* current)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // Guard: Check whether a boost is due
+            if (--this->ticksUntilBoost == 0)
+            {
+                this->ticksUntilBoost = BoostPeriod;
+
+                // The idle task always runs at its own priority level
+                if constexpr (requires { self->getIdleTask(); })
+                {
+                    self->boost(current == self->getIdleTask() ? nullptr : current);
+                }
+                else
+                {
+                    self->boost(current);
+                }
+            }
+
+            return BaseHandler::onTimerInterrupt(current);
+        }
+    };
+}
+
+/// Defines all tickless timer interrupt handlers
+///
+/// @note A tickless handler lets the caller replace the periodic timer tick with a one-shot timer.
+///       The caller queries `ticksUntilQuantumExpiry()` after each scheduling decision to program the timer,
+///       and passes the number of ticks that have elapsed since the last charge to `onTimerInterrupt()`,
+///       which charges the current running task in bulk via `consumeTicks()`.
+/// @note Each handler also provides the single-argument `onTimerInterrupt()` that charges exactly one tick,
+///       so the scheduler still works with a periodic timer tick.
+///
+namespace Scheduler::EventHandlers::TimerInterrupt::Tickless
+{
+    ///
+    /// A handler that keeps the current running with a custom ticks used up handler
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @warning This handler does not take the idle task into consideration.
+    /// @seealso `KeepRunningCurrentWithAnyQuantumUsedUpHandlerAndIdleTaskSupport` to deal with the idle task properly.
+    ///
+    template <typename ConcreteScheduler>
+    struct KeepRunningCurrentWithAnyQuantumUsedUpHandler
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        /// This handler relies on the task quantum used up handler
+        static constexpr bool kRequiresQuantumUsedUpHandler = true;
+
+        /// Type of the time tick
+        using Tick = typename Task::Tick;
+
+        static_assert(TaskConstraints::TicklessQuantizable<Task>, "The task must support charging elapsed ticks in bulk.");
+
+        ///
+        /// Notify the delegate that a timer interrupt has occurred
+        ///
+        /// @param current The current running task
+        /// @param elapsed The number of ticks that have elapsed since the current running task was last charged
+        /// @returns The non-null task that is selected to run.
+        ///
+        Task* onTimerInterrupt(Task* current, Tick elapsed)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // The current running task has run for the elapsed ticks
+            current->consumeTicks(elapsed);
+
+            // Guard: Let the custom handler deal with the task if it has used up all ticks
+            if (current->hasUsedUpTimeAllotment())
+            {
+                return self->onTaskQuantumUsedUp(current);
+            }
+
+            // Keep running the current task
+            return current;
+        }
+
+        ///
+        /// Notify the delegate that a periodic timer interrupt has occurred
+        ///
+        /// @param current The current running task
+        /// @returns The non-null task that is selected to run.
+        ///
+        Task* onTimerInterrupt(Task* current)
+        {
+            return this->onTimerInterrupt(current, 1);
+        }
+
+        ///
+        /// Get the number of ticks until the current running task uses up its time allotment
+        ///
+        /// @param current The current running task
+        /// @return The number of ticks after which the caller should deliver the next timer interrupt.
+        ///
+        [[nodiscard]]
+        Tick ticksUntilQuantumExpiry(Task* current)
+        {
+            return current->getRemainingTicks();
+        }
+    };
+
+    ///
+    /// A handler that keeps the current running with a custom ticks used up handler
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @warning This handler takes the idle task into consideration.
+    ///
+    template <typename ConcreteScheduler>
+    struct KeepRunningCurrentWithAnyQuantumUsedUpHandlerAndIdleTaskSupport
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        /// This handler relies on the task quantum used up handler
+        static constexpr bool kRequiresQuantumUsedUpHandler = true;
+
+        /// This handler relies on the idle task support component
+        static constexpr bool kRequiresIdleTaskSupport = true;
+
+        /// Type of the time tick
+        using Tick = typename Task::Tick;
+
+        static_assert(TaskConstraints::TicklessQuantizable<Task>, "The task must support charging elapsed ticks in bulk.");
+
+        ///
+        /// Notify the delegate that a timer interrupt has occurred
+        ///
+        /// @param current The current running task
+        /// @param elapsed The number of ticks that have elapsed since the current running task was last charged
+        /// @returns The non-null task that is selected to run.
+        ///
+        Task* onTimerInterrupt(Task* current, Tick elapsed)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // The ready queue might be modified before this method is called
+            // Guard: Check whether the current task is the idle task
+            if (current == self->getIdleTask())
+            {
+                return Utilities::nextOrIdleTask(*self);
+            }
+
+            // The current running task has run for the elapsed ticks
+            current->consumeTicks(elapsed);
+
+            // Guard: Let the custom handler deal with the task if it has used up all ticks
+            if (current->hasUsedUpTimeAllotment())
+            {
+                return self->onTaskQuantumUsedUp(current);
+            }
+
+            // Keep running the current task
+            return current;
+        }
+
+        ///
+        /// Notify the delegate that a periodic timer interrupt has occurred
+        ///
+        /// @param current The current running task
+        /// @returns The non-null task that is selected to run.
+        ///
+        Task* onTimerInterrupt(Task* current)
+        {
+            return this->onTimerInterrupt(current, 1);
+        }
+
+        ///
+        /// Get the number of ticks until the current running task uses up its time allotment
+        ///
+        /// @param current The current running task
+        /// @return The number of ticks after which the caller should deliver the next timer interrupt,
+        ///         or the maximum tick value if the idle task is running and no timer interrupt is needed.
+        /// @note Tasks that become ready while the idle task is running arrive through other events,
+        ///       such as the task creation or task unblocked handler, so the idle task never needs to be preempted by the timer.
+        ///
+        [[nodiscard]]
+        Tick ticksUntilQuantumExpiry(Task* current)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // Guard: The idle task runs until another event makes a task ready
+            if (current == self->getIdleTask())
+            {
+                return std::numeric_limits<Tick>::max();
+            }
+
+            return current->getRemainingTicks();
+        }
+    };
+
+    ///
+    /// A handler that keeps the current task running unless it has used up its ticks
+    /// In this case, the handler demotes the current task and selects the next task to run
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @warning This handler does not take the idle task into consideration.
+    /// @seealso `KeepRunningCurrentWithAutoDemotionOnQuantumUsedUpAndIdleTaskSupport` to deal with the idle task properly.
+    ///
+    template <typename ConcreteScheduler>
+    struct KeepRunningCurrentWithAutoDemotionOnQuantumUsedUp:
+            public KeepRunningCurrentWithAnyQuantumUsedUpHandler<ConcreteScheduler>,
+            public TaskQuantumUsedUp::Preemptive::RunNextWithDemotion<ConcreteScheduler> {};
+
+    ///
+    /// A handler that keeps the current task running unless it has used up its ticks
+    /// In this case, the handler demotes the current task and selects the next task to run
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @warning This handler takes the idle task into consideration.
+    ///
+    template <typename ConcreteScheduler>
+    struct KeepRunningCurrentWithAutoDemotionOnQuantumUsedUpAndIdleTaskSupport:
+            public KeepRunningCurrentWithAnyQuantumUsedUpHandlerAndIdleTaskSupport<ConcreteScheduler>,
+            public TaskQuantumUsedUp::Preemptive::RunNextWithDemotion<ConcreteScheduler> {};
+
+    ///
+    /// A handler that keeps the current task running unless it has used up its ticks
+    /// In this case, the handler recharges its ticks based on its priority level and selects the next task to run
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @tparam CustomQuantumSpecifier A callable type that maps a priority level to a certain amount of time ticks
+    /// @warning This handler does not take the idle task into consideration.
+    /// @seealso `KeepRunningCurrentWithAutoRechargeOnQuantumUsedUpAndIdleTaskSupport` to deal with the idle task properly.
+    ///
+    template <typename ConcreteScheduler, typename CustomQuantumSpecifier>
+    struct KeepRunningCurrentWithAutoRechargeOnQuantumUsedUp:
+            public KeepRunningCurrentWithAnyQuantumUsedUpHandler<ConcreteScheduler>,
+            public TaskQuantumUsedUp::Preemptive::RunNextWithQuantumRecharged<ConcreteScheduler, CustomQuantumSpecifier> {};
+
+    ///
+    /// A handler that keeps the current task running unless it has used up its ticks
+    /// In this case, the handler recharges its ticks based on its priority level and selects the next task to run
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @tparam CustomQuantumSpecifier A callable type that maps a priority level to a certain amount of time ticks
+    /// @warning This handler takes the idle task into consideration.
+    ///
+    template <typename ConcreteScheduler, typename CustomQuantumSpecifier>
+    struct KeepRunningCurrentWithAutoRechargeOnQuantumUsedUpAndIdleTaskSupport:
+            public KeepRunningCurrentWithAnyQuantumUsedUpHandlerAndIdleTaskSupport<ConcreteScheduler>,
+            public TaskQuantumUsedUp::Preemptive::RunNextWithQuantumRecharged<ConcreteScheduler, CustomQuantumSpecifier> {};
+}
+
+/// Defines all fair-share timer interrupt handlers
+///
+/// @note A fair-share handler charges the ticks consumed by the current running task to its virtual runtime
+///       and preempts it once it has run sufficiently longer than the task that has the smallest virtual runtime.
+///       The handlers rely on the scheduling policy to provide `charge()` and `shouldPreempt()`,
+///       e.g. `Policies::FairShare::Normal::RedBlackTreeImp`.
+/// @note Each handler accepts the number of ticks that have elapsed since the current running task was last charged,
+///       and also provides the single-argument `onTimerInterrupt()` that charges exactly one tick for a periodic timer tick.
+///
+namespace Scheduler::EventHandlers::TimerInterrupt::FairShare
+{
+    ///
+    /// A handler that charges the current task and runs the task that has the smallest virtual runtime if the current one is preempted
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @warning This handler does not take the idle task into consideration.
+    /// @seealso `ChargeCurrentAndRunFairestWithIdleTaskSupport` to deal with the idle task properly.
+    ///
+    template <typename ConcreteScheduler>
+    struct ChargeCurrentAndRunFairest
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        ///
+        /// Notify the delegate that a timer interrupt has occurred
+        ///
+        /// @param current The current running task
+        /// @param elapsed The number of ticks that have elapsed since the current running task was last charged
+        /// @returns The non-null task that is selected to run.
+        ///
+        Task* onTimerInterrupt(Task* current, uint64_t elapsed)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // The current running task has run for the elapsed ticks
+            self->charge(current, elapsed);
+
+            // Guard: Keep running the current task if it has not received more than its fair share
+            if (!self->shouldPreempt(current))
+            {
+                return current;
+            }
+
+            self->ready(current);
+
+            return self->next();
+        }
+
+        ///
+        /// Notify the delegate that a periodic timer interrupt has occurred
+        ///
+        /// @param current The current running task
+        /// @returns The non-null task that is selected to run.
+        ///
+        Task* onTimerInterrupt(Task* current)
+        {
+            return this->onTimerInterrupt(current, 1);
+        }
+    };
+
+    ///
+    /// A handler that charges the current task and runs the task that has the smallest virtual runtime if the current one is preempted
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @warning This handler takes the idle task into consideration.
+    ///
+    template <typename ConcreteScheduler>
+    struct ChargeCurrentAndRunFairestWithIdleTaskSupport
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        /// This handler relies on the idle task support component
+        static constexpr bool kRequiresIdleTaskSupport = true;
+
+        ///
+        /// Notify the delegate that a timer interrupt has occurred
+        ///
+        /// @param current The current running task
+        /// @param elapsed The number of ticks that have elapsed since the current running task was last charged
+        /// @returns The non-null task that is selected to run.
+        ///
+        Task* onTimerInterrupt(Task* current, uint64_t elapsed)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // The ready queue might be modified before this method is called
+            // Guard: Check whether the current task is the idle task
+            if (current == self->getIdleTask())
+            {
+                return Utilities::nextOrIdleTask(*self);
+            }
+
+            // The current running task has run for the elapsed ticks
+            self->charge(current, elapsed);
+
+            // Guard: Keep running the current task if it has not received more than its fair share
+            if (!self->shouldPreempt(current))
+            {
+                return current;
+            }
+
+            self->ready(current);
+
+            return Utilities::nextOrIdleTask(*self);
+        }
+
+        ///
+        /// Notify the delegate that a periodic timer interrupt has occurred
+        ///
+        /// @param current The current running task
+        /// @returns The non-null task that is selected to run.
+        ///
+        Task* onTimerInterrupt(Task* current)
+        {
+            return this->onTimerInterrupt(current, 1);
+        }
+    };
+}
+
+/// Defines all constant bandwidth timer interrupt handlers
+///
+/// @note A constant bandwidth handler advances the clock of the server, which enqueues throttled tasks whose budgets are due,
+///       charges the current running task against its budget and preempts it once it is throttled
+///       or a replenished task has an earlier server deadline.
+///       The handlers rely on the scheduling policy to provide `advance()` and `consume()`,
+///       e.g. `Policies::ConstantBandwidth::PolicyWithReservations`.
+/// @note Each handler accepts the number of ticks that have elapsed since the previous timer interrupt,
+///       and also provides the single-argument `onTimerInterrupt()` that charges exactly one tick for a periodic timer tick.
+///
+namespace Scheduler::EventHandlers::TimerInterrupt::ConstantBandwidth
+{
+    ///
+    /// A handler that enforces the budget of the current task and runs the task that has the earliest server deadline
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @warning This handler takes the idle task into consideration.
+    ///
+    template <typename ConcreteScheduler>
+    struct ChargeCurrentAndRunEarliestWithIdleTaskSupport
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        /// This handler relies on the idle task support component
+        static constexpr bool kRequiresIdleTaskSupport = true;
+
+        ///
+        /// Notify the delegate that a timer interrupt has occurred
+        ///
+        /// @param current The current running task
+        /// @param elapsed The number of ticks that have elapsed since the previous timer interrupt
+        /// @returns The non-null task that is selected to run.
+        ///
+        Task* onTimerInterrupt(Task* current, uint64_t elapsed)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // Throttled tasks whose budgets are due are ready to run again
+            bool replenished = self->advance(elapsed) != 0;
+
+            // The ready queue might be modified before this method is called
+            // Guard: Check whether the current task is the idle task
+            if (current == self->getIdleTask())
+            {
+                return Utilities::nextOrIdleTask(*self);
+            }
+
+            uint64_t deadline = current->getServerDeadline();
+
+            // Guard: Check whether the current task has exhausted its budget
+            if (self->consume(current, elapsed))
+            {
+                return Utilities::nextOrIdleTask(*self);
+            }
+
+            // Guard: Keep running the current task if no task could have an earlier server deadline now
+            if (!replenished && current->getServerDeadline() == deadline)
+            {
+                return current;
+            }
+
+            self->ready(current);
+
+            return self->next();
+        }
+
+        ///
+        /// Notify the delegate that a periodic timer interrupt has occurred
+        ///
+        /// @param current The current running task
+        /// @returns The non-null task that is selected to run.
+        ///
+        Task* onTimerInterrupt(Task* current)
+        {
+            return this->onTimerInterrupt(current, 1);
+        }
+    };
+}
+
+/// Defines all hierarchical timer interrupt handlers
+///
+/// @note A hierarchical handler advances the clock of the hierarchy, which brings back throttled groups once a new period starts,
+///       charges the groups of the current running task and preempts it once one of its groups ends its slice or gets throttled.
+///       The handlers rely on the scheduling policy to provide `advance()` and `charge()`,
+///       e.g. `Policies::Hierarchical::Normal::GroupTreeImp`.
+/// @note Each handler accepts the number of ticks that have elapsed since the previous timer interrupt,
+///       and also provides the single-argument `onTimerInterrupt()` that charges exactly one tick for a periodic timer tick.
+///
+namespace Scheduler::EventHandlers::TimerInterrupt::Hierarchical
+{
+    ///
+    /// A handler that charges the groups of the current task and runs the next task selected by the hierarchy if the current one is preempted
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @warning This handler takes the idle task into consideration.
+    ///
+    template <typename ConcreteScheduler>
+    struct ChargeCurrentAndRunNextWithIdleTaskSupport
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        /// This handler relies on the idle task support component
+        static constexpr bool kRequiresIdleTaskSupport = true;
+
+        ///
+        /// Notify the delegate that a timer interrupt has occurred
+        ///
+        /// @param current The current running task
+        /// @param elapsed The number of ticks that have elapsed since the previous timer interrupt
+        /// @returns The non-null task that is selected to run.
+        ///
+        Task* onTimerInterrupt(Task* current, uint64_t elapsed)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            // Throttled groups are brought back once a new period starts
+            self->advance(elapsed);
+
+            // The ready queue might be modified before this method is called
+            // Guard: Check whether the current task is the idle task
+            if (current == self->getIdleTask())
+            {
+                return Utilities::nextOrIdleTask(*self);
+            }
+
+            // Guard: Keep running the current task if its groups remain selected
+            if (!self->charge(current, elapsed))
+            {
+                return current;
+            }
+
+            self->ready(current);
+
+            return Utilities::nextOrIdleTask(*self);
+        }
+
+        ///
+        /// Notify the delegate that a periodic timer interrupt has occurred
+        ///
+        /// @param current The current running task
+        /// @returns The non-null task that is selected to run.
+        ///
+        Task* onTimerInterrupt(Task* current)
+        {
+            return this->onTimerInterrupt(current, 1);
+        }
+    };
+}
+
+/// Defines all earliest-deadline-first timer interrupt handlers
+///
+/// @note An earliest-deadline-first handler advances the clock against which the policy detects deadline misses on the dispatch path.
+///       The handlers rely on the scheduling policy to provide `advance()`,
+///       e.g. `Policies::EarliestDeadlineFirst::PolicyWithOverloadDetection`.
+/// @note Each handler accepts the number of ticks that have elapsed since the previous timer interrupt,
+///       and also provides the single-argument `onTimerInterrupt()` that advances the clock by exactly one tick.
+///
+namespace Scheduler::EventHandlers::TimerInterrupt::EarliestDeadlineFirst
+{
+    ///
+    /// A handler that advances the clock of the policy and lets the current task keep running
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @note The current task keeps running since the passage of time does not change the order of deadlines.
+    ///       A task that arrives with an earlier deadline preempts it on creation or unblocking instead.
+    ///
+    template <typename ConcreteScheduler>
+    struct AdvanceClockAndKeepRunningCurrent
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+        ///
+        /// Notify the delegate that a timer interrupt has occurred
+        ///
+        /// @param current The current running task
+        /// @param elapsed The number of ticks that have elapsed since the previous timer interrupt
+        /// @returns The non-null task that is selected to run.
+        ///
+        Task* onTimerInterrupt(Task* current, uint64_t elapsed)
+        {
+            static_cast<ConcreteScheduler*>(this)->advance(elapsed);
+
+            return current;
+        }
+
+        ///
+        /// Notify the delegate that a periodic timer interrupt has occurred
+        ///
+        /// @param current The current running task
+        /// @returns The non-null task that is selected to run.
+        ///
+        Task* onTimerInterrupt(Task* current)
+        {
+            return this->onTimerInterrupt(current, 1);
+        }
+    };
 }
 
 /// Defines all cooperative timer interrupt handlers
@@ -0,0 +1,473 @@
+//
+//  Instrumented.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_Instrumented_hpp
+#define Scheduler_Instrumented_hpp
+
+#include <Scheduler/Instrumentation/Recorder.hpp>
+#include <Scheduler/Policy/Policy.hpp>
+#include <Scheduler/Misc/Traits.hpp>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <type_traits>
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    ///
+    /// A scheduling policy that reports enqueue, dequeue and removal operations to an instrumentation recorder
+    ///
+    /// @tparam BasePolicy Specify the scheduling policy to be instrumented
+    /// @tparam Recorder Specify the recorder that receives the reports
+    /// @note The policy keeps track of the number of tasks in the ready queue and reports it along with each operation.
+    /// @note When `Recorder::kEnabled` is `false`, e.g. `Instrumentation::NullRecorder`,
+    ///       every primitive forwards to the base policy directly and the recorder occupies no storage.
+    /// @note Instrumented event handlers fetch the recorder via `getRecorder()`.
+    ///
+    template <typename BasePolicy, typename Recorder>
+    requires Concepts::Policy<BasePolicy> && Concepts::InstrumentationRecorder<Recorder, Traits::PolicyTask<BasePolicy>>
+    struct PolicyWithInstrumentation: public BasePolicy
+    {
+    public:
+        /// Type of the task managed by the policy component
+        using Task = Traits::PolicyTask<BasePolicy>;
+
+    private:
+        /// The recorder that receives the reports
+        [[no_unique_address]]
+        Recorder recorder;
+
+        /// The number of tasks in the ready queue, which occupies no storage if the recorder is disabled
+        [[no_unique_address]]
+        std::conditional_t<Recorder::kEnabled, size_t, std::tuple<>> depth = {};
+
+    public:
+        /// Inherit the constructors of the base policy
+        using BasePolicy::BasePolicy;
+
+        ///
+        /// Get the recorder that receives the reports
+        ///
+        /// @return The recorder.
+        ///
+        Recorder& getRecorder()
+        {
+            return this->recorder;
+        }
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next()
+        {
+            Task* task = BasePolicy::next();
+
+            if constexpr (Recorder::kEnabled)
+            {
+                if (task != nullptr)
+                {
+                    this->recorder.taskDequeued(task, --this->depth);
+                }
+            }
+
+            return task;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task)
+        {
+            BasePolicy::ready(task);
+
+            if constexpr (Recorder::kEnabled)
+            {
+                this->recorder.taskEnqueued(task, ++this->depth);
+            }
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) requires Concepts::RemovablePolicy<BasePolicy>
+        {
+            BasePolicy::remove(task);
+
+            if constexpr (Recorder::kEnabled)
+            {
+                this->recorder.taskRemoved(task, --this->depth);
+            }
+        }
+
+        ///
+        /// Enqueue a batch of ready schedulable tasks
+        ///
+        /// @param tasks Non-null tasks that are ready to run
+        ///
+        void readyBatch(std::span<Task* const> tasks) requires Concepts::BatchReadyPolicy<BasePolicy>
+        {
+            BasePolicy::readyBatch(tasks);
+
+            if constexpr (Recorder::kEnabled)
+            {
+                for (Task* task : tasks)
+                {
+                    this->recorder.taskEnqueued(task, ++this->depth);
+                }
+            }
+        }
+
+        ///
+        /// Remove a batch of schedulable tasks from the ready queue
+        ///
+        /// @param tasks Non-null tasks that reside in the ready queue
+        ///
+        void removeBatch(std::span<Task* const> tasks) requires Concepts::BatchRemovablePolicy<BasePolicy>
+        {
+            BasePolicy::removeBatch(tasks);
+
+            if constexpr (Recorder::kEnabled)
+            {
+                for (Task* task : tasks)
+                {
+                    this->recorder.taskRemoved(task, --this->depth);
+                }
+            }
+        }
+    };
+}
+
+/// Defines concepts used by the instrumented event handler to find the handler of each event
+namespace Scheduler::Concepts
+{
+    /// An event handler that provides `onTaskCreated(Task* current, Task* task)`
+    template <typename Handler, typename Task>
+    concept HandlesTaskCreation = requires(Handler& handler, Task* task)
+    {
+        { handler.onTaskCreated(task, task) } -> std::same_as<Task*>;
+    };
+
+    /// An event handler that provides `onTaskFinished(Task* current)`
+    template <typename Handler, typename Task>
+    concept HandlesTaskTermination = requires(Handler& handler, Task* task)
+    {
+        { handler.onTaskFinished(task) } -> std::same_as<Task*>;
+    };
+
+    /// An event handler that provides `onTaskYielded(Task* current)`
+    template <typename Handler, typename Task>
+    concept HandlesTaskYielding = requires(Handler& handler, Task* task)
+    {
+        { handler.onTaskYielded(task) } -> std::same_as<Task*>;
+    };
+
+    /// An event handler that provides `onTaskBlocked(Task* current)`
+    template <typename Handler, typename Task>
+    concept HandlesTaskBlocked = requires(Handler& handler, Task* task)
+    {
+        { handler.onTaskBlocked(task) } -> std::same_as<Task*>;
+    };
+
+    /// An event handler that provides `onTaskUnblocked(Task* current, Task* task)`
+    template <typename Handler, typename Task>
+    concept HandlesTaskUnblocked = requires(Handler& handler, Task* task)
+    {
+        { handler.onTaskUnblocked(task, task) } -> std::same_as<Task*>;
+    };
+
+    /// An event handler that provides `onTaskKilled(Task* current, Task* task)`
+    template <typename Handler, typename Task>
+    concept HandlesTaskKilled = requires(Handler& handler, Task* task)
+    {
+        { handler.onTaskKilled(task, task) } -> std::same_as<Task*>;
+    };
+
+    /// An event handler that provides `onTaskPriorityChanged(Task* current)`
+    template <typename Handler, typename Task>
+    concept HandlesTaskSelfPriorityChanged = requires(Handler& handler, Task* task)
+    {
+        { handler.onTaskPriorityChanged(task) } -> std::same_as<Task*>;
+    };
+
+    /// An event handler that provides `onTaskQuantumUsedUp(Task* current)`
+    template <typename Handler, typename Task>
+    concept HandlesTaskQuantumUsedUp = requires(Handler& handler, Task* task)
+    {
+        { handler.onTaskQuantumUsedUp(task) } -> std::same_as<Task*>;
+    };
+
+    /// An event handler that provides `onTimerInterrupt(Task* current)`
+    template <typename Handler, typename Task>
+    concept HandlesTimerInterrupt = requires(Handler& handler, Task* task)
+    {
+        { handler.onTimerInterrupt(task) } -> std::same_as<Task*>;
+    };
+
+    /// An event handler that provides `onTaskPriorityChanged(Task* current, Task* task, const Priority& oldPriority)`
+    template <typename Handler, typename Task, typename Priority>
+    concept HandlesTaskPriorityChanged = requires(Handler& handler, Task* task, const Priority& oldPriority)
+    {
+        { handler.onTaskPriorityChanged(task, task, oldPriority) } -> std::same_as<Task*>;
+    };
+
+    /// An event handler that provides `onTimerInterrupt(Task* current, Tick elapsed)`
+    template <typename Handler, typename Task, typename Tick>
+    concept HandlesTicklessTimerInterrupt = requires(Handler& handler, Task* task, Tick elapsed)
+    {
+        { handler.onTimerInterrupt(task, elapsed) } -> std::same_as<Task*>;
+    };
+}
+
+/// Defines the wrapper that instruments event handlers
+namespace Scheduler::EventHandlers
+{
+    ///
+    /// A handler that reports each event handled by the given handlers to the instrumentation recorder of the scheduler
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler
+    /// @tparam Handler Specify the event handlers to be instrumented
+    /// @note The concrete scheduler must provide `getRecorder()`, e.g. by using `PolicyWithInstrumentation` as its policy.
+    /// @note The wrapper inherits all given handlers and provides the same event handler functions as them, and nothing more.
+    ///       Each function forwards to the first given handler that handles the event, and then reports the event.
+    ///       When the recorder is disabled, each function forwards to the given handler directly.
+    /// @note If the recorder measures latencies, e.g. `Instrumentation::LatencyRecorder`,
+    ///       each function also reads the clock of the recorder before it forwards the event and reports the elapsed time afterwards.
+    /// @note Since a handler calls other handlers through the concrete scheduler,
+    ///       an event handled on behalf of another one is reported as well,
+    ///       e.g. a timer interrupt that triggers the task quantum used up handler reports both events.
+    /// @note Pass all handlers to a single wrapper, since functions of the same name provided by multiple wrappers are ambiguous.
+    ///
+    template <typename ConcreteScheduler, typename... Handler>
+    struct Instrumented: public Handler...
+    {
+        /// Type of the task managed by the scheduler
+        using Task = Traits::ScheduledTask<ConcreteScheduler>;
+
+    private:
+        ///
+        /// [Helper] Find the first handler that handles an event
+        ///
+        /// @tparam Handles Specify whether each given handler handles the event
+        /// @return The index of the first handler that handles the event.
+        ///
+        template <bool... Handles>
+        static constexpr size_t indexOfProvider()
+        {
+            constexpr bool handles[] = {Handles...};
+
+            size_t index = 0;
+
+            while (!handles[index])
+            {
+                index += 1;
+            }
+
+            return index;
+        }
+
+        /// [Helper] The first handler that handles an event
+        template <bool... Handles>
+        using Provider = std::tuple_element_t<indexOfProvider<Handles...>(), std::tuple<Handler...>>;
+
+        ///
+        /// [Helper] Read the clock of the recorder before an event is handled
+        ///
+        /// @return The start timestamp if the recorder measures latencies, zero otherwise.
+        ///
+        uint64_t begin()
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            using Recorder = std::remove_reference_t<decltype(self->getRecorder())>;
+
+            if constexpr (Recorder::kEnabled && Concepts::LatencyRecorder<Recorder>)
+            {
+                return self->getRecorder().eventStarted();
+            }
+            else
+            {
+                return 0;
+            }
+        }
+
+        ///
+        /// [Helper] Report the given event to the recorder of the scheduler
+        ///
+        /// @param event The event that has been handled
+        /// @param start The timestamp returned by `begin()` before the event was handled
+        /// @param current The current running task passed to the handler
+        /// @param next The task returned by the handler
+        /// @return The task returned by the handler.
+        ///
+        Task* report(Instrumentation::Event event, uint64_t start, Task* current, Task* next)
+        {
+            auto self = static_cast<ConcreteScheduler*>(this);
+
+            using Recorder = std::remove_reference_t<decltype(self->getRecorder())>;
+
+            if constexpr (Recorder::kEnabled && Concepts::LatencyRecorder<Recorder>)
+            {
+                self->getRecorder().eventFinished(event, start);
+            }
+
+            if constexpr (Recorder::kEnabled)
+            {
+                self->getRecorder().eventHandled(event, current, next);
+            }
+
+            return next;
+        }
+
+    public:
+        ///
+        /// Notify the delegate that a new task has been created and report the event
+        ///
+        Task* onTaskCreated(Task* current, Task* task) requires (Concepts::HandlesTaskCreation<Handler, Task> || ...)
+        {
+            using H = Provider<Concepts::HandlesTaskCreation<Handler, Task>...>;
+
+            uint64_t start = this->begin();
+
+            return this->report(Instrumentation::Event::kTaskCreated, start, current, H::onTaskCreated(current, task));
+        }
+
+        ///
+        /// Notify the delegate that the current running task has finished and report the event
+        ///
+        Task* onTaskFinished(Task* current) requires (Concepts::HandlesTaskTermination<Handler, Task> || ...)
+        {
+            using H = Provider<Concepts::HandlesTaskTermination<Handler, Task>...>;
+
+            uint64_t start = this->begin();
+
+            return this->report(Instrumentation::Event::kTaskFinished, start, current, H::onTaskFinished(current));
+        }
+
+        ///
+        /// Notify the delegate that the current running task has yielded and report the event
+        ///
+        Task* onTaskYielded(Task* current) requires (Concepts::HandlesTaskYielding<Handler, Task> || ...)
+        {
+            using H = Provider<Concepts::HandlesTaskYielding<Handler, Task>...>;
+
+            uint64_t start = this->begin();
+
+            return this->report(Instrumentation::Event::kTaskYielded, start, current, H::onTaskYielded(current));
+        }
+
+        ///
+        /// Notify the delegate that the current running task has been blocked and report the event
+        ///
+        Task* onTaskBlocked(Task* current) requires (Concepts::HandlesTaskBlocked<Handler, Task> || ...)
+        {
+            using H = Provider<Concepts::HandlesTaskBlocked<Handler, Task>...>;
+
+            uint64_t start = this->begin();
+
+            return this->report(Instrumentation::Event::kTaskBlocked, start, current, H::onTaskBlocked(current));
+        }
+
+        ///
+        /// Notify the delegate that a task has been unblocked and report the event
+        ///
+        Task* onTaskUnblocked(Task* current, Task* task) requires (Concepts::HandlesTaskUnblocked<Handler, Task> || ...)
+        {
+            using H = Provider<Concepts::HandlesTaskUnblocked<Handler, Task>...>;
+
+            uint64_t start = this->begin();
+
+            return this->report(Instrumentation::Event::kTaskUnblocked, start, current, H::onTaskUnblocked(current, task));
+        }
+
+        ///
+        /// Notify the delegate that a task has been killed and report the event
+        ///
+        Task* onTaskKilled(Task* current, Task* task) requires (Concepts::HandlesTaskKilled<Handler, Task> || ...)
+        {
+            using H = Provider<Concepts::HandlesTaskKilled<Handler, Task>...>;
+
+            uint64_t start = this->begin();
+
+            return this->report(Instrumentation::Event::kTaskKilled, start, current, H::onTaskKilled(current, task));
+        }
+
+        ///
+        /// Notify the delegate that the priority level of a task has been changed and report the event
+        ///
+        template <typename Priority>
+        requires (Concepts::HandlesTaskPriorityChanged<Handler, Task, Priority> || ...)
+        Task* onTaskPriorityChanged(Task* current, Task* task, const Priority& oldPriority)
+        {
+            using H = Provider<Concepts::HandlesTaskPriorityChanged<Handler, Task, Priority>...>;
+
+            uint64_t start = this->begin();
+
+            return this->report(Instrumentation::Event::kTaskPriorityChanged, start, current, H::onTaskPriorityChanged(current, task, oldPriority));
+        }
+
+        ///
+        /// Notify the delegate that the current running task has changed its own priority level and report the event
+        ///
+        Task* onTaskPriorityChanged(Task* current) requires (Concepts::HandlesTaskSelfPriorityChanged<Handler, Task> || ...)
+        {
+            using H = Provider<Concepts::HandlesTaskSelfPriorityChanged<Handler, Task>...>;
+
+            uint64_t start = this->begin();
+
+            return this->report(Instrumentation::Event::kTaskSelfPriorityChanged, start, current, H::onTaskPriorityChanged(current));
+        }
+
+        ///
+        /// Notify the delegate that the current running task has used up its allocated ticks and report the event
+        ///
+        Task* onTaskQuantumUsedUp(Task* current) requires (Concepts::HandlesTaskQuantumUsedUp<Handler, Task> || ...)
+        {
+            using H = Provider<Concepts::HandlesTaskQuantumUsedUp<Handler, Task>...>;
+
+            uint64_t start = this->begin();
+
+            return this->report(Instrumentation::Event::kTaskQuantumUsedUp, start, current, H::onTaskQuantumUsedUp(current));
+        }
+
+        ///
+        /// Notify the delegate that a timer interrupt has occurred and report the event
+        ///
+        Task* onTimerInterrupt(Task* current) requires (Concepts::HandlesTimerInterrupt<Handler, Task> || ...)
+        {
+            using H = Provider<Concepts::HandlesTimerInterrupt<Handler, Task>...>;
+
+            uint64_t start = this->begin();
+
+            return this->report(Instrumentation::Event::kTimerInterrupt, start, current, H::onTimerInterrupt(current));
+        }
+
+        ///
+        /// Notify the delegate that a one-shot timer interrupt has occurred and report the event
+        ///
+        template <typename Tick>
+        requires (Concepts::HandlesTicklessTimerInterrupt<Handler, Task, Tick> || ...)
+        Task* onTimerInterrupt(Task* current, Tick elapsed)
+        {
+            using H = Provider<Concepts::HandlesTicklessTimerInterrupt<Handler, Task, Tick>...>;
+
+            uint64_t start = this->begin();
+
+            return this->report(Instrumentation::Event::kTimerInterrupt, start, current, H::onTimerInterrupt(current, elapsed));
+        }
+    };
+}
+
+#endif /* Scheduler_Instrumented_hpp */
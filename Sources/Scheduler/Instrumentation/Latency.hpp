@@ -0,0 +1,347 @@
+//
+//  Latency.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef Scheduler_Latency_hpp
+#define Scheduler_Latency_hpp
+
+#include <Scheduler/Instrumentation/Recorder.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif !defined(__aarch64__)
+#include <chrono>
+#endif
+
+/// Defines components that measure what the scheduler is doing
+namespace Scheduler::Instrumentation
+{
+    ///
+    /// A clock that reads the cycle counter of the current core
+    ///
+    /// @note The clock reads the time stamp counter on x86 and the virtual counter on AArch64,
+    ///       both of which take a few cycles and never trap into the kernel.
+    ///       Other architectures fall back to the steady clock in nanoseconds.
+    /// @warning Readings taken on different cores are comparable only if the counters are synchronized.
+    ///
+    struct CycleCounter
+    {
+        static uint64_t now()
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#elif defined(__aarch64__)
+            uint64_t value;
+
+            asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+
+            return value;
+#else
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+        }
+    };
+
+    ///
+    /// A log-linear histogram of 64-bit values in the style of HdrHistogram
+    ///
+    /// @tparam SubBucketBits Specify the number of bits that split each power of two into linear sub-buckets
+    /// @note Values below `2^SubBucketBits` are counted exactly, while larger values are counted in buckets
+    ///       whose width is at most `1 / 2^SubBucketBits` of their lower bound, e.g. 6.25% for the default 4 bits.
+    ///       Recording a value takes a count-leading-zeros instruction, a shift and an increment.
+    /// @note The histogram has a single writer, e.g. the scheduler of one core, and any number of readers on other cores.
+    ///       Each counter is updated by a relaxed load and store instead of an atomic read-modify-write,
+    ///       so the writer never stalls on a locked instruction and readers see each counter without tearing.
+    /// @note `reset()` and `merge()` are meant to be called by the writer or while the writer is quiescent.
+    ///       A reset that races with the writer may lose the values recorded in the meantime.
+    ///
+    template <size_t SubBucketBits = 4>
+    requires (SubBucketBits > 0 && SubBucketBits < 16)
+    struct LatencyHistogram
+    {
+    public:
+        /// The number of sub-buckets in each power of two
+        static constexpr size_t kSubBucketCount = size_t{1} << SubBucketBits;
+
+        /// The number of buckets that cover all 64-bit values
+        static constexpr size_t kBucketCount = (64 - SubBucketBits + 1) * kSubBucketCount;
+
+    private:
+        /// The number of values recorded in each bucket
+        std::array<std::atomic<uint64_t>, kBucketCount> buckets = {};
+
+        /// The total number of values recorded
+        std::atomic<uint64_t> count = 0;
+
+        /// The largest value recorded
+        std::atomic<uint64_t> maximum = 0;
+
+        ///
+        /// [Single Writer] Add the given amount to the given counter
+        ///
+        static void add(std::atomic<uint64_t>& counter, uint64_t amount)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+
+    public:
+        ///
+        /// Get the index of the bucket that counts the given value
+        ///
+        /// @param value The value
+        /// @return The bucket index.
+        ///
+        static constexpr size_t indexOf(uint64_t value)
+        {
+            // Guard: Small values are counted exactly
+            if (value < kSubBucketCount)
+            {
+                return static_cast<size_t>(value);
+            }
+
+            size_t shift = std::bit_width(value) - 1 - SubBucketBits;
+
+            return (shift + 1) * kSubBucketCount + static_cast<size_t>((value >> shift) - kSubBucketCount);
+        }
+
+        ///
+        /// Get the largest value counted by the given bucket
+        ///
+        /// @param index The bucket index
+        /// @return The upper bound of the bucket, inclusive.
+        ///
+        static constexpr uint64_t upperBoundOf(size_t index)
+        {
+            // Guard: Small values are counted exactly
+            if (index < kSubBucketCount)
+            {
+                return index;
+            }
+
+            size_t shift = index / kSubBucketCount - 1;
+
+            uint64_t lowerBound = static_cast<uint64_t>(index % kSubBucketCount + kSubBucketCount) << shift;
+
+            return lowerBound + ((uint64_t{1} << shift) - 1);
+        }
+
+        ///
+        /// [Single Writer] Record the given value
+        ///
+        /// @param value The value, e.g. the number of cycles spent in an event handler
+        ///
+        void record(uint64_t value)
+        {
+            add(this->buckets[indexOf(value)], 1);
+
+            add(this->count, 1);
+
+            if (value > this->maximum.load(std::memory_order_relaxed))
+            {
+                this->maximum.store(value, std::memory_order_relaxed);
+            }
+        }
+
+        ///
+        /// Get the number of values recorded
+        ///
+        /// @return The total count.
+        ///
+        [[nodiscard]]
+        uint64_t getCount() const
+        {
+            return this->count.load(std::memory_order_relaxed);
+        }
+
+        ///
+        /// Get the largest value recorded
+        ///
+        /// @return The exact maximum, zero if no value has been recorded.
+        ///
+        [[nodiscard]]
+        uint64_t getMaximum() const
+        {
+            return this->maximum.load(std::memory_order_relaxed);
+        }
+
+        ///
+        /// Get the value at the given percentile
+        ///
+        /// @param percentile The percentile in the range [0, 100], e.g. 99.9
+        /// @return The upper bound of the bucket that contains the value at the percentile, clamped to the maximum,
+        ///         or zero if no value has been recorded.
+        /// @note The result never underestimates the value by construction, and overestimates it by at most the bucket width.
+        ///
+        [[nodiscard]]
+        uint64_t getValueAtPercentile(double percentile) const
+        {
+            uint64_t total = 0;
+
+            for (const auto& bucket : this->buckets)
+            {
+                total += bucket.load(std::memory_order_relaxed);
+            }
+
+            // Guard: Check whether any value has been recorded
+            if (total == 0)
+            {
+                return 0;
+            }
+
+            // The rank of the value at the percentile, in the range [1, total]
+            auto rank = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(total) + 0.5);
+
+            rank = std::max<uint64_t>(1, std::min(rank, total));
+
+            uint64_t seen = 0;
+
+            for (size_t index = 0; index < kBucketCount; index += 1)
+            {
+                seen += this->buckets[index].load(std::memory_order_relaxed);
+
+                if (seen >= rank)
+                {
+                    return std::min(upperBoundOf(index), this->getMaximum());
+                }
+            }
+
+            return this->getMaximum();
+        }
+
+        ///
+        /// Clear all recorded values
+        ///
+        void reset()
+        {
+            for (auto& bucket : this->buckets)
+            {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+
+            this->count.store(0, std::memory_order_relaxed);
+
+            this->maximum.store(0, std::memory_order_relaxed);
+        }
+
+        ///
+        /// Add all values recorded by the given histogram to this histogram
+        ///
+        /// @param other A histogram of the same layout, e.g. the one of another core
+        ///
+        void merge(const LatencyHistogram& other)
+        {
+            for (size_t index = 0; index < kBucketCount; index += 1)
+            {
+                add(this->buckets[index], other.buckets[index].load(std::memory_order_relaxed));
+            }
+
+            add(this->count, other.getCount());
+
+            if (other.getMaximum() > this->getMaximum())
+            {
+                this->maximum.store(other.getMaximum(), std::memory_order_relaxed);
+            }
+        }
+    };
+
+    ///
+    /// A recorder that keeps a latency histogram for each event handled by the scheduler
+    ///
+    /// @tparam Clock Specify the clock that measures the time spent in each event handler, e.g. `CycleCounter`
+    /// @tparam SubBucketBits Specify the precision of each histogram
+    /// @note Instrumented event handlers read the clock before they forward an event and report the elapsed time afterwards,
+    ///       so each histogram covers the whole handler, including the calls it makes into the policy.
+    ///       An event handled on behalf of another one is timed separately and also counts towards the outer event.
+    /// @note Give each core its own scheduler and thus its own recorder, and `merge()` them to obtain system-wide percentiles.
+    ///
+    template <typename Clock, size_t SubBucketBits = 4>
+    requires Concepts::InstrumentationClock<Clock>
+    struct LatencyRecorder
+    {
+    private:
+        /// A histogram for each event
+        std::array<LatencyHistogram<SubBucketBits>, static_cast<size_t>(Event::kCount)> histograms;
+
+    public:
+        /// Instrumented components report to this recorder
+        static constexpr bool kEnabled = true;
+
+        template <typename Task>
+        void taskEnqueued(Task*, size_t) {}
+
+        template <typename Task>
+        void taskDequeued(Task*, size_t) {}
+
+        template <typename Task>
+        void taskRemoved(Task*, size_t) {}
+
+        template <typename Task>
+        void eventHandled(Event, Task*, Task*) {}
+
+        ///
+        /// Read the clock before an event is handled
+        ///
+        /// @return The start timestamp that is passed back to `eventFinished()`.
+        ///
+        uint64_t eventStarted()
+        {
+            return Clock::now();
+        }
+
+        ///
+        /// Record the time spent in handling the given event
+        ///
+        /// @param event The event that has been handled
+        /// @param start The timestamp returned by `eventStarted()`
+        ///
+        void eventFinished(Event event, uint64_t start)
+        {
+            this->histograms[static_cast<size_t>(event)].record(Clock::now() - start);
+        }
+
+        ///
+        /// Get the histogram of the given event
+        ///
+        /// @param event The event
+        /// @return The latency histogram of the event handler.
+        ///
+        [[nodiscard]]
+        const LatencyHistogram<SubBucketBits>& getHistogram(Event event) const
+        {
+            return this->histograms[static_cast<size_t>(event)];
+        }
+
+        /// Clear the histograms of all events
+        void reset()
+        {
+            for (auto& histogram : this->histograms)
+            {
+                histogram.reset();
+            }
+        }
+
+        ///
+        /// Add the histograms of the given recorder to the histograms of this recorder
+        ///
+        /// @param other A recorder of the same configuration, e.g. the one of another core
+        ///
+        void merge(const LatencyRecorder& other)
+        {
+            for (size_t index = 0; index < this->histograms.size(); index += 1)
+            {
+                this->histograms[index].merge(other.histograms[index]);
+            }
+        }
+    };
+}
+
+#endif /* Scheduler_Latency_hpp */
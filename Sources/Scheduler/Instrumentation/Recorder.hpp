@@ -0,0 +1,219 @@
+//
+//  Recorder.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_Recorder_hpp
+#define Scheduler_Recorder_hpp
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+/// Defines components that measure what the scheduler is doing
+namespace Scheduler::Instrumentation
+{
+    ///
+    /// Events that are reported to an instrumentation recorder by instrumented event handlers
+    ///
+    enum class Event: size_t
+    {
+        kTaskCreated,
+        kTaskFinished,
+        kTaskYielded,
+        kTaskBlocked,
+        kTaskUnblocked,
+        kTaskKilled,
+        kTaskPriorityChanged,
+        kTaskSelfPriorityChanged,
+        kTaskQuantumUsedUp,
+        kTimerInterrupt,
+        kDeadlineMissed,
+        kCount
+    };
+
+    ///
+    /// A recorder that discards everything it receives
+    ///
+    /// @note Instrumented components check `kEnabled` at compile time,
+    ///       so they compile down to the uninstrumented code when they are configured with this recorder.
+    ///
+    struct NullRecorder
+    {
+        /// Instrumented components skip all bookkeeping for this recorder
+        static constexpr bool kEnabled = false;
+
+        template <typename Task>
+        void taskEnqueued(Task*, size_t) {}
+
+        template <typename Task>
+        void taskDequeued(Task*, size_t) {}
+
+        template <typename Task>
+        void taskRemoved(Task*, size_t) {}
+
+        template <typename Task>
+        void eventHandled(Event, Task*, Task*) {}
+    };
+}
+
+/// Defines concepts related to scheduler components
+namespace Scheduler::Concepts
+{
+    /// An instrumentation recorder that also measures the time spent in each event handler
+    template <typename Recorder>
+    concept LatencyRecorder = requires(Recorder& recorder, Instrumentation::Event event, uint64_t start)
+    {
+        /// Must read its clock before an event is handled and return the start timestamp
+        { recorder.eventStarted() } -> std::same_as<uint64_t>;
+
+        /// Must accept an event that has been handled along with the start timestamp
+        { recorder.eventFinished(event, start) } -> std::same_as<void>;
+    };
+}
+
+/// Defines components that measure what the scheduler is doing
+namespace Scheduler::Instrumentation
+{
+    ///
+    /// A recorder that forwards everything it receives to each of the given recorders
+    ///
+    /// @tparam Recorder Specify the recorders, e.g. a statistics recorder and a trace recorder
+    /// @note Disabled recorders are skipped at compile time.
+    /// @note The composite recorder measures latencies if any of the given recorders does.
+    ///       The start timestamp is taken from the first of them and is passed to all of them, so they should use the same clock.
+    ///
+    template <typename... Recorder>
+    struct CompositeRecorder
+    {
+    private:
+        /// The recorders
+        std::tuple<Recorder...> recorders;
+
+    public:
+        /// Instrumented components report to this recorder if any of the given recorders is enabled
+        static constexpr bool kEnabled = (Recorder::kEnabled || ...);
+
+        ///
+        /// Get the given recorder
+        ///
+        /// @tparam R Specify the type of the recorder
+        /// @return The recorder of the given type.
+        ///
+        template <typename R>
+        R& get()
+        {
+            return std::get<R>(this->recorders);
+        }
+
+        template <typename Task>
+        void taskEnqueued(Task* task, size_t depth)
+        {
+            std::apply([&](auto&... recorder) { (forward(recorder, [&](auto& r) { r.taskEnqueued(task, depth); }), ...); }, this->recorders);
+        }
+
+        template <typename Task>
+        void taskDequeued(Task* task, size_t depth)
+        {
+            std::apply([&](auto&... recorder) { (forward(recorder, [&](auto& r) { r.taskDequeued(task, depth); }), ...); }, this->recorders);
+        }
+
+        template <typename Task>
+        void taskRemoved(Task* task, size_t depth)
+        {
+            std::apply([&](auto&... recorder) { (forward(recorder, [&](auto& r) { r.taskRemoved(task, depth); }), ...); }, this->recorders);
+        }
+
+        template <typename Task>
+        void eventHandled(Event event, Task* current, Task* next)
+        {
+            std::apply([&](auto&... recorder) { (forward(recorder, [&](auto& r) { r.eventHandled(event, current, next); }), ...); }, this->recorders);
+        }
+
+        uint64_t eventStarted() requires ((Recorder::kEnabled && Concepts::LatencyRecorder<Recorder>) || ...)
+        {
+            uint64_t start = 0;
+
+            std::apply([&](auto&... recorder) { (startLatency(recorder, start) || ...); }, this->recorders);
+
+            return start;
+        }
+
+        void eventFinished(Event event, uint64_t start) requires ((Recorder::kEnabled && Concepts::LatencyRecorder<Recorder>) || ...)
+        {
+            std::apply([&](auto&... recorder) { (forward(recorder, [&](auto& r) { if constexpr (Concepts::LatencyRecorder<std::remove_reference_t<decltype(r)>>) { r.eventFinished(event, start); } }), ...); }, this->recorders);
+        }
+
+    private:
+        ///
+        /// [Helper] Read the clock of the given recorder if it is enabled and measures latencies
+        ///
+        /// @return `true` if the start timestamp has been taken, `false` otherwise.
+        ///
+        template <typename R>
+        static bool startLatency(R& recorder, uint64_t& start)
+        {
+            if constexpr (R::kEnabled && Concepts::LatencyRecorder<R>)
+            {
+                start = recorder.eventStarted();
+
+                return true;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        ///
+        /// [Helper] Pass the given recorder to the given action if the recorder is enabled
+        ///
+        template <typename R, typename Action>
+        static void forward(R& recorder, Action&& action)
+        {
+            if constexpr (R::kEnabled)
+            {
+                action(recorder);
+            }
+        }
+    };
+}
+
+/// Defines concepts related to scheduler components
+namespace Scheduler::Concepts
+{
+    /// An instrumentation recorder receives notifications from instrumented policies and event handlers
+    template <typename Recorder, typename Task>
+    concept InstrumentationRecorder = requires(Recorder& recorder, Task* task, size_t depth, Instrumentation::Event event)
+    {
+        /// Must specify whether instrumented components should report to the recorder at all
+        { Recorder::kEnabled } -> std::convertible_to<bool>;
+
+        /// Must accept a task that has been enqueued along with the number of tasks in the ready queue afterwards
+        { recorder.taskEnqueued(task, depth) } -> std::same_as<void>;
+
+        /// Must accept a task that has been dequeued along with the number of tasks in the ready queue afterwards
+        { recorder.taskDequeued(task, depth) } -> std::same_as<void>;
+
+        /// Must accept a task that has been removed along with the number of tasks in the ready queue afterwards
+        { recorder.taskRemoved(task, depth) } -> std::same_as<void>;
+
+        /// Must accept an event along with the current running task and the task selected to run,
+        /// where the latter is `nullptr` if the event is reported by an intermediate call
+        { recorder.eventHandled(event, task, task) } -> std::same_as<void>;
+    };
+
+    /// A clock provides the current time in an arbitrary monotonic unit for an instrumentation recorder
+    template <typename Clock>
+    concept InstrumentationClock = requires
+    {
+        /// Must provide the current time
+        { Clock::now() } -> std::convertible_to<uint64_t>;
+    };
+}
+
+#endif /* Scheduler_Recorder_hpp */
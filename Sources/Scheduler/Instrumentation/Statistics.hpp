@@ -0,0 +1,294 @@
+//
+//  Statistics.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_Statistics_hpp
+#define Scheduler_Statistics_hpp
+
+#include <Scheduler/Instrumentation/Recorder.hpp>
+#include <Scheduler/Constraint/Instrumentable.hpp>
+#include <Scheduler/Constraint/Prioritizable.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/// Defines components that measure what the scheduler is doing
+namespace Scheduler::Instrumentation
+{
+    ///
+    /// A recorder that keeps counters and accumulated times of the scheduler activity
+    ///
+    /// @tparam Task Specify the type of tasks managed by the scheduler
+    /// @tparam Clock Specify the clock that provides timestamps for the runnable-wait time and the run time
+    /// @tparam NumberOfLevels Specify the number of priority levels to keep enqueue and dequeue counters for
+    /// @note Enqueue and dequeue counters are kept per priority level if tasks are prioritizable by their priority level,
+    ///       where tasks of a priority level beyond the last one are counted in the last one.
+    ///       Otherwise, all tasks are counted in the first level.
+    /// @note Runnable-wait times and run times are recorded only if tasks are instrumentable.
+    ///       Each task accumulates its own times, while the recorder keeps the totals of all tasks.
+    /// @note A context switch is counted whenever an event handler selects a task other than the current running one.
+    ///       The context-switch rate is the difference of two readings divided by the time elapsed between them.
+    ///
+    template <typename Task, typename Clock, size_t NumberOfLevels = 1>
+    requires Concepts::InstrumentationClock<Clock> && (NumberOfLevels > 0)
+    struct Statistics
+    {
+    public:
+        /// Instrumented components report to this recorder
+        static constexpr bool kEnabled = true;
+
+    private:
+        /// The number of times each event has been handled
+        std::array<uint64_t, static_cast<size_t>(Event::kCount)> events = {};
+
+        /// The number of enqueue operations per priority level
+        std::array<uint64_t, NumberOfLevels> enqueues = {};
+
+        /// The number of dequeue operations per priority level
+        std::array<uint64_t, NumberOfLevels> dequeues = {};
+
+        /// The number of removal operations
+        uint64_t removals = 0;
+
+        /// The maximum number of tasks that have been in the ready queue at the same time
+        size_t highWaterMark = 0;
+
+        /// The number of context switches
+        uint64_t contextSwitches = 0;
+
+        /// The total amount of time all tasks have spent in the ready queue
+        uint64_t totalWaitTime = 0;
+
+        /// The longest time a task has spent in the ready queue
+        uint64_t maxWaitTime = 0;
+
+        /// The total amount of time all tasks have spent running
+        uint64_t totalRunTime = 0;
+
+        ///
+        /// [Helper] Get the priority level where the given task is counted
+        ///
+        /// @param task A non-null task
+        /// @return The index of the counter for the given task.
+        ///
+        static size_t levelOf(Task* task)
+        {
+            if constexpr (NumberOfLevels > 1 && TaskConstraints::PrioritizableByPriority<Task>)
+            {
+                return std::min(static_cast<size_t>(task->getPriority()), NumberOfLevels - 1);
+            }
+            else
+            {
+                return 0;
+            }
+        }
+
+    public:
+        // MARK: - Recorder IMP
+
+        ///
+        /// Record that a task has been enqueued
+        ///
+        /// @param task A non-null task that has been enqueued
+        /// @param depth The number of tasks in the ready queue after the task has been enqueued
+        ///
+        void taskEnqueued(Task* task, size_t depth)
+        {
+            this->enqueues[levelOf(task)] += 1;
+
+            this->highWaterMark = std::max(this->highWaterMark, depth);
+
+            if constexpr (TaskConstraints::Instrumentable<Task>)
+            {
+                task->setReadyTimestamp(Clock::now());
+            }
+        }
+
+        ///
+        /// Record that a task has been dequeued
+        ///
+        /// @param task A non-null task that has been dequeued
+        /// @param depth The number of tasks in the ready queue after the task has been dequeued
+        ///
+        void taskDequeued(Task* task, [[maybe_unused]] size_t depth)
+        {
+            this->dequeues[levelOf(task)] += 1;
+
+            if constexpr (TaskConstraints::Instrumentable<Task>)
+            {
+                uint64_t wait = Clock::now() - task->getReadyTimestamp();
+
+                task->addWaitTime(wait);
+
+                this->totalWaitTime += wait;
+
+                this->maxWaitTime = std::max(this->maxWaitTime, wait);
+            }
+        }
+
+        ///
+        /// Record that a task has been removed from the ready queue
+        ///
+        /// @param task A non-null task that has been removed
+        /// @param depth The number of tasks in the ready queue after the task has been removed
+        ///
+        void taskRemoved([[maybe_unused]] Task* task, [[maybe_unused]] size_t depth)
+        {
+            this->removals += 1;
+        }
+
+        ///
+        /// Record that an event has been handled
+        ///
+        /// @param event The event
+        /// @param current The current running task passed to the event handler
+        /// @param next The task selected to run by the event handler, `nullptr` if the handler is called as an intermediate call
+        ///
+        void eventHandled(Event event, Task* current, Task* next)
+        {
+            this->events[static_cast<size_t>(event)] += 1;
+
+            // Guard: Only terminating calls that select another task switch the context
+            if (next == nullptr || next == current)
+            {
+                return;
+            }
+
+            this->contextSwitches += 1;
+
+            if constexpr (TaskConstraints::Instrumentable<Task>)
+            {
+                uint64_t now = Clock::now();
+
+                if (current != nullptr)
+                {
+                    uint64_t run = now - current->getDispatchTimestamp();
+
+                    current->addRunTime(run);
+
+                    this->totalRunTime += run;
+                }
+
+                next->setDispatchTimestamp(now);
+            }
+        }
+
+        // MARK: - Query Statistics
+
+        ///
+        /// Get the number of times the given event has been handled
+        ///
+        /// @param event The event
+        /// @return The number of times the event handler has been called for the given event.
+        ///
+        [[nodiscard]]
+        uint64_t getEventCount(Event event) const
+        {
+            return this->events[static_cast<size_t>(event)];
+        }
+
+        ///
+        /// Get the number of enqueue operations of tasks at the given priority level
+        ///
+        /// @param level The index of the priority level
+        /// @return The number of tasks enqueued at the given priority level.
+        ///
+        [[nodiscard]]
+        uint64_t getEnqueueCount(size_t level = 0) const
+        {
+            return this->enqueues[level];
+        }
+
+        ///
+        /// Get the number of dequeue operations of tasks at the given priority level
+        ///
+        /// @param level The index of the priority level
+        /// @return The number of tasks dequeued at the given priority level.
+        ///
+        [[nodiscard]]
+        uint64_t getDequeueCount(size_t level = 0) const
+        {
+            return this->dequeues[level];
+        }
+
+        ///
+        /// Get the number of removal operations
+        ///
+        /// @return The number of tasks removed from the ready queue.
+        ///
+        [[nodiscard]]
+        uint64_t getRemovalCount() const
+        {
+            return this->removals;
+        }
+
+        ///
+        /// Get the maximum number of tasks that have been in the ready queue at the same time
+        ///
+        /// @return The high-water mark of the ready queue depth.
+        ///
+        [[nodiscard]]
+        size_t getHighWaterMark() const
+        {
+            return this->highWaterMark;
+        }
+
+        ///
+        /// Get the number of context switches
+        ///
+        /// @return The number of times an event handler has selected a task other than the current running one.
+        ///
+        [[nodiscard]]
+        uint64_t getContextSwitchCount() const
+        {
+            return this->contextSwitches;
+        }
+
+        ///
+        /// Get the total amount of time all tasks have spent in the ready queue
+        ///
+        /// @return The accumulated runnable-wait time, zero if tasks are not instrumentable.
+        ///
+        [[nodiscard]]
+        uint64_t getTotalWaitTime() const
+        {
+            return this->totalWaitTime;
+        }
+
+        ///
+        /// Get the longest time a task has spent in the ready queue
+        ///
+        /// @return The maximum runnable-wait time, zero if tasks are not instrumentable.
+        ///
+        [[nodiscard]]
+        uint64_t getMaxWaitTime() const
+        {
+            return this->maxWaitTime;
+        }
+
+        ///
+        /// Get the total amount of time all tasks have spent running
+        ///
+        /// @return The accumulated run time, zero if tasks are not instrumentable.
+        ///
+        [[nodiscard]]
+        uint64_t getTotalRunTime() const
+        {
+            return this->totalRunTime;
+        }
+
+        ///
+        /// Reset all counters and accumulated times
+        ///
+        void reset()
+        {
+            *this = Statistics();
+        }
+    };
+}
+
+#endif /* Scheduler_Statistics_hpp */
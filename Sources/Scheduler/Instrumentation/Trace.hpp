@@ -0,0 +1,325 @@
+//
+//  Trace.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_Trace_hpp
+#define Scheduler_Trace_hpp
+
+#include <Scheduler/Instrumentation/Recorder.hpp>
+#include <Scheduler/Constraint/Prioritizable.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+/// Defines components that measure what the scheduler is doing
+namespace Scheduler::Instrumentation
+{
+    ///
+    /// A compact record of a scheduling decision
+    ///
+    struct TraceRecord
+    {
+        /// The identifier recorded in place of a null task
+        static constexpr uint32_t kNoTask = UINT32_MAX;
+
+        /// The time when the decision was made
+        uint64_t timestamp;
+
+        /// The event that led to the decision
+        Event event;
+
+        /// The identifier of the current running task passed to the event handler
+        uint32_t current;
+
+        /// The identifier of the task selected to run, `kNoTask` if the event handler is called as an intermediate call
+        uint32_t next;
+
+        /// The priority level of the task selected to run, or that of the current running task for an intermediate call
+        uint32_t priority;
+    };
+
+    ///
+    /// A fixed-size ring buffer of trace records that has a single writer and a single draining reader
+    ///
+    /// @tparam Capacity Specify the number of records kept in the buffer
+    /// @note The writer never blocks and never waits for the reader.
+    ///       Once the buffer is full, each new record overwrites the oldest one.
+    /// @note Each slot is protected by a sequence number, so the reader detects and skips a record that is overwritten while being read,
+    ///       i.e. the reader may run on another core without stopping the scheduler.
+    /// @note `drain()` must be called by at most one reader at a time, while `snapshot()` may be called by any number of readers.
+    ///
+    template <size_t Capacity>
+    requires (std::has_single_bit(Capacity))
+    struct TraceBuffer
+    {
+    private:
+        /// A slot that stores a record in words that can be accessed atomically
+        struct Slot
+        {
+            /// Odd while the writer is storing the record, `2 * (index + 1)` once the record at the given index is stored
+            std::atomic<uint64_t> sequence = 0;
+
+            /// The timestamp
+            std::atomic<uint64_t> timestamp = 0;
+
+            /// The current running task in the higher half and the selected task in the lower half
+            std::atomic<uint64_t> tasks = 0;
+
+            /// The event in the higher half and the priority level in the lower half
+            std::atomic<uint64_t> attributes = 0;
+        };
+
+        /// The slots
+        std::array<Slot, Capacity> slots;
+
+        /// The number of records that have ever been written
+        alignas(64) std::atomic<uint64_t> head = 0;
+
+        /// The index of the next record to be drained
+        alignas(64) uint64_t tail = 0;
+
+        /// The number of records that have been overwritten before they are drained
+        uint64_t dropped = 0;
+
+        ///
+        /// [Helper] Read the record at the given index
+        ///
+        /// @param index The index of the record
+        /// @param record The record to be filled
+        /// @return `true` if the record is read consistently, `false` if it has been or is being overwritten.
+        ///
+        bool read(uint64_t index, TraceRecord& record) const
+        {
+            const Slot& slot = this->slots[index & (Capacity - 1)];
+
+            uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+
+            // Guard: The slot must hold the record at the given index
+            if (sequence != 2 * (index + 1))
+            {
+                return false;
+            }
+
+            uint64_t timestamp = slot.timestamp.load(std::memory_order_relaxed);
+
+            uint64_t tasks = slot.tasks.load(std::memory_order_relaxed);
+
+            uint64_t attributes = slot.attributes.load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            // Guard: The writer must not have started to overwrite the slot while it is being read
+            if (slot.sequence.load(std::memory_order_relaxed) != sequence)
+            {
+                return false;
+            }
+
+            record.timestamp = timestamp;
+
+            record.event = static_cast<Event>(attributes >> 32);
+
+            record.current = static_cast<uint32_t>(tasks >> 32);
+
+            record.next = static_cast<uint32_t>(tasks);
+
+            record.priority = static_cast<uint32_t>(attributes);
+
+            return true;
+        }
+
+    public:
+        ///
+        /// Append the given record to the buffer
+        ///
+        /// @param record The record to be appended
+        /// @note This method must be called by the writer only.
+        ///
+        void push(const TraceRecord& record)
+        {
+            uint64_t index = this->head.load(std::memory_order_relaxed);
+
+            Slot& slot = this->slots[index & (Capacity - 1)];
+
+            // Mark the slot as being written, so that a concurrent reader discards its contents
+            slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_release);
+
+            slot.timestamp.store(record.timestamp, std::memory_order_relaxed);
+
+            slot.tasks.store(static_cast<uint64_t>(record.current) << 32 | record.next, std::memory_order_relaxed);
+
+            slot.attributes.store(static_cast<uint64_t>(record.event) << 32 | record.priority, std::memory_order_relaxed);
+
+            // Publish the record
+            slot.sequence.store(2 * (index + 1), std::memory_order_release);
+
+            this->head.store(index + 1, std::memory_order_release);
+        }
+
+        ///
+        /// Move records that have not been drained yet to the given storage, in the order they are written
+        ///
+        /// @param records The storage of records
+        /// @return The number of records stored in `records`.
+        /// @note Records that have been overwritten before they are drained are counted by `getDroppedCount()`.
+        ///
+        size_t drain(std::span<TraceRecord> records)
+        {
+            uint64_t head = this->head.load(std::memory_order_acquire);
+
+            // Guard: Skip records that have been overwritten
+            if (head - this->tail > Capacity)
+            {
+                this->dropped += head - this->tail - Capacity;
+
+                this->tail = head - Capacity;
+            }
+
+            size_t count = 0;
+
+            while (this->tail < head && count < records.size())
+            {
+                if (this->read(this->tail, records[count]))
+                {
+                    count += 1;
+                }
+                else
+                {
+                    this->dropped += 1;
+                }
+
+                this->tail += 1;
+            }
+
+            return count;
+        }
+
+        ///
+        /// Copy the latest records to the given storage, in the order they are written, without draining them
+        ///
+        /// @param records The storage of records
+        /// @return The number of records stored in `records`.
+        ///
+        size_t snapshot(std::span<TraceRecord> records) const
+        {
+            uint64_t head = this->head.load(std::memory_order_acquire);
+
+            uint64_t first = head - std::min<uint64_t>({head, Capacity, records.size()});
+
+            size_t count = 0;
+
+            for (uint64_t index = first; index < head; index++)
+            {
+                if (this->read(index, records[count]))
+                {
+                    count += 1;
+                }
+            }
+
+            return count;
+        }
+
+        ///
+        /// Get the number of records that have been overwritten before they are drained
+        ///
+        /// @return The number of records lost by `drain()`.
+        ///
+        [[nodiscard]]
+        uint64_t getDroppedCount() const
+        {
+            return this->dropped;
+        }
+    };
+
+    ///
+    /// A recorder that traces each scheduling decision in a ring buffer
+    ///
+    /// @tparam Task Specify the type of tasks managed by the scheduler
+    /// @tparam Clock Specify the clock that provides timestamps
+    /// @tparam Capacity Specify the number of records kept in the buffer
+    /// @note Tasks are identified by `getIdentifier()` if they provide one, otherwise by the lower half of their address.
+    /// @note Priority levels are recorded if tasks are prioritizable by their priority level, otherwise zero is recorded.
+    /// @note Enqueue, dequeue and removal operations are not traced.
+    ///
+    template <typename Task, typename Clock, size_t Capacity = 1024>
+    requires Concepts::InstrumentationClock<Clock>
+    struct TraceRecorder: public TraceBuffer<Capacity>
+    {
+    public:
+        /// Instrumented components report to this recorder
+        static constexpr bool kEnabled = true;
+
+    private:
+        ///
+        /// [Helper] Get the identifier of the given task
+        ///
+        /// @param task A task
+        /// @return The identifier of the task, `TraceRecord::kNoTask` if the task is null.
+        ///
+        static uint32_t identifierOf(Task* task)
+        {
+            if (task == nullptr)
+            {
+                return TraceRecord::kNoTask;
+            }
+
+            if constexpr (requires { { task->getIdentifier() } -> std::convertible_to<uint32_t>; })
+            {
+                return static_cast<uint32_t>(task->getIdentifier());
+            }
+            else
+            {
+                return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(task));
+            }
+        }
+
+        ///
+        /// [Helper] Get the priority level of the given task
+        ///
+        /// @param task A task
+        /// @return The priority level of the task, zero if the task is null or not prioritizable by its priority level.
+        ///
+        static uint32_t priorityOf(Task* task)
+        {
+            if constexpr (TaskConstraints::PrioritizableByPriority<Task>)
+            {
+                return task == nullptr ? 0 : static_cast<uint32_t>(task->getPriority());
+            }
+            else
+            {
+                return 0;
+            }
+        }
+
+    public:
+        // MARK: - Recorder IMP
+
+        void taskEnqueued(Task*, size_t) {}
+
+        void taskDequeued(Task*, size_t) {}
+
+        void taskRemoved(Task*, size_t) {}
+
+        ///
+        /// Record that an event has been handled
+        ///
+        /// @param event The event
+        /// @param current The current running task passed to the event handler
+        /// @param next The task selected to run by the event handler, `nullptr` if the handler is called as an intermediate call
+        ///
+        void eventHandled(Event event, Task* current, Task* next)
+        {
+            this->push({Clock::now(), event, identifierOf(current), identifierOf(next), priorityOf(next != nullptr ? next : current)});
+        }
+    };
+}
+
+#endif /* Scheduler_Trace_hpp */
@@ -9,6 +9,9 @@
 #define Scheduler_Utils_hpp
 
 #include <Scheduler/Constraint/Prioritizable.hpp>
+#include <Scheduler/Policy/Policy.hpp>
+#include <Debug.hpp>
+#include <span>
 #include <utility>
 
 /// Defines some useful helper functions that may be needed by a handler
@@ -61,6 +64,94 @@ namespace Scheduler::Utilities
             return std::make_pair(task2, task1);
         }
     }
+
+    ///
+    /// Enqueue a batch of ready tasks through the given scheduling policy
+    ///
+    /// @tparam P Specify the type of the scheduling policy
+    /// @param policy A scheduling policy or a scheduler that inherits from one
+    /// @param tasks Non-null tasks that are ready to run
+    /// @note The batch primitive of the policy is used if available,
+    ///       otherwise tasks are enqueued one by one in the given order.
+    ///
+    template <typename P>
+    requires Concepts::Policy<P>
+    void readyBatch(P& policy, std::span<typename P::SchedulableTask* const> tasks)
+    {
+        if constexpr (Concepts::BatchReadyPolicy<P>)
+        {
+            policy.readyBatch(tasks);
+        }
+        else
+        {
+            for (auto task : tasks)
+            {
+                policy.ready(task);
+            }
+        }
+    }
+
+    ///
+    /// Remove a batch of tasks from the ready queue of the given scheduling policy
+    ///
+    /// @tparam P Specify the type of the scheduling policy
+    /// @param policy A scheduling policy or a scheduler that inherits from one
+    /// @param tasks Non-null tasks that reside in the ready queue
+    /// @note The batch primitive of the policy is used if available,
+    ///       otherwise tasks are removed one by one in the given order.
+    ///
+    template <typename P>
+    requires Concepts::RemovablePolicy<P>
+    void removeBatch(P& policy, std::span<typename P::SchedulableTask* const> tasks)
+    {
+        if constexpr (Concepts::BatchRemovablePolicy<P>)
+        {
+            policy.removeBatch(tasks);
+        }
+        else
+        {
+            for (auto task : tasks)
+            {
+                policy.remove(task);
+            }
+        }
+    }
+
+    ///
+    /// Dequeue the next ready task of the given scheduler, or fall back to the idle task if no task is ready
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the concrete scheduler that supports the idle task
+    /// @param scheduler The scheduler
+    /// @return The non-null task that is selected to run.
+    /// @note The fallback is compiled out if the scheduling policy guarantees a ready task on each dequeue.
+    /// @note If the scheduler provides `enterIdle()`, e.g. via `IdleTaskSupportWithGovernor`, it is invoked before the idle task is returned.
+    ///
+    template <typename ConcreteScheduler>
+    requires Concepts::Policy<ConcreteScheduler>
+    typename ConcreteScheduler::SchedulableTask* nextOrIdleTask(ConcreteScheduler& scheduler)
+    {
+        auto next = scheduler.next();
+
+        if constexpr (Concepts::NonEmptyPolicy<ConcreteScheduler>)
+        {
+            passert(next != nullptr, "Usage Error: A policy that is never empty has returned a null task.");
+
+            return next;
+        }
+        else
+        {
+            // Guard: Let the idle governor prepare the idle period if the scheduler has one
+            if constexpr (requires { scheduler.enterIdle(); })
+            {
+                if (next == nullptr)
+                {
+                    scheduler.enterIdle();
+                }
+            }
+
+            return next == nullptr ? scheduler.getIdleTask() : next;
+        }
+    }
 }
 
 #endif /* Scheduler_Utils_hpp */
@@ -0,0 +1,229 @@
+//
+//  Validation.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_Validation_hpp
+#define Scheduler_Validation_hpp
+
+#include <Scheduler/Scheduler.hpp>
+#include <Scheduler/Instrumentation/Instrumented.hpp>
+#include <concepts>
+#include <type_traits>
+
+///
+/// Defines compile-time checks of schedulers assembled from a policy and event handlers
+///
+/// @note Event handlers call the scheduling primitives and other handlers through the concrete scheduler,
+///       so an incompatible combination may compile until a handler is instantiated or even misbehave at runtime.
+///       Validate each concrete scheduler once it is complete, e.g. right after its definition:
+///       ```
+///       static_assert(Scheduler::Validation::validate<MyScheduler>());
+///       ```
+///       Each violated requirement is reported by its own static assertion.
+///
+namespace Scheduler::Validation
+{
+    ///
+    /// Collects the requirements that an event handler component declares on the concrete scheduler
+    ///
+    /// @tparam Handler Specify the event handler component
+    /// @note A handler declares a requirement by defining the corresponding static constant,
+    ///       e.g. `static constexpr bool kRequiresIdleTaskSupport = true`.
+    ///
+    template <typename Handler>
+    struct HandlerRequirements
+    {
+        /// `true` if the handler relies on the idle task support component
+        static constexpr bool kIdleTaskSupport = requires { requires Handler::kRequiresIdleTaskSupport; };
+
+        /// `true` if the handler relies on the task quantum used up handler
+        static constexpr bool kQuantumUsedUpHandler = requires { requires Handler::kRequiresQuantumUsedUpHandler; };
+
+        /// `true` if the handler relies on the instrumentation recorder
+        static constexpr bool kRecorder = false;
+    };
+
+    ///
+    /// [SPEC] Collects the requirements of event handlers wrapped by the instrumentation handler
+    ///
+    template <typename ConcreteScheduler, typename... Handler>
+    struct HandlerRequirements<EventHandlers::Instrumented<ConcreteScheduler, Handler...>>
+    {
+        static constexpr bool kIdleTaskSupport = (HandlerRequirements<Handler>::kIdleTaskSupport || ...);
+
+        static constexpr bool kQuantumUsedUpHandler = (HandlerRequirements<Handler>::kQuantumUsedUpHandler || ...);
+
+        static constexpr bool kRecorder = true;
+    };
+
+    ///
+    /// Collects the requirements of all event handlers of an assembled scheduler
+    ///
+    /// @tparam Handler Specify the event handler components
+    ///
+    template <typename... Handler>
+    struct AssemblyRequirements
+    {
+        static constexpr bool kIdleTaskSupport = (HandlerRequirements<Handler>::kIdleTaskSupport || ... || false);
+
+        static constexpr bool kQuantumUsedUpHandler = (HandlerRequirements<Handler>::kQuantumUsedUpHandler || ... || false);
+
+        static constexpr bool kRecorder = (HandlerRequirements<Handler>::kRecorder || ... || false);
+    };
+
+    ///
+    /// [Helper] Deduce the requirements of the event handlers passed to the assembler of a scheduler
+    ///
+    /// @note This function is used in unevaluated contexts only.
+    ///
+    template <typename Policy, typename... Handler>
+    AssemblyRequirements<Handler...> requirementsOf(const Assembler<Policy, Handler...>*);
+
+    /// The requirements of all event handlers of the given assembled scheduler
+    template <typename ConcreteScheduler>
+    using RequirementsOf = decltype(requirementsOf(static_cast<const ConcreteScheduler*>(nullptr)));
+
+    /// A scheduler that derives from exactly one `Assembler`
+    template <typename ConcreteScheduler>
+    concept Assembled = requires { typename RequirementsOf<ConcreteScheduler>; };
+
+    ///
+    /// [Helper] Deduce the policy passed to the assembler of a scheduler
+    ///
+    /// @note This function is used in unevaluated contexts only.
+    ///
+    template <typename Policy, typename... Handler>
+    Policy policyOf(const Assembler<Policy, Handler...>*);
+
+    /// The scheduling policy of the given assembled scheduler
+    template <typename ConcreteScheduler>
+    using PolicyOf = decltype(policyOf(static_cast<const ConcreteScheduler*>(nullptr)));
+
+    // MARK: - Individual Requirements
+
+    /// Handlers that take the idle task into consideration must be paired with `IdleTaskSupport`
+    template <typename ConcreteScheduler>
+    concept IdleTaskSupportSatisfied = !RequirementsOf<ConcreteScheduler>::kIdleTaskSupport || SupportsIdleTask<ConcreteScheduler>;
+
+    /// A timer interrupt handler that delegates to a custom quantum used up handler must be paired with one
+    template <typename ConcreteScheduler>
+    concept QuantumUsedUpHandlerSatisfied = !RequirementsOf<ConcreteScheduler>::kQuantumUsedUpHandler || ProvidesTaskQuantumUsedUpHandler<ConcreteScheduler>;
+
+    /// Instrumented handlers must be paired with a policy that provides the recorder
+    template <typename ConcreteScheduler>
+    concept RecorderSatisfied = !RequirementsOf<ConcreteScheduler>::kRecorder || requires(ConcreteScheduler& scheduler) { scheduler.getRecorder(); };
+
+    /// A task killed handler removes tasks from the ready queue, so the policy must support removing tasks
+    template <typename ConcreteScheduler>
+    concept TaskKilledHandlerSatisfied = !ProvidesTaskKilledHandler<ConcreteScheduler> || SupportsRemovingTasks<ConcreteScheduler>;
+
+    /// A scheduler of which tasks define their priority level type
+    template <typename ConcreteScheduler>
+    concept SchedulesTasksWithPriority = requires { typename Traits::TaskPriority<Traits::ScheduledTask<ConcreteScheduler>>; };
+
+    /// A task priority changed handler repositions tasks in the ready queue, so the policy must support adjusting their positions
+    /// @note Tasks that do not define their priority level type cannot be passed to a task priority changed handler at all.
+    template <typename ConcreteScheduler>
+    concept TaskPriorityChangedHandlerSatisfied = !SchedulesTasksWithPriority<ConcreteScheduler> ||
+                                                  !ProvidesTaskPriorityChangedHandler<ConcreteScheduler> ||
+                                                  SupportsAdjustingTaskPriority<ConcreteScheduler>;
+
+    /// A batch adapter of the task killed handler makes the final decision through the task killed handler
+    template <typename ConcreteScheduler>
+    concept TasksKilledHandlerSatisfied = !ProvidesTasksKilledHandler<ConcreteScheduler> || ProvidesTaskKilledHandler<ConcreteScheduler>;
+
+    /// A batch adapter of the task unblocked handler makes the final decision through the task unblocked handler
+    template <typename ConcreteScheduler>
+    concept TasksUnblockedHandlerSatisfied = !ProvidesTasksUnblockedHandler<ConcreteScheduler> || ProvidesTaskUnblockedHandler<ConcreteScheduler>;
+
+    /// A scheduler that satisfies all requirements of its components
+    template <typename ConcreteScheduler>
+    concept ValidScheduler = Assembled<ConcreteScheduler> &&
+                             IdleTaskSupportSatisfied<ConcreteScheduler> &&
+                             QuantumUsedUpHandlerSatisfied<ConcreteScheduler> &&
+                             RecorderSatisfied<ConcreteScheduler> &&
+                             TaskKilledHandlerSatisfied<ConcreteScheduler> &&
+                             TaskPriorityChangedHandlerSatisfied<ConcreteScheduler> &&
+                             TasksKilledHandlerSatisfied<ConcreteScheduler> &&
+                             TasksUnblockedHandlerSatisfied<ConcreteScheduler>;
+
+    // MARK: - Static Requirements
+
+    /// A type of which a default-initialized instance is a constant expression, so constructing it cannot allocate memory dynamically
+    template <typename T>
+    concept ConstantInitializable = std::default_initializable<T> && requires { typename std::integral_constant<bool, (static_cast<void>(T()), true)>; };
+
+    /// A policy that is constructed at compile time and never owns dynamic memory
+    /// @note A trivially destructible policy has nothing to release, so it cannot hold memory allocated after construction either.
+    template <typename ConcreteScheduler>
+    concept StaticPolicySatisfied = ConstantInitializable<PolicyOf<ConcreteScheduler>> && std::is_trivially_destructible_v<PolicyOf<ConcreteScheduler>>;
+
+    ///
+    /// Check whether the given concrete scheduler satisfies all requirements of its components
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the complete concrete scheduler
+    /// @return `true` if the scheduler is valid, otherwise the compilation fails with the violated requirement.
+    /// @note All checks are performed at compile time, so validating a scheduler adds nothing to its event handlers.
+    ///
+    template <typename ConcreteScheduler>
+    consteval bool validate()
+    {
+        static_assert(Assembled<ConcreteScheduler>,
+                      "The scheduler must derive from exactly one Assembler<Policy, EventHandler...>.");
+
+        if constexpr (Assembled<ConcreteScheduler>)
+        {
+            static_assert(IdleTaskSupportSatisfied<ConcreteScheduler>,
+                          "Event handlers that take the idle task into consideration require the scheduler to inherit from IdleTaskSupport.");
+
+            static_assert(QuantumUsedUpHandlerSatisfied<ConcreteScheduler>,
+                          "The timer interrupt handler requires a task quantum used up handler.");
+
+            static_assert(RecorderSatisfied<ConcreteScheduler>,
+                          "Instrumented event handlers require a policy that provides getRecorder(), e.g. PolicyWithInstrumentation.");
+
+            static_assert(TaskKilledHandlerSatisfied<ConcreteScheduler>,
+                          "The task killed handler requires a policy that supports remove().");
+
+            static_assert(TaskPriorityChangedHandlerSatisfied<ConcreteScheduler>,
+                          "The task priority changed handler requires a policy that supports adjustPosition().");
+
+            static_assert(TasksKilledHandlerSatisfied<ConcreteScheduler>,
+                          "The batch task killed handler requires a task killed handler.");
+
+            static_assert(TasksUnblockedHandlerSatisfied<ConcreteScheduler>,
+                          "The batch task unblocked handler requires a task unblocked handler.");
+        }
+
+        return true;
+    }
+
+    ///
+    /// Check whether the given concrete scheduler satisfies all requirements of its components and never allocates memory dynamically
+    ///
+    /// @tparam ConcreteScheduler Specify the type of the complete concrete scheduler
+    /// @return `true` if the scheduler is valid and static, otherwise the compilation fails with the violated requirement.
+    /// @note A static scheduler can be defined as a `constinit` variable, so it lives in the data section of the image
+    ///       and needs neither a heap nor a constructor running at startup.
+    ///       Use policies that are sized by template arguments, e.g. `PrioritizedMultiQueue::Normal::BitmapArrayMapHomoImp`
+    ///       over `FIFO::Normal::RingBufferImp` or `FIFO::Normal::LinkedListImp`, instead of policies that rely on the STL or a policy maker.
+    ///
+    template <typename ConcreteScheduler>
+    consteval bool validateStatic()
+    {
+        static_assert(validate<ConcreteScheduler>());
+
+        if constexpr (Assembled<ConcreteScheduler>)
+        {
+            static_assert(StaticPolicySatisfied<ConcreteScheduler>,
+                          "A static scheduler requires a policy that is constant-initializable and trivially destructible, i.e. one that does not allocate memory.");
+        }
+
+        return true;
+    }
+}
+
+#endif /* Scheduler_Validation_hpp */
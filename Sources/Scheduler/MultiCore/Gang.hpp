@@ -0,0 +1,486 @@
+//
+//  Gang.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef Scheduler_Gang_hpp
+#define Scheduler_Gang_hpp
+
+#include <Scheduler/Policy/Policy.hpp>
+#include <Scheduler/Constraint/GangSchedulable.hpp>
+#include <Scheduler/Constraint/WakeupLinkable.hpp>
+#include <Scheduler/MultiCore/WakeupInbox.hpp>
+#include <Scheduler/MultiCore/WorkStealing.hpp>
+#include <Scheduler/Misc/Traits.hpp>
+#include <LinkedList.hpp>
+#include <Debug.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+/// Defines components that allow schedulers on different cores to cooperate
+namespace Scheduler::MultiCore
+{
+    ///
+    /// A set of tasks that run simultaneously on different cores, e.g. the threads of a parallel job that synchronize frequently
+    ///
+    /// @tparam Task Specify the type of tasks in the gang
+    /// @note The first task enrolled is the leader, which is scheduled like any other task.
+    ///       The other members never wait in a ready queue. They are parked in the gang when they become ready
+    ///       and are dispatched on other cores only when the leader is dispatched, so that the whole gang runs at the same time.
+    /// @note Members are parked in a lock-free inbox, so they can become ready on any core concurrently.
+    /// @note The gang is running from the time its leader is dispatched with its members on other cores
+    ///       until the core of the leader makes its next scheduling decision.
+    /// @note Tasks must be `WakeupLinkable`. The type is not constrained here, since it is forward declared by `GangSchedulable`.
+    /// @warning The gang must outlive its members, and a member must not be enrolled in another gang.
+    ///
+    template <typename Task>
+    class Gang
+    {
+    private:
+        /// The task whose dispatch launches the gang
+        Task* leader = nullptr;
+
+        /// The number of tasks in the gang, including the leader
+        size_t size = 0;
+
+        /// Members that are ready and wait for the leader to be dispatched
+        WakeupInbox<Task> parked;
+
+        /// `true` if the leader and its members are running on different cores
+        std::atomic<bool> running = false;
+
+    public:
+        ///
+        /// Enroll the given tasks in the gang
+        ///
+        /// @param tasks Non-null tasks that do not reside in any ready queue, where the first one is the leader
+        ///
+        void enroll(std::span<Task* const> tasks)
+        {
+            passert(!tasks.empty() && this->size == 0, "A gang should be enrolled once with at least one task.");
+
+            this->leader = tasks.front();
+
+            this->size = tasks.size();
+
+            for (Task* task : tasks)
+            {
+                task->setGang(this);
+            }
+        }
+
+        ///
+        /// Get the leader of the gang
+        ///
+        /// @return The task whose dispatch launches the gang.
+        ///
+        [[nodiscard]]
+        Task* getLeader() const
+        {
+            return this->leader;
+        }
+
+        ///
+        /// Get the number of tasks in the gang
+        ///
+        /// @return The number of tasks, including the leader.
+        ///
+        [[nodiscard]]
+        size_t getSize() const
+        {
+            return this->size;
+        }
+
+        ///
+        /// Check whether the gang is running
+        ///
+        /// @return `true` if the leader has been dispatched with its members on other cores and is still running, `false` otherwise.
+        /// @note This method can be invoked on any core concurrently.
+        ///
+        [[nodiscard]]
+        bool isRunning() const
+        {
+            return this->running.load(std::memory_order_acquire);
+        }
+
+        ///
+        /// Mark the gang as running or stopped
+        ///
+        /// @param running `true` if the leader has just been dispatched with its members on other cores,
+        ///                `false` if the core of the leader is about to make another scheduling decision
+        /// @note This method is invoked by the core of the leader only.
+        ///
+        void setRunning(bool running)
+        {
+            this->running.store(running, std::memory_order_release);
+        }
+
+        ///
+        /// Park a member that has become ready
+        ///
+        /// @param task A non-null member other than the leader
+        /// @note This method can be invoked on any core concurrently.
+        ///
+        void park(Task* task)
+        {
+            this->parked.post(task);
+        }
+
+        ///
+        /// Take all parked members out of the gang
+        ///
+        /// @param consumer A callable object that consumes each member in the order they were parked
+        /// @note This method is invoked by the core that dispatches the leader.
+        ///
+        template <typename Consumer>
+        void unpark(Consumer&& consumer)
+        {
+            this->parked.drain(consumer);
+        }
+
+        ///
+        /// Take the given member out of the gang if it is parked
+        ///
+        /// @param task A non-null member other than the leader
+        /// @return `true` if the member was parked and has been taken out, `false` otherwise.
+        /// @note Other parked members are parked again in the same order.
+        /// @warning This method must not run concurrently with `unpark()` or with itself.
+        ///
+        bool withdraw(Task* task)
+        {
+            bool found = false;
+
+            this->parked.drain([&](Task* member)
+            {
+                if (member == task)
+                {
+                    found = true;
+                }
+                else
+                {
+                    this->parked.post(member);
+                }
+            });
+
+            return found;
+        }
+    };
+
+    ///
+    /// A scheduling policy that co-schedules the members of a gang on other cores when the leader of the gang is dispatched
+    ///
+    /// @tparam BasePolicy Specify the scheduling policy of the core
+    /// @note When the leader is dequeued by `next()`, each parked member is posted to the co-scheduling inbox of a distinct other core.
+    ///       A core takes members from its inbox before any task in its own ready queue,
+    ///       so each member starts at the next scheduling decision of its core,
+    ///       which is at the latest the next tick boundary if the core re-selects a task at every timer interrupt,
+    ///       e.g. via `EventHandlers::TimerInterrupt::Preemptive::RunNextWithIdleTaskSupport`.
+    ///       With synchronized timers, the whole gang thus runs from the same tick boundary on.
+    /// @note A member that is preempted while its gang is running stays on its core and is dispatched again before any local task,
+    ///       so the gang keeps running as long as the leader does.
+    ///       Once the leader is preempted, blocked or finished, each member is parked at the next scheduling decision of its core
+    ///       until the next time the leader is dispatched, so members do not keep running without their leader.
+    /// @warning The policy cannot interrupt other cores, so members do not start at the same instant as their leader.
+    ///          A member starts at the next scheduling decision of its core, which lags behind the leader by up to one tick.
+    ///          If the platform requires a tighter start, it should send a reschedule interrupt to every core
+    ///          whose `hasPendingMembers()` returns `true` right after the leader is dispatched.
+    /// @note If the domain does not have a distinct core for every member other than the leader, co-scheduling is pointless,
+    ///       since the members would spin on their barriers while waiting for each other.
+    ///       The parked members are enqueued on the core of the leader instead and share it like any other task.
+    /// @note Cores join the domain through this policy rather than `WorkStealing`,
+    ///       so a gang member is never stolen by a core other than the one it has been assigned to.
+    ///       Wrap this policy with `PolicyWithWakeupInbox` so that members woken up by other cores are parked as well.
+    /// @warning A task passed to `remove()` must reside in the ready queue, i.e. it must not be a parked or co-scheduled member.
+    ///
+    template <typename BasePolicy>
+    requires Concepts::Policy<BasePolicy> &&
+             ListableItem<Traits::PolicyTask<BasePolicy>> &&
+             TaskConstraints::GangSchedulable<Traits::PolicyTask<BasePolicy>> &&
+             TaskConstraints::WakeupLinkable<Traits::PolicyTask<BasePolicy>>
+    struct PolicyWithGangScheduling: public BasePolicy
+    {
+    public:
+        /// Type of the task managed by the policy component
+        using Task = Traits::PolicyTask<BasePolicy>;
+
+    private:
+        /// Members posted by the cores that dispatched their leaders
+        WakeupInbox<Task> inbox;
+
+        /// Members taken out of the inbox that have not been dispatched yet
+        LinkedList<Task> coscheduled;
+
+        /// The gang whose leader has been dispatched by this core along with its members, `NULL` if none
+        Gang<Task>* launched = nullptr;
+
+        /// All cores in the domain, `NULL` if the core has not joined a domain
+        PolicyWithGangScheduling* const* cores = nullptr;
+
+        /// The number of cores in the domain
+        size_t numberOfCores = 0;
+
+        /// The index of this core in the domain
+        size_t coreIndex = 0;
+
+        /// The number of gangs launched by this core
+        uint64_t launches = 0;
+
+        /// The number of gangs enqueued on this core since the domain does not have enough cores
+        uint64_t fallbacks = 0;
+
+        ///
+        /// [Helper] Count the cores other than this one that can run a member
+        ///
+        /// @return The number of other cores that have joined the domain.
+        ///
+        [[nodiscard]]
+        size_t getNumberOfOtherCores() const
+        {
+            size_t count = 0;
+
+            for (size_t index = 0; index < this->numberOfCores; index += 1)
+            {
+                if (index != this->coreIndex && this->cores[index] != nullptr)
+                {
+                    count += 1;
+                }
+            }
+
+            return count;
+        }
+
+        ///
+        /// [Helper] Dispatch the parked members of the given gang on other cores
+        ///
+        /// @param gang The gang whose leader has just been dequeued by this core
+        ///
+        void launch(Gang<Task>* gang)
+        {
+            // Guard: Fall back to sharing this core if there is not a distinct core for every member
+            if (this->cores == nullptr || this->getNumberOfOtherCores() + 1 < gang->getSize())
+            {
+                gang->unpark([this](Task* member) { BasePolicy::ready(member); });
+
+                this->fallbacks += 1;
+
+                return;
+            }
+
+            size_t offset = 0;
+
+            gang->unpark([this, &offset](Task* member)
+            {
+                // Find the next other core that has joined the domain
+                size_t core = 0;
+
+                do
+                {
+                    offset += 1;
+
+                    core = (this->coreIndex + offset) % this->numberOfCores;
+                }
+                while (this->cores[core] == nullptr);
+
+                this->cores[core]->coschedule(member);
+            });
+
+            gang->setRunning(true);
+
+            this->launched = gang;
+
+            this->launches += 1;
+        }
+
+    public:
+        ///
+        /// Join a domain of cores
+        ///
+        /// @param cores All cores in the domain where unused entries are `NULL`
+        /// @param numberOfCores The number of entries in `cores`
+        /// @param coreIndex The index of this core in `cores`
+        /// @note This method is invoked by the domain only, e.g. `Domain<PolicyWithGangScheduling<...>, N>`.
+        ///
+        void join(PolicyWithGangScheduling* const* cores, size_t numberOfCores, size_t coreIndex, uint32_t = 0, uint32_t = 0)
+        {
+            this->cores = cores;
+
+            this->numberOfCores = numberOfCores;
+
+            this->coreIndex = coreIndex;
+        }
+
+        ///
+        /// Post a member that must run on this core alongside its leader
+        ///
+        /// @param task A non-null member of a gang whose leader has just been dispatched by another core
+        /// @note This method can be invoked on any core concurrently.
+        ///
+        void coschedule(Task* task)
+        {
+            this->inbox.post(task);
+        }
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        /// @note Members co-scheduled by other cores are dispatched before any task in the ready queue.
+        ///       If the selected task leads a gang, the parked members of the gang are dispatched on other cores.
+        ///
+        Task* next()
+        {
+            // The leader launched by this core stops running at the next scheduling decision unless it is selected again
+            if (this->launched != nullptr)
+            {
+                this->launched->setRunning(false);
+
+                this->launched = nullptr;
+            }
+
+            this->inbox.drain([this](Task* member) { this->coscheduled.enqueue(member); });
+
+            // Guard: Members of launched gangs preempt local tasks
+            if (!this->coscheduled.isEmpty())
+            {
+                return this->coscheduled.dequeue();
+            }
+
+            Task* task = BasePolicy::next();
+
+            if (task != nullptr && task->getGang() != nullptr && task->getGang()->getLeader() == task)
+            {
+                this->launch(task->getGang());
+            }
+
+            return task;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @note A gang member other than the leader is parked in its gang instead of being enqueued,
+        ///       unless the gang is running, in which case the member is dispatched again by this core before any local task.
+        ///
+        void ready(Task* task)
+        {
+            Gang<Task>* gang = task->getGang();
+
+            // Guard: Members run alongside their leader only
+            if (gang != nullptr && gang->getLeader() != task)
+            {
+                if (gang->isRunning())
+                {
+                    this->coscheduled.enqueue(task);
+                }
+                else
+                {
+                    gang->park(task);
+                }
+
+                return;
+            }
+
+            BasePolicy::ready(task);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue or from the members waiting on this core
+        ///
+        /// @param task A non-null task that is ready on this core, or a member that is parked in its gang or co-scheduled on this core
+        /// @note Members posted to this core by other cores are taken out of the inbox first, so that they can be unlinked.
+        /// @warning A member co-scheduled on another core must be removed by that core.
+        ///
+        void remove(Task* task) requires Concepts::RemovablePolicy<BasePolicy>
+        {
+            Gang<Task>* gang = task->getGang();
+
+            // Guard: Only members other than the leader bypass the ready queue
+            if (gang == nullptr || gang->getLeader() == task)
+            {
+                BasePolicy::remove(task);
+
+                return;
+            }
+
+            this->inbox.drain([this](Task* member) { this->coscheduled.enqueue(member); });
+
+            bool isCoscheduled = false;
+
+            this->coscheduled.forEach([&](Task* member) { isCoscheduled = isCoscheduled || member == task; });
+
+            // Guard: Check whether the member waits to be dispatched on this core
+            if (isCoscheduled)
+            {
+                this->coscheduled.remove(task);
+
+                return;
+            }
+
+            // Guard: Check whether the member waits for its leader
+            if (gang->withdraw(task))
+            {
+                return;
+            }
+
+            // The member has been enqueued on this core since the domain does not have enough cores
+            BasePolicy::remove(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Members of launched gangs that this core has taken are visited before the tasks of the base policy.
+        ///       Members still in the inbox are not visited, since taking them would change the state of this core.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) requires Concepts::VisitablePolicy<BasePolicy>
+        {
+            this->coscheduled.forEach(visitor);
+
+            BasePolicy::forEach(visitor);
+        }
+
+        ///
+        /// Check whether other cores have posted members that this core has not taken yet
+        ///
+        /// @return `true` if the next scheduling decision of this core will dispatch a member posted by another core, `false` otherwise.
+        /// @note This method can be invoked on any core, e.g. to decide whether to send a reschedule interrupt to this core.
+        ///       The result may be stale as soon as it is returned.
+        ///
+        [[nodiscard]]
+        bool hasPendingMembers() const
+        {
+            return !this->inbox.isEmpty();
+        }
+
+        ///
+        /// Get the number of gangs launched by this core
+        ///
+        /// @return The number of times this core has dispatched a leader and co-scheduled its members on other cores.
+        ///
+        [[nodiscard]]
+        uint64_t getLaunchCount() const
+        {
+            return this->launches;
+        }
+
+        ///
+        /// Get the number of gangs that could not be co-scheduled
+        ///
+        /// @return The number of times this core has dispatched a leader and enqueued its members locally.
+        ///
+        [[nodiscard]]
+        uint64_t getFallbackCount() const
+        {
+            return this->fallbacks;
+        }
+    };
+}
+
+#endif /* Scheduler_Gang_hpp */
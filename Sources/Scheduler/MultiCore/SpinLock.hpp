@@ -0,0 +1,56 @@
+//
+//  SpinLock.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_SpinLock_hpp
+#define Scheduler_SpinLock_hpp
+
+#include <atomic>
+
+/// Defines components that allow schedulers on different cores to cooperate
+namespace Scheduler::MultiCore
+{
+    ///
+    /// A test-and-test-and-set spin lock that protects the ready queue of a single core
+    ///
+    /// @note The lock satisfies the `BasicLockable` requirement, so it can be used with `std::lock_guard`.
+    /// @note Waiters spin on a relaxed load so that the cache line is not bounced between cores while the lock is held.
+    ///
+    struct SpinLock
+    {
+    private:
+        /// Whether the lock is held
+        std::atomic<bool> locked = false;
+
+    public:
+        /// Acquire the lock
+        void lock()
+        {
+            while (this->locked.exchange(true, std::memory_order_acquire))
+            {
+                while (this->locked.load(std::memory_order_relaxed)) {}
+            }
+        }
+
+        ///
+        /// Try to acquire the lock without spinning
+        ///
+        /// @return `true` if the lock is acquired, `false` otherwise.
+        ///
+        bool try_lock()
+        {
+            return !this->locked.load(std::memory_order_relaxed) && !this->locked.exchange(true, std::memory_order_acquire);
+        }
+
+        /// Release the lock
+        void unlock()
+        {
+            this->locked.store(false, std::memory_order_release);
+        }
+    };
+}
+
+#endif /* Scheduler_SpinLock_hpp */
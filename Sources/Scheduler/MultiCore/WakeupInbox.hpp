@@ -0,0 +1,194 @@
+//
+//  WakeupInbox.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_WakeupInbox_hpp
+#define Scheduler_WakeupInbox_hpp
+
+#include <Scheduler/Policy/Policy.hpp>
+#include <Scheduler/Constraint/WakeupLinkable.hpp>
+#include <Scheduler/Misc/Traits.hpp>
+#include <atomic>
+
+/// Defines components that allow schedulers on different cores to cooperate
+namespace Scheduler::MultiCore
+{
+    ///
+    /// A lock-free multi-producer, single-consumer inbox where other cores post tasks that have been woken up
+    ///
+    /// @tparam Task Specify the type of tasks posted to the inbox
+    /// @note Producers push tasks onto an intrusive stack with a compare-and-swap loop, so `post()` never blocks and never allocates memory.
+    ///       The consumer detaches the whole stack with a single exchange and visits tasks in the order they were posted.
+    ///       Since the consumer never pops a single task, the inbox does not suffer from the ABA problem.
+    /// @warning Only the core that owns the inbox may drain it.
+    ///
+    template <typename Task>
+    requires TaskConstraints::WakeupLinkable<Task>
+    struct WakeupInbox
+    {
+    private:
+        /// The most recently posted task
+        std::atomic<Task*> head = nullptr;
+
+    public:
+        ///
+        /// Post a task to the inbox
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @note This method can be invoked on any core concurrently.
+        ///
+        void post(Task* task)
+        {
+            Task* head = this->head.load(std::memory_order_relaxed);
+
+            do
+            {
+                task->setWakeupNext(head);
+            }
+            while (!this->head.compare_exchange_weak(head, task, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        ///
+        /// Check whether the inbox is empty
+        ///
+        /// @return `true` if no task has been posted since the last drain, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool isEmpty() const
+        {
+            return this->head.load(std::memory_order_relaxed) == nullptr;
+        }
+
+        ///
+        /// Take all posted tasks out of the inbox
+        ///
+        /// @param consumer A callable object that consumes each task in the order they were posted
+        /// @note This method must be invoked on the core that owns the inbox.
+        ///
+        template <typename Consumer>
+        void drain(Consumer&& consumer)
+        {
+            // Guard: Avoid the atomic exchange if the inbox is empty
+            if (this->isEmpty())
+            {
+                return;
+            }
+
+            Task* task = this->head.exchange(nullptr, std::memory_order_acquire);
+
+            // Reverse the stack so that tasks are consumed in the order they were posted
+            Task* reversed = nullptr;
+
+            while (task != nullptr)
+            {
+                auto* next = static_cast<Task*>(task->getWakeupNext());
+
+                task->setWakeupNext(reversed);
+
+                reversed = task;
+
+                task = next;
+            }
+
+            while (reversed != nullptr)
+            {
+                auto* next = static_cast<Task*>(reversed->getWakeupNext());
+
+                reversed->setWakeupNext(nullptr);
+
+                consumer(reversed);
+
+                reversed = next;
+            }
+        }
+    };
+
+    ///
+    /// A scheduling policy that accepts tasks woken up by other cores through a lock-free inbox
+    ///
+    /// @tparam BasePolicy Specify the scheduling policy of the core
+    /// @note Other cores call `post()` instead of an event handler, so cross-core wakeups never touch the ready queue.
+    ///       The owning core moves all posted tasks into the ready queue in a batch before it enqueues or selects a task,
+    ///       i.e. on its next `ready()` or `next()`, which are invoked by event handlers such as the timer interrupt handler,
+    ///       so tasks posted earlier are enqueued before tasks readied locally afterwards.
+    /// @note This policy can wrap `WorkStealing` so that posted tasks become visible to thieves once they are drained.
+    /// @warning A task passed to `adjustPosition()` must reside in the ready queue, i.e. it must not be waiting in the inbox.
+    ///
+    template <typename BasePolicy>
+    requires Concepts::Policy<BasePolicy> && TaskConstraints::WakeupLinkable<Traits::PolicyTask<BasePolicy>>
+    struct PolicyWithWakeupInbox: public BasePolicy
+    {
+    public:
+        /// Type of the task managed by the policy component
+        using Task = Traits::PolicyTask<BasePolicy>;
+
+    private:
+        /// Tasks woken up by other cores
+        WakeupInbox<Task> inbox;
+
+    public:
+        ///
+        /// Post a task woken up by another core
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @note This method can be invoked on any core concurrently.
+        ///
+        void post(Task* task)
+        {
+            this->inbox.post(task);
+        }
+
+        ///
+        /// Move all posted tasks into the ready queue
+        ///
+        /// @note This method must be invoked on the core that owns the scheduler.
+        ///
+        void drainWakeupInbox()
+        {
+            this->inbox.drain([this](Task* task) { BasePolicy::ready(task); });
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @note Tasks posted by other cores are enqueued before the given task.
+        ///
+        void ready(Task* task)
+        {
+            this->drainWakeupInbox();
+
+            BasePolicy::ready(task);
+        }
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        /// @note Tasks posted by other cores are enqueued before the next task is selected.
+        ///
+        Task* next()
+        {
+            this->drainWakeupInbox();
+
+            return BasePolicy::next();
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue or has been posted to the inbox
+        ///
+        void remove(Task* task) requires Concepts::RemovablePolicy<BasePolicy>
+        {
+            this->drainWakeupInbox();
+
+            BasePolicy::remove(task);
+        }
+    };
+}
+
+#endif /* Scheduler_WakeupInbox_hpp */
@@ -0,0 +1,675 @@
+//
+//  WorkStealing.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_WorkStealing_hpp
+#define Scheduler_WorkStealing_hpp
+
+#include <Scheduler/Policy/Policy.hpp>
+#include <Scheduler/MultiCore/SpinLock.hpp>
+#include <Scheduler/Constraint/Affinity.hpp>
+#include <Debug.hpp>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+/// Defines concepts related to scheduler components
+namespace Scheduler::Concepts
+{
+    /// A type that selects the core from which an idle core steals a ready task
+    template <typename B, typename Core>
+    concept Balancer = requires(Core* const* cores, size_t numberOfCores, size_t thief)
+    {
+        ///
+        /// The balancer must implement the static member function `selectVictim()` that picks a core other than the thief
+        ///
+        /// @note Signature: `static size_t selectVictim(Core* const* cores, size_t numberOfCores, size_t thief)`.
+        /// @note The function returns `numberOfCores` if there is no core to steal from.
+        ///
+        { B::selectVictim(cores, numberOfCores, thief) } -> std::same_as<size_t>;
+    };
+}
+
+/// Defines some common balancers that select the core to steal from
+namespace Scheduler::MultiCore::Balancers
+{
+    ///
+    /// A balancer that steals from the core that has the largest number of ready tasks
+    ///
+    /// @note The loads of all cores are sampled without any lock, so the selected core may have drained before the steal.
+    ///
+    struct Busiest
+    {
+        template <typename Core>
+        static size_t selectVictim(Core* const* cores, size_t numberOfCores, size_t thief)
+        {
+            size_t victim = numberOfCores;
+
+            size_t maxLoad = 0;
+
+            for (size_t index = 0; index < numberOfCores; index++)
+            {
+                // Guard: Skip the thief itself and cores that have not joined the domain
+                if (index == thief || cores[index] == nullptr)
+                {
+                    continue;
+                }
+
+                size_t load = cores[index]->getLoad();
+
+                if (load > maxLoad)
+                {
+                    victim = index;
+
+                    maxLoad = load;
+                }
+            }
+
+            return victim;
+        }
+    };
+
+    ///
+    /// A balancer that steals from the first core after the thief that has any ready task
+    ///
+    /// @note This balancer stops at the first candidate, so it touches fewer remote cache lines than `Busiest` on large machines,
+    ///       and different thieves start from different cores, which spreads their steals.
+    ///
+    struct NextNeighbor
+    {
+        template <typename Core>
+        static size_t selectVictim(Core* const* cores, size_t numberOfCores, size_t thief)
+        {
+            for (size_t offset = 1; offset < numberOfCores; offset++)
+            {
+                size_t index = (thief + offset) % numberOfCores;
+
+                if (cores[index] != nullptr && cores[index]->getLoad() > 0)
+                {
+                    return index;
+                }
+            }
+
+            return numberOfCores;
+        }
+    };
+
+    ///
+    /// A balancer that steals from the busiest core that is closest to the thief in the cache hierarchy
+    ///
+    /// @tparam RemoteMinimumLoad Specify the minimum number of ready tasks that a core on another NUMA node must have to be a victim
+    /// @note The balancer prefers the busiest core that shares the last level cache with the thief,
+    ///       then the busiest core on the same NUMA node, and crosses sockets only if no closer core has any ready task.
+    /// @note A stolen task leaves its caches and its memory behind when it crosses sockets,
+    ///       so a remote core with a single ready task is left alone by default, since it will run that task soon anyway.
+    /// @note The topology of each core is given when the core is attached to the domain.
+    ///
+    template <size_t RemoteMinimumLoad = 2>
+    requires (RemoteMinimumLoad > 0)
+    struct NearestBusiest
+    {
+        template <typename Core>
+        static size_t selectVictim(Core* const* cores, size_t numberOfCores, size_t thief)
+        {
+            // The busiest candidate in the same cache domain, on the same node and on another node
+            size_t victims[3] = { numberOfCores, numberOfCores, numberOfCores };
+
+            size_t maxLoads[3] = { 0, 0, RemoteMinimumLoad - 1 };
+
+            const Core* self = cores[thief];
+
+            for (size_t index = 0; index < numberOfCores; index++)
+            {
+                // Guard: Skip the thief itself and cores that have not joined the domain
+                if (index == thief || cores[index] == nullptr)
+                {
+                    continue;
+                }
+
+                size_t distance = 2;
+
+                if (cores[index]->getNode() == self->getNode())
+                {
+                    distance = cores[index]->getCacheDomain() == self->getCacheDomain() ? 0 : 1;
+                }
+
+                size_t load = cores[index]->getLoad();
+
+                if (load > maxLoads[distance])
+                {
+                    victims[distance] = index;
+
+                    maxLoads[distance] = load;
+                }
+            }
+
+            for (size_t victim : victims)
+            {
+                if (victim < numberOfCores)
+                {
+                    return victim;
+                }
+            }
+
+            return numberOfCores;
+        }
+    };
+
+    ///
+    /// A balancer that packs tasks onto fewer cores when the system is lightly loaded
+    ///
+    /// @tparam MinimumLoad Specify the minimum number of ready tasks that a core must have to be a victim
+    /// @note An idle core steals from the busiest core only if that core has a backlog of at least `MinimumLoad` ready tasks.
+    ///       Otherwise the tasks stay on the cores that are already awake and the idle core keeps its idle state,
+    ///       which its idle governor can make deeper as its idle periods grow longer.
+    ///       This trades some latency for power, since a ready task may wait for a busy core instead of waking up an idle one.
+    ///
+    template <size_t MinimumLoad = 2>
+    requires (MinimumLoad > 0)
+    struct Packing
+    {
+        template <typename Core>
+        static size_t selectVictim(Core* const* cores, size_t numberOfCores, size_t thief)
+        {
+            size_t victim = Busiest::selectVictim(cores, numberOfCores, thief);
+
+            // Guard: Leave cores without a backlog alone
+            if (victim < numberOfCores && cores[victim]->getLoad() < MinimumLoad)
+            {
+                return numberOfCores;
+            }
+
+            return victim;
+        }
+    };
+}
+
+/// Defines components that allow schedulers on different cores to cooperate
+namespace Scheduler::MultiCore
+{
+    ///
+    /// A scheduling policy wrapper that runs on a single core and steals ready tasks from other cores when its own queue is empty
+    ///
+    /// @tparam Policy Specify the non-virtual scheduling policy of the core
+    /// @tparam Balancer Specify the balancer that selects the core to steal from, `Balancers::Busiest` by default
+    /// @note Each core has its own scheduler assembled with this policy, so cores never share a global ready queue.
+    ///       The ready queue of a core is protected by its own spin lock, which is only contended when another core steals from it.
+    /// @note If the local ready queue is empty, `next()` steals the next ready task of the core selected by the balancer,
+    ///       so event handlers fall back to the idle task only if no other core has any ready task.
+    /// @note A core that has not joined a domain behaves exactly like the wrapped policy.
+    /// @note If tasks conform to `TaskConstraints::HasAffinity`, a core never steals a task whose affinity mask excludes it,
+    ///       records the core where each dequeued task is about to run, and can select a core for a task via `selectCoreFor()`.
+    /// @warning Only the core that owns the scheduler may invoke its event handlers.
+    ///          Other cores may only steal from it or enqueue tasks placed on it via `readyOn()`.
+    /// @seealso `Domain` to connect schedulers on different cores.
+    ///
+    template <typename Policy, typename Balancer = Balancers::Busiest>
+    requires Concepts::Policy<Policy>
+    struct WorkStealing
+    {
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = typename Policy::SchedulableTask;
+
+    private:
+        /// The wrapped policy
+        Policy policy;
+
+        /// The lock that protects the wrapped policy
+        SpinLock lock;
+
+        /// The number of ready tasks in the wrapped policy
+        std::atomic<size_t> load = 0;
+
+        /// All cores in the domain, `NULL` if the core has not joined a domain
+        WorkStealing* const* cores = nullptr;
+
+        /// The number of cores in the domain
+        size_t numberOfCores = 0;
+
+        /// The index of this core in the domain
+        size_t coreIndex = 0;
+
+        /// The NUMA node of this core
+        uint32_t node = 0;
+
+        /// The last level cache shared by this core and its siblings
+        uint32_t cacheDomain = 0;
+
+        ///
+        /// [Helper] Record that the given task is about to run on this core
+        ///
+        /// @param task A non-null task that has been dequeued by this core
+        ///
+        void track(SchedulableTask* task) const
+        {
+            if constexpr (TaskConstraints::HasAffinity<SchedulableTask>)
+            {
+                task->setLastCore(static_cast<uint32_t>(this->coreIndex));
+            }
+        }
+
+    public:
+        ///
+        /// Join a domain of cores
+        ///
+        /// @param cores All cores in the domain where unused entries are `NULL`
+        /// @param numberOfCores The number of entries in `cores`
+        /// @param coreIndex The index of this core in `cores`
+        /// @param node The NUMA node of this core
+        /// @param cacheDomain The identifier of the last level cache of this core, which is unique across all nodes
+        /// @note This method is invoked by the domain only.
+        ///
+        void join(WorkStealing* const* cores, size_t numberOfCores, size_t coreIndex, uint32_t node = 0, uint32_t cacheDomain = 0)
+        {
+            this->cores = cores;
+
+            this->numberOfCores = numberOfCores;
+
+            this->coreIndex = coreIndex;
+
+            this->node = node;
+
+            this->cacheDomain = cacheDomain;
+        }
+
+        ///
+        /// Get the index of this core in the domain
+        ///
+        /// @return The index of this core, `0` if the core has not joined a domain.
+        ///
+        [[nodiscard]]
+        size_t getCoreIndex() const
+        {
+            return this->coreIndex;
+        }
+
+        ///
+        /// Get the NUMA node of this core
+        ///
+        /// @return The node given when the core joined the domain.
+        ///
+        [[nodiscard]]
+        uint32_t getNode() const
+        {
+            return this->node;
+        }
+
+        ///
+        /// Get the last level cache of this core
+        ///
+        /// @return The identifier of the cache given when the core joined the domain.
+        ///
+        [[nodiscard]]
+        uint32_t getCacheDomain() const
+        {
+            return this->cacheDomain;
+        }
+
+        ///
+        /// Get the number of ready tasks on this core
+        ///
+        /// @return The number of ready tasks sampled without acquiring the lock.
+        ///
+        [[nodiscard]]
+        size_t getLoad() const
+        {
+            return this->load.load(std::memory_order_relaxed);
+        }
+
+        ///
+        /// Dequeue the next ready schedulable task, stealing one from another core if this core does not have any
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready on any core.
+        ///
+        SchedulableTask* next()
+        {
+            static_assert(Concepts::Balancer<Balancer, WorkStealing>, "The balancer should be able to select a victim among the cores.");
+
+            {
+                std::lock_guard guard(this->lock);
+
+                SchedulableTask* next = this->policy.next();
+
+                // Guard: Check whether a local task is available
+                if (next != nullptr)
+                {
+                    this->load.fetch_sub(1, std::memory_order_relaxed);
+
+                    this->track(next);
+
+                    return next;
+                }
+            }
+
+            // Guard: Check whether this core has joined a domain
+            if (this->cores == nullptr)
+            {
+                return nullptr;
+            }
+
+            // The local lock is released before stealing, so two cores that steal from each other never deadlock
+            size_t victim = Balancer::selectVictim(this->cores, this->numberOfCores, this->coreIndex);
+
+            SchedulableTask* stolen = victim < this->numberOfCores ? this->stealFrom(*this->cores[victim]) : nullptr;
+
+            if (stolen != nullptr)
+            {
+                this->track(stolen);
+            }
+
+            return stolen;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(SchedulableTask* task)
+        {
+            std::lock_guard guard(this->lock);
+
+            this->policy.ready(task);
+
+            this->load.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        ///
+        /// Enqueue a ready schedulable task on the given core
+        ///
+        /// @param core The index of a core in the domain that has been attached
+        /// @param task A non-null task that is ready to run and is allowed to run on the given core
+        /// @note The task is enqueued under the lock of the given core, so this method can be invoked on any core.
+        ///
+        void readyOn(size_t core, SchedulableTask* task)
+        {
+            // Guard: Use the local path if the task is placed on this core
+            if (this->cores == nullptr || core == this->coreIndex)
+            {
+                this->ready(task);
+
+                return;
+            }
+
+            passert(core < this->numberOfCores && this->cores[core] != nullptr, "The target core should have been attached to the domain.");
+
+            this->cores[core]->ready(task);
+        }
+
+        ///
+        /// Select the core on which the given task should be enqueued
+        ///
+        /// @param task A non-null task that is about to become ready
+        /// @param preferLastCore Pass `true` to keep the task on the core where it ran most recently if its affinity still allows it
+        /// @return The index of the selected core, which is allowed by the affinity mask of the task.
+        /// @note Among the allowed cores, the least loaded core on the home node of the task is preferred,
+        ///       then the least loaded core on any other node. Ties are broken in favor of this core,
+        ///       so a task that may run anywhere stays on the core that creates or wakes it up unless another core is less loaded.
+        /// @note The loads of all cores are sampled without any lock.
+        ///
+        [[nodiscard]]
+        size_t selectCoreFor(const SchedulableTask* task, bool preferLastCore) const requires TaskConstraints::HasAffinity<SchedulableTask>
+        {
+            // Guard: Check whether this core has joined a domain
+            if (this->cores == nullptr)
+            {
+                return this->coreIndex;
+            }
+
+            passert(this->numberOfCores <= 64 || task->getAffinityMask() == UINT64_MAX,
+                    "Affinity masks only cover the first 64 cores in the domain.");
+
+            size_t last = task->getLastCore();
+
+            // Guard: Keep the task on the core whose caches may still be warm
+            if (preferLastCore && last < this->numberOfCores && this->cores[last] != nullptr && Utilities::isAllowedOn(task, last))
+            {
+                return last;
+            }
+
+            uint32_t home = task->getHomeNode();
+
+            size_t selected = this->numberOfCores;
+
+            bool selectedAtHome = false;
+
+            size_t minLoad = SIZE_MAX;
+
+            // Start from this core so that it wins all ties
+            for (size_t offset = 0; offset < this->numberOfCores; offset++)
+            {
+                size_t index = (this->coreIndex + offset) % this->numberOfCores;
+
+                const WorkStealing* core = this->cores[index];
+
+                // Guard: Skip cores that have not joined the domain and cores excluded by the affinity mask
+                if (core == nullptr || !Utilities::isAllowedOn(task, index))
+                {
+                    continue;
+                }
+
+                bool atHome = home == Affinity::kAnyNode || core->getNode() == home;
+
+                size_t load = core->getLoad();
+
+                if ((atHome && !selectedAtHome) || (atHome == selectedAtHome && load < minLoad))
+                {
+                    selected = index;
+
+                    selectedAtHome = atHome;
+
+                    minLoad = load;
+                }
+            }
+
+            passert(selected < this->numberOfCores, "The affinity mask of the task should allow at least one attached core.");
+
+            return selected;
+        }
+
+        ///
+        /// Select the core on which the given task that has been woken up by this core should be enqueued
+        ///
+        /// @param task A non-null task that has just been unblocked
+        /// @return The index of the selected core, which is allowed by the affinity mask of the task.
+        /// @note The heuristic chooses among the previous core of the task, this core and an idle sibling of the previous core,
+        ///       where a core is considered idle if it does not have any ready task:
+        ///       1) The previous core if it is idle, since its caches are warm and the task is likely to run soon.
+        ///       2) The less loaded one of this core and the previous core if they share the last level cache,
+        ///          since the working set of the task can be fetched from the shared cache on either core.
+        ///       3) An idle core that shares the last level cache with the previous core.
+        ///       4) The previous core, since the cost of a cold cache usually exceeds the wait behind a few ready tasks.
+        ///       A task that has not run yet or must not run on its previous core anymore is placed by `selectCoreFor()`.
+        /// @note The loads of all cores are sampled without any lock and only the siblings of the previous core are visited.
+        ///
+        [[nodiscard]]
+        size_t selectWakeupCoreFor(const SchedulableTask* task) const requires TaskConstraints::HasAffinity<SchedulableTask>
+        {
+            // Guard: Check whether this core has joined a domain
+            if (this->cores == nullptr)
+            {
+                return this->coreIndex;
+            }
+
+            size_t previous = task->getLastCore();
+
+            // Guard: Check whether the task may return to its previous core
+            if (previous >= this->numberOfCores || this->cores[previous] == nullptr || !Utilities::isAllowedOn(task, previous))
+            {
+                return this->selectCoreFor(task, false);
+            }
+
+            const WorkStealing* last = this->cores[previous];
+
+            size_t lastLoad = last->getLoad();
+
+            // Guard: The previous core is idle
+            if (lastLoad == 0)
+            {
+                return previous;
+            }
+
+            // Guard: This core shares the last level cache with the previous core
+            if (last->getNode() == this->node && last->getCacheDomain() == this->cacheDomain && Utilities::isAllowedOn(task, this->coreIndex))
+            {
+                return this->getLoad() < lastLoad ? this->coreIndex : previous;
+            }
+
+            // Look for an idle sibling of the previous core
+            for (size_t index = 0; index < this->numberOfCores; index++)
+            {
+                const WorkStealing* core = this->cores[index];
+
+                if (core != nullptr &&
+                    core->getNode() == last->getNode() &&
+                    core->getCacheDomain() == last->getCacheDomain() &&
+                    core->getLoad() == 0 &&
+                    Utilities::isAllowedOn(task, index))
+                {
+                    return index;
+                }
+            }
+
+            return previous;
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue of this core
+        ///
+        void remove(SchedulableTask* task) requires Concepts::RemovablePolicy<Policy>
+        {
+            std::lock_guard guard(this->lock);
+
+            this->policy.remove(task);
+
+            this->load.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        ///
+        template <typename Priority>
+        void adjustPosition(SchedulableTask* task, const Priority& oldPriority) requires Concepts::AdjustablePolicy<Policy, Priority>
+        {
+            std::lock_guard guard(this->lock);
+
+            this->policy.adjustPosition(task, oldPriority);
+        }
+
+        ///
+        /// Steal the next ready task from the given core
+        ///
+        /// @param victim A core other than this one
+        /// @return The stolen task that should run on this core, `NULL` if the victim does not have any ready task that may run on this core.
+        /// @note The stolen task is removed from the ready queue of the victim and is not enqueued on this core.
+        /// @note If tasks have affinity, tasks that must not run on this core are skipped and put back into the ready queue of the victim,
+        ///       which moves them behind the other tasks of the victim. Each task is visited at most once per steal.
+        ///
+        SchedulableTask* stealFrom(WorkStealing& victim)
+        {
+            passert(&victim != this, "A core should not steal from itself.");
+
+            std::lock_guard guard(victim.lock);
+
+            if constexpr (TaskConstraints::HasAffinity<SchedulableTask>)
+            {
+                size_t remaining = victim.load.load(std::memory_order_relaxed);
+
+                while (remaining-- > 0)
+                {
+                    SchedulableTask* task = victim.policy.next();
+
+                    // Guard: Check whether the victim has drained
+                    if (task == nullptr)
+                    {
+                        return nullptr;
+                    }
+
+                    if (Utilities::isAllowedOn(task, this->coreIndex))
+                    {
+                        victim.load.fetch_sub(1, std::memory_order_relaxed);
+
+                        return task;
+                    }
+
+                    victim.policy.ready(task);
+                }
+
+                return nullptr;
+            }
+            else
+            {
+                SchedulableTask* task = victim.policy.next();
+
+                if (task != nullptr)
+                {
+                    victim.load.fetch_sub(1, std::memory_order_relaxed);
+                }
+
+                return task;
+            }
+        }
+    };
+
+    ///
+    /// A group of cores whose schedulers steal ready tasks from each other
+    ///
+    /// @tparam Core Specify the type of the work-stealing policy shared by all schedulers in the domain
+    /// @tparam MaxNumberOfCores Specify the maximum number of cores in the domain
+    /// @note Schedulers assembled with `WorkStealing` derive from it, so they can be attached to the domain directly.
+    /// @warning All cores must be attached before any of them starts to schedule tasks,
+    ///          and the domain must outlive all attached schedulers.
+    ///
+    template <typename Core, size_t MaxNumberOfCores>
+    requires (MaxNumberOfCores > 0)
+    struct Domain
+    {
+    private:
+        /// All cores in the domain where unused entries are `NULL`
+        std::array<Core*, MaxNumberOfCores> cores = {};
+
+    public:
+        ///
+        /// Attach the scheduler of a core to the domain
+        ///
+        /// @param coreIndex The index of the core
+        /// @param core The scheduler of the core
+        /// @param node The NUMA node of the core
+        /// @param cacheDomain The identifier of the last level cache of the core, which is unique across all nodes
+        /// @note Cores that share a cache domain must be on the same node.
+        ///
+        void attach(size_t coreIndex, Core& core, uint32_t node = 0, uint32_t cacheDomain = 0)
+        {
+            passert(coreIndex < MaxNumberOfCores, "The core index should be less than the maximum number of cores.");
+
+            this->cores[coreIndex] = &core;
+
+            core.join(this->cores.data(), MaxNumberOfCores, coreIndex, node, cacheDomain);
+        }
+
+        ///
+        /// Get the scheduler of the given core
+        ///
+        /// @param coreIndex The index of the core
+        /// @return The scheduler of the core, `NULL` if the core has not been attached.
+        ///
+        Core* getCore(size_t coreIndex) const
+        {
+            return this->cores[coreIndex];
+        }
+    };
+}
+
+#endif /* Scheduler_WorkStealing_hpp */
@@ -0,0 +1,310 @@
+//
+//  Snapshot.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef Scheduler_Snapshot_hpp
+#define Scheduler_Snapshot_hpp
+
+#include <Scheduler/Policy/Policy.hpp>
+#include <Scheduler/Constraint/Prioritizable.hpp>
+#include <Scheduler/Constraint/Quantizable.hpp>
+#include <Scheduler/Container/TaskArena.hpp>
+#include <Scheduler/Misc/Utils.hpp>
+#include <Debug.hpp>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+/// Defines components that save the state of a scheduling policy and load it back later
+namespace Scheduler::Persistence
+{
+    ///
+    /// The header at the beginning of a snapshot
+    ///
+    /// @note A snapshot is a header followed by one record per ready task in the order they would be dequeued.
+    ///       Both structures have a fixed size and no padding, so a snapshot can be mapped into memory and read in place.
+    /// @note Fields are stored in the byte order of the machine that takes the snapshot.
+    ///       A snapshot taken on a machine of the opposite byte order is rejected since its magic number does not match.
+    ///
+    struct SnapshotHeader
+    {
+        /// The magic number that identifies a snapshot
+        static constexpr uint32_t kMagic = 0x50414E53; // "SNAP"
+
+        /// The current version of the layout
+        static constexpr uint16_t kVersion = 1;
+
+        /// The flag set if records store the priority level of each task
+        static constexpr uint16_t kHasPriority = 1 << 0;
+
+        /// The flag set if records store the remaining ticks of each task
+        static constexpr uint16_t kHasTicks = 1 << 1;
+
+        /// The magic number
+        uint32_t magic;
+
+        /// The version of the layout
+        uint16_t version;
+
+        /// Flags that describe which fields of a record are meaningful
+        uint16_t flags;
+
+        /// The number of records that follow the header
+        uint32_t count;
+
+        /// Reserved for future use, always zero
+        uint32_t reserved;
+    };
+
+    ///
+    /// A record that describes a single ready task
+    ///
+    struct SnapshotRecord
+    {
+        /// The compact handle that identifies the task
+        uint32_t handle;
+
+        /// The priority level of the task, zero if the header does not have `kHasPriority`
+        uint32_t priority;
+
+        /// The remaining ticks of the task, zero if the header does not have `kHasTicks`
+        uint32_t ticks;
+    };
+
+    static_assert(sizeof(SnapshotHeader) == 16 && sizeof(SnapshotRecord) == 12, "The snapshot layout must not contain any padding.");
+
+    ///
+    /// Get the number of bytes required to store a snapshot of the given number of ready tasks
+    ///
+    /// @param count The maximum number of ready tasks
+    /// @return The size of the snapshot in bytes.
+    ///
+    constexpr size_t getSnapshotSize(size_t count)
+    {
+        return sizeof(SnapshotHeader) + count * sizeof(SnapshotRecord);
+    }
+
+    /// A type that converts a task to a compact handle and back
+    template <typename C, typename Task>
+    concept TaskCodec = requires(C& codec, const Task* task, uint32_t handle)
+    {
+        /// The codec must convert a live task to its handle
+        { codec.encode(task) } -> std::same_as<uint32_t>;
+
+        /// The codec must convert a handle back to the task, or return `NULL` if the task no longer exists
+        { codec.decode(handle) } -> std::same_as<Task*>;
+    };
+
+    ///
+    /// A codec that identifies tasks by the generational handles of the arena where they live
+    ///
+    /// @tparam Arena Specify the type of the task arena
+    /// @note A task destroyed after the snapshot has been taken is decoded to `NULL`, so it is skipped on restore.
+    ///
+    template <typename Arena>
+    struct ArenaCodec
+    {
+        /// The arena where tasks live
+        Arena& arena;
+
+        uint32_t encode(const auto* task)
+        {
+            return this->arena.getHandle(task).value;
+        }
+
+        auto* decode(uint32_t handle)
+        {
+            return this->arena.tryGet(Containers::TaskHandle{handle});
+        }
+    };
+
+    template <typename Arena>
+    ArenaCodec(Arena&) -> ArenaCodec<Arena>;
+
+    /// Defines the helpers that read and write the optional fields of a record
+    namespace Details
+    {
+        /// Check whether the priority level of a task can be stored in a record
+        template <typename Task>
+        concept HasSerializablePriority = TaskConstraints::PrioritizableByPriority<Task> && std::integral<typename Task::Priority> && (sizeof(typename Task::Priority) <= sizeof(uint32_t));
+
+        /// Check whether the remaining ticks of a task can be stored in a record
+        template <typename Task>
+        concept HasSerializableTicks = TaskConstraints::TicklessQuantizable<Task> && (sizeof(typename Task::Tick) <= sizeof(uint32_t));
+
+        /// The number of tasks passed to the policy in a single batch on restore
+        static constexpr size_t kBatchSize = 64;
+    }
+
+    ///
+    /// Write the ready queue of the given policy to the given buffer
+    ///
+    /// @tparam P Specify the type of the scheduling policy
+    /// @tparam Codec Specify the type of the codec that converts tasks to handles
+    /// @param policy A scheduling policy or a scheduler that inherits from one
+    /// @param buffer The buffer that receives the snapshot, which must be at least `getSnapshotSize(n)` bytes for `n` ready tasks
+    /// @param codec The codec that converts tasks to handles and back
+    /// @return The number of bytes written to the buffer, `0` if the buffer is too small.
+    /// @note The ready queue is visited in dequeue order without dequeuing any task,
+    ///       so the policy and its extensions are left untouched, e.g. the smallest virtual runtime of a fair-share policy.
+    ///       Tasks of the same priority level are recorded in the order they would be dequeued,
+    ///       so a stable policy that restores the snapshot serves them in the same order.
+    /// @note The number of ready tasks is counted before anything is written,
+    ///       so the buffer is left untouched if it cannot hold all records.
+    /// @note Every policy in `Policy/` can be visited, and so can wrappers whose base policy can be visited.
+    ///       Policies in the `Virtual` namespace and the level policies of multi-queue policies are visited through `Scheduler::Policy::forEachTask()`.
+    ///       The concurrent FIFO queue must be visited by its consumer, and a hierarchical policy records tasks group by group,
+    ///       since its dequeue order depends on how groups will be charged.
+    /// @note Tasks held aside by an extension rather than the ready queue of the base policy,
+    ///       e.g. tasks that have not been drained from a wakeup inbox yet, are not recorded.
+    ///
+    template <typename P, typename Codec>
+    requires Concepts::VisitablePolicy<P> && TaskCodec<Codec, typename P::SchedulableTask>
+    size_t snapshot(P& policy, std::span<std::byte> buffer, Codec& codec)
+    {
+        using Task = typename P::SchedulableTask;
+
+        uint32_t count = 0;
+
+        policy.forEach([&](Task*) { count += 1; });
+
+        // Guard: The buffer must hold the header and every record
+        if (buffer.size() < getSnapshotSize(count))
+        {
+            return 0;
+        }
+
+        SnapshotHeader header = {SnapshotHeader::kMagic, SnapshotHeader::kVersion, 0, count, 0};
+
+        if constexpr (Details::HasSerializablePriority<Task>)
+        {
+            header.flags |= SnapshotHeader::kHasPriority;
+        }
+
+        if constexpr (Details::HasSerializableTicks<Task>)
+        {
+            header.flags |= SnapshotHeader::kHasTicks;
+        }
+
+        memcpy(buffer.data(), &header, sizeof(SnapshotHeader));
+
+        // Write one record per ready task in dequeue order
+        std::byte* cursor = buffer.data() + sizeof(SnapshotHeader);
+
+        policy.forEach([&](Task* task)
+        {
+            SnapshotRecord record = {codec.encode(task), 0, 0};
+
+            if constexpr (Details::HasSerializablePriority<Task>)
+            {
+                record.priority = static_cast<uint32_t>(task->getPriority());
+            }
+
+            if constexpr (Details::HasSerializableTicks<Task>)
+            {
+                record.ticks = static_cast<uint32_t>(task->getRemainingTicks());
+            }
+
+            memcpy(cursor, &record, sizeof(SnapshotRecord));
+
+            cursor += sizeof(SnapshotRecord);
+        });
+
+        return getSnapshotSize(count);
+    }
+
+    ///
+    /// Load the ready tasks stored in the given snapshot into the given policy
+    ///
+    /// @tparam P Specify the type of the scheduling policy
+    /// @tparam Codec Specify the type of the codec that converts handles to tasks
+    /// @param policy A scheduling policy or a scheduler that inherits from one
+    /// @param buffer A buffer that holds a snapshot written by `snapshot()`
+    /// @param codec The codec that converts handles back to tasks
+    /// @return `true` on success, `false` if the snapshot is malformed or has an unsupported version.
+    /// @note The priority level and the remaining ticks of each task are restored before the task is enqueued,
+    ///       if the snapshot stores them and the task can accept them.
+    /// @note Tasks are handed to the batch primitive of the policy if available, so a heap is rebuilt in linear time
+    ///       instead of being built by a sequence of insertions. Tasks that no longer exist are skipped.
+    /// @note The snapshot is read in place and does not need to be aligned.
+    ///
+    template <typename P, typename Codec>
+    requires Concepts::Policy<P> && TaskCodec<Codec, typename P::SchedulableTask>
+    bool restore(P& policy, std::span<const std::byte> buffer, Codec& codec)
+    {
+        using Task = typename P::SchedulableTask;
+
+        // Guard: Validate the header
+        if (buffer.size() < sizeof(SnapshotHeader))
+        {
+            return false;
+        }
+
+        SnapshotHeader header;
+
+        memcpy(&header, buffer.data(), sizeof(SnapshotHeader));
+
+        if (header.magic != SnapshotHeader::kMagic || header.version != SnapshotHeader::kVersion || buffer.size() < getSnapshotSize(header.count))
+        {
+            return false;
+        }
+
+        // Decode and enqueue tasks in batches
+        Task* batch[Details::kBatchSize];
+
+        size_t length = 0;
+
+        const std::byte* reader = buffer.data() + sizeof(SnapshotHeader);
+
+        for (uint32_t index = 0; index < header.count; index += 1, reader += sizeof(SnapshotRecord))
+        {
+            SnapshotRecord record;
+
+            memcpy(&record, reader, sizeof(SnapshotRecord));
+
+            Task* task = codec.decode(record.handle);
+
+            // Guard: Skip the task if it no longer exists
+            if (task == nullptr)
+            {
+                continue;
+            }
+
+            if constexpr (TaskConstraints::PrioritizableByMutablePriority<Task> && Details::HasSerializablePriority<Task>)
+            {
+                if (header.flags & SnapshotHeader::kHasPriority)
+                {
+                    task->setPriority(static_cast<typename Task::Priority>(record.priority));
+                }
+            }
+
+            if constexpr (Details::HasSerializableTicks<Task>)
+            {
+                if (header.flags & SnapshotHeader::kHasTicks)
+                {
+                    task->allocateTicks(static_cast<typename Task::Tick>(record.ticks));
+                }
+            }
+
+            batch[length++] = task;
+
+            if (length == Details::kBatchSize)
+            {
+                Utilities::readyBatch(policy, std::span<Task* const>(batch, length));
+
+                length = 0;
+            }
+        }
+
+        Utilities::readyBatch(policy, std::span<Task* const>(batch, length));
+
+        return true;
+    }
+}
+
+#endif /* Scheduler_Snapshot_hpp */
@@ -0,0 +1,236 @@
+//
+//  ConstantBandwidth.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_ConstantBandwidth_hpp
+#define Scheduler_ConstantBandwidth_hpp
+
+#include <Scheduler/Policy/Policy.hpp>
+#include <Scheduler/Constraint/Reservable.hpp>
+#include <Scheduler/Container/TimingWheel.hpp>
+#include <Scheduler/Misc/Traits.hpp>
+#include <LinkedList.hpp>
+#include <Debug.hpp>
+#include <cstddef>
+#include <cstdint>
+
+///
+/// Defines the components of constant bandwidth servers
+///
+/// @note A constant bandwidth server grants each task a budget of `runtime` ticks in every `period` ticks
+///       and assigns the task a server deadline, by which an earliest-deadline-first policy orders ready tasks.
+///       A task that exhausts its budget is throttled until its server deadline, when the budget is replenished
+///       and the deadline is postponed by one period, so an overrunning task cannot steal the bandwidth of others.
+///
+namespace Scheduler::Policies::ConstantBandwidth
+{
+    ///
+    /// Use the replenishment time of a task as its time key
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    ///
+    template <typename Task>
+    requires TaskConstraints::Reservable<Task>
+    struct ReplenishmentTimeKey
+    {
+        uint64_t operator()(const Task& task) const
+        {
+            return task.getReplenishmentTime();
+        }
+    };
+
+    ///
+    /// A scheduling policy that enforces the bandwidth reservation of each task on top of an earliest-deadline-first policy
+    ///
+    /// @tparam BasePolicy Specify a policy that runs the ready task that has the earliest server deadline,
+    ///                    e.g. `PrioritizedSingleQueue::Normal::StableDaryHeapImp` with tasks compared by their server deadlines
+    /// @tparam NumberOfSlots Specify the number of consecutive ticks covered by the replenishment wheel, which must be a power of two
+    /// @note Throttled tasks are parked in a timing wheel keyed by their replenishment time instead of the ready queue,
+    ///       so replenishing due tasks at each timer interrupt does not scan the throttled tasks.
+    ///       The wheel should cover the longest reservation period, so that throttled tasks never overflow the window.
+    /// @note A throttled task reuses the link provided by `Listable`, since it does not reside in the ready queue.
+    /// @note The caller activates a task before it is enqueued after being created or unblocked,
+    ///       e.g. via `EventHandlers::Reservation::ActivateOnUnblock`,
+    ///       charges the current task and advances the clock at each timer interrupt,
+    ///       e.g. via `EventHandlers::TimerInterrupt::ConstantBandwidth::ChargeCurrentAndRunEarliestWithIdleTaskSupport`.
+    ///
+    template <typename BasePolicy, size_t NumberOfSlots = 1024>
+    requires Concepts::Policy<BasePolicy> &&
+             ListableItem<Traits::PolicyTask<BasePolicy>> &&
+             TaskConstraints::Reservable<Traits::PolicyTask<BasePolicy>>
+    struct PolicyWithReservations: public BasePolicy
+    {
+    public:
+        /// Type of the task managed by the policy component
+        using Task = Traits::PolicyTask<BasePolicy>;
+
+    private:
+        /// Throttled tasks keyed by their replenishment time
+        Containers::TimingWheel<Task, ReplenishmentTimeKey<Task>, NumberOfSlots> throttled;
+
+        /// The number of ticks that have elapsed since the scheduler started
+        uint64_t clock = 0;
+
+        ///
+        /// [Helper] Grant the given task a full budget and a new server deadline
+        ///
+        /// @param task A non-null task
+        /// @param deadline The new server deadline
+        ///
+        static void renew(Task* task, uint64_t deadline)
+        {
+            task->setRemainingBudget(task->getReservedRuntime());
+
+            task->setServerDeadline(deadline);
+        }
+
+    public:
+        ///
+        /// Get the current time of the server
+        ///
+        /// @return The number of ticks that have elapsed since the scheduler started.
+        ///
+        [[nodiscard]]
+        uint64_t getCurrentTime() const
+        {
+            return this->clock;
+        }
+
+        ///
+        /// Get the number of throttled tasks
+        ///
+        /// @return The number of tasks that wait for their budgets to be replenished.
+        ///
+        [[nodiscard]]
+        size_t getNumberOfThrottledTasks() const
+        {
+            return this->throttled.size();
+        }
+
+        ///
+        /// Check whether the given task has been throttled
+        ///
+        /// @param task A non-null task that has been activated
+        /// @return `true` if the task has exhausted its budget and waits for the replenishment, `false` otherwise.
+        ///
+        [[nodiscard]]
+        static bool isThrottled(const Task* task)
+        {
+            return task->getRemainingBudget() == 0;
+        }
+
+        ///
+        /// Update the reservation of a task that becomes ready after being created or blocked
+        ///
+        /// @param task A non-null task that is about to be enqueued
+        /// @note The task keeps its current budget and deadline if running the budget out before the deadline
+        ///       does not exceed its reserved bandwidth. Otherwise, it receives a full budget and a deadline one period from now,
+        ///       so that a task that has been blocked for a while cannot claim the bandwidth it did not use.
+        /// @note This method does not enqueue the task.
+        ///
+        void activate(Task* task)
+        {
+            passert(task->getReservedRuntime() != 0 && task->getReservedRuntime() <= task->getReservationPeriod(),
+                    "Usage Error: The task must reserve a non-zero runtime that does not exceed its period.");
+
+            uint64_t deadline = task->getServerDeadline();
+
+            // Guard: Keep the current reservation if the remaining budget fits into the reserved bandwidth before the deadline
+            if (deadline > this->clock &&
+                task->getRemainingBudget() * task->getReservationPeriod() < (deadline - this->clock) * task->getReservedRuntime())
+            {
+                return;
+            }
+
+            renew(task, this->clock + task->getReservationPeriod());
+        }
+
+        ///
+        /// Charge the given task for the ticks it has run and throttle it if its budget has been exhausted
+        ///
+        /// @param task The non-null current running task
+        /// @param ticks The number of ticks the task has run since it was last charged
+        /// @return `true` if the task has been throttled and must not run until its budget is replenished, `false` otherwise.
+        /// @note A task that exhausts its budget after its server deadline has passed receives a new budget immediately.
+        /// @note Ticks beyond the remaining budget are not carried into the next period.
+        ///
+        bool consume(Task* task, uint64_t ticks)
+        {
+            uint64_t budget = task->getRemainingBudget();
+
+            // Guard: Check whether the task has any budget left
+            if (ticks < budget)
+            {
+                task->setRemainingBudget(budget - ticks);
+
+                return false;
+            }
+
+            // Guard: Check whether the server deadline has already passed
+            if (task->getServerDeadline() <= this->clock)
+            {
+                renew(task, this->clock + task->getReservationPeriod());
+
+                return false;
+            }
+
+            // Throttle the task until its server deadline
+            task->setRemainingBudget(0);
+
+            task->setReplenishmentTime(task->getServerDeadline());
+
+            this->throttled.insert(task);
+
+            return true;
+        }
+
+        ///
+        /// Advance the clock of the server and enqueue throttled tasks whose budgets are due for replenishment
+        ///
+        /// @param ticks The number of ticks that have elapsed since the clock was last advanced
+        /// @return The number of tasks that have been replenished and enqueued.
+        /// @note A replenished task receives a full budget and a deadline one period after its previous one.
+        ///
+        size_t advance(uint64_t ticks)
+        {
+            this->clock += ticks;
+
+            size_t count = 0;
+
+            while (Task* task = this->throttled.popUntil(this->clock))
+            {
+                renew(task, task->getReplenishmentTime() + task->getReservationPeriod());
+
+                BasePolicy::ready(task);
+
+                count += 1;
+            }
+
+            return count;
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue or from the throttled tasks
+        ///
+        /// @param task A non-null task that is either ready or throttled
+        /// @note This allows the task killed handlers to kill a throttled task as if it were ready.
+        ///
+        void remove(Task* task)
+        {
+            // Guard: Check whether the task waits for the replenishment
+            if (isThrottled(task))
+            {
+                this->throttled.remove(task, task->getReplenishmentTime());
+
+                return;
+            }
+
+            BasePolicy::remove(task);
+        }
+    };
+}
+
+#endif /* Scheduler_ConstantBandwidth_hpp */
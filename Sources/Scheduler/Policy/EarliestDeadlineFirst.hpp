@@ -0,0 +1,380 @@
+//
+//  EarliestDeadlineFirst.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef Scheduler_EarliestDeadlineFirst_hpp
+#define Scheduler_EarliestDeadlineFirst_hpp
+
+#include <Scheduler/Policy/Policy.hpp>
+#include <Scheduler/Constraint/Deadline.hpp>
+#include <Scheduler/Instrumentation/Recorder.hpp>
+#include <Scheduler/Misc/Traits.hpp>
+#include <LinkedList.hpp>
+#include <Debug.hpp>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+///
+/// Defines the components that keep an earliest-deadline-first scheduler under control when it is overloaded
+///
+/// @note EDF meets every deadline as long as the utilization does not exceed 100%,
+///       but once it does, a late job still has the earliest deadline and keeps running,
+///       which makes the next job late as well until every task misses its deadline.
+///       An overload strategy decides what happens to a late job on the dispatch path, so that the damage stays bounded.
+///
+namespace Scheduler::Policies::EarliestDeadlineFirst
+{
+    ///
+    /// Actions that an overload strategy can take on a task that is about to be dispatched
+    ///
+    enum class OverloadAction
+    {
+        /// Dispatch the task
+        kRun,
+
+        /// Put the task back to the ready queue, since the strategy has moved its deadline
+        kRequeue,
+
+        /// Remove the task from the task set until the caller reclaims it
+        kShed
+    };
+}
+
+/// Defines concepts related to scheduler components
+namespace Scheduler::Concepts
+{
+    /// A strategy that decides what an earliest-deadline-first policy does with a task when it is dispatched
+    template <typename Strategy, typename Task>
+    concept OverloadStrategy = requires(Task* task, uint64_t now, bool overloaded)
+    {
+        ///
+        /// Decide what to do with the given task
+        ///
+        /// @param task The non-null task that has been dequeued
+        /// @param now The current time in ticks
+        /// @param overloaded `true` if a deadline has been missed since the ready queue was last empty
+        /// @return The action to be taken on the task.
+        /// @note A task that is requeued must not be requeued again at the same time.
+        ///
+        { Strategy::onDispatch(task, now, overloaded) } -> std::same_as<Policies::EarliestDeadlineFirst::OverloadAction>;
+    };
+}
+
+namespace Scheduler::Policies::EarliestDeadlineFirst
+{
+    ///
+    /// [Helper] Check whether the given task can no longer meet its deadline
+    ///
+    /// @param task A non-null task
+    /// @param now The current time in ticks
+    /// @return `true` if the deadline has been reached, since a job needs at least one more tick to finish.
+    ///
+    template <typename Task>
+    requires TaskConstraints::Deadlined<Task>
+    bool isLate(const Task* task, uint64_t now)
+    {
+        return static_cast<uint64_t>(task->getDeadline()) <= now;
+    }
+
+    ///
+    /// A strategy that dispatches late tasks as usual
+    ///
+    /// @note This is plain EDF, where overloads are detected and reported but nothing is done about them.
+    ///
+    struct RunLate
+    {
+        template <typename Task>
+        static OverloadAction onDispatch([[maybe_unused]] Task* task, [[maybe_unused]] uint64_t now, [[maybe_unused]] bool overloaded)
+        {
+            return OverloadAction::kRun;
+        }
+    };
+
+    ///
+    /// A strategy that skips the late job of a periodic task and lets the task continue with the next job that can still meet its deadline
+    ///
+    /// @note The deadline of a late task is moved forward by whole periods until it lies in the future,
+    ///       so every task keeps its phase, and a burst costs each task at most the jobs released during the burst.
+    ///
+    struct SkipOver
+    {
+        template <typename Task>
+        requires TaskConstraints::Skippable<Task>
+        static OverloadAction onDispatch(Task* task, uint64_t now, [[maybe_unused]] bool overloaded)
+        {
+            // Guard: Dispatch the task if it can still meet its deadline
+            if (!isLate(task, now))
+            {
+                return OverloadAction::kRun;
+            }
+
+            auto deadline = static_cast<uint64_t>(task->getDeadline());
+
+            auto period = static_cast<uint64_t>(task->getPeriod());
+
+            passert(period != 0, "Usage Error: A task that can be skipped must have a non-zero period.");
+
+            deadline += ((now - deadline) / period + 1) * period;
+
+            task->setDeadline(static_cast<typename Task::Tick>(deadline));
+
+            return OverloadAction::kRequeue;
+        }
+    };
+
+    ///
+    /// A strategy that sheds tasks whose value is below the given threshold while the scheduler is overloaded
+    ///
+    /// @tparam Threshold Specify the smallest value of a task that keeps running under overload
+    /// @note Valuable tasks keep running even if they are late, while less valuable tasks are shed until the backlog clears,
+    ///       so that the capacity they would have consumed goes to the tasks that matter.
+    ///
+    template <auto Threshold>
+    struct ShedBelowValue
+    {
+        template <typename Task>
+        requires TaskConstraints::Valuable<Task>
+        static OverloadAction onDispatch(Task* task, [[maybe_unused]] uint64_t now, bool overloaded)
+        {
+            return overloaded && task->getValue() < Threshold ? OverloadAction::kShed : OverloadAction::kRun;
+        }
+    };
+
+    ///
+    /// A scheduling policy that detects deadline misses on the dispatch path and applies an overload strategy
+    ///
+    /// @tparam BasePolicy Specify a policy that runs the ready task that has the earliest deadline,
+    ///                    e.g. `PrioritizedSingleQueue::Normal::StableDaryHeapImp` with tasks compared by their deadlines
+    /// @tparam Strategy Specify the overload strategy, e.g. `RunLate`, `SkipOver` or `ShedBelowValue`
+    /// @note A deadline miss is detected when a task is dequeued at or after its deadline.
+    ///       The scheduler enters the overload mode on the first miss and leaves it once the ready queue runs empty,
+    ///       i.e. once the backlog that caused the miss has been cleared.
+    /// @note Each miss is reported as `Instrumentation::Event::kDeadlineMissed` with the late task as the current task and no next task,
+    ///       if the base policy is instrumented, e.g. `PolicyWithInstrumentation`.
+    /// @note Shed tasks are parked in a list that reuses the link provided by `Listable`, since they do not reside in the ready queue.
+    ///       The caller reclaims them via `reclaim()`, e.g. to notify their owners or to admit them again later.
+    /// @note The caller advances the clock at each timer interrupt,
+    ///       e.g. via `EventHandlers::TimerInterrupt::EarliestDeadlineFirst::AdvanceClockAndKeepRunningCurrent`.
+    ///
+    template <typename BasePolicy, typename Strategy = RunLate>
+    requires Concepts::Policy<BasePolicy> &&
+             ListableItem<Traits::PolicyTask<BasePolicy>> &&
+             TaskConstraints::Deadlined<Traits::PolicyTask<BasePolicy>> &&
+             Concepts::OverloadStrategy<Strategy, Traits::PolicyTask<BasePolicy>>
+    struct PolicyWithOverloadDetection: public BasePolicy
+    {
+    public:
+        /// Type of the task managed by the policy component
+        using Task = Traits::PolicyTask<BasePolicy>;
+
+    private:
+        /// Tasks that have been shed and wait to be reclaimed
+        LinkedList<Task> shed;
+
+        /// The number of ticks that have elapsed since the scheduler started
+        uint64_t clock = 0;
+
+        /// `true` if a deadline has been missed since the ready queue was last empty
+        bool overloaded = false;
+
+        /// The number of deadline misses detected
+        uint64_t misses = 0;
+
+        /// The number of jobs skipped by the strategy
+        uint64_t skips = 0;
+
+        /// The number of tasks shed by the strategy
+        uint64_t sheds = 0;
+
+        ///
+        /// [Helper] Report a deadline miss to the recorder of the base policy if it has one
+        ///
+        /// @param task The non-null task that has missed its deadline
+        ///
+        void reportMiss(Task* task)
+        {
+            if constexpr (requires(BasePolicy& policy) { policy.getRecorder(); })
+            {
+                if constexpr (std::remove_reference_t<decltype(this->getRecorder())>::kEnabled)
+                {
+                    this->getRecorder().eventHandled(Instrumentation::Event::kDeadlineMissed, task, static_cast<Task*>(nullptr));
+                }
+            }
+        }
+
+    public:
+        /// Inherit the constructors of the base policy
+        using BasePolicy::BasePolicy;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        /// @note Tasks that the strategy requeues or sheds are not returned.
+        ///
+        Task* next()
+        {
+            while (true)
+            {
+                Task* task = BasePolicy::next();
+
+                // Guard: The backlog has been cleared once the ready queue runs empty
+                if (task == nullptr)
+                {
+                    this->overloaded = false;
+
+                    return nullptr;
+                }
+
+                if (isLate(task, this->clock))
+                {
+                    this->overloaded = true;
+
+                    this->misses += 1;
+
+                    this->reportMiss(task);
+                }
+
+                switch (Strategy::onDispatch(task, this->clock, this->overloaded))
+                {
+                    case OverloadAction::kRun:
+                        return task;
+
+                    case OverloadAction::kRequeue:
+                        this->skips += 1;
+
+                        BasePolicy::ready(task);
+
+                        break;
+
+                    case OverloadAction::kShed:
+                        this->sheds += 1;
+
+                        this->shed.enqueue(task);
+
+                        break;
+                }
+            }
+        }
+
+        ///
+        /// Advance the clock of the policy
+        ///
+        /// @param ticks The number of ticks that have elapsed since the clock was last advanced
+        ///
+        void advance(uint64_t ticks)
+        {
+            this->clock += ticks;
+        }
+
+        ///
+        /// Reclaim a task that has been shed
+        ///
+        /// @return A task that has been shed, `NULL` if no task is waiting to be reclaimed.
+        /// @note Tasks are reclaimed in the order they have been shed.
+        ///
+        Task* reclaim()
+        {
+            return this->shed.isEmpty() ? nullptr : this->shed.dequeue();
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue or from the shed tasks
+        ///
+        /// @param task A non-null task that is either ready or shed
+        /// @note This allows the task killed handlers to kill a shed task that has not been reclaimed as if it were ready.
+        /// @note Shed tasks are searched linearly, since they do not record where they reside.
+        ///
+        void remove(Task* task) requires Concepts::RemovablePolicy<BasePolicy>
+        {
+            bool isShed = false;
+
+            this->shed.forEach([&](Task* candidate) { isShed = isShed || candidate == task; });
+
+            // Guard: Check whether the task waits to be reclaimed
+            if (isShed)
+            {
+                this->shed.remove(task);
+
+                return;
+            }
+
+            BasePolicy::remove(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order the base policy would dequeue them
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Shed tasks are not visited, since they do not reside in the ready queue.
+        ///       The strategy may still requeue or shed a visited task when it is dequeued.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) requires Concepts::VisitablePolicy<BasePolicy>
+        {
+            BasePolicy::forEach(visitor);
+        }
+
+        ///
+        /// Get the current time of the policy
+        ///
+        /// @return The number of ticks that have elapsed since the scheduler started.
+        ///
+        [[nodiscard]]
+        uint64_t getCurrentTime() const
+        {
+            return this->clock;
+        }
+
+        ///
+        /// Check whether the scheduler is overloaded
+        ///
+        /// @return `true` if a deadline has been missed since the ready queue was last empty, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool isOverloaded() const
+        {
+            return this->overloaded;
+        }
+
+        ///
+        /// Get the number of deadline misses detected
+        ///
+        /// @return The number of tasks dequeued at or after their deadlines.
+        ///
+        [[nodiscard]]
+        uint64_t getDeadlineMissCount() const
+        {
+            return this->misses;
+        }
+
+        ///
+        /// Get the number of jobs skipped by the strategy
+        ///
+        /// @return The number of times a task has been requeued with a later deadline.
+        ///
+        [[nodiscard]]
+        uint64_t getSkippedJobCount() const
+        {
+            return this->skips;
+        }
+
+        ///
+        /// Get the number of tasks shed by the strategy
+        ///
+        /// @return The number of times a task has been shed, including tasks that have been reclaimed.
+        ///
+        [[nodiscard]]
+        uint64_t getShedTaskCount() const
+        {
+            return this->sheds;
+        }
+    };
+}
+
+#endif /* Scheduler_EarliestDeadlineFirst_hpp */
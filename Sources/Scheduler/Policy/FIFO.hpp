@@ -11,8 +11,15 @@
 #define Scheduler_FIFO_hpp
 
 #include <Scheduler/Policy/Policy.hpp>
+#include <Scheduler/Constraint/WakeupLinkable.hpp>
 #include <LinkedList.hpp>
-#include <queue>
+#include <Debug.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <deque>
 
 ///
 /// Defines scheduling policies that manage tasks on a first-come, first-served basis
@@ -58,19 +65,190 @@ namespace Scheduler::Policies::FIFO::Normal
         {
             this->queue.enqueue(task);
         }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method unlinks the task in constant time through its intrusive links.
+        ///
+        void remove(Task* task)
+        {
+            this->queue.remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note Tasks are served on a first-come, first-served basis regardless of their priority level,
+        ///       so the task keeps its current position in the queue.
+        ///
+        template <typename Priority>
+        void adjustPosition([[maybe_unused]] Task* task, [[maybe_unused]] const Priority& oldPriority) {}
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor)
+        {
+            this->queue.forEach(visitor);
+        }
+    };
+
+    ///
+    /// Implements the policy by maintaining a fixed-capacity ring buffer of schedulable tasks without allocating memory dynamically
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam Capacity Specify the maximum number of ready tasks, which must be a power of two
+    /// @note The buffer is embedded in the policy and is constant-initialized, so a policy defined as a static variable
+    ///       needs neither a heap nor a constructor running at startup. Tasks need not provide any intrusive link.
+    /// @note `next()` and `ready()` take constant time, while `remove()` takes at most `Capacity` steps,
+    ///       so the worst-case execution time of each primitive is bounded by the template arguments alone.
+    /// @warning The caller must not have more than `Capacity` tasks ready at the same time, which is checked by `passert()` only.
+    ///          Size the buffer by the maximum number of tasks in the system to rule out an overflow by construction.
+    ///
+    template <typename Task, size_t Capacity>
+    requires (Capacity > 0) && (std::has_single_bit(Capacity))
+    struct RingBufferImp
+    {
+    private:
+        /// The mask that wraps an index around the buffer
+        static constexpr size_t kMask = Capacity - 1;
+
+        /// The ready tasks
+        std::array<Task*, Capacity> buffer = {};
+
+        /// The index of the oldest ready task
+        size_t head = 0;
+
+        /// The number of ready tasks
+        size_t count = 0;
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        /// The maximum number of ready tasks
+        static constexpr size_t kCapacity = Capacity;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        constexpr Task* next()
+        {
+            // Guard: Check whether the queue is empty
+            if (this->count == 0)
+            {
+                return nullptr;
+            }
+
+            Task* task = this->buffer[this->head];
+
+            this->head = (this->head + 1) & kMask;
+
+            this->count -= 1;
+
+            return task;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
+        ///
+        constexpr void ready(Task* task)
+        {
+            passert(this->count < Capacity, "The number of ready tasks should not exceed the capacity of the ring buffer.");
+
+            this->buffer[(this->head + this->count) & kMask] = task;
+
+            this->count += 1;
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method locates the task by a linear search and closes the gap by shifting the tasks behind it,
+        ///       so tasks keep their order.
+        ///
+        constexpr void remove(Task* task)
+        {
+            size_t offset = 0;
+
+            while (offset < this->count && this->buffer[(this->head + offset) & kMask] != task)
+            {
+                offset += 1;
+            }
+
+            passert(offset < this->count, "The task to be removed should reside in the ready queue.");
+
+            for (; offset + 1 < this->count; offset += 1)
+            {
+                this->buffer[(this->head + offset) & kMask] = this->buffer[(this->head + offset + 1) & kMask];
+            }
+
+            this->count -= 1;
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note Tasks are served on a first-come, first-served basis regardless of their priority level,
+        ///       so the task keeps its current position in the queue.
+        ///
+        template <typename Priority>
+        constexpr void adjustPosition([[maybe_unused]] Task* task, [[maybe_unused]] const Priority& oldPriority) {}
+
+        ///
+        /// Get the number of ready tasks
+        ///
+        /// @return The number of tasks in the queue.
+        ///
+        [[nodiscard]]
+        constexpr size_t size() const
+        {
+            return this->count;
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        ///
+        template <typename Visitor>
+        constexpr void forEach(Visitor&& visitor) const
+        {
+            for (size_t offset = 0; offset < this->count; offset += 1)
+            {
+                visitor(this->buffer[(this->head + offset) & kMask]);
+            }
+        }
     };
 
     ///
-    /// Implements the policy by maintaining a STL queue of schedulable tasks
+    /// Implements the policy by maintaining a STL double-ended queue of schedulable tasks
     ///
     /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @note Removing an arbitrary task takes linear time, since the task must be found and erased from the middle of the queue.
+    ///       Use `LinkedListImp` on hot paths that remove tasks, which unlinks a task in constant time.
     ///
     template <typename Task>
     struct StlQueueImp
     {
     private:
         /// An internal FIFO queue
-        std::queue<Task*> queue;
+        std::deque<Task*> queue;
 
     public:
         /// Define the schedulable task type
@@ -91,7 +269,7 @@ namespace Scheduler::Policies::FIFO::Normal
 
             Task* task = this->queue.front();
 
-            this->queue.pop();
+            this->queue.pop_front();
 
             return task;
         }
@@ -104,7 +282,211 @@ namespace Scheduler::Policies::FIFO::Normal
         ///
         void ready(Task* task)
         {
-            this->queue.push(task);
+            this->queue.push_back(task);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method locates the task by a linear search and closes the gap by shifting the tasks behind it,
+        ///       so it runs in linear time.
+        ///
+        void remove(Task* task)
+        {
+            auto iterator = std::find(this->queue.begin(), this->queue.end(), task);
+
+            passert(iterator != this->queue.end(), "The task to be removed should reside in the ready queue.");
+
+            this->queue.erase(iterator);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note Tasks are served on a first-come, first-served basis regardless of their priority level,
+        ///       so the task keeps its current position in the queue.
+        ///
+        template <typename Priority>
+        void adjustPosition([[maybe_unused]] Task* task, [[maybe_unused]] const Priority& oldPriority) {}
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor)
+        {
+            for (Task* task : this->queue)
+            {
+                visitor(task);
+            }
+        }
+    };
+
+    ///
+    /// Implements the policy by maintaining an intrusive lock-free queue where many threads may enqueue tasks concurrently
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @note This is the multi-producer, single-consumer queue by Dmitry Vyukov.
+    ///       `ready()` is wait-free: a producer swaps itself in as the newest node with one atomic exchange and then links its predecessor to it.
+    ///       `next()` is lock-free and never allocates memory, since the queue keeps a stub node to avoid handling an empty list specially.
+    /// @note A task becomes visible to `next()` only once its producer has linked it,
+    ///       so `next()` may return `NULL` while a producer is between the two steps of `ready()`, even if other tasks were enqueued after it.
+    ///       The consumer should treat such an empty result as transient, e.g. retry on its next scheduling decision.
+    /// @note Tasks are served in the order in which producers performed the atomic exchange,
+    ///       so tasks enqueued by the same thread are served in the order they were enqueued.
+    /// @warning Only one thread may invoke `next()` at a time, e.g. the core that owns the queue or a thread that holds the scheduler lock.
+    /// @warning The queue cannot remove an arbitrary task, so there is no virtual counterpart of this policy.
+    ///
+    template <typename Task>
+    requires TaskConstraints::WakeupLinkable<Task>
+    struct IntrusiveMpscQueueImp
+    {
+    private:
+        /// The type of the link embedded in each task
+        using Link = Scheduler::WakeupLinkable<Task>;
+
+        /// A placeholder node that lets the queue keep at least one node at all times
+        Link stub;
+
+        /// The most recently enqueued node, written by producers
+        alignas(64) std::atomic<Link*> head;
+
+        /// The least recently enqueued node, owned by the consumer
+        alignas(64) Link* tail;
+
+        ///
+        /// [Helper] Append the given node to the queue
+        ///
+        /// @param node A non-null node that does not reside in the queue
+        ///
+        void push(Link* node)
+        {
+            node->setWakeupNext(nullptr, std::memory_order_relaxed);
+
+            Link* previous = this->head.exchange(node, std::memory_order_acq_rel);
+
+            // Publish the node to the consumer
+            previous->setWakeupNext(node, std::memory_order_release);
+        }
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        /// Create an empty queue that holds the stub node only
+        IntrusiveMpscQueueImp() : head(&this->stub), tail(&this->stub) {}
+
+        /// The queue cannot be copied since nodes refer to its stub node
+        IntrusiveMpscQueueImp(const IntrusiveMpscQueueImp&) = delete;
+
+        /// The queue cannot be copied since nodes refer to its stub node
+        IntrusiveMpscQueueImp& operator=(const IntrusiveMpscQueueImp&) = delete;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready or the oldest task has not been linked by its producer yet.
+        /// @note This method must not be invoked by more than one thread at a time.
+        ///
+        Task* next()
+        {
+            Link* tail = this->tail;
+
+            Link* next = tail->getWakeupNext(std::memory_order_acquire);
+
+            // Guard: Skip the stub node
+            if (tail == &this->stub)
+            {
+                // Guard: Check whether the queue is empty
+                if (next == nullptr)
+                {
+                    return nullptr;
+                }
+
+                this->tail = next;
+
+                tail = next;
+
+                next = next->getWakeupNext(std::memory_order_acquire);
+            }
+
+            // Guard: Check whether the oldest task has a successor
+            if (next != nullptr)
+            {
+                this->tail = next;
+
+                return static_cast<Task*>(tail);
+            }
+
+            // Guard: Check whether a producer has swapped in a new node but not linked it yet
+            if (tail != this->head.load(std::memory_order_acquire))
+            {
+                return nullptr;
+            }
+
+            // The oldest task is the only node, so enqueue the stub node behind it to detach it
+            this->push(&this->stub);
+
+            next = tail->getWakeupNext(std::memory_order_acquire);
+
+            // Guard: Check whether a producer has enqueued another task before the stub node
+            if (next == nullptr)
+            {
+                return nullptr;
+            }
+
+            this->tail = next;
+
+            return static_cast<Task*>(tail);
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @note This method can be invoked by any number of threads concurrently.
+        /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
+        ///
+        void ready(Task* task)
+        {
+            this->push(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note Tasks are served on a first-come, first-served basis regardless of their priority level,
+        ///       so the task keeps its current position in the queue.
+        ///
+        template <typename Priority>
+        void adjustPosition([[maybe_unused]] Task* task, [[maybe_unused]] const Priority& oldPriority) {}
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note This method follows the links from the oldest task, so it stops at a task that has not been linked by its producer yet,
+        ///       in which case tasks enqueued after that one are not visited.
+        /// @warning This method must be invoked by the consumer only, since it reads the end of the queue owned by the consumer.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor)
+        {
+            for (Link* node = this->tail; node != nullptr; node = node->getWakeupNext(std::memory_order_acquire))
+            {
+                // Guard: Skip the stub node
+                if (node != &this->stub)
+                {
+                    visitor(static_cast<Task*>(node));
+                }
+            }
         }
     };
 }
@@ -153,19 +535,54 @@ namespace Scheduler::Policies::FIFO::Virtual
         {
             this->queue.enqueue(task);
         }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method unlinks the task in constant time through its intrusive links.
+        ///
+        void remove(Task* task) override
+        {
+            this->queue.remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note Tasks are served on a first-come, first-served basis regardless of their priority level,
+        ///       so the task keeps its current position in the queue.
+        ///
+        template <typename Priority>
+        void adjustPosition([[maybe_unused]] Task* task, [[maybe_unused]] const Priority& oldPriority) {}
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            this->queue.forEach([&](Task* task) { visitor(task, context); });
+        }
     };
 
     ///
-    /// Implements the policy by maintaining a STL queue of schedulable tasks
+    /// Implements the policy by maintaining a STL double-ended queue of schedulable tasks
     ///
     /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @note Removing an arbitrary task takes linear time, since the task must be found and erased from the middle of the queue.
+    ///       Use `LinkedListImp` on hot paths that remove tasks, which unlinks a task in constant time.
     ///
     template <typename Task>
     struct StlQueueImp: public Scheduler::Policy<Task>
     {
     private:
         /// An internal FIFO queue
-        std::queue<Task*> queue;
+        std::deque<Task*> queue;
 
     public:
         /// Define the schedulable task type
@@ -186,7 +603,7 @@ namespace Scheduler::Policies::FIFO::Virtual
 
             Task* task = this->queue.front();
 
-            this->queue.pop();
+            this->queue.pop_front();
 
             return task;
         }
@@ -199,7 +616,48 @@ namespace Scheduler::Policies::FIFO::Virtual
         ///
         void ready(Task* task) override
         {
-            this->queue.push(task);
+            this->queue.push_back(task);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method locates the task by a linear search and closes the gap by shifting the tasks behind it,
+        ///       so it runs in linear time.
+        ///
+        void remove(Task* task) override
+        {
+            auto iterator = std::find(this->queue.begin(), this->queue.end(), task);
+
+            passert(iterator != this->queue.end(), "The task to be removed should reside in the ready queue.");
+
+            this->queue.erase(iterator);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note Tasks are served on a first-come, first-served basis regardless of their priority level,
+        ///       so the task keeps its current position in the queue.
+        ///
+        template <typename Priority>
+        void adjustPosition([[maybe_unused]] Task* task, [[maybe_unused]] const Priority& oldPriority) {}
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            for (Task* task : this->queue)
+            {
+                visitor(task, context);
+            }
         }
     };
 }
@@ -0,0 +1,384 @@
+//
+//  FairShare.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_FairShare_hpp
+#define Scheduler_FairShare_hpp
+
+#include <Scheduler/Policy/Policy.hpp>
+#include <Scheduler/Constraint/Prioritizable.hpp>
+#include <Scheduler/Constraint/TreeLinkable.hpp>
+#include <Scheduler/Constraint/WeightedRuntime.hpp>
+#include <Scheduler/Container/RedBlackTree.hpp>
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+
+/// Defines the components shared by fair-share scheduling policies
+namespace Scheduler::Policies::FairShare
+{
+    /// The weight of a task that runs at the default priority level
+    static constexpr uint32_t kNiceZeroWeight = 1024;
+
+    /// The amount of virtual runtime charged to a task of the default weight for each elapsed tick
+    static constexpr uint64_t kRuntimePerTick = 1024;
+
+    ///
+    /// Map a priority level to the weight of a nice level used by Linux
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @note Priority levels from 0 to 39 are mapped to nice levels from 19 to -20, and higher levels are clamped to 39.
+    ///       Priority level 19 corresponds to nice level 0 and has the weight of `kNiceZeroWeight`.
+    ///       Each priority level receives about 25% more processor time than the level below it.
+    ///
+    template <typename Task>
+    requires TaskConstraints::PrioritizableByPriority<Task> && std::integral<typename Task::Priority>
+    struct NiceLevelWeights
+    {
+        /// The weights of nice levels from -20 to 19
+        static constexpr std::array<uint32_t, 40> kWeights =
+        {
+            88761, 71755, 56483, 46273, 36291,
+            29154, 23254, 18705, 14949, 11916,
+             9548,  7620,  6100,  4904,  3906,
+             3121,  2501,  1991,  1586,  1277,
+             1024,   820,   655,   526,   423,
+              335,   272,   215,   172,   137,
+              110,    87,    70,    56,    45,
+               36,    29,    23,    18,    15,
+        };
+
+        uint32_t operator()(const typename Task::Priority& priority) const
+        {
+            auto level = static_cast<size_t>(std::clamp<typename Task::Priority>(priority, 0, kWeights.size() - 1));
+
+            return kWeights[kWeights.size() - 1 - level];
+        }
+    };
+
+    ///
+    /// Orders tasks by their virtual runtime
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    ///
+    template <typename Task>
+    requires TaskConstraints::WeightedRuntime<Task>
+    struct VirtualRuntimeComparator
+    {
+        bool operator()(const Task* lhs, const Task* rhs) const
+        {
+            return lhs->getVirtualRuntime() < rhs->getVirtualRuntime();
+        }
+    };
+}
+
+///
+/// Defines scheduling policies that share the processor among schedulable tasks in proportion to their weights
+///
+/// @note Each task accumulates a virtual runtime, which is the number of ticks it has run scaled inversely by its weight,
+///       and the task that has the smallest virtual runtime is dequeued first.
+///       The weight of a task is derived from its priority level, so a task of a higher priority level runs for more ticks
+///       before its virtual runtime catches up with others, while a task of a lower priority level is never starved.
+/// @note All structs do not define any virtual functions thus are suitable for schedulers that have a fixed policy.
+///
+namespace Scheduler::Policies::FairShare::Normal
+{
+    ///
+    /// Implements the policy by maintaining an intrusive red-black tree of schedulable tasks keyed by their virtual runtime
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam WeightSpecifier A callable type that maps a priority level to a weight, `NiceLevelWeights` by default
+    /// @tparam Granularity Specify the number of ticks by which the virtual runtime of the current task of the default weight
+    ///                     may exceed the smallest one in the ready queue before it is preempted, 1 by default
+    /// @note The tree caches its leftmost task, so this policy finds the next task in constant time,
+    ///       and enqueues, dequeues and removes a task in logarithmic time without allocating memory dynamically.
+    /// @note The policy tracks the smallest virtual runtime it has dequeued, which never decreases.
+    ///       A task whose virtual runtime falls behind, e.g. one that has been blocked for a while or has just been created,
+    ///       is moved forward to that runtime when it is enqueued,
+    ///       so it runs soon after it becomes ready but cannot monopolize the processor to make up for the time it was absent.
+    ///
+    template <typename Task, typename WeightSpecifier = NiceLevelWeights<Task>, uint64_t Granularity = 1>
+    requires TaskConstraints::TreeLinkable<Task> && TaskConstraints::WeightedRuntime<Task> &&
+             TaskConstraints::PrioritizableByPriority<Task> && Concepts::WeightSpecifier<WeightSpecifier, Task>
+    struct RedBlackTreeImp
+    {
+    private:
+        /// The type of the virtual runtime
+        using Runtime = typename Task::Runtime;
+
+        /// An internal tree that keeps the task with the smallest virtual runtime at the leftmost position
+        Containers::IntrusiveRedBlackTree<Task, VirtualRuntimeComparator<Task>> queue;
+
+        /// The smallest virtual runtime of tasks that have been dequeued
+        Runtime minimumRuntime = 0;
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next()
+        {
+            // Guard: Check whether the queue is empty
+            if (this->queue.isEmpty())
+            {
+                return nullptr;
+            }
+
+            Task* task = this->queue.pop();
+
+            this->minimumRuntime = std::max(this->minimumRuntime, task->getVirtualRuntime());
+
+            return task;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
+        ///
+        void ready(Task* task)
+        {
+            task->setVirtualRuntime(std::max(task->getVirtualRuntime(), this->minimumRuntime));
+
+            this->queue.insert(task);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method unlinks the task through the links stored in the task in logarithmic time.
+        ///
+        void remove(Task* task)
+        {
+            this->queue.remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note Tasks are ordered by their virtual runtime, which does not depend on the priority level,
+        ///       so this method does nothing. The new weight takes effect the next time the task is charged.
+        ///
+        template <typename Priority>
+        void adjustPosition([[maybe_unused]] Task* task, [[maybe_unused]] const Priority& oldPriority) {}
+
+        ///
+        /// Charge the given number of elapsed ticks to the virtual runtime of the given task
+        ///
+        /// @param task A non-null task that has been running
+        /// @param ticks The number of ticks that have elapsed since the task was last charged
+        /// @warning The given task must not reside in the ready queue.
+        ///
+        void charge(Task* task, uint64_t ticks)
+        {
+            uint64_t weight = WeightSpecifier{}(task->getPriority());
+
+            task->setVirtualRuntime(task->getVirtualRuntime() + static_cast<Runtime>(ticks * kRuntimePerTick * kNiceZeroWeight / weight));
+        }
+
+        ///
+        /// Check whether the given running task should yield the processor to the task that has the smallest virtual runtime
+        ///
+        /// @param current The non-null current running task
+        /// @return `true` if the virtual runtime of the current task exceeds the smallest one in the ready queue by more than the granularity,
+        ///         `false` if the ready queue is empty or the current task should keep running.
+        ///
+        [[nodiscard]]
+        bool shouldPreempt(const Task* current) const
+        {
+            const Task* fairest = this->queue.first();
+
+            return fairest != nullptr && current->getVirtualRuntime() > fairest->getVirtualRuntime() + Granularity * kRuntimePerTick;
+        }
+
+        ///
+        /// Get the smallest virtual runtime of tasks that have been dequeued
+        ///
+        /// @return The virtual runtime assigned to a task that falls behind when it is enqueued.
+        ///
+        [[nodiscard]]
+        Runtime getMinimumRuntime() const
+        {
+            return this->minimumRuntime;
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Unlike draining the queue, visiting tasks leaves the smallest virtual runtime unchanged.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) const
+        {
+            this->queue.forEach(visitor);
+        }
+    };
+}
+
+///
+/// Defines scheduling policies that share the processor among schedulable tasks in proportion to their weights
+///
+/// @note Each task accumulates a virtual runtime, which is the number of ticks it has run scaled inversely by its weight,
+///       and the task that has the smallest virtual runtime is dequeued first.
+///       The weight of a task is derived from its priority level, so a task of a higher priority level runs for more ticks
+///       before its virtual runtime catches up with others, while a task of a lower priority level is never starved.
+/// @note All structs implement the interface `SchedulingPolicy` thus their instances can be treated as opaque policies.
+///
+namespace Scheduler::Policies::FairShare::Virtual
+{
+    ///
+    /// Implements the policy by maintaining an intrusive red-black tree of schedulable tasks keyed by their virtual runtime
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam WeightSpecifier A callable type that maps a priority level to a weight, `NiceLevelWeights` by default
+    /// @tparam Granularity Specify the number of ticks by which the virtual runtime of the current task of the default weight
+    ///                     may exceed the smallest one in the ready queue before it is preempted, 1 by default
+    /// @note The tree caches its leftmost task, so this policy finds the next task in constant time,
+    ///       and enqueues, dequeues and removes a task in logarithmic time without allocating memory dynamically.
+    /// @note The policy tracks the smallest virtual runtime it has dequeued, which never decreases.
+    ///       A task whose virtual runtime falls behind, e.g. one that has been blocked for a while or has just been created,
+    ///       is moved forward to that runtime when it is enqueued,
+    ///       so it runs soon after it becomes ready but cannot monopolize the processor to make up for the time it was absent.
+    ///
+    template <typename Task, typename WeightSpecifier = NiceLevelWeights<Task>, uint64_t Granularity = 1>
+    requires TaskConstraints::TreeLinkable<Task> && TaskConstraints::WeightedRuntime<Task> &&
+             TaskConstraints::PrioritizableByPriority<Task> && Concepts::WeightSpecifier<WeightSpecifier, Task>
+    struct RedBlackTreeImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// The type of the virtual runtime
+        using Runtime = typename Task::Runtime;
+
+        /// An internal tree that keeps the task with the smallest virtual runtime at the leftmost position
+        Containers::IntrusiveRedBlackTree<Task, VirtualRuntimeComparator<Task>> queue;
+
+        /// The smallest virtual runtime of tasks that have been dequeued
+        Runtime minimumRuntime = 0;
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            // Guard: Check whether the queue is empty
+            if (this->queue.isEmpty())
+            {
+                return nullptr;
+            }
+
+            Task* task = this->queue.pop();
+
+            this->minimumRuntime = std::max(this->minimumRuntime, task->getVirtualRuntime());
+
+            return task;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
+        ///
+        void ready(Task* task) override
+        {
+            task->setVirtualRuntime(std::max(task->getVirtualRuntime(), this->minimumRuntime));
+
+            this->queue.insert(task);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method unlinks the task through the links stored in the task in logarithmic time.
+        ///
+        void remove(Task* task) override
+        {
+            this->queue.remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note Tasks are ordered by their virtual runtime, which does not depend on the priority level,
+        ///       so this method does nothing. The new weight takes effect the next time the task is charged.
+        ///
+        void adjustPosition([[maybe_unused]] Task* task, [[maybe_unused]] const typename Task::Priority& oldPriority) {}
+
+        ///
+        /// Charge the given number of elapsed ticks to the virtual runtime of the given task
+        ///
+        /// @param task A non-null task that has been running
+        /// @param ticks The number of ticks that have elapsed since the task was last charged
+        /// @warning The given task must not reside in the ready queue.
+        ///
+        void charge(Task* task, uint64_t ticks)
+        {
+            uint64_t weight = WeightSpecifier{}(task->getPriority());
+
+            task->setVirtualRuntime(task->getVirtualRuntime() + static_cast<Runtime>(ticks * kRuntimePerTick * kNiceZeroWeight / weight));
+        }
+
+        ///
+        /// Check whether the given running task should yield the processor to the task that has the smallest virtual runtime
+        ///
+        /// @param current The non-null current running task
+        /// @return `true` if the virtual runtime of the current task exceeds the smallest one in the ready queue by more than the granularity,
+        ///         `false` if the ready queue is empty or the current task should keep running.
+        ///
+        [[nodiscard]]
+        bool shouldPreempt(const Task* current) const
+        {
+            const Task* fairest = this->queue.first();
+
+            return fairest != nullptr && current->getVirtualRuntime() > fairest->getVirtualRuntime() + Granularity * kRuntimePerTick;
+        }
+
+        ///
+        /// Get the smallest virtual runtime of tasks that have been dequeued
+        ///
+        /// @return The virtual runtime assigned to a task that falls behind when it is enqueued.
+        ///
+        [[nodiscard]]
+        Runtime getMinimumRuntime() const
+        {
+            return this->minimumRuntime;
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note Unlike draining the queue, visiting tasks leaves the smallest virtual runtime unchanged.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            this->queue.forEach([&](Task* task) { visitor(task, context); });
+        }
+    };
+}
+
+#endif /* Scheduler_FairShare_hpp */
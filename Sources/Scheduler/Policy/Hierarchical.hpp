@@ -0,0 +1,746 @@
+//
+//  Hierarchical.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_Hierarchical_hpp
+#define Scheduler_Hierarchical_hpp
+
+#include <Scheduler/Policy/Policy.hpp>
+#include <Scheduler/Policy/FairShare.hpp>
+#include <Scheduler/Constraint/Groupable.hpp>
+#include <Scheduler/Constraint/TreeLinkable.hpp>
+#include <Scheduler/Constraint/WeightedRuntime.hpp>
+#include <LinkedList.hpp>
+#include <Debug.hpp>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+/// Forward declaration of the component that manages a hierarchy of scheduling groups
+namespace Scheduler::Policies::Hierarchical
+{
+    template <typename Task, typename RootPolicy, uint64_t Slice, uint64_t Period>
+    struct GroupTree;
+}
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    ///
+    /// A group of tasks or child groups that is scheduled as a single entity by the policy of its parent group
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @note A leaf group owns an opaque policy of tasks, while an inner group owns an opaque policy of child groups,
+    ///       so each level of the hierarchy can use a policy of any kind, e.g. a fair-share policy to divide the processor among tenants
+    ///       and a FIFO policy to serve the tasks of each tenant.
+    /// @note A group can be enqueued into a list-based policy, a tree-based policy or a fair-share policy,
+    ///       where its priority level is interpreted as its weight.
+    /// @note A group that has a non-zero quota may run at most `quota` ticks in each period of the hierarchy,
+    ///       after which it is throttled together with all its descendants until the next period.
+    /// @warning The caller must not change the weight or the quota of a group while the group has ready tasks.
+    ///
+    template <typename Task>
+    class SchedulingGroup: public Listable<SchedulingGroup<Task>>, public Schedulable, public TreeLinkable<SchedulingGroup<Task>>, public WeightedRuntime
+    {
+    public:
+        /// The weight of a group is its priority level
+        using Priority = uint32_t;
+
+    private:
+        /// The parent group, `NULL` if this is the root group
+        SchedulingGroup* parent;
+
+        /// The policy of tasks if this is a leaf group, `NULL` otherwise
+        Policy<Task>* tasks;
+
+        /// The policy of child groups if this is an inner group, `NULL` otherwise
+        /// @note The policy is stored as an opaque pointer since `Policy<SchedulingGroup>` cannot be named before the group type is complete.
+        void* groups;
+
+        /// The child group selected by the policy of this group, which does not reside in the policy
+        SchedulingGroup* selected = nullptr;
+
+        /// The number of ready tasks in this group and all its descendants that are not throttled
+        size_t count = 0;
+
+        /// The share of this group relative to its siblings
+        uint32_t weight;
+
+        /// The maximum number of ticks in each period, 0 if the group is not limited
+        uint64_t quota;
+
+        /// The number of ticks consumed in the period `usagePeriod`
+        uint64_t usage = 0;
+
+        /// The index of the period where the usage has been accounted
+        uint64_t usagePeriod = 0;
+
+        /// The number of ticks consumed since the group was last selected
+        uint64_t slice = 0;
+
+        /// `true` if the group has exhausted its quota in the current period
+        bool throttled = false;
+
+        ///
+        /// [Helper] Get the policy of child groups
+        ///
+        /// @return The policy of child groups, `NULL` if this is a leaf group.
+        ///
+        [[nodiscard]]
+        auto getGroupPolicy() const
+        {
+            return static_cast<Policy<SchedulingGroup>*>(this->groups);
+        }
+
+        template <typename, typename, uint64_t, uint64_t>
+        friend struct Policies::Hierarchical::GroupTree;
+
+    public:
+        ///
+        /// Create a root group
+        ///
+        /// @param groups A non-null policy of child groups
+        ///
+        template <typename GroupPolicy>
+        requires std::derived_from<GroupPolicy, Policy<SchedulingGroup>>
+        explicit SchedulingGroup(GroupPolicy* groups) :
+            Listable<SchedulingGroup>(), parent(nullptr), tasks(nullptr), groups(static_cast<Policy<SchedulingGroup>*>(groups)), weight(Policies::FairShare::kNiceZeroWeight), quota(0) {}
+
+        ///
+        /// Create a leaf group
+        ///
+        /// @param parent A non-null inner group
+        /// @param tasks A non-null policy of tasks
+        /// @param weight The share of this group relative to its siblings, the default fair-share weight by default
+        /// @param quota The maximum number of ticks in each period, 0 by default so that the group is not limited
+        ///
+        SchedulingGroup(SchedulingGroup* parent, Policy<Task>* tasks, uint32_t weight = Policies::FairShare::kNiceZeroWeight, uint64_t quota = 0) :
+            Listable<SchedulingGroup>(), parent(parent), tasks(tasks), groups(nullptr), weight(weight), quota(quota)
+        {
+            passert(parent != nullptr && !parent->isLeaf(), "Usage Error: A group must be the child of an inner group.");
+
+            passert(weight != 0, "Usage Error: The weight of a group must be non-zero.");
+        }
+
+        ///
+        /// Create an inner group
+        ///
+        /// @param parent A non-null inner group
+        /// @param groups A non-null policy of child groups
+        /// @param weight The share of this group relative to its siblings, the default fair-share weight by default
+        /// @param quota The maximum number of ticks in each period, 0 by default so that the group is not limited
+        ///
+        template <typename GroupPolicy>
+        requires std::derived_from<GroupPolicy, Policy<SchedulingGroup>>
+        SchedulingGroup(SchedulingGroup* parent, GroupPolicy* groups, uint32_t weight = Policies::FairShare::kNiceZeroWeight, uint64_t quota = 0) :
+            Listable<SchedulingGroup>(), parent(parent), tasks(nullptr), groups(static_cast<Policy<SchedulingGroup>*>(groups)), weight(weight), quota(quota)
+        {
+            passert(parent != nullptr && !parent->isLeaf(), "Usage Error: A group must be the child of an inner group.");
+
+            passert(weight != 0, "Usage Error: The weight of a group must be non-zero.");
+        }
+
+        ///
+        /// Get the weight of the group as its priority level
+        ///
+        /// @return The share of this group relative to its siblings.
+        ///
+        [[nodiscard]]
+        const uint32_t& getPriority() const
+        {
+            return this->weight;
+        }
+
+        ///
+        /// Set the weight of the group
+        ///
+        /// @param weight The new non-zero weight
+        ///
+        void setWeight(uint32_t weight)
+        {
+            this->weight = weight;
+        }
+
+        ///
+        /// Get the quota of the group
+        ///
+        /// @return The maximum number of ticks in each period, 0 if the group is not limited.
+        ///
+        [[nodiscard]]
+        uint64_t getQuota() const
+        {
+            return this->quota;
+        }
+
+        ///
+        /// Set the quota of the group
+        ///
+        /// @param quota The maximum number of ticks in each period, 0 if the group is not limited
+        ///
+        void setQuota(uint64_t quota)
+        {
+            this->quota = quota;
+        }
+
+        ///
+        /// Get the parent group
+        ///
+        /// @return The parent group, `NULL` if this is the root group.
+        ///
+        [[nodiscard]]
+        SchedulingGroup* getParent() const
+        {
+            return this->parent;
+        }
+
+        ///
+        /// Check whether the group is a leaf group
+        ///
+        /// @return `true` if the group owns a policy of tasks, `false` if it owns a policy of child groups.
+        ///
+        [[nodiscard]]
+        bool isLeaf() const
+        {
+            return this->tasks != nullptr;
+        }
+
+        ///
+        /// Check whether the group has been throttled
+        ///
+        /// @return `true` if the group has exhausted its quota in the current period, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool isThrottled() const
+        {
+            return this->throttled;
+        }
+
+        ///
+        /// Get the number of ready tasks that can be selected from the group
+        ///
+        /// @return The number of ready tasks in this group and all its descendants that are not throttled.
+        ///
+        [[nodiscard]]
+        size_t getNumberOfReadyTasks() const
+        {
+            return this->count;
+        }
+    };
+}
+
+/// Defines the components shared by hierarchical scheduling policies
+namespace Scheduler::Policies::Hierarchical
+{
+    ///
+    /// Use the priority level of a group as its weight in a fair-share policy of groups
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @note Useful as the weight specifier of `FairShare::Virtual::RedBlackTreeImp<SchedulingGroup<Task>>`.
+    ///
+    template <typename Task>
+    struct PriorityAsWeight
+    {
+        uint32_t operator()(const uint32_t& priority) const
+        {
+            return priority;
+        }
+    };
+
+    ///
+    /// Manages a hierarchy of scheduling groups rooted at a group that owns the given policy
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam RootPolicy Specify the opaque policy of the top-level groups owned by the root group
+    /// @tparam Slice Specify the number of ticks a selected group runs before its parent selects a group again
+    /// @tparam Period Specify the number of ticks in each quota period
+    /// @note Each inner group caches the child group selected by its policy, and the hierarchy caches the leaf group at the end of the selected path,
+    ///       so dequeuing a task does not consult the policy of any inner group until a group on the path runs out of ready tasks,
+    ///       ends its slice or gets throttled. Enqueuing and dequeuing a task update the number of ready tasks of each ancestor.
+    /// @note A selected group is charged the ticks consumed by its tasks and is put back into the policy of its parent once it ends its slice,
+    ///       so a fair-share parent divides the processor among its children in proportion to their weights,
+    ///       while a FIFO parent serves its children in a round-robin fashion.
+    /// @note Throttled groups are kept in a list and brought back at the first timer interrupt of the next period.
+    /// @note Use `Normal::GroupTreeImp` or `Virtual::GroupTreeImp` as the policy component of a scheduler.
+    ///
+    template <typename Task, typename RootPolicy, uint64_t Slice, uint64_t Period>
+    struct GroupTree
+    {
+    private:
+        /// Type of a scheduling group
+        using Group = SchedulingGroup<Task>;
+
+        /// The policy of the top-level groups
+        RootPolicy rootPolicy;
+
+        /// The root group
+        Group root;
+
+        /// The leaf group at the end of the selected path, `NULL` if the path must be selected again
+        Group* cached = nullptr;
+
+        /// Groups that have exhausted their quotas in the current period
+        LinkedList<Group> throttled;
+
+        /// The number of ticks that have elapsed since the scheduler started
+        uint64_t clock = 0;
+
+        ///
+        /// [Helper] Make the given group selectable by its parent
+        ///
+        /// @param group A non-null group that is neither the root group nor throttled and has ready tasks
+        ///
+        void activate(Group* group)
+        {
+            group->parent->getGroupPolicy()->ready(group);
+        }
+
+        ///
+        /// [Helper] Make the given group no longer selectable by its parent
+        ///
+        /// @param group A non-null group that is selectable by its parent
+        ///
+        void deactivate(Group* group)
+        {
+            Group* parent = group->parent;
+
+            // Guard: Check whether the group is the one selected by its parent
+            if (parent->selected == group)
+            {
+                parent->selected = nullptr;
+
+                this->cached = nullptr;
+            }
+            else
+            {
+                parent->getGroupPolicy()->remove(group);
+            }
+        }
+
+        ///
+        /// [Helper] Update the number of ready tasks of the given group and its ancestors
+        ///
+        /// @param group A non-null group
+        /// @param delta The change to the number of ready tasks
+        /// @note A group that starts to have ready tasks is made selectable by its parent, while one that no longer has any is withdrawn.
+        ///       The update stops at the first throttled group, which does not contribute to its ancestors.
+        ///
+        void propagate(Group* group, ptrdiff_t delta)
+        {
+            for (Group* node = group; ; node = node->parent)
+            {
+                size_t previous = node->count;
+
+                node->count += delta;
+
+                // Guard: The root group and throttled groups do not contribute to any parent
+                if (node->parent == nullptr || node->throttled)
+                {
+                    return;
+                }
+
+                if (previous == 0)
+                {
+                    this->activate(node);
+                }
+                else if (node->count == 0)
+                {
+                    this->deactivate(node);
+                }
+            }
+        }
+
+        ///
+        /// [Helper] Throttle the given group until the next period
+        ///
+        /// @param group A non-null group that has exhausted its quota
+        ///
+        void throttle(Group* group)
+        {
+            // Withdraw the group from its parent before its link is reused by the list of throttled groups
+            if (group->count != 0)
+            {
+                this->deactivate(group);
+
+                this->propagate(group->parent, -static_cast<ptrdiff_t>(group->count));
+            }
+
+            group->throttled = true;
+
+            this->throttled.enqueue(group);
+        }
+
+        ///
+        /// [Helper] Select the path from the root group to a leaf group that has ready tasks
+        ///
+        /// @return The non-null leaf group at the end of the path.
+        /// @note Only inner groups that do not have a selected child consult their policies.
+        ///
+        Group* select()
+        {
+            Group* group = &this->root;
+
+            while (!group->isLeaf())
+            {
+                if (group->selected == nullptr)
+                {
+                    group->selected = group->getGroupPolicy()->next();
+                }
+
+                group = group->selected;
+            }
+
+            return group;
+        }
+
+        ///
+        /// [Helper] Visit every ready task in the given group and its descendants that are not throttled
+        ///
+        /// @param group A non-null group
+        /// @param visitor A callable object that takes each task in turn
+        /// @note The child selected by an inner group is visited first, followed by the children in the order they reside in its policy.
+        ///
+        template <typename Visitor>
+        void forEachInGroup(Group* group, Visitor& visitor)
+        {
+            // Guard: A leaf group owns the tasks
+            if (group->isLeaf())
+            {
+                group->tasks->forEach(visitor);
+
+                return;
+            }
+
+            if (group->selected != nullptr)
+            {
+                this->forEachInGroup(group->selected, visitor);
+            }
+
+            group->getGroupPolicy()->forEach([&](Group* child) { this->forEachInGroup(child, visitor); });
+        }
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Create an empty hierarchy
+        ///
+        GroupTree() : root(&rootPolicy) {}
+
+        /// The root group refers to the policy of this instance
+        GroupTree(const GroupTree&) = delete;
+
+        /// The root group refers to the policy of this instance
+        GroupTree& operator=(const GroupTree&) = delete;
+
+        ///
+        /// Get the root group
+        ///
+        /// @return The non-null root group, which top-level groups specify as their parent.
+        ///
+        Group* getRootGroup()
+        {
+            return &this->root;
+        }
+
+        ///
+        /// Get the current time of the hierarchy
+        ///
+        /// @return The number of ticks that have elapsed since the scheduler started.
+        ///
+        [[nodiscard]]
+        uint64_t getCurrentTime() const
+        {
+            return this->clock;
+        }
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next()
+        {
+            // Guard: Check whether any group has ready tasks
+            if (this->root.count == 0)
+            {
+                return nullptr;
+            }
+
+            // Guard: Select the path again only if it has been invalidated
+            if (this->cached == nullptr)
+            {
+                this->cached = this->select();
+            }
+
+            Group* group = this->cached;
+
+            Task* task = group->tasks->next();
+
+            this->propagate(group, -1);
+
+            return task;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task into its group
+        ///
+        /// @param task A non-null task that is ready to run and belongs to a leaf group
+        ///
+        void ready(Task* task)
+        {
+            Group* group = task->getGroup();
+
+            passert(group != nullptr && group->isLeaf(), "Usage Error: A task must belong to a leaf group.");
+
+            group->tasks->ready(task);
+
+            this->propagate(group, 1);
+        }
+
+        ///
+        /// Remove the given schedulable task from its group
+        ///
+        /// @param task A non-null task that resides in the ready queue of its group
+        ///
+        void remove(Task* task)
+        {
+            Group* group = task->getGroup();
+
+            group->tasks->remove(task);
+
+            this->propagate(group, -1);
+        }
+
+        ///
+        /// Advance the clock of the hierarchy and bring back throttled groups once a new period starts
+        ///
+        /// @param ticks The number of ticks that have elapsed since the clock was last advanced
+        ///
+        void advance(uint64_t ticks)
+        {
+            uint64_t previous = this->clock / Period;
+
+            this->clock += ticks;
+
+            // Guard: Check whether a new period has started
+            if (this->clock / Period == previous)
+            {
+                return;
+            }
+
+            while (!this->throttled.isEmpty())
+            {
+                Group* group = this->throttled.dequeue();
+
+                group->throttled = false;
+
+                group->usage = 0;
+
+                group->usagePeriod = this->clock / Period;
+
+                if (group->count != 0)
+                {
+                    this->activate(group);
+
+                    this->propagate(group->parent, static_cast<ptrdiff_t>(group->count));
+                }
+            }
+        }
+
+        ///
+        /// Charge the groups of the given task for the ticks it has run
+        ///
+        /// @param task The non-null current running task
+        /// @param ticks The number of ticks the task has run since it was last charged
+        /// @return `true` if a group of the task has ended its slice or has been throttled, so the task should be preempted, `false` otherwise.
+        /// @note The virtual runtime of each group is advanced in inverse proportion to its weight,
+        ///       and a group that ends its slice is put back into the policy of its parent,
+        ///       which selects a group again at the next dequeue.
+        ///
+        bool charge(Task* task, uint64_t ticks)
+        {
+            bool preempted = false;
+
+            uint64_t period = this->clock / Period;
+
+            for (Group* group = task->getGroup(); group->parent != nullptr; group = group->parent)
+            {
+                group->setVirtualRuntime(group->getVirtualRuntime() + ticks * FairShare::kRuntimePerTick * FairShare::kNiceZeroWeight / group->weight);
+
+                // Guard: Throttle the group once it exhausts its quota
+                if (group->quota != 0 && !group->throttled)
+                {
+                    if (group->usagePeriod != period)
+                    {
+                        group->usagePeriod = period;
+
+                        group->usage = 0;
+                    }
+
+                    group->usage += ticks;
+
+                    if (group->usage >= group->quota)
+                    {
+                        this->throttle(group);
+
+                        group->slice = 0;
+
+                        preempted = true;
+
+                        continue;
+                    }
+                }
+
+                group->slice += ticks;
+
+                // Guard: Keep the group selected until it ends its slice
+                if (group->slice < Slice)
+                {
+                    continue;
+                }
+
+                group->slice = 0;
+
+                preempted = true;
+
+                // Let the parent select a group again if this one still has ready tasks
+                if (group->parent->selected == group)
+                {
+                    group->parent->selected = nullptr;
+
+                    group->parent->getGroupPolicy()->ready(group);
+
+                    this->cached = nullptr;
+                }
+            }
+
+            return preempted;
+        }
+
+        ///
+        /// Visit every ready task in the hierarchy without changing any group
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Groups are visited in the order they currently reside in the policies of their parents, starting from the selected path,
+        ///       followed by the throttled groups in the order they have been throttled.
+        ///       The actual dequeue order also depends on how groups will be charged, so it may differ from the visiting order.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor)
+        {
+            this->forEachInGroup(&this->root, visitor);
+
+            this->throttled.forEach([&](Group* group) { this->forEachInGroup(group, visitor); });
+        }
+    };
+}
+
+///
+/// Defines scheduling policies that arrange schedulable tasks in a hierarchy of scheduling groups
+///
+/// @note All structs do not define any virtual functions thus are suitable for schedulers that have a fixed policy.
+///
+namespace Scheduler::Policies::Hierarchical::Normal
+{
+    ///
+    /// Implements the policy by maintaining a tree of scheduling groups, each of which owns an opaque policy
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam RootPolicy Specify the opaque policy of the top-level groups,
+    ///                    `FairShare::Virtual::RedBlackTreeImp` that divides the processor by group weights by default
+    /// @tparam Slice Specify the number of ticks a selected group runs before its parent selects a group again, 4 by default
+    /// @tparam Period Specify the number of ticks in each quota period, 100 by default
+    /// @seealso `GroupTree` for details on how the selection is cached.
+    ///
+    template <typename Task,
+              typename RootPolicy = FairShare::Virtual::RedBlackTreeImp<SchedulingGroup<Task>, PriorityAsWeight<Task>>,
+              uint64_t Slice = 4,
+              uint64_t Period = 100>
+    requires TaskConstraints::Groupable<Task> && std::derived_from<RootPolicy, Scheduler::Policy<SchedulingGroup<Task>>> && (Slice > 0) && (Period > 0)
+    struct GroupTreeImp: public GroupTree<Task, RootPolicy, Slice, Period> {};
+}
+
+///
+/// Defines scheduling policies that arrange schedulable tasks in a hierarchy of scheduling groups
+///
+/// @note All structs implement the interface `SchedulingPolicy` thus their instances can be treated as opaque policies.
+///
+namespace Scheduler::Policies::Hierarchical::Virtual
+{
+    ///
+    /// Implements the policy by maintaining a tree of scheduling groups, each of which owns an opaque policy
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam RootPolicy Specify the opaque policy of the top-level groups,
+    ///                    `FairShare::Virtual::RedBlackTreeImp` that divides the processor by group weights by default
+    /// @tparam Slice Specify the number of ticks a selected group runs before its parent selects a group again, 4 by default
+    /// @tparam Period Specify the number of ticks in each quota period, 100 by default
+    /// @seealso `GroupTree` for details on how the selection is cached.
+    ///
+    template <typename Task,
+              typename RootPolicy = FairShare::Virtual::RedBlackTreeImp<SchedulingGroup<Task>, PriorityAsWeight<Task>>,
+              uint64_t Slice = 4,
+              uint64_t Period = 100>
+    requires TaskConstraints::Groupable<Task> && std::derived_from<RootPolicy, Scheduler::Policy<SchedulingGroup<Task>>> && (Slice > 0) && (Period > 0)
+    struct GroupTreeImp: public Scheduler::Policy<Task>, public GroupTree<Task, RootPolicy, Slice, Period>
+    {
+    private:
+        /// The hierarchy that implements the scheduling primitives
+        using Tree = GroupTree<Task, RootPolicy, Slice, Period>;
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        /// Both bases provide the same visitor
+        using Tree::forEach;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            return Tree::next();
+        }
+
+        ///
+        /// Enqueue a ready schedulable task into its group
+        ///
+        /// @param task A non-null task that is ready to run and belongs to a leaf group
+        ///
+        void ready(Task* task) override
+        {
+            Tree::ready(task);
+        }
+
+        ///
+        /// Remove the given schedulable task from its group
+        ///
+        /// @param task A non-null task that resides in the ready queue of its group
+        ///
+        void remove(Task* task) override
+        {
+            Tree::remove(task);
+        }
+
+        ///
+        /// Visit every ready task in the hierarchy without changing any group
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @seealso `GroupTree::forEach()` for the order in which tasks are visited.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            Tree::forEach([&](Task* task) { visitor(task, context); });
+        }
+    };
+}
+
+#endif /* Scheduler_Hierarchical_hpp */
@@ -10,6 +10,9 @@
 #define Scheduler_Policy_hpp
 
 #include <Scheduler/Constraint/Schedulable.hpp>
+#include <memory>
+#include <span>
+#include <type_traits>
 
 /// The root namespace for the scheduler module where core components are defined
 namespace Scheduler
@@ -38,6 +41,38 @@ namespace Scheduler
         /// @param task A non-null task that is ready to run
         ///
         virtual void ready(Task* task) = 0;
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        virtual void remove(Task* task) = 0;
+
+        // MARK:- Inspection Primitives
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued without changing the queue
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note This is the type-erased hook behind `forEach()`, which takes any callable object instead.
+        ///
+        virtual void forEachTask(void (*visitor)(Task*, void*), void* context) = 0;
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued without changing the queue
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor)
+        {
+            using Callable = std::remove_reference_t<Visitor>;
+
+            this->forEachTask([](Task* task, void* context) { (*static_cast<Callable*>(context))(task); },
+                              const_cast<void*>(static_cast<const void*>(std::addressof(visitor))));
+        }
     };
 }
 
@@ -57,6 +92,55 @@ namespace Scheduler::Concepts
         /// Must provide the enqueue primitive
         { policy.ready(task) } -> std::same_as<void>;
     };
+
+    /// A scheduling policy component that can remove an arbitrary task from the ready queue
+    template <typename P>
+    concept RemovablePolicy = Policy<P> && requires(P& policy, typename P::SchedulableTask* task)
+    {
+        /// Must provide the removal primitive
+        { policy.remove(task) } -> std::same_as<void>;
+    };
+
+    /// A scheduling policy component that can reposition a task whose priority level has been changed
+    template <typename P, typename Priority = typename P::SchedulableTask::Priority>
+    concept AdjustablePolicy = Policy<P> && requires(P& policy, typename P::SchedulableTask* task, const Priority& oldPriority)
+    {
+        /// Must provide the primitive to reposition a task
+        { policy.adjustPosition(task, oldPriority) } -> std::same_as<void>;
+    };
+
+    /// A scheduling policy component that can enqueue a batch of ready tasks faster than enqueuing them one by one
+    template <typename P>
+    concept BatchReadyPolicy = Policy<P> && requires(P& policy, std::span<typename P::SchedulableTask* const> tasks)
+    {
+        /// Must provide the batch enqueue primitive
+        { policy.readyBatch(tasks) } -> std::same_as<void>;
+    };
+
+    /// A scheduling policy component that can remove a batch of tasks faster than removing them one by one
+    template <typename P>
+    concept BatchRemovablePolicy = RemovablePolicy<P> && requires(P& policy, std::span<typename P::SchedulableTask* const> tasks)
+    {
+        /// Must provide the batch removal primitive
+        { policy.removeBatch(tasks) } -> std::same_as<void>;
+    };
+
+    /// A scheduling policy component that can visit every task in its ready queue without changing the queue
+    template <typename P>
+    concept VisitablePolicy = Policy<P> && requires(P& policy, void (*visitor)(typename P::SchedulableTask*))
+    {
+        /// Must visit tasks in the order they would be dequeued, where ties in an unstable policy are visited in an unspecified order
+        { policy.forEach(visitor) } -> std::same_as<void>;
+    };
+
+    /// A scheduling policy component that guarantees a ready task on each dequeue,
+    /// e.g. one that keeps a background task in its ready queue all the time
+    template <typename P>
+    concept NonEmptyPolicy = Policy<P> && requires
+    {
+        /// Must declare `static constexpr bool kNeverEmpty = true`
+        requires P::kNeverEmpty;
+    };
 }
 
 #endif /* Scheduler_Policy_hpp */
@@ -10,9 +10,14 @@
 #ifndef Scheduler_PolicyExtension_hpp
 #define Scheduler_PolicyExtension_hpp
 
+#include <Scheduler/Policy/Policy.hpp>
 #include <Scheduler/Constraint/Prioritizable.hpp>
 #include <Scheduler/Constraint/Quantizable.hpp>
 #include <Scheduler/Constraint/QuantumSpecifier.hpp>
+#include <Debug.hpp>
+#include <array>
+#include <concepts>
+#include <cstddef>
 
 /// The root namespace for the scheduler module where core components are defined
 namespace Scheduler
@@ -36,8 +41,8 @@ namespace Scheduler
         ///
         /// Notify the delegate that a task has been dequeued
         ///
-        /// @param task The task returned by `next()`
-        /// @note This delegate function is called after `next()`.
+        /// @param task The non-null task returned by `next()`
+        /// @note This delegate function is called after `next()` and is not called if the ready queue is empty.
         ///
         virtual void taskHasDequeued(Task* task) = 0;
     };
@@ -70,7 +75,11 @@ namespace Scheduler
         {
             Task* task = super::next();
 
-            this->delegate->taskHasDequeued(task);
+            // Guard: The ready queue must not be empty
+            if (task != nullptr)
+            {
+                this->delegate->taskHasDequeued(task);
+            }
 
             return task;
         }
@@ -106,6 +115,40 @@ namespace Scheduler::Concepts
         /// The extension must implement the operator () that consumes a task to be enqueued or having been dequeued and returns void
         { Extension{}(task) } -> std::same_as<void>;
     };
+
+    /// A delegate that is notified before a task is enqueued
+    template <typename Delegate, typename Task>
+    concept ObservesEnqueue = requires(Delegate& delegate, Task* task)
+    {
+        ///
+        /// Notify the delegate that a task will be enqueued
+        ///
+        /// @param task The task passed to `ready()`
+        /// @note Signature: `void taskWillEnqueue(Task* task)`.
+        ///
+        { delegate.taskWillEnqueue(task) } -> std::same_as<void>;
+    };
+
+    /// A delegate that is notified after a task has been dequeued
+    template <typename Delegate, typename Task>
+    concept ObservesDequeue = requires(Delegate& delegate, Task* task)
+    {
+        ///
+        /// Notify the delegate that a task has been dequeued
+        ///
+        /// @param task The non-null task returned by `next()`
+        /// @note Signature: `void taskHasDequeued(Task* task)`.
+        ///
+        { delegate.taskHasDequeued(task) } -> std::same_as<void>;
+    };
+
+    ///
+    /// Defines the interface of a delegate that is called without virtual calls
+    ///
+    /// @note The delegate must implement at least one of the hooks, while the other one is optional.
+    ///
+    template <typename Delegate, typename Task>
+    concept StaticPolicyDelegate = std::default_initializable<Delegate> && (ObservesEnqueue<Delegate, Task> || ObservesDequeue<Delegate, Task>);
 }
 
 /// The root namespace for the scheduler module where core components are defined
@@ -135,7 +178,15 @@ namespace Scheduler
         }
     };
 
+    ///
     /// Defines the interface of a scheduling policy that supports installing code extensions for the `next()` primitives
+    ///
+    /// @note Code extensions are not run if `next()` finds the ready queue empty.
+    /// @note Installing `PriorityBasedTaskQuantumAllocator` here instead of in `PolicyWithEnqueueExtensions` allocates the quantum lazily,
+    ///       i.e. once when the task is dispatched rather than on every `ready()`,
+    ///       so tasks that are enqueued several times or change their priority level before they run are charged only once,
+    ///       and the quantum always matches the priority level at which the task runs.
+    ///
     template <typename BasePolicy, Concepts::PolicyCodeExtension<Traits::PolicyTask<BasePolicy>>... Extension>
     requires Concepts::Policy<BasePolicy>
     struct PolicyWithDequeueExtensions: public BasePolicy
@@ -154,6 +205,12 @@ namespace Scheduler
             // Dequeue the next task
             Task* task = BasePolicy::next();
 
+            // Guard: The ready queue must not be empty
+            if (task == nullptr)
+            {
+                return nullptr;
+            }
+
             // Run each code extension in order
             ((Extension{}(task)), ...);
 
@@ -163,9 +220,157 @@ namespace Scheduler
     };
 }
 
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    ///
+    /// Defines the interface of a scheduling policy that notifies a statically bound delegate when a task will be enqueued or has been dequeued
+    ///
+    /// @tparam BasePolicy Specify the policy that manages ready tasks
+    /// @tparam Delegate Specify the delegate that implements the hooks defined by `Concepts::ObservesEnqueue` and `Concepts::ObservesDequeue`
+    /// @note Unlike `PolicyWithDelegateSupport`, this policy works over any policy type and resolves all calls at compile time,
+    ///       so the hooks can be inlined into the scheduling primitives.
+    /// @note The delegate is stored in the policy and takes no space if it does not have any data member.
+    /// @note The delegate is not notified if `next()` finds the ready queue empty.
+    ///
+    template <typename BasePolicy, typename Delegate>
+    requires Concepts::Policy<BasePolicy> && Concepts::StaticPolicyDelegate<Delegate, Traits::PolicyTask<BasePolicy>>
+    struct PolicyWithStaticDelegate: public BasePolicy
+    {
+    public:
+        /// Type of the task managed by the policy component
+        using Task = Traits::PolicyTask<BasePolicy>;
+
+    private:
+        /// The delegate
+        [[no_unique_address]] Delegate delegate;
+
+    public:
+        ///
+        /// Get the delegate
+        ///
+        /// @return The delegate notified by this policy.
+        ///
+        Delegate& getDelegate()
+        {
+            return this->delegate;
+        }
+
+        // MARK:- Scheduling Primitives
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next()
+        {
+            Task* task = BasePolicy::next();
+
+            if constexpr (Concepts::ObservesDequeue<Delegate, Task>)
+            {
+                // Guard: The ready queue must not be empty
+                if (task != nullptr)
+                {
+                    this->delegate.taskHasDequeued(task);
+                }
+            }
+
+            return task;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task)
+        {
+            if constexpr (Concepts::ObservesEnqueue<Delegate, Task>)
+            {
+                this->delegate.taskWillEnqueue(task);
+            }
+
+            BasePolicy::ready(task);
+        }
+
+        ///
+        /// Enqueue the given ready schedulable tasks at once
+        ///
+        /// @param tasks A span of non-null tasks that are ready to run
+        /// @note The delegate is notified of each task in order before the tasks are enqueued.
+        ///
+        void readyBatch(std::span<Task* const> tasks) requires Concepts::BatchReadyPolicy<BasePolicy>
+        {
+            if constexpr (Concepts::ObservesEnqueue<Delegate, Task>)
+            {
+                for (Task* task : tasks)
+                {
+                    this->delegate.taskWillEnqueue(task);
+                }
+            }
+
+            BasePolicy::readyBatch(tasks);
+        }
+    };
+}
+
 /// Defines some common code injectors
 namespace Scheduler::Policies::Extensions
 {
+    ///
+    /// A quantum specifier that looks up the amount of time ticks of each priority level in a table precomputed at compile time
+    ///
+    /// @tparam Task Specify the type of the task
+    /// @tparam CustomQuantumSpecifier A callable type that maps a priority level to a certain amount of time ticks in a constant expression
+    /// @tparam MaxPriorityLevel Specify the largest priority level in the table
+    /// @tparam MinPriorityLevel Specify the smallest priority level in the table, e.g. `1` if level `0` is reserved for the idle task
+    /// @note This specifier can replace the custom one wherever a quantum specifier is expected,
+    ///       so that a quantum allocation becomes a single array load instead of a call to the custom specifier.
+    ///
+    template <typename Task, typename CustomQuantumSpecifier, size_t MaxPriorityLevel, size_t MinPriorityLevel = 0>
+    requires TaskConstraints::Quantizable<Task> &&
+             TaskConstraints::PrioritizableByPriority<Task> &&
+             Concepts::QuantumSpecifier<CustomQuantumSpecifier, Task> &&
+             std::unsigned_integral<Traits::TaskPriority<Task>> &&
+             (MinPriorityLevel <= MaxPriorityLevel)
+    struct TabulatedQuantumSpecifier
+    {
+    private:
+        /// The priority level type
+        using Priority = Traits::TaskPriority<Task>;
+
+        /// The time tick type
+        using Tick = typename Task::Tick;
+
+        /// The amount of time ticks of each priority level, starting from the smallest one
+        static constexpr std::array<Tick, MaxPriorityLevel - MinPriorityLevel + 1> kTable = []()
+        {
+            std::array<Tick, MaxPriorityLevel - MinPriorityLevel + 1> table = {};
+
+            for (size_t priority = MinPriorityLevel; priority <= MaxPriorityLevel; priority++)
+            {
+                table[priority - MinPriorityLevel] = CustomQuantumSpecifier{}(static_cast<Priority>(priority));
+            }
+
+            return table;
+        }();
+
+    public:
+        ///
+        /// Get the amount of time ticks of the given priority level
+        ///
+        /// @param priority A priority level in the range of `[MinPriorityLevel, MaxPriorityLevel]`
+        /// @return The amount of time ticks computed by the custom specifier at compile time.
+        ///
+        Tick operator()(const Priority& priority) const
+        {
+            passert(static_cast<size_t>(priority) - MinPriorityLevel < kTable.size(), "The priority level should reside in the table.");
+
+            return kTable[static_cast<size_t>(priority) - MinPriorityLevel];
+        }
+    };
+
     ///
     /// A code injector that allocates quantum for the given task based on the task priority level
     ///
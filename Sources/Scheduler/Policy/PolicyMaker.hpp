@@ -13,6 +13,7 @@
 #include <Scheduler/Constraint/Prioritizable.hpp>
 #include <Scheduler/Policy/FIFO.hpp>
 #include <Scheduler/Misc/Traits.hpp>
+#include <Scheduler/Container/StaticObjectPool.hpp>
 #include <concepts>
 
 /// Defines concepts related to scheduler components
@@ -36,6 +37,18 @@ namespace Scheduler::Concepts
         ///
         { Maker::destroy(policy) } -> std::same_as<void>;
     };
+
+    /// A policy maker that requests multi-queue policies to create the policy of every priority level at construction
+    template <typename Maker>
+    concept EagerPolicyMaker = requires
+    {
+        ///
+        /// The policy maker must define a static constant `eagerInitialization` that is set to `true`
+        ///
+        /// @note Signature: `static constexpr bool eagerInitialization = true`.
+        ///
+        requires Maker::eagerInitialization;
+    };
 }
 
 /// Defines some common policy makers as an example
@@ -74,6 +87,58 @@ namespace Scheduler::PolicyMakers
             delete policy;
         }
     };
+
+    ///
+    /// A policy maker that maps each priority level to a FIFO scheduling policy allocated from a static pool
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam Capacity Specify the maximum number of policies that can be created at the same time
+    /// @tparam EagerInitialization Specify `true` to let multi-queue policies create the policy of every priority level at construction,
+    ///                             so that the first task enqueued at a level does not pay for creating its policy
+    /// @note The pool lives in static storage and is shared by all multi-queue policies that use the same policy maker type,
+    ///       so the capacity should cover the total number of priority levels of those policies.
+    /// @note This policy maker never allocates memory dynamically and is suitable for environments that do not have an allocator.
+    /// @warning The pool is not thread-safe, so policies that use the same policy maker type must be created and destroyed on a single core.
+    ///
+    template <typename Task, size_t Capacity, bool EagerInitialization = false>
+    requires TaskConstraints::PrioritizableByPriority<Task>
+    struct StaticFIFO
+    {
+        /// Type of the task priority
+        using Priority = Scheduler::Traits::TaskPriority<Task>;
+
+        /// Type of the policy created by this policy maker
+        using Policy = Scheduler::Policies::FIFO::Virtual::LinkedListImp<Task>;
+
+        /// Whether multi-queue policies should create the policy of every priority level at construction
+        static constexpr bool eagerInitialization = EagerInitialization;
+
+    private:
+        /// The pool where policies are created
+        static inline Scheduler::Containers::StaticObjectPool<Policy, Capacity> pool;
+
+    public:
+        ///
+        /// Maps the given priority level to a specific scheduling policies
+        ///
+        /// @param priority The task priority
+        /// @return A non-null scheduling policy.
+        ///
+        static Scheduler::Policy<Task>* create([[maybe_unused]] const Priority& priority)
+        {
+            return pool.construct();
+        }
+
+        ///
+        /// Releases the given policy properly
+        ///
+        /// @param policy A non-null scheduling policy instance returned by `create()`
+        ///
+        static void destroy(Scheduler::Policy<Task>* policy)
+        {
+            pool.destroy(static_cast<Policy*>(policy));
+        }
+    };
 }
 
 #endif /* Scheduler_PolicyMaker_hpp */
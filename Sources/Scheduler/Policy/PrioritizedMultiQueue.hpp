@@ -12,10 +12,17 @@
 
 #include <Scheduler/Policy/Policy.hpp>
 #include <Scheduler/Policy/PolicyMaker.hpp>
+#include <Scheduler/Policy/PolicyExtension.hpp>
+#include <Scheduler/Constraint/Boostable.hpp>
+#include <Scheduler/Container/PriorityBitmap.hpp>
+#include <Scheduler/Container/FlatLevelMap.hpp>
 #include <Hashable.hpp>
 #include <Debug.hpp>
 #include <array>
 #include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 ///
 /// Defines scheduling policies that prioritizes schedulable tasks in multiple queues
@@ -56,6 +63,22 @@ namespace Scheduler::Policies::PrioritizedMultiQueue::Normal
         /// Define the schedulable task type
         using SchedulableTask = Task;
 
+        ///
+        /// Create the policy of every priority level if the policy maker requests eager initialization
+        ///
+        /// @note Otherwise, the policy of a priority level is created when the first task at that level is enqueued.
+        ///
+        ArrayMapImp()
+        {
+            if constexpr (Concepts::EagerPolicyMaker<PolicyMaker>)
+            {
+                for (size_t priority = 0; priority <= MaxPriorityLevel; priority++)
+                {
+                    this->queues[priority] = PolicyMaker::create(static_cast<Priority>(priority));
+                }
+            }
+        }
+
         /// Default Destructor
         ~ArrayMapImp()
         {
@@ -117,6 +140,57 @@ namespace Scheduler::Policies::PrioritizedMultiQueue::Normal
 
             this->queues[priority]->ready(task);
         }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task)
+        {
+            Scheduler::Policy<Task>* queue = this->queues[task->getPriority()];
+
+            passert(queue != nullptr, "Scheduler for priority level should be non-null.");
+
+            queue->remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority)
+        {
+            Scheduler::Policy<Task>* queue = this->queues[oldPriority];
+
+            passert(queue != nullptr, "Scheduler for priority level should be non-null.");
+
+            queue->remove(task);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor)
+        {
+            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
+            {
+                // Guard: Ensure that the current priority level exists
+                if (*iterator != nullptr)
+                {
+                    (*iterator)->forEach(visitor);
+                }
+            }
+        }
     };
 
     ///
@@ -153,7 +227,7 @@ namespace Scheduler::Policies::PrioritizedMultiQueue::Normal
         {
             for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
             {
-                typename PolicyMaker::destroy(iterator->second);
+                PolicyMaker::destroy(iterator->second);
             }
         }
 
@@ -199,6 +273,53 @@ namespace Scheduler::Policies::PrioritizedMultiQueue::Normal
 
             this->queues[priority]->ready(task);
         }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task)
+        {
+            auto iterator = this->queues.find(task->getPriority());
+
+            passert(iterator != this->queues.end(), "Scheduler for priority level should be non-null.");
+
+            iterator->second->remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority)
+        {
+            auto iterator = this->queues.find(oldPriority);
+
+            passert(iterator != this->queues.end(), "Scheduler for priority level should be non-null.");
+
+            iterator->second->remove(task);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor)
+        {
+            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
+            {
+                iterator->second->forEach(visitor);
+            }
+        }
     };
 
     ///
@@ -258,6 +379,45 @@ namespace Scheduler::Policies::PrioritizedMultiQueue::Normal
         {
             this->queues[task->getPriority()].ready(task);
         }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) requires Concepts::RemovablePolicy<Policy>
+        {
+            this->queues[task->getPriority()].remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority) requires Concepts::RemovablePolicy<Policy>
+        {
+            this->queues[oldPriority].remove(task);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) requires Concepts::VisitablePolicy<Policy>
+        {
+            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
+            {
+                iterator->forEach(visitor);
+            }
+        }
     };
 
     ///
@@ -313,24 +473,65 @@ namespace Scheduler::Policies::PrioritizedMultiQueue::Normal
         {
             this->queues[task->getPriority()].ready(task);
         }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) requires Concepts::RemovablePolicy<Policy>
+        {
+            auto iterator = this->queues.find(task->getPriority());
+
+            passert(iterator != this->queues.end(), "Scheduler for priority level should exist.");
+
+            iterator->second.remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority) requires Concepts::RemovablePolicy<Policy>
+        {
+            auto iterator = this->queues.find(oldPriority);
+
+            passert(iterator != this->queues.end(), "Scheduler for priority level should exist.");
+
+            iterator->second.remove(task);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) requires Concepts::VisitablePolicy<Policy>
+        {
+            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
+            {
+                iterator->second.forEach(visitor);
+            }
+        }
     };
-}
 
-///
-/// Defines scheduling policies that prioritizes schedulable tasks in multiple queues
-///
-/// @note All structs implement the interface `SchedulingPolicy` thus their instances can be treated as opaque policies.
-///
-namespace Scheduler::Policies::PrioritizedMultiQueue::Virtual
-{
     ///
-    /// Implements the policy using a static array to map each priority level to a queue
+    /// Implements the policy using a static array to map each priority level to a queue and a bitmap to locate the highest non-empty level
     ///
     /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
     /// @tparam PolicyMaker A callable type that maps a priority level to a scheduling policy
     /// @tparam MaxPriorityLevel Defines the value of the largest priority level
     /// @note The length of the array map will be `max + 1`, so it is recommended to define a contiguous sequence of priority levels.
     /// @note The priority level must be convertible to an unsigned integer.
+    /// @note Unlike `ArrayMapImp`, this policy finds the highest non-empty priority level in constant time regardless of `MaxPriorityLevel`,
+    ///       at the cost of keeping one occupancy bit and one task counter per priority level in sync on every `ready()` and `next()`.
     /// @note The policy maker is called once for each priority level,
     ///       and the returned policy instance should be unique for each level.
     ///       The memory of returned policy instance is managed by this class.
@@ -341,7 +542,7 @@ namespace Scheduler::Policies::PrioritizedMultiQueue::Virtual
     requires TaskConstraints::PrioritizableByPriority<Task> &&
              Concepts::PolicyMaker<PolicyMaker, Task> &&
              std::unsigned_integral<Traits::TaskPriority<Task>>
-    struct ArrayMapImp: public Scheduler::Policy<Task>
+    struct BitmapArrayMapImp
     {
     private:
         /// The priority level type
@@ -351,12 +552,52 @@ namespace Scheduler::Policies::PrioritizedMultiQueue::Virtual
         /// Non-existent priority levels are mapped to null pointers
         std::array<Scheduler::Policy<Task>*, MaxPriorityLevel + 1> queues = {};
 
+        /// The number of ready tasks at each priority level
+        std::array<size_t, MaxPriorityLevel + 1> counts = {};
+
+        /// A bitmap where each bit indicates whether the corresponding priority level has any ready task
+        Containers::PriorityBitmap<MaxPriorityLevel + 1> bitmap;
+
+        ///
+        /// [Helper] Remove the given task from the queue of the given priority level
+        ///
+        /// @param task A non-null task that resides in the queue of the given priority level
+        /// @param priority The priority level at which the task was enqueued
+        ///
+        void removeFromLevel(Task* task, const Priority& priority)
+        {
+            passert(this->queues[priority] != nullptr && this->counts[priority] != 0, "The task should reside in the queue of the given priority level.");
+
+            this->queues[priority]->remove(task);
+
+            // Guard: Check whether the priority level has been drained
+            if (--this->counts[priority] == 0)
+            {
+                this->bitmap.clear(priority);
+            }
+        }
     public:
         /// Define the schedulable task type
         using SchedulableTask = Task;
 
+        ///
+        /// Create the policy of every priority level if the policy maker requests eager initialization
+        ///
+        /// @note Otherwise, the policy of a priority level is created when the first task at that level is enqueued.
+        ///
+        BitmapArrayMapImp()
+        {
+            if constexpr (Concepts::EagerPolicyMaker<PolicyMaker>)
+            {
+                for (size_t priority = 0; priority <= MaxPriorityLevel; priority++)
+                {
+                    this->queues[priority] = PolicyMaker::create(static_cast<Priority>(priority));
+                }
+            }
+        }
+
         /// Default Destructor
-        ~ArrayMapImp()
+        ~BitmapArrayMapImp()
         {
             for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
             {
@@ -372,28 +613,28 @@ namespace Scheduler::Policies::PrioritizedMultiQueue::Virtual
         ///
         /// @returns A task that is ready to run, `NULL` if no task is ready.
         ///
-        Task* next() override
+        Task* next()
         {
-            // From the highest priority level to the lowest
-            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
+            // Guard: Check whether any priority level has a pending task
+            if (this->bitmap.isEmpty())
             {
-                // Guard: Ensure that the current priority level exists
-                if (*iterator == nullptr)
-                {
-                    continue;
-                }
+                return nullptr;
+            }
 
-                // Guard: Check whether a higher priority task is pending
-                Task* next = (*iterator)->next();
+            // Dequeue from the highest non-empty priority level
+            size_t priority = this->bitmap.highest();
 
-                if (next != nullptr)
-                {
-                    return next;
-                }
+            Task* next = this->queues[priority]->next();
+
+            passert(next != nullptr, "The highest non-empty priority level should have a pending task.");
+
+            // Guard: Check whether the priority level has been drained
+            if (--this->counts[priority] == 0)
+            {
+                this->bitmap.clear(priority);
             }
 
-            // No pending task
-            return nullptr;
+            return next;
         }
 
         ///
@@ -401,7 +642,7 @@ namespace Scheduler::Policies::PrioritizedMultiQueue::Virtual
         ///
         /// @param task A non-null task that is ready to run
         ///
-        void ready(Task* task) override
+        void ready(Task* task)
         {
             const Priority& priority = task->getPriority();
 
@@ -415,138 +656,2268 @@ namespace Scheduler::Policies::PrioritizedMultiQueue::Virtual
             passert(this->queues[priority] != nullptr, "Scheduler for priority level should be non-null.");
 
             this->queues[priority]->ready(task);
-        }
-    };
-
-    ///
-    /// Implements the policy using an array to map each priority level to a queue
-    ///
-    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
-    /// @tparam PolicyMaker A callable type that maps a priority level to a scheduling policy
-    /// @note The priority level must be hashable.
-    /// @note The policy maker is called once for each priority level,
-    ///       and the returned policy instance should be unique for each level.
-    ///       The memory of returned policy instance is managed by this class.
-    ///       The policy maker must provide a deleter to avoid any memory leaks.
-    /// @seealso `SchedulingPolicyMakers` to see predefined policy makers.
-    ///
-    template <typename Task, typename PolicyMaker>
-    requires TaskConstraints::PrioritizableByPriority<Task> &&
-             Concepts::PolicyMaker<PolicyMaker, Task> &&
-             Hashable<Traits::TaskPriority<Task>>
-    struct StlMapImp: public Scheduler::Policy<Task>
-    {
-    private:
-        /// The priority level type
-        using Priority = Traits::TaskPriority<Task>;
 
-        /// A private map that maps priority levels to their scheduling policies
-        std::map<Priority, Scheduler::Policy<Task>*, std::greater<Priority>> queues;
+            this->counts[priority] += 1;
 
-    public:
-        /// Define the schedulable task type
-        using SchedulableTask = Task;
+            this->bitmap.set(priority);
+        }
 
-        /// Default Destructor
-        ~StlMapImp()
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task)
         {
-            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
-            {
-                PolicyMaker::destroy(iterator->second);
-            }
+            this->removeFromLevel(task, task->getPriority());
         }
 
         ///
-        /// Dequeue the next ready schedulable task
+        /// Adjust the position of the given task in the ready queue
         ///
-        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
         ///
-        Task* next() override
+        void adjustPosition(Task* task, const Priority& oldPriority)
         {
-            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
-            {
-                Task* next = iterator->second->next();
-
-                // Guard: A higher priority task is pending
-                if (next != nullptr)
-                {
-                    return next;
-                }
-            }
+            this->removeFromLevel(task, oldPriority);
 
-            // No pending task
-            return nullptr;
+            this->ready(task);
         }
 
         ///
-        /// Enqueue a ready schedulable task
+        /// Visit every task in the ready queue in the order they would be dequeued
         ///
-        /// @param task A non-null task that is ready to run
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Priority levels are visited from the highest to the lowest one.
         ///
-        void ready(Task* task) override
+        template <typename Visitor>
+        void forEach(Visitor&& visitor)
         {
-            const Priority& priority = task->getPriority();
-
-            // Guard: Check whether a scheduler is already available for the priority of the given task
-            if (this->queues[priority] == nullptr)
+            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
             {
-                this->queues[priority] = PolicyMaker::create(priority);
+                // Guard: Ensure that the current priority level exists
+                if (*iterator != nullptr)
+                {
+                    (*iterator)->forEach(visitor);
+                }
             }
-
-            // Guard: Scheduler should now be available
-            passert(this->queues[priority] != nullptr, "Scheduler for priority level should be non-null.");
-
-            this->queues[priority]->ready(task);
         }
     };
 
     ///
-    /// Implements the policy using a static array to map each priority level to a queue of the same type
+    /// Implements the policy using a static array to map each priority level to a queue of the same type and a bitmap to locate the highest non-empty level
     ///
     /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
     /// @tparam Policy Specify the type of scheduling policies to which the scheduler maps each priority level
     /// @tparam MaxPriorityLevel Defines the value of the largest priority level
     /// @note The length of the array map will be `max + 1`, so it is recommended to define a contiguous sequence of priority levels.
     /// @note The priority level must be convertible to an unsigned integer.
-    /// @seealso `SchedulingPolicyMakers` to see predefined policy makers.
+    /// @note Unlike `ArrayMapHomoImp`, this policy finds the highest non-empty priority level in constant time regardless of `MaxPriorityLevel`,
+    ///       at the cost of keeping one occupancy bit and one task counter per priority level in sync on every `ready()` and `next()`.
     ///
     template <typename Task, typename Policy, size_t MaxPriorityLevel>
     requires TaskConstraints::PrioritizableByPriority<Task> && std::unsigned_integral<Traits::TaskPriority<Task>>
-    struct ArrayMapHomoImp: public Scheduler::Policy<Task>
+    struct BitmapArrayMapHomoImp
     {
     private:
         /// The priority level type
         using Priority = Traits::TaskPriority<Task>;
 
         /// A private map that maps priority levels to their scheduling policies
-        /// Non-existent priority levels are mapped to null pointers
         std::array<Policy, MaxPriorityLevel + 1> queues = {};
 
-    public:
-        /// Define the schedulable task type
-        using SchedulableTask = Task;
+        /// The number of ready tasks at each priority level
+        std::array<size_t, MaxPriorityLevel + 1> counts = {};
+
+        /// A bitmap where each bit indicates whether the corresponding priority level has any ready task
+        Containers::PriorityBitmap<MaxPriorityLevel + 1> bitmap;
 
         ///
-        /// Dequeue the next ready schedulable task
+        /// [Helper] Remove the given task from the queue of the given priority level
         ///
-        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        /// @param task A non-null task that resides in the queue of the given priority level
+        /// @param priority The priority level at which the task was enqueued
         ///
-        Task* next() override
+        void removeFromLevel(Task* task, const Priority& priority)
         {
-            // From the highest priority level to the lowest
-            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
-            {
+            passert(this->counts[priority] != 0, "The task should reside in the queue of the given priority level.");
+
+            this->queues[priority].remove(task);
+
+            // Guard: Check whether the priority level has been drained
+            if (--this->counts[priority] == 0)
+            {
+                this->bitmap.clear(priority);
+            }
+        }
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next()
+        {
+            // Guard: Check whether any priority level has a pending task
+            if (this->bitmap.isEmpty())
+            {
+                return nullptr;
+            }
+
+            // Dequeue from the highest non-empty priority level
+            size_t priority = this->bitmap.highest();
+
+            Task* next = this->queues[priority].next();
+
+            passert(next != nullptr, "The highest non-empty priority level should have a pending task.");
+
+            // Guard: Check whether the priority level has been drained
+            if (--this->counts[priority] == 0)
+            {
+                this->bitmap.clear(priority);
+            }
+
+            return next;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task)
+        {
+            const Priority& priority = task->getPriority();
+
+            this->queues[priority].ready(task);
+
+            this->counts[priority] += 1;
+
+            this->bitmap.set(priority);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) requires Concepts::RemovablePolicy<Policy>
+        {
+            this->removeFromLevel(task, task->getPriority());
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority) requires Concepts::RemovablePolicy<Policy>
+        {
+            this->removeFromLevel(task, oldPriority);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) requires Concepts::VisitablePolicy<Policy>
+        {
+            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
+            {
+                iterator->forEach(visitor);
+            }
+        }
+    };
+
+    ///
+    /// Implements the policy using a static array to map each priority level to a FIFO queue and a bitmap to locate the highest non-empty level,
+    /// and supports a priority boost that moves all ready tasks to the highest priority level in `O(levels)` time
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam PolicyMaker A callable type that maps a priority level to a FIFO scheduling policy
+    /// @tparam MaxPriorityLevel Defines the value of the largest priority level, to which all ready tasks are boosted
+    /// @tparam BoostExtension A code injector that is applied to each task as it is boosted, e.g. `PriorityBasedTaskQuantumAllocator`
+    /// @note The boost is lazy. `boost()` only records the number of ready tasks at each level and starts a new boost epoch,
+    ///       since these tasks are exactly the ones at the front of each FIFO queue.
+    ///       `next()` dispatches them before any task enqueued after the boost, from the highest level to the lowest one and in FIFO order within a level,
+    ///       and raises each of them to `MaxPriorityLevel` and applies the boost extension as it is dispatched.
+    ///       As a result, the cost of a boost does not depend on the number of ready tasks.
+    /// @note A task that has been boosted keeps reporting its previous priority level until it is dispatched,
+    ///       and loses its boost if it is removed from the ready queue or its position is adjusted before then.
+    /// @warning The queue of each level must dispatch tasks in FIFO order, otherwise tasks enqueued after the boost may be dispatched as boosted ones.
+    ///
+    template <typename Task, typename PolicyMaker, size_t MaxPriorityLevel, typename BoostExtension>
+    requires TaskConstraints::Boostable<Task> &&
+             Concepts::PolicyMaker<PolicyMaker, Task> &&
+             Concepts::PolicyCodeExtension<BoostExtension, Task> &&
+             std::unsigned_integral<Traits::TaskPriority<Task>>
+    struct BoostableBitmapArrayMapImp
+    {
+    private:
+        /// The priority level type
+        using Priority = Traits::TaskPriority<Task>;
+
+        /// A private map that maps priority levels to their scheduling policies
+        /// Non-existent priority levels are mapped to null pointers
+        std::array<Scheduler::Policy<Task>*, MaxPriorityLevel + 1> queues = {};
+
+        /// The number of ready tasks at each priority level
+        std::array<size_t, MaxPriorityLevel + 1> counts = {};
+
+        /// A bitmap where each bit indicates whether the corresponding priority level has any ready task
+        Containers::PriorityBitmap<MaxPriorityLevel + 1> bitmap;
+
+        /// The number of ready tasks at the front of each priority level that have been boosted but not yet dispatched
+        std::array<size_t, MaxPriorityLevel + 1> boosted = {};
+
+        /// A bitmap where each bit indicates whether the corresponding priority level has any boosted task
+        Containers::PriorityBitmap<MaxPriorityLevel + 1> boostedBitmap;
+
+        /// The current boost epoch, which is stored in each task when it is enqueued
+        uint32_t epoch = 0;
+
+        ///
+        /// [Helper] Record that a task has been dequeued or removed from the given priority level
+        ///
+        /// @param task A non-null task that has left the queue of the given priority level
+        /// @param priority The priority level at which the task was enqueued
+        ///
+        void leaveLevel(Task* task, const Priority& priority)
+        {
+            // Guard: Check whether the priority level has been drained
+            if (--this->counts[priority] == 0)
+            {
+                this->bitmap.clear(priority);
+            }
+
+            // Guard: Check whether the task was enqueued before the most recent boost
+            if (task->getBoostEpoch() == this->epoch)
+            {
+                return;
+            }
+
+            passert(this->boosted[priority] != 0, "A task enqueued before the most recent boost should be counted as a boosted task.");
+
+            // Guard: Check whether all boosted tasks at the priority level have left
+            if (--this->boosted[priority] == 0)
+            {
+                this->boostedBitmap.clear(priority);
+            }
+        }
+
+        ///
+        /// [Helper] Remove the given task from the queue of the given priority level
+        ///
+        /// @param task A non-null task that resides in the queue of the given priority level
+        /// @param priority The priority level at which the task was enqueued
+        ///
+        void removeFromLevel(Task* task, const Priority& priority)
+        {
+            passert(this->queues[priority] != nullptr && this->counts[priority] != 0, "The task should reside in the queue of the given priority level.");
+
+            this->queues[priority]->remove(task);
+
+            this->leaveLevel(task, priority);
+        }
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Create the policy of every priority level if the policy maker requests eager initialization
+        ///
+        /// @note Otherwise, the policy of a priority level is created when the first task at that level is enqueued.
+        ///
+        BoostableBitmapArrayMapImp()
+        {
+            if constexpr (Concepts::EagerPolicyMaker<PolicyMaker>)
+            {
+                for (size_t priority = 0; priority <= MaxPriorityLevel; priority++)
+                {
+                    this->queues[priority] = PolicyMaker::create(static_cast<Priority>(priority));
+                }
+            }
+        }
+
+        /// Default Destructor
+        ~BoostableBitmapArrayMapImp()
+        {
+            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
+            {
+                if (*iterator != nullptr)
+                {
+                    PolicyMaker::destroy(*iterator);
+                }
+            }
+        }
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        /// @note Tasks that have been boosted are dispatched first, and each of them is raised to the highest priority level at this point.
+        ///
+        Task* next()
+        {
+            // Guard: Check whether any boosted task has not yet been dispatched
+            if (!this->boostedBitmap.isEmpty())
+            {
+                size_t priority = this->boostedBitmap.highest();
+
+                Task* next = this->queues[priority]->next();
+
+                passert(next != nullptr && next->getBoostEpoch() != this->epoch, "The front of the priority level should be a boosted task.");
+
+                this->leaveLevel(next, static_cast<Priority>(priority));
+
+                // Apply the boost now that the task leaves the queue
+                next->setPriority(static_cast<Priority>(MaxPriorityLevel));
+
+                BoostExtension{}(next);
+
+                return next;
+            }
+
+            // Guard: Check whether any priority level has a pending task
+            if (this->bitmap.isEmpty())
+            {
+                return nullptr;
+            }
+
+            // Dequeue from the highest non-empty priority level
+            size_t priority = this->bitmap.highest();
+
+            Task* next = this->queues[priority]->next();
+
+            passert(next != nullptr, "The highest non-empty priority level should have a pending task.");
+
+            this->leaveLevel(next, static_cast<Priority>(priority));
+
+            return next;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task)
+        {
+            const Priority& priority = task->getPriority();
+
+            // Guard: Check whether a scheduler is already available for the priority of the given task
+            if (this->queues[priority] == nullptr)
+            {
+                this->queues[priority] = PolicyMaker::create(priority);
+            }
+
+            // Guard: Scheduler should now be available
+            passert(this->queues[priority] != nullptr, "Scheduler for priority level should be non-null.");
+
+            this->queues[priority]->ready(task);
+
+            task->setBoostEpoch(this->epoch);
+
+            this->counts[priority] += 1;
+
+            this->bitmap.set(priority);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task)
+        {
+            this->removeFromLevel(task, task->getPriority());
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority)
+        {
+            this->removeFromLevel(task, oldPriority);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Boost all ready tasks and the given running task to the highest priority level
+        ///
+        /// @param current The current running task that is boosted immediately, `NULL` if no task other than the idle task is running
+        /// @note This method takes `O(MaxPriorityLevel)` time regardless of the number of ready tasks,
+        ///       since ready tasks are raised to the highest priority level lazily when they are dispatched.
+        ///
+        void boost(Task* current = nullptr)
+        {
+            this->epoch += 1;
+
+            // Every ready task has been enqueued before the new epoch
+            this->boosted = this->counts;
+
+            this->boostedBitmap = this->bitmap;
+
+            // Guard: Check whether the running task should be boosted as well
+            if (current != nullptr)
+            {
+                current->setPriority(static_cast<Priority>(MaxPriorityLevel));
+
+                BoostExtension{}(current);
+            }
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Boosted tasks at the front of each priority level are visited first, followed by the other tasks,
+        ///       and priority levels are visited from the highest to the lowest one in both passes.
+        ///       A boosted task still reports its previous priority level, since it is raised only when it is dispatched.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor)
+        {
+            // Boosted tasks are dispatched first, from the highest priority level to the lowest one
+            for (size_t level = 0; level <= MaxPriorityLevel; level++)
+            {
+                size_t priority = MaxPriorityLevel - level;
+
+                // Guard: Skip priority levels that do not have any boosted task
+                if (this->boosted[priority] == 0)
+                {
+                    continue;
+                }
+
+                size_t index = 0;
+
+                this->queues[priority]->forEach([&](Task* task)
+                {
+                    if (index++ < this->boosted[priority])
+                    {
+                        visitor(task);
+                    }
+                });
+            }
+
+            // Followed by the tasks enqueued after the most recent boost
+            for (size_t level = 0; level <= MaxPriorityLevel; level++)
+            {
+                size_t priority = MaxPriorityLevel - level;
+
+                // Guard: Skip priority levels that only have boosted tasks
+                if (this->counts[priority] == this->boosted[priority])
+                {
+                    continue;
+                }
+
+                size_t index = 0;
+
+                this->queues[priority]->forEach([&](Task* task)
+                {
+                    if (index++ >= this->boosted[priority])
+                    {
+                        visitor(task);
+                    }
+                });
+            }
+        }
+    };
+    ///
+    /// Implements the policy using a tuple to map each priority level to a queue whose type is known at compile time
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam LevelPolicy Specify the non-virtual scheduling policy of each priority level, starting from level 0
+    /// @note The number of priority levels is the number of level policies,
+    ///       and each level may use a different policy, e.g. FIFO queues for lower levels and a heap for the highest one.
+    /// @note All calls to level policies are resolved at compile time,
+    ///       so this policy does not need any virtual calls or pointer chasing to find the queue of a priority level.
+    /// @note The priority level must be convertible to an unsigned integer.
+    ///
+    template <typename Task, typename... LevelPolicy>
+    requires TaskConstraints::PrioritizableByPriority<Task> &&
+             std::unsigned_integral<Traits::TaskPriority<Task>> &&
+             (sizeof...(LevelPolicy) > 0) &&
+             (Concepts::Policy<LevelPolicy> && ...) &&
+             (std::same_as<typename LevelPolicy::SchedulableTask, Task> && ...)
+    struct TupleMapImp
+    {
+    private:
+        /// The priority level type
+        using Priority = Traits::TaskPriority<Task>;
+
+        /// The number of priority levels
+        static constexpr size_t kNumberOfLevels = sizeof...(LevelPolicy);
+
+        /// A private tuple that maps priority levels to their scheduling policies
+        std::tuple<LevelPolicy...> queues;
+
+        ///
+        /// [Helper] Dequeue the next ready task from the highest non-empty priority level
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        template <size_t... Levels>
+        Task* nextFromLevels(std::index_sequence<Levels...>)
+        {
+            Task* next = nullptr;
+
+            // From the highest priority level to the lowest
+            (((next = std::get<kNumberOfLevels - 1 - Levels>(this->queues).next()) != nullptr) || ...);
+
+            return next;
+        }
+
+        ///
+        /// [Helper] Visit every task in the priority levels from the highest one to the lowest one
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        ///
+        template <typename Visitor, size_t... Levels>
+        void forEachInLevels(Visitor& visitor, std::index_sequence<Levels...>)
+        {
+            (std::get<kNumberOfLevels - 1 - Levels>(this->queues).forEach(visitor), ...);
+        }
+
+        ///
+        /// [Helper] Apply the given action to the policy of the given priority level
+        ///
+        /// @param priority The priority level
+        /// @param action A callable object that takes the policy of the priority level
+        ///
+        template <typename Action, size_t... Levels>
+        void visit(const Priority& priority, Action&& action, std::index_sequence<Levels...>)
+        {
+            // Guard: The priority level must have a policy
+            passert(priority < kNumberOfLevels, "Scheduler for priority level should exist.");
+
+            ((priority == Levels ? (action(std::get<Levels>(this->queues)), true) : false) || ...);
+        }
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next()
+        {
+            return this->nextFromLevels(std::index_sequence_for<LevelPolicy...>{});
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task)
+        {
+            this->visit(task->getPriority(), [task](auto& queue) { queue.ready(task); }, std::index_sequence_for<LevelPolicy...>{});
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task)
+        requires (Concepts::RemovablePolicy<LevelPolicy> && ...)
+        {
+            this->visit(task->getPriority(), [task](auto& queue) { queue.remove(task); }, std::index_sequence_for<LevelPolicy...>{});
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority)
+        requires (Concepts::RemovablePolicy<LevelPolicy> && ...)
+        {
+            this->visit(oldPriority, [task](auto& queue) { queue.remove(task); }, std::index_sequence_for<LevelPolicy...>{});
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor)
+        requires (Concepts::VisitablePolicy<LevelPolicy> && ...)
+        {
+            this->forEachInLevels(visitor, std::index_sequence_for<LevelPolicy...>{});
+        }
+    };
+
+    ///
+    /// Implements the policy using a sorted flat map that only keeps track of non-empty priority levels
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam PolicyMaker A callable type that maps a priority level to a scheduling policy
+    /// @note The priority level must be hashable.
+    /// @note Unlike `StlMapImp`, this policy removes a priority level as soon as it drains,
+    ///       so `next()` always finds the highest non-empty level at the end of the map in constant time,
+    ///       and `ready()` locates an existing level by a binary search over contiguous memory.
+    ///       It is suitable for priority levels that are sparse in a large space, e.g. 32-bit values.
+    /// @note The policy maker is called each time a priority level becomes non-empty,
+    ///       and the policy instance is returned to the policy maker once the level drains.
+    ///       Pair this policy with a pool-based policy maker, e.g. `StaticFIFO`, to avoid allocating memory on these transitions.
+    /// @seealso `SchedulingPolicyMakers` to see predefined policy makers.
+    ///
+    template <typename Task, typename PolicyMaker>
+    requires TaskConstraints::PrioritizableByPriority<Task> &&
+             Concepts::PolicyMaker<PolicyMaker, Task> &&
+             Hashable<Traits::TaskPriority<Task>>
+    struct SparseMapImp
+    {
+    private:
+        /// The priority level type
+        using Priority = Traits::TaskPriority<Task>;
+
+        /// A private map that maps non-empty priority levels to their scheduling policies
+        Containers::FlatLevelMap<Priority, Scheduler::Policy<Task>> queues;
+
+        ///
+        /// [Helper] Remove the given task from the given priority level and erase the level if it drains
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @param priority The priority level where the task resides
+        ///
+        void removeFromLevel(Task* task, const Priority& priority)
+        {
+            auto* level = this->queues.find(priority);
+
+            passert(level != nullptr, "Scheduler for priority level should be non-null.");
+
+            level->queue->remove(task);
+
+            // Guard: Release the policy if the level drains
+            if (--level->count == 0)
+            {
+                PolicyMaker::destroy(level->queue);
+
+                this->queues.erase(*level);
+            }
+        }
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        /// Default Destructor
+        ~SparseMapImp()
+        {
+            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
+            {
+                PolicyMaker::destroy(iterator->queue);
+            }
+        }
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next()
+        {
+            // Guard: Check whether there is any non-empty priority level
+            if (this->queues.isEmpty())
+            {
+                return nullptr;
+            }
+
+            auto& level = this->queues.highest();
+
+            Task* next = level.queue->next();
+
+            passert(next != nullptr, "The highest non-empty priority level should have a ready task.");
+
+            // Guard: Release the policy if the level drains
+            if (--level.count == 0)
+            {
+                PolicyMaker::destroy(level.queue);
+
+                this->queues.erase(level);
+            }
+
+            return next;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task)
+        {
+            auto& level = this->queues.findOrInsert(task->getPriority(), [](const Priority& priority) { return PolicyMaker::create(priority); });
+
+            // Guard: Scheduler should now be available
+            passert(level.queue != nullptr, "Scheduler for priority level should be non-null.");
+
+            level.queue->ready(task);
+
+            level.count += 1;
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task)
+        {
+            this->removeFromLevel(task, task->getPriority());
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority)
+        {
+            this->removeFromLevel(task, oldPriority);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor)
+        {
+            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
+            {
+                iterator->queue->forEach(visitor);
+            }
+        }
+    };
+
+    ///
+    /// Implements the policy using a sorted flat map that only keeps track of non-empty priority levels whose queues have the same type
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam Policy Specify the type of scheduling policies to which the scheduler maps each priority level
+    /// @note The priority level must be hashable.
+    /// @note Unlike `StlMapHomoImp`, this policy removes a priority level as soon as it drains,
+    ///       so `next()` always finds the highest non-empty level at the end of the map in constant time,
+    ///       and `ready()` locates an existing level by a binary search over contiguous memory.
+    ///       It is suitable for priority levels that are sparse in a large space, e.g. 32-bit values.
+    /// @note Policies of drained levels are kept aside and reused by levels that become non-empty later,
+    ///       so memory is allocated only when the number of non-empty levels exceeds its previous maximum.
+    ///
+    template <typename Task, typename Policy>
+    requires TaskConstraints::PrioritizableByPriority<Task> && Hashable<Traits::TaskPriority<Task>>
+    struct SparseMapHomoImp
+    {
+    private:
+        /// The priority level type
+        using Priority = Traits::TaskPriority<Task>;
+
+        /// A private map that maps non-empty priority levels to their scheduling policies
+        Containers::FlatLevelMap<Priority, Policy> queues;
+
+        /// Policies of drained priority levels that can be reused
+        std::vector<Policy*> spares;
+
+        ///
+        /// [Helper] Erase the given drained priority level and keep its policy for later reuse
+        ///
+        /// @param level A priority level that has no task
+        ///
+        void eraseLevel(typename Containers::FlatLevelMap<Priority, Policy>::Level& level)
+        {
+            this->spares.push_back(level.queue);
+
+            this->queues.erase(level);
+        }
+
+        ///
+        /// [Helper] Remove the given task from the given priority level and erase the level if it drains
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @param priority The priority level where the task resides
+        ///
+        void removeFromLevel(Task* task, const Priority& priority) requires Concepts::RemovablePolicy<Policy>
+        {
+            auto* level = this->queues.find(priority);
+
+            passert(level != nullptr, "Scheduler for priority level should exist.");
+
+            level->queue->remove(task);
+
+            // Guard: Erase the level if it drains
+            if (--level->count == 0)
+            {
+                this->eraseLevel(*level);
+            }
+        }
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        /// Default Destructor
+        ~SparseMapHomoImp()
+        {
+            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
+            {
+                delete iterator->queue;
+            }
+
+            for (Policy* spare : this->spares)
+            {
+                delete spare;
+            }
+        }
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next()
+        {
+            // Guard: Check whether there is any non-empty priority level
+            if (this->queues.isEmpty())
+            {
+                return nullptr;
+            }
+
+            auto& level = this->queues.highest();
+
+            Task* next = level.queue->next();
+
+            passert(next != nullptr, "The highest non-empty priority level should have a ready task.");
+
+            // Guard: Erase the level if it drains
+            if (--level.count == 0)
+            {
+                this->eraseLevel(level);
+            }
+
+            return next;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task)
+        {
+            auto& level = this->queues.findOrInsert(task->getPriority(), [this]([[maybe_unused]] const Priority& priority)
+            {
+                // Guard: Reuse the policy of a drained level if possible
+                if (this->spares.empty())
+                {
+                    return new Policy();
+                }
+
+                Policy* spare = this->spares.back();
+
+                this->spares.pop_back();
+
+                return spare;
+            });
+
+            level.queue->ready(task);
+
+            level.count += 1;
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) requires Concepts::RemovablePolicy<Policy>
+        {
+            this->removeFromLevel(task, task->getPriority());
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority) requires Concepts::RemovablePolicy<Policy>
+        {
+            this->removeFromLevel(task, oldPriority);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) requires Concepts::VisitablePolicy<Policy>
+        {
+            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
+            {
+                iterator->queue->forEach(visitor);
+            }
+        }
+    };
+
+    ///
+    /// Implements the policy using either a bitmap-indexed array or a sorted flat map of queues of the same type,
+    /// and switches between the two representations as the number of non-empty priority levels changes
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam Policy Specify the type of scheduling policies to which the scheduler maps each priority level
+    /// @tparam MaxPriorityLevel Defines the value of the largest priority level
+    /// @tparam SparseThreshold Specify the number of non-empty levels at or below which the policy switches to the sparse representation
+    /// @tparam DenseThreshold Specify the number of non-empty levels at or above which the policy switches to the dense representation
+    /// @note The sparse representation works like `SparseMapHomoImp`. It only touches the contiguous entries of the non-empty levels,
+    ///       which suits a few hot levels, but it shifts entries whenever a level is created or drains,
+    ///       which becomes expensive once many levels are non-empty and churn.
+    ///       The dense representation works like `BitmapArrayMapHomoImp`. Each operation takes constant time regardless of the occupancy,
+    ///       but it touches the bitmap, the counter and the queue of a level, which are spread across arrays sized by `MaxPriorityLevel`.
+    /// @note The gap between the two thresholds provides hysteresis, so that a workload that hovers around one threshold does not migrate back and forth.
+    ///       Each migration moves every ready task once, by draining the queue of each level in dequeue order and enqueuing the tasks in the same order,
+    ///       so tasks are never reordered within a level.
+    /// @note The policy starts in the sparse representation.
+    ///       Policies of drained levels in the sparse representation are kept aside and reused like in `SparseMapHomoImp`.
+    /// @note The priority level must be convertible to an unsigned integer.
+    ///
+    template <typename Task, typename Policy, size_t MaxPriorityLevel, size_t SparseThreshold = 4, size_t DenseThreshold = 16>
+    requires TaskConstraints::PrioritizableByPriority<Task> && std::unsigned_integral<Traits::TaskPriority<Task>> && (SparseThreshold < DenseThreshold)
+    struct AdaptiveMapHomoImp
+    {
+    private:
+        /// The priority level type
+        using Priority = Traits::TaskPriority<Task>;
+
+        /// A private map that maps non-empty priority levels to their scheduling policies in the sparse representation
+        Containers::FlatLevelMap<Priority, Policy> sparse;
+
+        /// Policies of drained priority levels that can be reused in the sparse representation
+        std::vector<Policy*> spares;
+
+        /// A private map that maps priority levels to their scheduling policies in the dense representation
+        std::array<Policy, MaxPriorityLevel + 1> dense = {};
+
+        /// The number of ready tasks at each priority level in the dense representation
+        std::array<size_t, MaxPriorityLevel + 1> counts = {};
+
+        /// A bitmap where each bit indicates whether the corresponding priority level has any ready task in the dense representation
+        Containers::PriorityBitmap<MaxPriorityLevel + 1> bitmap;
+
+        /// The number of non-empty priority levels in the dense representation
+        size_t levels = 0;
+
+        /// `true` if the policy uses the dense representation
+        bool isDense = false;
+
+        /// The number of times the policy has switched its representation
+        size_t migrations = 0;
+
+        ///
+        /// [Helper] Get a policy for a priority level that becomes non-empty in the sparse representation
+        ///
+        /// @return A policy that has no task.
+        ///
+        Policy* makeQueue()
+        {
+            // Guard: Reuse the policy of a drained level if possible
+            if (this->spares.empty())
+            {
+                return new Policy();
+            }
+
+            Policy* spare = this->spares.back();
+
+            this->spares.pop_back();
+
+            return spare;
+        }
+
+        ///
+        /// [Helper] Erase the given drained priority level in the sparse representation and keep its policy for later reuse
+        ///
+        /// @param level A priority level that has no task
+        ///
+        void eraseLevel(typename Containers::FlatLevelMap<Priority, Policy>::Level& level)
+        {
+            this->spares.push_back(level.queue);
+
+            this->sparse.erase(level);
+        }
+
+        ///
+        /// [Helper] Move all tasks from the given queue to another one without reordering them
+        ///
+        /// @param source The queue that holds the given number of tasks
+        /// @param destination The queue that receives the tasks
+        /// @param count The number of tasks in the source queue
+        ///
+        static void transfer(Policy& source, Policy& destination, size_t count)
+        {
+            for (size_t index = 0; index < count; index += 1)
+            {
+                Task* task = source.next();
+
+                passert(task != nullptr, "The queue should have as many tasks as recorded.");
+
+                destination.ready(task);
+            }
+        }
+
+        ///
+        /// [Helper] Move all ready tasks to the dense representation
+        ///
+        void migrateToDense()
+        {
+            while (!this->sparse.isEmpty())
+            {
+                auto& level = this->sparse.highest();
+
+                this->transfer(*level.queue, this->dense[level.priority], level.count);
+
+                this->counts[level.priority] = level.count;
+
+                this->bitmap.set(level.priority);
+
+                this->levels += 1;
+
+                this->eraseLevel(level);
+            }
+
+            this->isDense = true;
+
+            this->migrations += 1;
+        }
+
+        ///
+        /// [Helper] Move all ready tasks to the sparse representation
+        ///
+        void migrateToSparse()
+        {
+            this->sparse.reserve(this->levels);
+
+            while (!this->bitmap.isEmpty())
+            {
+                size_t priority = this->bitmap.highest();
+
+                auto& level = this->sparse.findOrInsert(static_cast<Priority>(priority), [this]([[maybe_unused]] const Priority& priority) { return this->makeQueue(); });
+
+                this->transfer(this->dense[priority], *level.queue, this->counts[priority]);
+
+                level.count = this->counts[priority];
+
+                this->counts[priority] = 0;
+
+                this->bitmap.clear(priority);
+            }
+
+            this->levels = 0;
+
+            this->isDense = false;
+
+            this->migrations += 1;
+        }
+
+        ///
+        /// [Helper] Record that the given priority level in the dense representation has lost a task
+        ///
+        /// @param priority The priority level
+        ///
+        void leaveDenseLevel(size_t priority)
+        {
+            // Guard: Check whether the priority level has been drained
+            if (--this->counts[priority] != 0)
+            {
+                return;
+            }
+
+            this->bitmap.clear(priority);
+
+            // Guard: Switch to the sparse representation once few levels remain
+            if (--this->levels <= SparseThreshold)
+            {
+                this->migrateToSparse();
+            }
+        }
+
+        ///
+        /// [Helper] Remove the given task from the queue of the given priority level
+        ///
+        /// @param task A non-null task that resides in the queue of the given priority level
+        /// @param priority The priority level at which the task was enqueued
+        ///
+        void removeFromLevel(Task* task, const Priority& priority) requires Concepts::RemovablePolicy<Policy>
+        {
+            if (this->isDense)
+            {
+                passert(this->counts[priority] != 0, "The task should reside in the queue of the given priority level.");
+
+                this->dense[priority].remove(task);
+
+                this->leaveDenseLevel(priority);
+
+                return;
+            }
+
+            auto* level = this->sparse.find(priority);
+
+            passert(level != nullptr, "Scheduler for priority level should exist.");
+
+            level->queue->remove(task);
+
+            // Guard: Erase the level if it drains
+            if (--level->count == 0)
+            {
+                this->eraseLevel(*level);
+            }
+        }
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        /// Default Destructor
+        ~AdaptiveMapHomoImp()
+        {
+            for (auto iterator = this->sparse.begin(); iterator != this->sparse.end(); iterator++)
+            {
+                delete iterator->queue;
+            }
+
+            for (Policy* spare : this->spares)
+            {
+                delete spare;
+            }
+        }
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next()
+        {
+            if (this->isDense)
+            {
+                // Guard: Check whether any priority level has a pending task
+                if (this->bitmap.isEmpty())
+                {
+                    return nullptr;
+                }
+
+                size_t priority = this->bitmap.highest();
+
+                Task* next = this->dense[priority].next();
+
+                passert(next != nullptr, "The highest non-empty priority level should have a pending task.");
+
+                this->leaveDenseLevel(priority);
+
+                return next;
+            }
+
+            // Guard: Check whether there is any non-empty priority level
+            if (this->sparse.isEmpty())
+            {
+                return nullptr;
+            }
+
+            auto& level = this->sparse.highest();
+
+            Task* next = level.queue->next();
+
+            passert(next != nullptr, "The highest non-empty priority level should have a ready task.");
+
+            // Guard: Erase the level if it drains
+            if (--level.count == 0)
+            {
+                this->eraseLevel(level);
+            }
+
+            return next;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task)
+        {
+            const Priority& priority = task->getPriority();
+
+            passert(priority <= MaxPriorityLevel, "The priority level should not exceed the largest priority level.");
+
+            if (this->isDense)
+            {
+                this->dense[priority].ready(task);
+
+                // Guard: Check whether the priority level becomes non-empty
+                if (this->counts[priority]++ == 0)
+                {
+                    this->bitmap.set(priority);
+
+                    this->levels += 1;
+                }
+
+                return;
+            }
+
+            auto& level = this->sparse.findOrInsert(priority, [this]([[maybe_unused]] const Priority& priority) { return this->makeQueue(); });
+
+            level.queue->ready(task);
+
+            level.count += 1;
+
+            // Guard: Switch to the dense representation once many levels are non-empty
+            if (this->sparse.size() >= DenseThreshold)
+            {
+                this->migrateToDense();
+            }
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) requires Concepts::RemovablePolicy<Policy>
+        {
+            this->removeFromLevel(task, task->getPriority());
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority) requires Concepts::RemovablePolicy<Policy>
+        {
+            this->removeFromLevel(task, oldPriority);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Check whether the policy uses the dense representation
+        ///
+        /// @return `true` if ready tasks are kept in the bitmap-indexed array, `false` if they are kept in the sorted flat map.
+        ///
+        [[nodiscard]]
+        bool usesDenseRepresentation() const
+        {
+            return this->isDense;
+        }
+
+        ///
+        /// Get the number of non-empty priority levels
+        ///
+        /// @return The number of priority levels that have at least one ready task.
+        ///
+        [[nodiscard]]
+        size_t getNonEmptyLevelCount() const
+        {
+            return this->isDense ? this->levels : this->sparse.size();
+        }
+
+        ///
+        /// Get the spread of non-empty priority levels
+        ///
+        /// @return The distance between the highest and the lowest non-empty priority levels plus one, `0` if no task is ready.
+        ///
+        [[nodiscard]]
+        size_t getLevelSpread()
+        {
+            if (this->isDense)
+            {
+                return this->bitmap.isEmpty() ? 0 : this->bitmap.highest() - this->bitmap.nextFrom(0) + 1;
+            }
+
+            return this->sparse.isEmpty() ? 0 : static_cast<size_t>(this->sparse.highest().priority - this->sparse.begin()->priority) + 1;
+        }
+
+        ///
+        /// Get the number of times the policy has switched its representation
+        ///
+        /// @return The number of migrations between the two representations.
+        ///
+        [[nodiscard]]
+        size_t getMigrationCount() const
+        {
+            return this->migrations;
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) requires Concepts::VisitablePolicy<Policy>
+        {
+            if (this->isDense)
+            {
+                for (auto iterator = this->dense.rbegin(); iterator != this->dense.rend(); iterator++)
+                {
+                    iterator->forEach(visitor);
+                }
+            }
+            else
+            {
+                for (auto iterator = this->sparse.rbegin(); iterator != this->sparse.rend(); iterator++)
+                {
+                    iterator->queue->forEach(visitor);
+                }
+            }
+        }
+    };
+
+}
+
+///
+/// Defines scheduling policies that prioritizes schedulable tasks in multiple queues
+///
+/// @note All structs implement the interface `SchedulingPolicy` thus their instances can be treated as opaque policies.
+///
+namespace Scheduler::Policies::PrioritizedMultiQueue::Virtual
+{
+    ///
+    /// Implements the policy using a static array to map each priority level to a queue
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam PolicyMaker A callable type that maps a priority level to a scheduling policy
+    /// @tparam MaxPriorityLevel Defines the value of the largest priority level
+    /// @note The length of the array map will be `max + 1`, so it is recommended to define a contiguous sequence of priority levels.
+    /// @note The priority level must be convertible to an unsigned integer.
+    /// @note The policy maker is called once for each priority level,
+    ///       and the returned policy instance should be unique for each level.
+    ///       The memory of returned policy instance is managed by this class.
+    ///       The policy maker must provide a deleter to avoid any memory leaks.
+    /// @seealso `SchedulingPolicyMakers` to see predefined policy makers.
+    ///
+    template <typename Task, typename PolicyMaker, size_t MaxPriorityLevel>
+    requires TaskConstraints::PrioritizableByPriority<Task> &&
+             Concepts::PolicyMaker<PolicyMaker, Task> &&
+             std::unsigned_integral<Traits::TaskPriority<Task>>
+    struct ArrayMapImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// The priority level type
+        using Priority = Traits::TaskPriority<Task>;
+
+        /// A private map that maps priority levels to their scheduling policies
+        /// Non-existent priority levels are mapped to null pointers
+        std::array<Scheduler::Policy<Task>*, MaxPriorityLevel + 1> queues = {};
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Create the policy of every priority level if the policy maker requests eager initialization
+        ///
+        /// @note Otherwise, the policy of a priority level is created when the first task at that level is enqueued.
+        ///
+        ArrayMapImp()
+        {
+            if constexpr (Concepts::EagerPolicyMaker<PolicyMaker>)
+            {
+                for (size_t priority = 0; priority <= MaxPriorityLevel; priority++)
+                {
+                    this->queues[priority] = PolicyMaker::create(static_cast<Priority>(priority));
+                }
+            }
+        }
+
+        /// Default Destructor
+        ~ArrayMapImp()
+        {
+            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
+            {
+                if (*iterator != nullptr)
+                {
+                    PolicyMaker::destroy(*iterator);
+                }
+            }
+        }
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            // From the highest priority level to the lowest
+            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
+            {
+                // Guard: Ensure that the current priority level exists
+                if (*iterator == nullptr)
+                {
+                    continue;
+                }
+
+                // Guard: Check whether a higher priority task is pending
+                Task* next = (*iterator)->next();
+
+                if (next != nullptr)
+                {
+                    return next;
+                }
+            }
+
+            // No pending task
+            return nullptr;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task) override
+        {
+            const Priority& priority = task->getPriority();
+
+            // Guard: Check whether a scheduler is already available for the priority of the given task
+            if (this->queues[priority] == nullptr)
+            {
+                this->queues[priority] = PolicyMaker::create(priority);
+            }
+
+            // Guard: Scheduler should now be available
+            passert(this->queues[priority] != nullptr, "Scheduler for priority level should be non-null.");
+
+            this->queues[priority]->ready(task);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) override
+        {
+            Scheduler::Policy<Task>* queue = this->queues[task->getPriority()];
+
+            passert(queue != nullptr, "Scheduler for priority level should be non-null.");
+
+            queue->remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority)
+        {
+            Scheduler::Policy<Task>* queue = this->queues[oldPriority];
+
+            passert(queue != nullptr, "Scheduler for priority level should be non-null.");
+
+            queue->remove(task);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
+            {
+                // Guard: Ensure that the current priority level exists
+                if (*iterator != nullptr)
+                {
+                    (*iterator)->forEachTask(visitor, context);
+                }
+            }
+        }
+    };
+
+    ///
+    /// Implements the policy using an array to map each priority level to a queue
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam PolicyMaker A callable type that maps a priority level to a scheduling policy
+    /// @note The priority level must be hashable.
+    /// @note The policy maker is called once for each priority level,
+    ///       and the returned policy instance should be unique for each level.
+    ///       The memory of returned policy instance is managed by this class.
+    ///       The policy maker must provide a deleter to avoid any memory leaks.
+    /// @seealso `SchedulingPolicyMakers` to see predefined policy makers.
+    ///
+    template <typename Task, typename PolicyMaker>
+    requires TaskConstraints::PrioritizableByPriority<Task> &&
+             Concepts::PolicyMaker<PolicyMaker, Task> &&
+             Hashable<Traits::TaskPriority<Task>>
+    struct StlMapImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// The priority level type
+        using Priority = Traits::TaskPriority<Task>;
+
+        /// A private map that maps priority levels to their scheduling policies
+        std::map<Priority, Scheduler::Policy<Task>*, std::greater<Priority>> queues;
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        /// Default Destructor
+        ~StlMapImp()
+        {
+            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
+            {
+                PolicyMaker::destroy(iterator->second);
+            }
+        }
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
+            {
+                Task* next = iterator->second->next();
+
+                // Guard: A higher priority task is pending
+                if (next != nullptr)
+                {
+                    return next;
+                }
+            }
+
+            // No pending task
+            return nullptr;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task) override
+        {
+            const Priority& priority = task->getPriority();
+
+            // Guard: Check whether a scheduler is already available for the priority of the given task
+            if (this->queues[priority] == nullptr)
+            {
+                this->queues[priority] = PolicyMaker::create(priority);
+            }
+
+            // Guard: Scheduler should now be available
+            passert(this->queues[priority] != nullptr, "Scheduler for priority level should be non-null.");
+
+            this->queues[priority]->ready(task);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) override
+        {
+            auto iterator = this->queues.find(task->getPriority());
+
+            passert(iterator != this->queues.end(), "Scheduler for priority level should be non-null.");
+
+            iterator->second->remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority)
+        {
+            auto iterator = this->queues.find(oldPriority);
+
+            passert(iterator != this->queues.end(), "Scheduler for priority level should be non-null.");
+
+            iterator->second->remove(task);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
+            {
+                iterator->second->forEachTask(visitor, context);
+            }
+        }
+    };
+
+    ///
+    /// Implements the policy using a static array to map each priority level to a queue of the same type
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam Policy Specify the type of scheduling policies to which the scheduler maps each priority level
+    /// @tparam MaxPriorityLevel Defines the value of the largest priority level
+    /// @note The length of the array map will be `max + 1`, so it is recommended to define a contiguous sequence of priority levels.
+    /// @note The priority level must be convertible to an unsigned integer.
+    /// @seealso `SchedulingPolicyMakers` to see predefined policy makers.
+    ///
+    template <typename Task, typename Policy, size_t MaxPriorityLevel>
+    requires TaskConstraints::PrioritizableByPriority<Task> && std::unsigned_integral<Traits::TaskPriority<Task>>
+    struct ArrayMapHomoImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// The priority level type
+        using Priority = Traits::TaskPriority<Task>;
+
+        /// A private map that maps priority levels to their scheduling policies
+        /// Non-existent priority levels are mapped to null pointers
+        std::array<Policy, MaxPriorityLevel + 1> queues = {};
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            // From the highest priority level to the lowest
+            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
+            {
                 // Guard: Check whether a higher priority task is pending
                 Task* next = (*iterator).next();
 
-                if (next != nullptr)
-                {
-                    return next;
-                }
+                if (next != nullptr)
+                {
+                    return next;
+                }
+            }
+
+            // No pending task
+            return nullptr;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task) override
+        {
+            this->queues[task->getPriority()].ready(task);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) override
+        {
+            this->queues[task->getPriority()].remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority)
+        {
+            this->queues[oldPriority].remove(task);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
+            {
+                iterator->forEach([&](Task* task) { visitor(task, context); });
+            }
+        }
+    };
+
+    ///
+    /// Implements the policy using an array to map each priority level to a queue of the same type
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam Policy Specify the type of scheduling policies to which the scheduler maps each priority level
+    /// @note The priority level must be hashable.
+    ///
+    template <typename Task, typename Policy>
+    requires TaskConstraints::PrioritizableByPriority<Task> && Hashable<Traits::TaskPriority<Task>>
+    struct StlMapHomoImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// The priority level type
+        using Priority = Traits::TaskPriority<Task>;
+
+        /// A private map that maps priority levels to their scheduling policies
+        std::map<Priority, Policy, std::greater<Priority>> queues;
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
+            {
+                Task* next = iterator->second.next();
+
+                // Guard: A higher priority task is pending
+                if (next != nullptr)
+                {
+                    return next;
+                }
+            }
+
+            // No pending task
+            return nullptr;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task) override
+        {
+            this->queues[task->getPriority()].ready(task);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) override
+        {
+            auto iterator = this->queues.find(task->getPriority());
+
+            passert(iterator != this->queues.end(), "Scheduler for priority level should exist.");
+
+            iterator->second.remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority)
+        {
+            auto iterator = this->queues.find(oldPriority);
+
+            passert(iterator != this->queues.end(), "Scheduler for priority level should exist.");
+
+            iterator->second.remove(task);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
+            {
+                iterator->second.forEach([&](Task* task) { visitor(task, context); });
+            }
+        }
+    };
+
+    ///
+    /// Implements the policy using a static array to map each priority level to a queue and a bitmap to locate the highest non-empty level
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam PolicyMaker A callable type that maps a priority level to a scheduling policy
+    /// @tparam MaxPriorityLevel Defines the value of the largest priority level
+    /// @note The length of the array map will be `max + 1`, so it is recommended to define a contiguous sequence of priority levels.
+    /// @note The priority level must be convertible to an unsigned integer.
+    /// @note Unlike `ArrayMapImp`, this policy finds the highest non-empty priority level in constant time regardless of `MaxPriorityLevel`,
+    ///       at the cost of keeping one occupancy bit and one task counter per priority level in sync on every `ready()` and `next()`.
+    /// @note The policy maker is called once for each priority level,
+    ///       and the returned policy instance should be unique for each level.
+    ///       The memory of returned policy instance is managed by this class.
+    ///       The policy maker must provide a deleter to avoid any memory leaks.
+    /// @seealso `SchedulingPolicyMakers` to see predefined policy makers.
+    ///
+    template <typename Task, typename PolicyMaker, size_t MaxPriorityLevel>
+    requires TaskConstraints::PrioritizableByPriority<Task> &&
+             Concepts::PolicyMaker<PolicyMaker, Task> &&
+             std::unsigned_integral<Traits::TaskPriority<Task>>
+    struct BitmapArrayMapImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// The priority level type
+        using Priority = Traits::TaskPriority<Task>;
+
+        /// A private map that maps priority levels to their scheduling policies
+        /// Non-existent priority levels are mapped to null pointers
+        std::array<Scheduler::Policy<Task>*, MaxPriorityLevel + 1> queues = {};
+
+        /// The number of ready tasks at each priority level
+        std::array<size_t, MaxPriorityLevel + 1> counts = {};
+
+        /// A bitmap where each bit indicates whether the corresponding priority level has any ready task
+        Containers::PriorityBitmap<MaxPriorityLevel + 1> bitmap;
+
+        ///
+        /// [Helper] Remove the given task from the queue of the given priority level
+        ///
+        /// @param task A non-null task that resides in the queue of the given priority level
+        /// @param priority The priority level at which the task was enqueued
+        ///
+        void removeFromLevel(Task* task, const Priority& priority)
+        {
+            passert(this->queues[priority] != nullptr && this->counts[priority] != 0, "The task should reside in the queue of the given priority level.");
+
+            this->queues[priority]->remove(task);
+
+            // Guard: Check whether the priority level has been drained
+            if (--this->counts[priority] == 0)
+            {
+                this->bitmap.clear(priority);
+            }
+        }
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Create the policy of every priority level if the policy maker requests eager initialization
+        ///
+        /// @note Otherwise, the policy of a priority level is created when the first task at that level is enqueued.
+        ///
+        BitmapArrayMapImp()
+        {
+            if constexpr (Concepts::EagerPolicyMaker<PolicyMaker>)
+            {
+                for (size_t priority = 0; priority <= MaxPriorityLevel; priority++)
+                {
+                    this->queues[priority] = PolicyMaker::create(static_cast<Priority>(priority));
+                }
+            }
+        }
+
+        /// Default Destructor
+        ~BitmapArrayMapImp()
+        {
+            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
+            {
+                if (*iterator != nullptr)
+                {
+                    PolicyMaker::destroy(*iterator);
+                }
+            }
+        }
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            // Guard: Check whether any priority level has a pending task
+            if (this->bitmap.isEmpty())
+            {
+                return nullptr;
+            }
+
+            // Dequeue from the highest non-empty priority level
+            size_t priority = this->bitmap.highest();
+
+            Task* next = this->queues[priority]->next();
+
+            passert(next != nullptr, "The highest non-empty priority level should have a pending task.");
+
+            // Guard: Check whether the priority level has been drained
+            if (--this->counts[priority] == 0)
+            {
+                this->bitmap.clear(priority);
+            }
+
+            return next;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task) override
+        {
+            const Priority& priority = task->getPriority();
+
+            // Guard: Check whether a scheduler is already available for the priority of the given task
+            if (this->queues[priority] == nullptr)
+            {
+                this->queues[priority] = PolicyMaker::create(priority);
+            }
+
+            // Guard: Scheduler should now be available
+            passert(this->queues[priority] != nullptr, "Scheduler for priority level should be non-null.");
+
+            this->queues[priority]->ready(task);
+
+            this->counts[priority] += 1;
+
+            this->bitmap.set(priority);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) override
+        {
+            this->removeFromLevel(task, task->getPriority());
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority)
+        {
+            this->removeFromLevel(task, oldPriority);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
+            {
+                // Guard: Ensure that the current priority level exists
+                if (*iterator != nullptr)
+                {
+                    (*iterator)->forEachTask(visitor, context);
+                }
+            }
+        }
+    };
+
+    ///
+    /// Implements the policy using a static array to map each priority level to a queue of the same type and a bitmap to locate the highest non-empty level
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam Policy Specify the type of scheduling policies to which the scheduler maps each priority level
+    /// @tparam MaxPriorityLevel Defines the value of the largest priority level
+    /// @note The length of the array map will be `max + 1`, so it is recommended to define a contiguous sequence of priority levels.
+    /// @note The priority level must be convertible to an unsigned integer.
+    /// @note Unlike `ArrayMapHomoImp`, this policy finds the highest non-empty priority level in constant time regardless of `MaxPriorityLevel`,
+    ///       at the cost of keeping one occupancy bit and one task counter per priority level in sync on every `ready()` and `next()`.
+    ///
+    template <typename Task, typename Policy, size_t MaxPriorityLevel>
+    requires TaskConstraints::PrioritizableByPriority<Task> && std::unsigned_integral<Traits::TaskPriority<Task>>
+    struct BitmapArrayMapHomoImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// The priority level type
+        using Priority = Traits::TaskPriority<Task>;
+
+        /// A private map that maps priority levels to their scheduling policies
+        std::array<Policy, MaxPriorityLevel + 1> queues = {};
+
+        /// The number of ready tasks at each priority level
+        std::array<size_t, MaxPriorityLevel + 1> counts = {};
+
+        /// A bitmap where each bit indicates whether the corresponding priority level has any ready task
+        Containers::PriorityBitmap<MaxPriorityLevel + 1> bitmap;
+
+        ///
+        /// [Helper] Remove the given task from the queue of the given priority level
+        ///
+        /// @param task A non-null task that resides in the queue of the given priority level
+        /// @param priority The priority level at which the task was enqueued
+        ///
+        void removeFromLevel(Task* task, const Priority& priority)
+        {
+            passert(this->counts[priority] != 0, "The task should reside in the queue of the given priority level.");
+
+            this->queues[priority].remove(task);
+
+            // Guard: Check whether the priority level has been drained
+            if (--this->counts[priority] == 0)
+            {
+                this->bitmap.clear(priority);
+            }
+        }
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            // Guard: Check whether any priority level has a pending task
+            if (this->bitmap.isEmpty())
+            {
+                return nullptr;
+            }
+
+            // Dequeue from the highest non-empty priority level
+            size_t priority = this->bitmap.highest();
+
+            Task* next = this->queues[priority].next();
+
+            passert(next != nullptr, "The highest non-empty priority level should have a pending task.");
+
+            // Guard: Check whether the priority level has been drained
+            if (--this->counts[priority] == 0)
+            {
+                this->bitmap.clear(priority);
+            }
+
+            return next;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task) override
+        {
+            const Priority& priority = task->getPriority();
+
+            this->queues[priority].ready(task);
+
+            this->counts[priority] += 1;
+
+            this->bitmap.set(priority);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) override
+        {
+            this->removeFromLevel(task, task->getPriority());
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority)
+        {
+            this->removeFromLevel(task, oldPriority);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
+            {
+                iterator->forEach([&](Task* task) { visitor(task, context); });
             }
+        }
+    };
+    ///
+    /// Implements the policy using a tuple to map each priority level to a queue whose type is known at compile time
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam LevelPolicy Specify the non-virtual scheduling policy of each priority level, starting from level 0
+    /// @note The number of priority levels is the number of level policies,
+    ///       and each level may use a different policy, e.g. FIFO queues for lower levels and a heap for the highest one.
+    /// @note All calls to level policies are resolved at compile time,
+    ///       so this policy does not need any virtual calls or pointer chasing to find the queue of a priority level.
+    /// @note The priority level must be convertible to an unsigned integer.
+    /// @note Since `Scheduler::Policy` requires the removal primitive, all level policies must be able to remove a task.
+    ///
+    template <typename Task, typename... LevelPolicy>
+    requires TaskConstraints::PrioritizableByPriority<Task> &&
+             std::unsigned_integral<Traits::TaskPriority<Task>> &&
+             (sizeof...(LevelPolicy) > 0) &&
+             (Concepts::Policy<LevelPolicy> && ...) &&
+             (std::same_as<typename LevelPolicy::SchedulableTask, Task> && ...) &&
+             (Concepts::RemovablePolicy<LevelPolicy> && ...)
+    struct TupleMapImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// The priority level type
+        using Priority = Traits::TaskPriority<Task>;
 
-            // No pending task
-            return nullptr;
+        /// The number of priority levels
+        static constexpr size_t kNumberOfLevels = sizeof...(LevelPolicy);
+
+        /// A private tuple that maps priority levels to their scheduling policies
+        std::tuple<LevelPolicy...> queues;
+
+        ///
+        /// [Helper] Dequeue the next ready task from the highest non-empty priority level
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        template <size_t... Levels>
+        Task* nextFromLevels(std::index_sequence<Levels...>)
+        {
+            Task* next = nullptr;
+
+            // From the highest priority level to the lowest
+            (((next = std::get<kNumberOfLevels - 1 - Levels>(this->queues).next()) != nullptr) || ...);
+
+            return next;
+        }
+
+        ///
+        /// [Helper] Visit every task in the priority levels from the highest one to the lowest one
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        ///
+        template <typename Visitor, size_t... Levels>
+        void forEachInLevels(Visitor& visitor, std::index_sequence<Levels...>)
+        {
+            (std::get<kNumberOfLevels - 1 - Levels>(this->queues).forEach(visitor), ...);
+        }
+
+        ///
+        /// [Helper] Apply the given action to the policy of the given priority level
+        ///
+        /// @param priority The priority level
+        /// @param action A callable object that takes the policy of the priority level
+        ///
+        template <typename Action, size_t... Levels>
+        void visit(const Priority& priority, Action&& action, std::index_sequence<Levels...>)
+        {
+            // Guard: The priority level must have a policy
+            passert(priority < kNumberOfLevels, "Scheduler for priority level should exist.");
+
+            ((priority == Levels ? (action(std::get<Levels>(this->queues)), true) : false) || ...);
+        }
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            return this->nextFromLevels(std::index_sequence_for<LevelPolicy...>{});
         }
 
         ///
@@ -556,32 +2927,276 @@ namespace Scheduler::Policies::PrioritizedMultiQueue::Virtual
         ///
         void ready(Task* task) override
         {
-            this->queues[task->getPriority()].ready(task);
+            this->visit(task->getPriority(), [task](auto& queue) { queue.ready(task); }, std::index_sequence_for<LevelPolicy...>{});
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) override
+        {
+            this->visit(task->getPriority(), [task](auto& queue) { queue.remove(task); }, std::index_sequence_for<LevelPolicy...>{});
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority)
+        {
+            this->visit(oldPriority, [task](auto& queue) { queue.remove(task); }, std::index_sequence_for<LevelPolicy...>{});
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            auto forward = [&](Task* task) { visitor(task, context); };
+
+            this->forEachInLevels(forward, std::index_sequence_for<LevelPolicy...>{});
         }
     };
 
     ///
-    /// Implements the policy using an array to map each priority level to a queue of the same type
+    /// Implements the policy using a sorted flat map that only keeps track of non-empty priority levels
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam PolicyMaker A callable type that maps a priority level to a scheduling policy
+    /// @note The priority level must be hashable.
+    /// @note Unlike `StlMapImp`, this policy removes a priority level as soon as it drains,
+    ///       so `next()` always finds the highest non-empty level at the end of the map in constant time,
+    ///       and `ready()` locates an existing level by a binary search over contiguous memory.
+    ///       It is suitable for priority levels that are sparse in a large space, e.g. 32-bit values.
+    /// @note The policy maker is called each time a priority level becomes non-empty,
+    ///       and the policy instance is returned to the policy maker once the level drains.
+    ///       Pair this policy with a pool-based policy maker, e.g. `StaticFIFO`, to avoid allocating memory on these transitions.
+    /// @seealso `SchedulingPolicyMakers` to see predefined policy makers.
+    ///
+    template <typename Task, typename PolicyMaker>
+    requires TaskConstraints::PrioritizableByPriority<Task> &&
+             Concepts::PolicyMaker<PolicyMaker, Task> &&
+             Hashable<Traits::TaskPriority<Task>>
+    struct SparseMapImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// The priority level type
+        using Priority = Traits::TaskPriority<Task>;
+
+        /// A private map that maps non-empty priority levels to their scheduling policies
+        Containers::FlatLevelMap<Priority, Scheduler::Policy<Task>> queues;
+
+        ///
+        /// [Helper] Remove the given task from the given priority level and erase the level if it drains
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @param priority The priority level where the task resides
+        ///
+        void removeFromLevel(Task* task, const Priority& priority)
+        {
+            auto* level = this->queues.find(priority);
+
+            passert(level != nullptr, "Scheduler for priority level should be non-null.");
+
+            level->queue->remove(task);
+
+            // Guard: Release the policy if the level drains
+            if (--level->count == 0)
+            {
+                PolicyMaker::destroy(level->queue);
+
+                this->queues.erase(*level);
+            }
+        }
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        /// Default Destructor
+        ~SparseMapImp()
+        {
+            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
+            {
+                PolicyMaker::destroy(iterator->queue);
+            }
+        }
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            // Guard: Check whether there is any non-empty priority level
+            if (this->queues.isEmpty())
+            {
+                return nullptr;
+            }
+
+            auto& level = this->queues.highest();
+
+            Task* next = level.queue->next();
+
+            passert(next != nullptr, "The highest non-empty priority level should have a ready task.");
+
+            // Guard: Release the policy if the level drains
+            if (--level.count == 0)
+            {
+                PolicyMaker::destroy(level.queue);
+
+                this->queues.erase(level);
+            }
+
+            return next;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task) override
+        {
+            auto& level = this->queues.findOrInsert(task->getPriority(), [](const Priority& priority) { return PolicyMaker::create(priority); });
+
+            // Guard: Scheduler should now be available
+            passert(level.queue != nullptr, "Scheduler for priority level should be non-null.");
+
+            level.queue->ready(task);
+
+            level.count += 1;
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) override
+        {
+            this->removeFromLevel(task, task->getPriority());
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority)
+        {
+            this->removeFromLevel(task, oldPriority);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
+            {
+                iterator->queue->forEachTask(visitor, context);
+            }
+        }
+    };
+
+    ///
+    /// Implements the policy using a sorted flat map that only keeps track of non-empty priority levels whose queues have the same type
     ///
     /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
     /// @tparam Policy Specify the type of scheduling policies to which the scheduler maps each priority level
     /// @note The priority level must be hashable.
+    /// @note Unlike `StlMapHomoImp`, this policy removes a priority level as soon as it drains,
+    ///       so `next()` always finds the highest non-empty level at the end of the map in constant time,
+    ///       and `ready()` locates an existing level by a binary search over contiguous memory.
+    ///       It is suitable for priority levels that are sparse in a large space, e.g. 32-bit values.
+    /// @note Policies of drained levels are kept aside and reused by levels that become non-empty later,
+    ///       so memory is allocated only when the number of non-empty levels exceeds its previous maximum.
     ///
     template <typename Task, typename Policy>
     requires TaskConstraints::PrioritizableByPriority<Task> && Hashable<Traits::TaskPriority<Task>>
-    struct StlMapHomoImp: public Scheduler::Policy<Task>
+    struct SparseMapHomoImp: public Scheduler::Policy<Task>
     {
     private:
         /// The priority level type
         using Priority = Traits::TaskPriority<Task>;
 
-        /// A private map that maps priority levels to their scheduling policies
-        std::map<Priority, Policy, std::greater<Priority>> queues;
+        /// A private map that maps non-empty priority levels to their scheduling policies
+        Containers::FlatLevelMap<Priority, Policy> queues;
+
+        /// Policies of drained priority levels that can be reused
+        std::vector<Policy*> spares;
+
+        ///
+        /// [Helper] Erase the given drained priority level and keep its policy for later reuse
+        ///
+        /// @param level A priority level that has no task
+        ///
+        void eraseLevel(typename Containers::FlatLevelMap<Priority, Policy>::Level& level)
+        {
+            this->spares.push_back(level.queue);
+
+            this->queues.erase(level);
+        }
+
+        ///
+        /// [Helper] Remove the given task from the given priority level and erase the level if it drains
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @param priority The priority level where the task resides
+        ///
+        void removeFromLevel(Task* task, const Priority& priority)
+        {
+            auto* level = this->queues.find(priority);
+
+            passert(level != nullptr, "Scheduler for priority level should exist.");
+
+            level->queue->remove(task);
+
+            // Guard: Erase the level if it drains
+            if (--level->count == 0)
+            {
+                this->eraseLevel(*level);
+            }
+        }
 
     public:
         /// Define the schedulable task type
         using SchedulableTask = Task;
 
+        /// Default Destructor
+        ~SparseMapHomoImp()
+        {
+            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
+            {
+                delete iterator->queue;
+            }
+
+            for (Policy* spare : this->spares)
+            {
+                delete spare;
+            }
+        }
+
         ///
         /// Dequeue the next ready schedulable task
         ///
@@ -589,19 +3204,25 @@ namespace Scheduler::Policies::PrioritizedMultiQueue::Virtual
         ///
         Task* next() override
         {
-            for (auto iterator = this->queues.begin(); iterator != this->queues.end(); iterator++)
+            // Guard: Check whether there is any non-empty priority level
+            if (this->queues.isEmpty())
             {
-                Task* next = iterator->second.next();
+                return nullptr;
+            }
 
-                // Guard: A higher priority task is pending
-                if (next != nullptr)
-                {
-                    return next;
-                }
+            auto& level = this->queues.highest();
+
+            Task* next = level.queue->next();
+
+            passert(next != nullptr, "The highest non-empty priority level should have a ready task.");
+
+            // Guard: Erase the level if it drains
+            if (--level.count == 0)
+            {
+                this->eraseLevel(level);
             }
 
-            // No pending task
-            return nullptr;
+            return next;
         }
 
         ///
@@ -611,9 +3232,66 @@ namespace Scheduler::Policies::PrioritizedMultiQueue::Virtual
         ///
         void ready(Task* task) override
         {
-            this->queues[task->getPriority()].ready(task);
+            auto& level = this->queues.findOrInsert(task->getPriority(), [this]([[maybe_unused]] const Priority& priority)
+            {
+                // Guard: Reuse the policy of a drained level if possible
+                if (this->spares.empty())
+                {
+                    return new Policy();
+                }
+
+                Policy* spare = this->spares.back();
+
+                this->spares.pop_back();
+
+                return spare;
+            });
+
+            level.queue->ready(task);
+
+            level.count += 1;
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) override
+        {
+            this->removeFromLevel(task, task->getPriority());
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note The task is removed from the queue of its previous priority level and then enqueued at its new level.
+        ///
+        void adjustPosition(Task* task, const Priority& oldPriority)
+        {
+            this->removeFromLevel(task, oldPriority);
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note Priority levels are visited from the highest to the lowest one.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            for (auto iterator = this->queues.rbegin(); iterator != this->queues.rend(); iterator++)
+            {
+                iterator->queue->forEach([&](Task* task) { visitor(task, context); });
+            }
         }
     };
+
 }
 
 #endif /* Scheduler_PrioritizedMultiQueue_hpp */
@@ -12,8 +12,218 @@
 
 #include <Scheduler/Policy/Policy.hpp>
 #include <Scheduler/Constraint/Prioritizable.hpp>
+#include <Scheduler/Constraint/HeapIndexable.hpp>
+#include <Scheduler/Container/IndexedHeap.hpp>
+#include <Scheduler/Container/PriorityArray.hpp>
 #include <LinkedList.hpp>
-#include <queue>
+#include <Debug.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <span>
+#include <vector>
+
+/// Defines helpers shared by the prioritized single queue policies
+namespace Scheduler::Policies::PrioritizedSingleQueue::Details
+{
+    ///
+    /// Move all tasks in the given source list to the end of the given destination list
+    ///
+    /// @param destination The list that receives the tasks
+    /// @param source The list to be emptied
+    ///
+    template <typename Task>
+    void append(LinkedList<Task>& destination, LinkedList<Task>& source)
+    {
+        while (!source.isEmpty())
+        {
+            destination.enqueue(source.dequeue());
+        }
+    }
+
+    ///
+    /// Merge two lists sorted by the task priority into the end of the given destination list
+    ///
+    /// @param destination The list that receives the merged tasks
+    /// @param left A sorted list of tasks that precede tasks of the same priority in the right list
+    /// @param right A sorted list of tasks
+    /// @note Both source lists are emptied. A task in the right list is taken first only if it has a strictly higher priority,
+    ///       so the merge is stable.
+    ///
+    template <typename Task>
+    void merge(LinkedList<Task>& destination, LinkedList<Task>& left, LinkedList<Task>& right)
+    {
+        using Greater = typename AnyPrioritizableTask<Task>::BridgedGreaterComparator;
+
+        Task* lhs = left.isEmpty() ? nullptr : left.dequeue();
+
+        Task* rhs = right.isEmpty() ? nullptr : right.dequeue();
+
+        while (lhs != nullptr && rhs != nullptr)
+        {
+            if (Greater{}(rhs, lhs))
+            {
+                destination.enqueue(rhs);
+
+                rhs = right.isEmpty() ? nullptr : right.dequeue();
+            }
+            else
+            {
+                destination.enqueue(lhs);
+
+                lhs = left.isEmpty() ? nullptr : left.dequeue();
+            }
+        }
+
+        if (lhs != nullptr)
+        {
+            destination.enqueue(lhs);
+
+            append(destination, left);
+        }
+
+        if (rhs != nullptr)
+        {
+            destination.enqueue(rhs);
+
+            append(destination, right);
+        }
+    }
+
+    ///
+    /// Insert a batch of tasks into a list sorted by the task priority
+    ///
+    /// @param queue A list sorted by the task priority in descending order
+    /// @param tasks Non-null tasks that do not reside in the list
+    /// @note The batch is sorted by a bottom-up merge sort on the intrusive links and then merged into the list in a single pass,
+    ///       which takes `O(m log m + n)` time for `m` new tasks and `n` queued tasks without allocating memory dynamically.
+    /// @note Tasks of the same priority end up in the same order as if they were inserted one by one,
+    ///       i.e. queued tasks precede new tasks, which keep their order in the batch.
+    ///
+    template <typename Task>
+    void insertBatch(LinkedList<Task>& queue, std::span<Task* const> tasks)
+    {
+        // The list at level `i` holds `2^i` sorted tasks, and a higher level holds tasks that appear earlier in the batch
+        LinkedList<Task> levels[64];
+
+        size_t numberOfLevels = 0;
+
+        LinkedList<Task> carry;
+
+        LinkedList<Task> merged;
+
+        for (Task* task : tasks)
+        {
+            carry.enqueue(task);
+
+            size_t level = 0;
+
+            for (; level < numberOfLevels && !levels[level].isEmpty(); level += 1)
+            {
+                merge(merged, levels[level], carry);
+
+                append(carry, merged);
+            }
+
+            append(levels[level], carry);
+
+            numberOfLevels = std::max(numberOfLevels, level + 1);
+        }
+
+        // Collapse the levels from the latest tasks to the earliest ones
+        for (size_t level = 0; level < numberOfLevels; level += 1)
+        {
+            merge(merged, levels[level], carry);
+
+            append(carry, merged);
+        }
+
+        merge(merged, queue, carry);
+
+        append(queue, merged);
+    }
+
+    ///
+    /// Insert a batch of tasks into a binary max-heap stored in the given vector
+    ///
+    /// @param queue A vector organized as a binary max-heap by the given comparator
+    /// @param tasks Non-null tasks that do not reside in the heap
+    /// @note The heap is rebuilt in linear time by `std::make_heap()` if that is cheaper than sifting tasks up one by one.
+    ///
+    template <typename Task, typename Comparator>
+    void pushHeapBatch(std::vector<Task*>& queue, std::span<Task* const> tasks)
+    {
+        size_t first = queue.size();
+
+        queue.insert(queue.end(), tasks.begin(), tasks.end());
+
+        // Guard: Rebuild the whole heap if the batch is large
+        // Sifting costs about `count * height` steps while rebuilding costs about `size` steps
+        if (tasks.size() * std::bit_width(queue.size()) >= queue.size())
+        {
+            std::make_heap(queue.begin(), queue.end(), Comparator{});
+
+            return;
+        }
+
+        for (size_t index = first + 1; index <= queue.size(); index += 1)
+        {
+            std::push_heap(queue.begin(), queue.begin() + static_cast<ptrdiff_t>(index), Comparator{});
+        }
+    }
+
+    ///
+    /// Restore the heap property after the task at the given index has been replaced or repositioned
+    ///
+    /// @param queue A vector organized as a binary max-heap by the given comparator except for the task at the given index
+    /// @param index The index of the task that may violate the heap property
+    /// @note The task is sifted up if it now precedes its parent, otherwise it is sifted down, thus taking logarithmic time.
+    ///
+    template <typename Task, typename Comparator>
+    void restoreHeap(std::vector<Task*>& queue, size_t index)
+    {
+        Comparator comparator;
+
+        // Guard: Sift the task up if it now precedes its parent
+        if (index > 0 && comparator(queue[(index - 1) / 2], queue[index]))
+        {
+            std::push_heap(queue.begin(), queue.begin() + static_cast<ptrdiff_t>(index + 1), comparator);
+
+            return;
+        }
+
+        // Sift the task down while one of its children precedes it
+        while (true)
+        {
+            size_t largest = index;
+
+            size_t left = 2 * index + 1;
+
+            size_t right = left + 1;
+
+            if (left < queue.size() && comparator(queue[largest], queue[left]))
+            {
+                largest = left;
+            }
+
+            if (right < queue.size() && comparator(queue[largest], queue[right]))
+            {
+                largest = right;
+            }
+
+            if (largest == index)
+            {
+                return;
+            }
+
+            std::swap(queue[index], queue[largest]);
+
+            index = largest;
+        }
+    }
+}
 
 ///
 /// Defines scheduling policies that prioritizes schedulable tasks in a single queue
@@ -60,20 +270,74 @@ namespace Scheduler::Policies::PrioritizedSingleQueue::Normal
         {
             this->queue.template insert(task, typename AnyPrioritizableTask<Task>::BridgedGreaterComparator{});
         }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method unlinks the task in constant time through its intrusive links.
+        ///
+        void remove(Task* task)
+        {
+            this->queue.remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note This method unlinks the task in constant time and then inserts it back to keep the queue sorted.
+        ///
+        template <typename Priority>
+        void adjustPosition(Task* task, [[maybe_unused]] const Priority& oldPriority)
+        {
+            this->queue.remove(task);
+
+            this->queue.template insert(task, typename AnyPrioritizableTask<Task>::BridgedGreaterComparator{});
+        }
+
+        ///
+        /// Enqueue a batch of ready schedulable tasks
+        ///
+        /// @param tasks Non-null tasks that are ready to run
+        /// @note This method sorts the batch on the intrusive links and merges it into the queue in a single pass,
+        ///       instead of walking the queue once per task. Ties are broken in the same way as enqueuing tasks one by one.
+        ///
+        void readyBatch(std::span<Task* const> tasks)
+        {
+            Details::insertBatch(this->queue, tasks);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor)
+        {
+            this->queue.forEach(visitor);
+        }
     };
 
     ///
     /// Implements the policy by maintaining a STL priority queue of schedulable tasks
     ///
     /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @note Removing or repositioning a task takes linear time, since the heap does not know where the task resides and must search for it.
+    ///       Use `DaryHeapImp` on hot paths that remove or reposition tasks, which keeps the position of each task in the task itself.
     ///
     template <typename Task>
     requires TaskConstraints::AnyPrioritizable<Task>
     struct StlPriorityQueueImp
     {
     private:
-        /// An internal priority queue
-        std::priority_queue<Task*, std::vector<Task*>, typename AnyPrioritizableTask<Task>::BridgedLessComparator> queue;
+        /// The comparator that keeps the task with the highest priority at the front of the heap
+        using Comparator = typename AnyPrioritizableTask<Task>::BridgedLessComparator;
+
+        /// An internal priority queue organized as a binary max-heap
+        std::vector<Task*> queue;
 
     public:
         /// Define the schedulable task type
@@ -92,9 +356,11 @@ namespace Scheduler::Policies::PrioritizedSingleQueue::Normal
                 return nullptr;
             }
 
-            Task* task = this->queue.top();
+            std::pop_heap(this->queue.begin(), this->queue.end(), Comparator{});
+
+            Task* task = this->queue.back();
 
-            this->queue.pop();
+            this->queue.pop_back();
 
             return task;
         }
@@ -107,30 +373,104 @@ namespace Scheduler::Policies::PrioritizedSingleQueue::Normal
         ///
         void ready(Task* task)
         {
-            this->queue.push(task);
+            this->queue.push_back(task);
+
+            std::push_heap(this->queue.begin(), this->queue.end(), Comparator{});
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method locates the task by a linear search, which dominates the logarithmic cost of restoring the heap.
+        ///
+        void remove(Task* task)
+        {
+            auto iterator = std::find(this->queue.begin(), this->queue.end(), task);
+
+            passert(iterator != this->queue.end(), "The task to be removed should reside in the ready queue.");
+
+            auto index = static_cast<size_t>(iterator - this->queue.begin());
+
+            // Move the last task to the vacant slot and restore the heap property from there
+            *iterator = this->queue.back();
+
+            this->queue.pop_back();
+
+            // Guard: The removed task was the last one
+            if (index == this->queue.size())
+            {
+                return;
+            }
+
+            Details::restoreHeap<Task, Comparator>(this->queue, index);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note This method locates the task by a linear search, which dominates the logarithmic cost of sifting it to its new position.
+        ///
+        template <typename Priority>
+        void adjustPosition(Task* task, [[maybe_unused]] const Priority& oldPriority)
+        {
+            auto iterator = std::find(this->queue.begin(), this->queue.end(), task);
+
+            passert(iterator != this->queue.end(), "The task to be adjusted should reside in the ready queue.");
+
+            Details::restoreHeap<Task, Comparator>(this->queue, static_cast<size_t>(iterator - this->queue.begin()));
+        }
+
+        ///
+        /// Enqueue a batch of ready schedulable tasks
+        ///
+        /// @param tasks Non-null tasks that are ready to run
+        /// @note This method rebuilds the heap in linear time if that is cheaper than enqueuing tasks one by one.
+        ///
+        void readyBatch(std::span<Task* const> tasks)
+        {
+            Details::pushHeapBatch<Task, Comparator>(this->queue, tasks);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note This method sorts a copy of the heap, so it allocates memory dynamically.
+        ///       Tasks that have the same priority level are visited in an unspecified order.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) const
+        {
+            std::vector<Task*> sorted(this->queue);
+
+            std::sort(sorted.begin(), sorted.end(), [](Task* lhs, Task* rhs) { return Comparator{}(rhs, lhs); });
+
+            for (Task* task : sorted)
+            {
+                visitor(task);
+            }
         }
     };
-}
 
-///
-/// Defines scheduling policies that prioritizes schedulable tasks in a single queue
-///
-/// @note All structs implement the interface `SchedulingPolicy` thus their instances can be treated as opaque policies.
-///
-namespace Scheduler::Policies::PrioritizedSingleQueue::Virtual
-{
     ///
-    /// Implements the policy by maintaining a linked list of schedulable tasks without allocating memory dynamically
+    /// Implements the policy by maintaining an intrusive d-ary heap of schedulable tasks
     ///
     /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam Arity Specify the number of children of each node in the heap, 4 by default
+    /// @note Each task stores its own position in the heap,
+    ///       so this policy enqueues, dequeues, removes and repositions a task in logarithmic time.
+    /// @note Tasks that have the same priority level are not guaranteed to be dequeued in the order they are enqueued.
     ///
-    template <typename Task>
-    requires ListableItem<Task> && TaskConstraints::AnyPrioritizable<Task>
-    struct LinkedListImp: public Scheduler::Policy<Task>
+    template <typename Task, size_t Arity = 4>
+    requires TaskConstraints::HeapIndexable<Task> && TaskConstraints::AnyPrioritizable<Task>
+    struct DaryHeapImp
     {
     private:
-        /// An internal FIFO queue
-        LinkedList<Task> queue;
+        /// An internal heap that keeps the task with the highest priority at the root
+        Containers::IndexedDaryHeap<Task, typename AnyPrioritizableTask<Task>::BridgedGreaterComparator, Arity> queue;
 
     public:
         /// Define the schedulable task type
@@ -141,10 +481,10 @@ namespace Scheduler::Policies::PrioritizedSingleQueue::Virtual
         ///
         /// @returns A task that is ready to run, `NULL` if no task is ready.
         ///
-        Task* next() override
+        Task* next()
         {
             // Guard: Check whether the queue is empty
-            return this->queue.isEmpty() ? nullptr : this->queue.removeFirst();
+            return this->queue.isEmpty() ? nullptr : this->queue.pop();
         }
 
         ///
@@ -153,24 +493,122 @@ namespace Scheduler::Policies::PrioritizedSingleQueue::Virtual
         /// @param task A non-null task that is ready to run
         /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
         ///
-        void ready(Task* task) override
+        void ready(Task* task)
         {
-            this->queue.template insert(task, typename AnyPrioritizableTask<Task>::BridgedGreaterComparator{});
+            this->queue.push(task);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method locates the task in constant time through the heap index stored in the task.
+        ///
+        void remove(Task* task)
+        {
+            this->queue.remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note This method moves the task up or down the heap in logarithmic time.
+        ///
+        template <typename Priority>
+        void adjustPosition(Task* task, [[maybe_unused]] const Priority& oldPriority)
+        {
+            this->queue.update(task);
+        }
+
+        ///
+        /// Enqueue a batch of ready schedulable tasks
+        ///
+        /// @param tasks Non-null tasks that are ready to run
+        /// @note This method rebuilds the heap in linear time if that is cheaper than enqueuing tasks one by one.
+        ///
+        void readyBatch(std::span<Task* const> tasks)
+        {
+            this->queue.pushBatch(tasks);
+        }
+
+        ///
+        /// Remove a batch of schedulable tasks from the ready queue
+        ///
+        /// @param tasks Non-null tasks that reside in the ready queue
+        /// @note This method compacts and rebuilds the heap in linear time if that is cheaper than removing tasks one by one.
+        ///
+        void removeBatch(std::span<Task* const> tasks)
+        {
+            this->queue.removeBatch(tasks);
+        }
+
+        ///
+        /// Reserve the storage for the given number of ready tasks
+        ///
+        /// @param capacity The expected maximum number of ready tasks
+        /// @note Reserving the storage beforehand keeps memory allocations off the path that readies a task.
+        ///
+        void reserve(size_t capacity)
+        {
+            this->queue.reserve(capacity);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note This method sorts a copy of the heap, so it allocates memory dynamically.
+        ///       Tasks that have the same priority level are visited in an unspecified order.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) const
+        {
+            this->queue.forEach(visitor);
         }
     };
 
     ///
-    /// Implements the policy by maintaining a STL priority queue of schedulable tasks
+    /// Implements the policy by maintaining an intrusive d-ary heap of schedulable tasks that breaks ties in FIFO order
     ///
     /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam Arity Specify the number of children of each node in the heap, 4 by default
+    /// @note Each task is stamped with a monotonically increasing sequence number when it is enqueued,
+    ///       so tasks that have the same priority level are served on a first-come, first-served basis,
+    ///       which is identical to the behavior of `LinkedListImp` but runs in logarithmic time.
     ///
-    template <typename Task>
-    requires TaskConstraints::AnyPrioritizable<Task>
-    struct StlPriorityQueueImp: public Scheduler::Policy<Task>
+    template <typename Task, size_t Arity = 4>
+    requires TaskConstraints::StableHeapIndexable<Task> && TaskConstraints::AnyPrioritizable<Task>
+    struct StableDaryHeapImp
     {
     private:
-        /// An internal priority queue
-        std::priority_queue<Task*, std::vector<Task*>, typename AnyPrioritizableTask<Task>::BridgedLessComparator> queue;
+        /// The comparator that orders tasks by priority level and then by their enqueue sequence number
+        struct Comparator
+        {
+            bool operator()(Task* const& lhs, Task* const& rhs)
+            {
+                AnyPrioritizableTask<Task> left(*lhs), right(*rhs);
+
+                if (left > right)
+                {
+                    return true;
+                }
+
+                if (right > left)
+                {
+                    return false;
+                }
+
+                return lhs->getHeapSequence() < rhs->getHeapSequence();
+            }
+        };
+
+        /// An internal heap that keeps the task with the highest priority at the root
+        Containers::IndexedDaryHeap<Task, Comparator, Arity> queue;
+
+        /// The sequence number to be assigned to the next enqueued task
+        uint64_t sequence = 0;
 
     public:
         /// Define the schedulable task type
@@ -181,19 +619,10 @@ namespace Scheduler::Policies::PrioritizedSingleQueue::Virtual
         ///
         /// @returns A task that is ready to run, `NULL` if no task is ready.
         ///
-        Task* next() override
+        Task* next()
         {
             // Guard: Check whether the queue is empty
-            if (this->queue.empty())
-            {
-                return nullptr;
-            }
-
-            Task* task = this->queue.top();
-
-            this->queue.pop();
-
-            return task;
+            return this->queue.isEmpty() ? nullptr : this->queue.pop();
         }
 
         ///
@@ -202,10 +631,1163 @@ namespace Scheduler::Policies::PrioritizedSingleQueue::Virtual
         /// @param task A non-null task that is ready to run
         /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
         ///
-        void ready(Task* task) override
+        void ready(Task* task)
         {
+            task->setHeapSequence(this->sequence++);
+
             this->queue.push(task);
         }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method locates the task in constant time through the heap index stored in the task.
+        ///
+        void remove(Task* task)
+        {
+            this->queue.remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note This method moves the task up or down the heap in logarithmic time.
+        /// @note The task is placed after all other tasks at its new priority level as if it were enqueued again,
+        ///       which is identical to the behavior of `LinkedListImp`.
+        ///
+        template <typename Priority>
+        void adjustPosition(Task* task, [[maybe_unused]] const Priority& oldPriority)
+        {
+            task->setHeapSequence(this->sequence++);
+
+            this->queue.update(task);
+        }
+
+        ///
+        /// Enqueue a batch of ready schedulable tasks
+        ///
+        /// @param tasks Non-null tasks that are ready to run in the order they become ready
+        /// @note This method rebuilds the heap in linear time if that is cheaper than enqueuing tasks one by one.
+        ///
+        void readyBatch(std::span<Task* const> tasks)
+        {
+            for (Task* task : tasks)
+            {
+                task->setHeapSequence(this->sequence++);
+            }
+
+            this->queue.pushBatch(tasks);
+        }
+
+        ///
+        /// Remove a batch of schedulable tasks from the ready queue
+        ///
+        /// @param tasks Non-null tasks that reside in the ready queue
+        /// @note This method compacts and rebuilds the heap in linear time if that is cheaper than removing tasks one by one.
+        ///
+        void removeBatch(std::span<Task* const> tasks)
+        {
+            this->queue.removeBatch(tasks);
+        }
+
+        ///
+        /// Reserve the storage for the given number of ready tasks
+        ///
+        /// @param capacity The expected maximum number of ready tasks
+        /// @note Reserving the storage beforehand keeps memory allocations off the path that readies a task.
+        ///
+        void reserve(size_t capacity)
+        {
+            this->queue.reserve(capacity);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note This method sorts a copy of the heap, so it allocates memory dynamically.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) const
+        {
+            this->queue.forEach(visitor);
+        }
+    };
+
+    ///
+    /// Implements the policy by maintaining the priority levels and the ready tasks in two parallel arrays of a fixed capacity
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam Capacity Specify the maximum number of ready tasks, 256 by default
+    /// @note Priority levels are copied into a contiguous aligned array when tasks are enqueued,
+    ///       so selecting the next task scans the array of keys with `Containers::PriorityScanner` without dereferencing any task control block.
+    ///       Enqueuing a task runs in constant time, while dequeuing, removing and repositioning a task run in linear time
+    ///       that is dominated by sequential memory accesses, which is suitable for short ready queues of tasks that have large control blocks.
+    /// @note Tasks that have the same priority level are dequeued in the order they are enqueued.
+    /// @warning The priority level of a task must not be changed while the task resides in the queue unless `adjustPosition()` is invoked.
+    ///
+    template <typename Task, size_t Capacity = 256>
+    requires TaskConstraints::PrioritizableByPriority<Task> && std::integral<typename Task::Priority>
+    struct PackedArrayImp
+    {
+    private:
+        /// The scanner that finds the highest priority level
+        using Scanner = Containers::PriorityScanner<typename Task::Priority>;
+
+        /// The number of slots of priority levels, rounded up to a multiple of the number of keys compared at once
+        static constexpr size_t kNumberOfSlots = (Capacity + Scanner::kLanes - 1) / Scanner::kLanes * Scanner::kLanes;
+
+        /// The value of unused slots of priority levels
+        static constexpr typename Task::Priority kPadding = std::numeric_limits<typename Task::Priority>::min();
+
+        /// Priority levels of ready tasks in the order they are enqueued followed by padding
+        alignas(32) std::array<typename Task::Priority, kNumberOfSlots> priorities;
+
+        /// Ready tasks in the order they are enqueued, parallel to `priorities`
+        std::array<Task*, Capacity> tasks;
+
+        /// The number of ready tasks
+        size_t count = 0;
+
+        ///
+        /// [Helper] Remove the task at the given position and close the gap, preserving the order of the remaining tasks
+        ///
+        /// @param index The position of the task in the arrays
+        /// @return The removed task.
+        ///
+        Task* erase(size_t index)
+        {
+            Task* task = this->tasks[index];
+
+            std::copy(this->priorities.begin() + index + 1, this->priorities.begin() + this->count, this->priorities.begin() + index);
+
+            std::copy(this->tasks.begin() + index + 1, this->tasks.begin() + this->count, this->tasks.begin() + index);
+
+            this->count -= 1;
+
+            this->priorities[this->count] = kPadding;
+
+            return task;
+        }
+
+        ///
+        /// [Helper] Find the position of the given task
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @return The position of the task in the arrays.
+        ///
+        size_t find(Task* task) const
+        {
+            auto index = static_cast<size_t>(std::find(this->tasks.begin(), this->tasks.begin() + this->count, task) - this->tasks.begin());
+
+            passert(index < this->count, "The given task must reside in the ready queue.");
+
+            return index;
+        }
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        /// Create an empty ready queue
+        PackedArrayImp()
+        {
+            this->priorities.fill(kPadding);
+        }
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        /// @note This method picks the first task that has the highest priority level by scanning the contiguous priority levels.
+        ///
+        Task* next()
+        {
+            // Guard: Check whether the queue is empty
+            if (this->count == 0)
+            {
+                return nullptr;
+            }
+
+            return this->erase(Scanner::findHighest(this->priorities.data(), this->count));
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
+        /// @warning The queue must not be full.
+        ///
+        void ready(Task* task)
+        {
+            passert(this->count < Capacity, "The ready queue must not be full.");
+
+            this->priorities[this->count] = task->getPriority();
+
+            this->tasks[this->count] = task;
+
+            this->count += 1;
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method scans the contiguous array of tasks to locate the given task.
+        ///
+        void remove(Task* task)
+        {
+            this->erase(this->find(task));
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note This method moves the task to the end of the queue with its new priority level,
+        ///       so it is served after other tasks of the same priority level, which is identical to the behavior of `LinkedListImp`.
+        ///
+        template <typename Priority>
+        void adjustPosition(Task* task, [[maybe_unused]] const Priority& oldPriority)
+        {
+            this->erase(this->find(task));
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note This method sorts a copy of the tasks by priority level, which keeps tasks of the same level in the order they are enqueued.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) const
+        {
+            std::vector<Task*> sorted(this->tasks.begin(), this->tasks.begin() + this->count);
+
+            std::stable_sort(sorted.begin(), sorted.end(), [](Task* lhs, Task* rhs) { return lhs->getPriority() > rhs->getPriority(); });
+
+            for (Task* task : sorted)
+            {
+                visitor(task);
+            }
+        }
+    };
+
+    ///
+    /// Implements the policy by maintaining an unsorted array of a fixed capacity that is scanned for the highest priority level
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam Capacity Specify the maximum number of ready tasks, 64 by default
+    /// @note Priority levels are copied into a contiguous aligned array when tasks are enqueued,
+    ///       and the highest one is found with SIMD instructions if the target supports them.
+    ///       Enqueuing a task runs in constant time, and dequeuing a task runs in linear time with a predictable latency
+    ///       that never touches a task control block other than the one being dequeued, which suits a few dozen ready tasks.
+    /// @note A task is removed by moving the last task into its slot,
+    ///       so tasks that have the same priority level are not guaranteed to be dequeued in the order they are enqueued.
+    /// @warning The priority level of a task must not be changed while the task resides in the queue unless `adjustPosition()` is invoked.
+    /// @seealso `PackedArrayImp` to preserve the order of tasks that have the same priority level.
+    ///
+    template <typename Task, size_t Capacity = 64>
+    requires TaskConstraints::PrioritizableByPriority<Task> && std::integral<typename Task::Priority>
+    struct UnsortedArrayImp
+    {
+    private:
+        /// Priority levels of ready tasks
+        Containers::PriorityArray<typename Task::Priority, Capacity> priorities;
+
+        /// Ready tasks, parallel to `priorities`
+        std::array<Task*, Capacity> tasks;
+
+        ///
+        /// [Helper] Remove the task at the given position by moving the last task into its slot
+        ///
+        /// @param index The position of the task in the arrays
+        /// @return The removed task.
+        ///
+        Task* erase(size_t index)
+        {
+            Task* task = this->tasks[index];
+
+            this->tasks[index] = this->tasks[this->priorities.remove(index)];
+
+            return task;
+        }
+
+        ///
+        /// [Helper] Find the position of the given task
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @return The position of the task in the arrays.
+        ///
+        size_t find(Task* task) const
+        {
+            auto index = static_cast<size_t>(std::find(this->tasks.begin(), this->tasks.begin() + this->priorities.size(), task) - this->tasks.begin());
+
+            passert(index < this->priorities.size(), "The given task must reside in the ready queue.");
+
+            return index;
+        }
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next()
+        {
+            // Guard: Check whether the queue is empty
+            return this->priorities.isEmpty() ? nullptr : this->erase(this->priorities.findHighest());
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
+        /// @warning The queue must not be full.
+        ///
+        void ready(Task* task)
+        {
+            this->tasks[this->priorities.push(task->getPriority())] = task;
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method scans the array of tasks to locate the given task and then moves the last task into its slot.
+        ///
+        void remove(Task* task)
+        {
+            this->erase(this->find(task));
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note This method locates the task and updates its priority level in place.
+        ///
+        template <typename Priority>
+        void adjustPosition(Task* task, [[maybe_unused]] const Priority& oldPriority)
+        {
+            this->priorities.set(this->find(task), task->getPriority());
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        /// @note This method sorts a copy of the tasks by priority level.
+        ///       Tasks that have the same priority level are visited in an unspecified order.
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) const
+        {
+            std::vector<Task*> sorted(this->tasks.begin(), this->tasks.begin() + this->priorities.size());
+
+            std::sort(sorted.begin(), sorted.end(), [](Task* lhs, Task* rhs) { return lhs->getPriority() > rhs->getPriority(); });
+
+            for (Task* task : sorted)
+            {
+                visitor(task);
+            }
+        }
+    };
+}
+
+///
+/// Defines scheduling policies that prioritizes schedulable tasks in a single queue
+///
+/// @note All structs implement the interface `SchedulingPolicy` thus their instances can be treated as opaque policies.
+///
+namespace Scheduler::Policies::PrioritizedSingleQueue::Virtual
+{
+    ///
+    /// Implements the policy by maintaining a linked list of schedulable tasks without allocating memory dynamically
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    ///
+    template <typename Task>
+    requires ListableItem<Task> && TaskConstraints::AnyPrioritizable<Task>
+    struct LinkedListImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// An internal FIFO queue
+        LinkedList<Task> queue;
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            // Guard: Check whether the queue is empty
+            return this->queue.isEmpty() ? nullptr : this->queue.removeFirst();
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
+        ///
+        void ready(Task* task) override
+        {
+            this->queue.template insert(task, typename AnyPrioritizableTask<Task>::BridgedGreaterComparator{});
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method unlinks the task in constant time through its intrusive links.
+        ///
+        void remove(Task* task) override
+        {
+            this->queue.remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note This method unlinks the task in constant time and then inserts it back to keep the queue sorted.
+        ///
+        template <typename Priority>
+        void adjustPosition(Task* task, [[maybe_unused]] const Priority& oldPriority)
+        {
+            this->queue.remove(task);
+
+            this->queue.template insert(task, typename AnyPrioritizableTask<Task>::BridgedGreaterComparator{});
+        }
+
+        ///
+        /// Enqueue a batch of ready schedulable tasks
+        ///
+        /// @param tasks Non-null tasks that are ready to run
+        /// @note This method sorts the batch on the intrusive links and merges it into the queue in a single pass,
+        ///       instead of walking the queue once per task. Ties are broken in the same way as enqueuing tasks one by one.
+        ///
+        void readyBatch(std::span<Task* const> tasks)
+        {
+            Details::insertBatch(this->queue, tasks);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            this->queue.forEach([&](Task* task) { visitor(task, context); });
+        }
+    };
+
+    ///
+    /// Implements the policy by maintaining a STL priority queue of schedulable tasks
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @note Removing or repositioning a task takes linear time, since the heap does not know where the task resides and must search for it.
+    ///       Use `DaryHeapImp` on hot paths that remove or reposition tasks, which keeps the position of each task in the task itself.
+    ///
+    template <typename Task>
+    requires TaskConstraints::AnyPrioritizable<Task>
+    struct StlPriorityQueueImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// The comparator that keeps the task with the highest priority at the front of the heap
+        using Comparator = typename AnyPrioritizableTask<Task>::BridgedLessComparator;
+
+        /// An internal priority queue organized as a binary max-heap
+        std::vector<Task*> queue;
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            // Guard: Check whether the queue is empty
+            if (this->queue.empty())
+            {
+                return nullptr;
+            }
+
+            std::pop_heap(this->queue.begin(), this->queue.end(), Comparator{});
+
+            Task* task = this->queue.back();
+
+            this->queue.pop_back();
+
+            return task;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
+        ///
+        void ready(Task* task) override
+        {
+            this->queue.push_back(task);
+
+            std::push_heap(this->queue.begin(), this->queue.end(), Comparator{});
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method locates the task by a linear search, which dominates the logarithmic cost of restoring the heap.
+        ///
+        void remove(Task* task) override
+        {
+            auto iterator = std::find(this->queue.begin(), this->queue.end(), task);
+
+            passert(iterator != this->queue.end(), "The task to be removed should reside in the ready queue.");
+
+            auto index = static_cast<size_t>(iterator - this->queue.begin());
+
+            // Move the last task to the vacant slot and restore the heap property from there
+            *iterator = this->queue.back();
+
+            this->queue.pop_back();
+
+            // Guard: The removed task was the last one
+            if (index == this->queue.size())
+            {
+                return;
+            }
+
+            Details::restoreHeap<Task, Comparator>(this->queue, index);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note This method locates the task by a linear search, which dominates the logarithmic cost of sifting it to its new position.
+        ///
+        template <typename Priority>
+        void adjustPosition(Task* task, [[maybe_unused]] const Priority& oldPriority)
+        {
+            auto iterator = std::find(this->queue.begin(), this->queue.end(), task);
+
+            passert(iterator != this->queue.end(), "The task to be adjusted should reside in the ready queue.");
+
+            Details::restoreHeap<Task, Comparator>(this->queue, static_cast<size_t>(iterator - this->queue.begin()));
+        }
+
+        ///
+        /// Enqueue a batch of ready schedulable tasks
+        ///
+        /// @param tasks Non-null tasks that are ready to run
+        /// @note This method rebuilds the heap in linear time if that is cheaper than enqueuing tasks one by one.
+        ///
+        void readyBatch(std::span<Task* const> tasks)
+        {
+            Details::pushHeapBatch<Task, Comparator>(this->queue, tasks);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note This method sorts a copy of the heap, so it allocates memory dynamically.
+        ///       Tasks that have the same priority level are visited in an unspecified order.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            std::vector<Task*> sorted(this->queue);
+
+            std::sort(sorted.begin(), sorted.end(), [](Task* lhs, Task* rhs) { return Comparator{}(rhs, lhs); });
+
+            for (Task* task : sorted)
+            {
+                visitor(task, context);
+            }
+        }
+    };
+
+    ///
+    /// Implements the policy by maintaining an intrusive d-ary heap of schedulable tasks
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam Arity Specify the number of children of each node in the heap, 4 by default
+    /// @note Each task stores its own position in the heap,
+    ///       so this policy enqueues, dequeues, removes and repositions a task in logarithmic time.
+    /// @note Tasks that have the same priority level are not guaranteed to be dequeued in the order they are enqueued.
+    ///
+    template <typename Task, size_t Arity = 4>
+    requires TaskConstraints::HeapIndexable<Task> && TaskConstraints::AnyPrioritizable<Task>
+    struct DaryHeapImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// An internal heap that keeps the task with the highest priority at the root
+        Containers::IndexedDaryHeap<Task, typename AnyPrioritizableTask<Task>::BridgedGreaterComparator, Arity> queue;
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            // Guard: Check whether the queue is empty
+            return this->queue.isEmpty() ? nullptr : this->queue.pop();
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
+        ///
+        void ready(Task* task) override
+        {
+            this->queue.push(task);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method locates the task in constant time through the heap index stored in the task.
+        ///
+        void remove(Task* task) override
+        {
+            this->queue.remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note This method moves the task up or down the heap in logarithmic time.
+        ///
+        template <typename Priority>
+        void adjustPosition(Task* task, [[maybe_unused]] const Priority& oldPriority)
+        {
+            this->queue.update(task);
+        }
+
+        ///
+        /// Enqueue a batch of ready schedulable tasks
+        ///
+        /// @param tasks Non-null tasks that are ready to run
+        /// @note This method rebuilds the heap in linear time if that is cheaper than enqueuing tasks one by one.
+        ///
+        void readyBatch(std::span<Task* const> tasks)
+        {
+            this->queue.pushBatch(tasks);
+        }
+
+        ///
+        /// Remove a batch of schedulable tasks from the ready queue
+        ///
+        /// @param tasks Non-null tasks that reside in the ready queue
+        /// @note This method compacts and rebuilds the heap in linear time if that is cheaper than removing tasks one by one.
+        ///
+        void removeBatch(std::span<Task* const> tasks)
+        {
+            this->queue.removeBatch(tasks);
+        }
+
+        ///
+        /// Reserve the storage for the given number of ready tasks
+        ///
+        /// @param capacity The expected maximum number of ready tasks
+        /// @note Reserving the storage beforehand keeps memory allocations off the path that readies a task.
+        ///
+        void reserve(size_t capacity)
+        {
+            this->queue.reserve(capacity);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note This method sorts a copy of the heap, so it allocates memory dynamically.
+        ///       Tasks that have the same priority level are visited in an unspecified order.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            this->queue.forEach([&](Task* task) { visitor(task, context); });
+        }
+    };
+
+    ///
+    /// Implements the policy by maintaining an intrusive d-ary heap of schedulable tasks that breaks ties in FIFO order
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam Arity Specify the number of children of each node in the heap, 4 by default
+    /// @note Each task is stamped with a monotonically increasing sequence number when it is enqueued,
+    ///       so tasks that have the same priority level are served on a first-come, first-served basis,
+    ///       which is identical to the behavior of `LinkedListImp` but runs in logarithmic time.
+    ///
+    template <typename Task, size_t Arity = 4>
+    requires TaskConstraints::StableHeapIndexable<Task> && TaskConstraints::AnyPrioritizable<Task>
+    struct StableDaryHeapImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// The comparator that orders tasks by priority level and then by their enqueue sequence number
+        struct Comparator
+        {
+            bool operator()(Task* const& lhs, Task* const& rhs)
+            {
+                AnyPrioritizableTask<Task> left(*lhs), right(*rhs);
+
+                if (left > right)
+                {
+                    return true;
+                }
+
+                if (right > left)
+                {
+                    return false;
+                }
+
+                return lhs->getHeapSequence() < rhs->getHeapSequence();
+            }
+        };
+
+        /// An internal heap that keeps the task with the highest priority at the root
+        Containers::IndexedDaryHeap<Task, Comparator, Arity> queue;
+
+        /// The sequence number to be assigned to the next enqueued task
+        uint64_t sequence = 0;
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            // Guard: Check whether the queue is empty
+            return this->queue.isEmpty() ? nullptr : this->queue.pop();
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
+        ///
+        void ready(Task* task) override
+        {
+            task->setHeapSequence(this->sequence++);
+
+            this->queue.push(task);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method locates the task in constant time through the heap index stored in the task.
+        ///
+        void remove(Task* task) override
+        {
+            this->queue.remove(task);
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note This method moves the task up or down the heap in logarithmic time.
+        /// @note The task is placed after all other tasks at its new priority level as if it were enqueued again,
+        ///       which is identical to the behavior of `LinkedListImp`.
+        ///
+        template <typename Priority>
+        void adjustPosition(Task* task, [[maybe_unused]] const Priority& oldPriority)
+        {
+            task->setHeapSequence(this->sequence++);
+
+            this->queue.update(task);
+        }
+
+        ///
+        /// Enqueue a batch of ready schedulable tasks
+        ///
+        /// @param tasks Non-null tasks that are ready to run in the order they become ready
+        /// @note This method rebuilds the heap in linear time if that is cheaper than enqueuing tasks one by one.
+        ///
+        void readyBatch(std::span<Task* const> tasks)
+        {
+            for (Task* task : tasks)
+            {
+                task->setHeapSequence(this->sequence++);
+            }
+
+            this->queue.pushBatch(tasks);
+        }
+
+        ///
+        /// Remove a batch of schedulable tasks from the ready queue
+        ///
+        /// @param tasks Non-null tasks that reside in the ready queue
+        /// @note This method compacts and rebuilds the heap in linear time if that is cheaper than removing tasks one by one.
+        ///
+        void removeBatch(std::span<Task* const> tasks)
+        {
+            this->queue.removeBatch(tasks);
+        }
+
+        ///
+        /// Reserve the storage for the given number of ready tasks
+        ///
+        /// @param capacity The expected maximum number of ready tasks
+        /// @note Reserving the storage beforehand keeps memory allocations off the path that readies a task.
+        ///
+        void reserve(size_t capacity)
+        {
+            this->queue.reserve(capacity);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note This method sorts a copy of the heap, so it allocates memory dynamically.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            this->queue.forEach([&](Task* task) { visitor(task, context); });
+        }
+    };
+
+    ///
+    /// Implements the policy by maintaining the priority levels and the ready tasks in two parallel arrays of a fixed capacity
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam Capacity Specify the maximum number of ready tasks, 256 by default
+    /// @note Priority levels are copied into a contiguous aligned array when tasks are enqueued,
+    ///       so selecting the next task scans the array of keys with `Containers::PriorityScanner` without dereferencing any task control block.
+    ///       Enqueuing a task runs in constant time, while dequeuing, removing and repositioning a task run in linear time
+    ///       that is dominated by sequential memory accesses, which is suitable for short ready queues of tasks that have large control blocks.
+    /// @note Tasks that have the same priority level are dequeued in the order they are enqueued.
+    /// @warning The priority level of a task must not be changed while the task resides in the queue unless `adjustPosition()` is invoked.
+    ///
+    template <typename Task, size_t Capacity = 256>
+    requires TaskConstraints::PrioritizableByPriority<Task> && std::integral<typename Task::Priority>
+    struct PackedArrayImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// The scanner that finds the highest priority level
+        using Scanner = Containers::PriorityScanner<typename Task::Priority>;
+
+        /// The number of slots of priority levels, rounded up to a multiple of the number of keys compared at once
+        static constexpr size_t kNumberOfSlots = (Capacity + Scanner::kLanes - 1) / Scanner::kLanes * Scanner::kLanes;
+
+        /// The value of unused slots of priority levels
+        static constexpr typename Task::Priority kPadding = std::numeric_limits<typename Task::Priority>::min();
+
+        /// Priority levels of ready tasks in the order they are enqueued followed by padding
+        alignas(32) std::array<typename Task::Priority, kNumberOfSlots> priorities;
+
+        /// Ready tasks in the order they are enqueued, parallel to `priorities`
+        std::array<Task*, Capacity> tasks;
+
+        /// The number of ready tasks
+        size_t count = 0;
+
+        ///
+        /// [Helper] Remove the task at the given position and close the gap, preserving the order of the remaining tasks
+        ///
+        /// @param index The position of the task in the arrays
+        /// @return The removed task.
+        ///
+        Task* erase(size_t index)
+        {
+            Task* task = this->tasks[index];
+
+            std::copy(this->priorities.begin() + index + 1, this->priorities.begin() + this->count, this->priorities.begin() + index);
+
+            std::copy(this->tasks.begin() + index + 1, this->tasks.begin() + this->count, this->tasks.begin() + index);
+
+            this->count -= 1;
+
+            this->priorities[this->count] = kPadding;
+
+            return task;
+        }
+
+        ///
+        /// [Helper] Find the position of the given task
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @return The position of the task in the arrays.
+        ///
+        size_t find(Task* task) const
+        {
+            auto index = static_cast<size_t>(std::find(this->tasks.begin(), this->tasks.begin() + this->count, task) - this->tasks.begin());
+
+            passert(index < this->count, "The given task must reside in the ready queue.");
+
+            return index;
+        }
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        /// Create an empty ready queue
+        PackedArrayImp()
+        {
+            this->priorities.fill(kPadding);
+        }
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        /// @note This method picks the first task that has the highest priority level by scanning the contiguous priority levels.
+        ///
+        Task* next() override
+        {
+            // Guard: Check whether the queue is empty
+            if (this->count == 0)
+            {
+                return nullptr;
+            }
+
+            return this->erase(Scanner::findHighest(this->priorities.data(), this->count));
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
+        /// @warning The queue must not be full.
+        ///
+        void ready(Task* task) override
+        {
+            passert(this->count < Capacity, "The ready queue must not be full.");
+
+            this->priorities[this->count] = task->getPriority();
+
+            this->tasks[this->count] = task;
+
+            this->count += 1;
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method scans the contiguous array of tasks to locate the given task.
+        ///
+        void remove(Task* task) override
+        {
+            this->erase(this->find(task));
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note This method moves the task to the end of the queue with its new priority level,
+        ///       so it is served after other tasks of the same priority level, which is identical to the behavior of `LinkedListImp`.
+        ///
+        template <typename Priority>
+        void adjustPosition(Task* task, [[maybe_unused]] const Priority& oldPriority)
+        {
+            this->erase(this->find(task));
+
+            this->ready(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note This method sorts a copy of the tasks by priority level, which keeps tasks of the same level in the order they are enqueued.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            std::vector<Task*> sorted(this->tasks.begin(), this->tasks.begin() + this->count);
+
+            std::stable_sort(sorted.begin(), sorted.end(), [](Task* lhs, Task* rhs) { return lhs->getPriority() > rhs->getPriority(); });
+
+            for (Task* task : sorted)
+            {
+                visitor(task, context);
+            }
+        }
+    };
+
+    ///
+    /// Implements the policy by maintaining an unsorted array of a fixed capacity that is scanned for the highest priority level
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam Capacity Specify the maximum number of ready tasks, 64 by default
+    /// @note Priority levels are copied into a contiguous aligned array when tasks are enqueued,
+    ///       and the highest one is found with SIMD instructions if the target supports them.
+    ///       Enqueuing a task runs in constant time, and dequeuing a task runs in linear time with a predictable latency
+    ///       that never touches a task control block other than the one being dequeued, which suits a few dozen ready tasks.
+    /// @note A task is removed by moving the last task into its slot,
+    ///       so tasks that have the same priority level are not guaranteed to be dequeued in the order they are enqueued.
+    /// @warning The priority level of a task must not be changed while the task resides in the queue unless `adjustPosition()` is invoked.
+    /// @seealso `PackedArrayImp` to preserve the order of tasks that have the same priority level.
+    ///
+    template <typename Task, size_t Capacity = 64>
+    requires TaskConstraints::PrioritizableByPriority<Task> && std::integral<typename Task::Priority>
+    struct UnsortedArrayImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// Priority levels of ready tasks
+        Containers::PriorityArray<typename Task::Priority, Capacity> priorities;
+
+        /// Ready tasks, parallel to `priorities`
+        std::array<Task*, Capacity> tasks;
+
+        ///
+        /// [Helper] Remove the task at the given position by moving the last task into its slot
+        ///
+        /// @param index The position of the task in the arrays
+        /// @return The removed task.
+        ///
+        Task* erase(size_t index)
+        {
+            Task* task = this->tasks[index];
+
+            this->tasks[index] = this->tasks[this->priorities.remove(index)];
+
+            return task;
+        }
+
+        ///
+        /// [Helper] Find the position of the given task
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @return The position of the task in the arrays.
+        ///
+        size_t find(Task* task) const
+        {
+            auto index = static_cast<size_t>(std::find(this->tasks.begin(), this->tasks.begin() + this->priorities.size(), task) - this->tasks.begin());
+
+            passert(index < this->priorities.size(), "The given task must reside in the ready queue.");
+
+            return index;
+        }
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            // Guard: Check whether the queue is empty
+            return this->priorities.isEmpty() ? nullptr : this->erase(this->priorities.findHighest());
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
+        /// @warning The queue must not be full.
+        ///
+        void ready(Task* task) override
+        {
+            this->tasks[this->priorities.push(task->getPriority())] = task;
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method scans the array of tasks to locate the given task and then moves the last task into its slot.
+        ///
+        void remove(Task* task) override
+        {
+            this->erase(this->find(task));
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note This method locates the task and updates its priority level in place.
+        ///
+        template <typename Priority>
+        void adjustPosition(Task* task, [[maybe_unused]] const Priority& oldPriority)
+        {
+            this->priorities.set(this->find(task), task->getPriority());
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        /// @note This method sorts a copy of the tasks by priority level.
+        ///       Tasks that have the same priority level are visited in an unspecified order.
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            std::vector<Task*> sorted(this->tasks.begin(), this->tasks.begin() + this->priorities.size());
+
+            std::sort(sorted.begin(), sorted.end(), [](Task* lhs, Task* rhs) { return lhs->getPriority() > rhs->getPriority(); });
+
+            for (Task* task : sorted)
+            {
+                visitor(task, context);
+            }
+        }
     };
 }
 
@@ -0,0 +1,533 @@
+//
+//  PriorityInheritance.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_PriorityInheritance_hpp
+#define Scheduler_PriorityInheritance_hpp
+
+#include <Scheduler/Policy/Policy.hpp>
+#include <Scheduler/Constraint/PriorityInheritable.hpp>
+#include <Scheduler/Misc/Traits.hpp>
+#include <Debug.hpp>
+#include <span>
+
+/// The root namespace for the scheduler module where core components are defined
+namespace Scheduler
+{
+    ///
+    /// A mutex whose owner inherits the priority of its waiters and optionally runs at a fixed ceiling priority
+    ///
+    /// @tparam Task Specify the type of the task that locks the mutex
+    /// @note The mutex only records its owner and its waiters. It is locked and unlocked through the scheduler,
+    ///       e.g. via `EventHandlers::PriorityInheritance::LockMutex` and `EventHandlers::PriorityInheritance::UnlockMutex`.
+    /// @note Waiters are linked through the storage provided by `PriorityInheritable` in the order they arrived,
+    ///       so that finding the waiter of the highest priority visits all waiters, which are usually few.
+    ///
+    template <typename Task>
+    class PriorityInheritanceMutex
+    {
+    public:
+        /// Type of the priority level of the task
+        using Priority = typename Task::Priority;
+
+    private:
+        /// The task that holds the mutex, `NULL` if the mutex is unlocked
+        Task* owner = nullptr;
+
+        /// The first task that waits for the mutex
+        Task* waiters = nullptr;
+
+        /// The mutex acquired by the owner before this one
+        PriorityInheritanceMutex* nextHeld = nullptr;
+
+        /// The priority at which the owner runs at least
+        Priority ceiling = {};
+
+        /// `true` if the owner is raised to the ceiling priority
+        bool ceilingEnabled = false;
+
+    public:
+        ///
+        /// Create a mutex that implements the priority inheritance protocol
+        ///
+        PriorityInheritanceMutex() = default;
+
+        ///
+        /// Create a mutex that also implements the immediate priority ceiling protocol
+        ///
+        /// @param ceiling The priority at which the owner runs at least, which should be the highest priority of all tasks that may lock the mutex
+        ///
+        explicit PriorityInheritanceMutex(const Priority& ceiling) : ceiling(ceiling), ceilingEnabled(true) {}
+
+        /// The mutex is referenced by its owner and its waiters
+        PriorityInheritanceMutex(const PriorityInheritanceMutex&) = delete;
+
+        /// The mutex is referenced by its owner and its waiters
+        PriorityInheritanceMutex& operator=(const PriorityInheritanceMutex&) = delete;
+
+        ///
+        /// Get the task that holds the mutex
+        ///
+        /// @return The owner of the mutex, `NULL` if the mutex is unlocked.
+        ///
+        [[nodiscard]]
+        Task* getOwner() const
+        {
+            return this->owner;
+        }
+
+        ///
+        /// Set the task that holds the mutex
+        ///
+        /// @param task The new owner, `NULL` to unlock the mutex
+        /// @note This method is invoked by the scheduler only.
+        ///
+        void setOwner(Task* task)
+        {
+            this->owner = task;
+        }
+
+        ///
+        /// Check whether any task waits for the mutex
+        ///
+        /// @return `true` if at least one task waits for the mutex, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool hasWaiters() const
+        {
+            return this->waiters != nullptr;
+        }
+
+        ///
+        /// Get the mutex acquired by the owner before this one
+        ///
+        /// @return The next mutex in the list of mutexes held by the owner.
+        ///
+        [[nodiscard]]
+        PriorityInheritanceMutex* getNextHeld() const
+        {
+            return this->nextHeld;
+        }
+
+        ///
+        /// Set the mutex acquired by the owner before this one
+        ///
+        /// @param mutex The next mutex in the list of mutexes held by the owner
+        /// @note This method is invoked by the scheduler only.
+        ///
+        void setNextHeld(PriorityInheritanceMutex* mutex)
+        {
+            this->nextHeld = mutex;
+        }
+
+        ///
+        /// Check whether the owner of the mutex runs at least at a ceiling priority
+        ///
+        /// @return `true` if the mutex has been created with a ceiling priority, `false` otherwise.
+        ///
+        [[nodiscard]]
+        bool hasCeiling() const
+        {
+            return this->ceilingEnabled;
+        }
+
+        ///
+        /// Get the ceiling priority of the mutex
+        ///
+        /// @return The priority at which the owner runs at least, valid only if `hasCeiling()` returns `true`.
+        ///
+        [[nodiscard]]
+        const Priority& getCeiling() const
+        {
+            return this->ceiling;
+        }
+
+        ///
+        /// Append a task to the waiters of the mutex
+        ///
+        /// @param task A non-null task that is about to block on the mutex
+        /// @note This method is invoked by the scheduler only.
+        ///
+        void addWaiter(Task* task)
+        {
+            task->setNextWaiter(nullptr);
+
+            // Guard: Check whether the task is the first waiter
+            if (this->waiters == nullptr)
+            {
+                this->waiters = task;
+
+                return;
+            }
+
+            Task* last = this->waiters;
+
+            while (last->getNextWaiter() != nullptr)
+            {
+                last = last->getNextWaiter();
+            }
+
+            last->setNextWaiter(task);
+        }
+
+        ///
+        /// Get the waiter that has the highest priority
+        ///
+        /// @return The waiter of the highest priority that arrived first, `NULL` if no task waits for the mutex.
+        ///
+        [[nodiscard]]
+        Task* getHighestWaiter() const
+        {
+            Task* highest = this->waiters;
+
+            for (Task* waiter = this->waiters; waiter != nullptr; waiter = waiter->getNextWaiter())
+            {
+                if (waiter->getPriority() > highest->getPriority())
+                {
+                    highest = waiter;
+                }
+            }
+
+            return highest;
+        }
+
+        ///
+        /// Remove the given task from the waiters of the mutex
+        ///
+        /// @param task A non-null task that waits for the mutex
+        /// @note This method is invoked by the scheduler only.
+        ///
+        void removeWaiter(Task* task)
+        {
+            Task* previous = nullptr;
+
+            Task* waiter = this->waiters;
+
+            while (waiter != task)
+            {
+                passert(waiter != nullptr, "The task must wait for the mutex.");
+
+                previous = waiter;
+
+                waiter = waiter->getNextWaiter();
+            }
+
+            if (previous == nullptr)
+            {
+                this->waiters = task->getNextWaiter();
+            }
+            else
+            {
+                previous->setNextWaiter(task->getNextWaiter());
+            }
+
+            task->setNextWaiter(nullptr);
+        }
+    };
+}
+
+///
+/// Defines the components of the priority inheritance protocol
+///
+/// @note A task that blocks on a mutex lends its priority to the owner of the mutex,
+///       and to the owner of the mutex that the owner waits for, along the full chain of blocked tasks,
+///       so that a low priority task holding a mutex cannot be delayed indefinitely by medium priority tasks
+///       while a high priority task waits for it. The owner returns to the highest priority among its base priority,
+///       the waiters of the mutexes it still holds and their ceilings once it releases a mutex.
+///
+namespace Scheduler::Policies::PriorityInheritance
+{
+    ///
+    /// A scheduling policy that boosts the owners of mutexes to the priorities of their waiters
+    ///
+    /// @tparam BasePolicy Specify a policy that prioritizes ready tasks by their mutable priority and can adjust the position of a task,
+    ///                    e.g. `PrioritizedSingleQueue::Normal::StableDaryHeapImp`
+    /// @note The policy records whether each task resides in the ready queue,
+    ///       so that a boosted owner that is ready is repositioned via `adjustPosition()` instead of being removed and enqueued again,
+    ///       while a boosted owner that is blocked or running simply receives its new priority.
+    /// @note Boosts are applied when a task starts to wait and undone when a mutex is released,
+    ///       so the cost of a lock or an unlock is proportional to the length of the chain and the number of waiters involved.
+    /// @warning The caller must not change the priority of a task that holds or waits for a mutex,
+    ///          and must not kill a task that waits for a mutex.
+    ///
+    template <typename BasePolicy>
+    requires Concepts::Policy<BasePolicy> &&
+             TaskConstraints::PriorityInheritable<Traits::PolicyTask<BasePolicy>> &&
+             Concepts::AdjustablePolicy<BasePolicy, typename Traits::PolicyTask<BasePolicy>::Priority>
+    struct PolicyWithPriorityInheritance: public BasePolicy
+    {
+    public:
+        /// Type of the task managed by the policy component
+        using Task = Traits::PolicyTask<BasePolicy>;
+
+        /// Type of the priority level of the task
+        using Priority = typename Task::Priority;
+
+        /// Type of the mutex
+        using Mutex = PriorityInheritanceMutex<Task>;
+
+    private:
+        ///
+        /// [Helper] Change the effective priority of the given task and reposition it if it is ready
+        ///
+        /// @param task A non-null task
+        /// @param priority The new effective priority
+        ///
+        void setEffectivePriority(Task* task, const Priority& priority)
+        {
+            // Guard: Check whether the priority is actually changed
+            if (task->getPriority() == priority)
+            {
+                return;
+            }
+
+            Priority oldPriority = task->getPriority();
+
+            task->setPriority(priority);
+
+            if (task->isInReadyQueue())
+            {
+                BasePolicy::adjustPosition(task, oldPriority);
+            }
+        }
+
+        ///
+        /// [Helper] Compute the priority inherited by the given task from the mutexes it holds
+        ///
+        /// @param task A non-null task
+        /// @return The highest priority among the base priority of the task, the ceilings of the mutexes it holds and their waiters.
+        ///
+        static Priority getInheritedPriority(const Task* task)
+        {
+            Priority priority = task->getBasePriority();
+
+            for (const Mutex* mutex = task->getHeldMutexes(); mutex != nullptr; mutex = mutex->getNextHeld())
+            {
+                if (mutex->hasCeiling() && mutex->getCeiling() > priority)
+                {
+                    priority = mutex->getCeiling();
+                }
+
+                const Task* waiter = mutex->getHighestWaiter();
+
+                if (waiter != nullptr && waiter->getPriority() > priority)
+                {
+                    priority = waiter->getPriority();
+                }
+            }
+
+            return priority;
+        }
+
+        ///
+        /// [Helper] Grant the given unlocked mutex to the given task
+        ///
+        /// @param task A non-null task that becomes the owner
+        /// @param mutex A non-null mutex that is not held by any task
+        ///
+        void grant(Task* task, Mutex* mutex)
+        {
+            // Record the base priority when the task acquires its first mutex
+            if (task->getHeldMutexes() == nullptr)
+            {
+                task->setBasePriority(task->getPriority());
+            }
+
+            mutex->setOwner(task);
+
+            mutex->setNextHeld(task->getHeldMutexes());
+
+            task->setHeldMutexes(mutex);
+
+            Priority priority = getInheritedPriority(task);
+
+            if (priority > task->getPriority())
+            {
+                this->setEffectivePriority(task, priority);
+            }
+        }
+
+    public:
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next()
+        {
+            Task* task = BasePolicy::next();
+
+            if (task != nullptr)
+            {
+                task->setInReadyQueue(false);
+            }
+
+            return task;
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        ///
+        void ready(Task* task)
+        {
+            BasePolicy::ready(task);
+
+            task->setInReadyQueue(true);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        ///
+        void remove(Task* task) requires Concepts::RemovablePolicy<BasePolicy>
+        {
+            BasePolicy::remove(task);
+
+            task->setInReadyQueue(false);
+        }
+
+        ///
+        /// Enqueue a batch of ready schedulable tasks
+        ///
+        /// @param tasks Non-null tasks that are ready to run
+        ///
+        void readyBatch(std::span<Task* const> tasks) requires Concepts::BatchReadyPolicy<BasePolicy>
+        {
+            BasePolicy::readyBatch(tasks);
+
+            for (Task* task : tasks)
+            {
+                task->setInReadyQueue(true);
+            }
+        }
+
+        ///
+        /// Remove a batch of schedulable tasks from the ready queue
+        ///
+        /// @param tasks Non-null tasks that reside in the ready queue
+        ///
+        void removeBatch(std::span<Task* const> tasks) requires Concepts::BatchRemovablePolicy<BasePolicy>
+        {
+            BasePolicy::removeBatch(tasks);
+
+            for (Task* task : tasks)
+            {
+                task->setInReadyQueue(false);
+            }
+        }
+
+        ///
+        /// Acquire the given mutex on behalf of the given task if it is unlocked
+        ///
+        /// @param task The non-null current running task
+        /// @param mutex A non-null mutex
+        /// @return `true` if the task now holds the mutex, `false` if the mutex is held by another task.
+        /// @note The task is raised to the ceiling of the mutex if any.
+        ///
+        bool tryAcquire(Task* task, Mutex* mutex)
+        {
+            passert(mutex->getOwner() != task, "A task must not lock a mutex that it already holds.");
+
+            // Guard: Check whether the mutex is held by another task
+            if (mutex->getOwner() != nullptr)
+            {
+                return false;
+            }
+
+            this->grant(task, mutex);
+
+            return true;
+        }
+
+        ///
+        /// Let the given task wait for the given mutex and lend its priority to the chain of owners
+        ///
+        /// @param task The non-null current running task that is about to block
+        /// @param mutex A non-null mutex held by another task
+        /// @note Each owner along the chain is boosted to the priority of the task, stopping at the first owner that already runs at least at that priority.
+        /// @note This method does not dequeue any task. The caller treats the task as blocked afterwards.
+        ///
+        void wait(Task* task, Mutex* mutex)
+        {
+            passert(mutex->getOwner() != nullptr && mutex->getOwner() != task, "The mutex must be held by another task.");
+
+            mutex->addWaiter(task);
+
+            task->setBlockingMutex(mutex);
+
+            // Walk the chain of blocked owners
+            for (Mutex* blocking = mutex; blocking != nullptr; blocking = blocking->getOwner()->getBlockingMutex())
+            {
+                Task* owner = blocking->getOwner();
+
+                passert(owner != task, "Deadlock: The task waits for a mutex held by itself through a chain of blocked tasks.");
+
+                // Guard: The owner and the rest of the chain already run at least at the priority of the task
+                if (owner->getPriority() >= task->getPriority())
+                {
+                    break;
+                }
+
+                this->setEffectivePriority(owner, task->getPriority());
+            }
+        }
+
+        ///
+        /// Release the given mutex held by the given task and hand it over to the waiter of the highest priority
+        ///
+        /// @param task The non-null current running task that holds the mutex
+        /// @param mutex A non-null mutex held by the task
+        /// @return The waiter that now holds the mutex and should be unblocked by the caller, `NULL` if no task waits for the mutex.
+        /// @note The task returns to the priority it inherits from the mutexes it still holds, or to its base priority if it holds none.
+        ///
+        Task* release(Task* task, Mutex* mutex)
+        {
+            passert(mutex->getOwner() == task, "A task must not unlock a mutex that it does not hold.");
+
+            // Unlink the mutex from the list of mutexes held by the task, which is usually the most recently acquired one
+            if (task->getHeldMutexes() == mutex)
+            {
+                task->setHeldMutexes(mutex->getNextHeld());
+            }
+            else
+            {
+                Mutex* previous = task->getHeldMutexes();
+
+                while (previous->getNextHeld() != mutex)
+                {
+                    previous = previous->getNextHeld();
+                }
+
+                previous->setNextHeld(mutex->getNextHeld());
+            }
+
+            mutex->setNextHeld(nullptr);
+
+            mutex->setOwner(nullptr);
+
+            this->setEffectivePriority(task, getInheritedPriority(task));
+
+            // Hand the mutex over to the waiter of the highest priority
+            Task* waiter = mutex->getHighestWaiter();
+
+            if (waiter != nullptr)
+            {
+                mutex->removeWaiter(waiter);
+
+                waiter->setBlockingMutex(nullptr);
+
+                this->grant(waiter, mutex);
+            }
+
+            return waiter;
+        }
+    };
+}
+
+#endif /* Scheduler_PriorityInheritance_hpp */
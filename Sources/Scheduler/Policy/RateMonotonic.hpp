@@ -0,0 +1,398 @@
+//
+//  RateMonotonic.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_RateMonotonic_hpp
+#define Scheduler_RateMonotonic_hpp
+
+#include <Scheduler/Policy/Policy.hpp>
+#include <Scheduler/Constraint/Periodic.hpp>
+#include <Scheduler/Constraint/Prioritizable.hpp>
+#include <Scheduler/Misc/Traits.hpp>
+#include <Debug.hpp>
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+/// Defines concepts related to scheduler components
+namespace Scheduler::Concepts
+{
+    /// A schedulability test that keeps the state of admitted tasks and decides whether another task can be admitted in constant time
+    template <typename Bound>
+    concept SchedulabilityBound = requires(Bound& bound, const Bound& constBound, double utilization)
+    {
+        /// The bound can be initialized with zero arguments
+        requires std::default_initializable<Bound>;
+
+        /// The bound must admit a task of the given utilization if the task set remains schedulable and return `true`,
+        /// or leave its state unchanged and return `false` otherwise
+        { bound.tryAdmit(utilization) } -> std::same_as<bool>;
+
+        /// The bound must forget an admitted task of the given utilization
+        { bound.release(utilization) } -> std::same_as<void>;
+
+        /// The bound must report the total utilization of admitted tasks
+        { constBound.getUtilization() } -> std::same_as<double>;
+
+        /// The bound must report the number of admitted tasks
+        { constBound.size() } -> std::same_as<size_t>;
+    };
+}
+
+/// Defines the components of rate-monotonic scheduling
+///
+/// @note A rate-monotonic scheduler assigns static priority levels to periodic tasks,
+///       so that a task that has a shorter period has a higher priority level,
+///       and always runs the ready task that has the highest priority level.
+///
+namespace Scheduler::Policies::RateMonotonic
+{
+    ///
+    /// Map the period of a task to a priority level by dividing periods into buckets of the same width
+    ///
+    /// @tparam MaxPriorityLevel Specify the largest priority level, which is assigned to the tasks of the shortest periods
+    /// @tparam BucketWidth Specify the number of consecutive periods that share a priority level, 1 by default
+    /// @note Periods from 1 to `BucketWidth` are mapped to `MaxPriorityLevel`, the next `BucketWidth` periods to the level below, and so on.
+    ///       Longer periods that exceed the range share the priority level 1, since the level 0 is reserved for the idle task.
+    /// @note Distinct periods that fall into the same bucket share a priority level, which is not rate-monotonic.
+    ///       `PolicyWithAdmissionControl` rejects a task whose period differs from that of the tasks already admitted at its level,
+    ///       so choose the width and the number of levels to separate the periods of the expected task set.
+    ///
+    template <size_t MaxPriorityLevel, uint64_t BucketWidth = 1>
+    requires (MaxPriorityLevel > 0 && BucketWidth > 0)
+    struct LinearPeriodBuckets
+    {
+        template <std::unsigned_integral Tick>
+        size_t operator()(Tick period) const
+        {
+            uint64_t bucket = (static_cast<uint64_t>(period) - 1) / BucketWidth;
+
+            return MaxPriorityLevel - static_cast<size_t>(std::min<uint64_t>(bucket, MaxPriorityLevel - 1));
+        }
+    };
+
+    ///
+    /// The utilization bound of rate-monotonic scheduling derived by Liu and Layland
+    ///
+    /// @note A set of `n` periodic tasks is schedulable if its total utilization does not exceed `n * (2^(1/n) - 1)`.
+    ///       The bound keeps a running sum of utilization, so each admission runs in constant time
+    ///       without analyzing the admitted tasks again.
+    /// @note The test is sufficient but not necessary, e.g. a harmonic task set may be schedulable with a utilization up to 1.
+    ///
+    struct LiuLaylandBound
+    {
+    private:
+        /// The total utilization of admitted tasks
+        double utilization = 0;
+
+        /// The number of admitted tasks
+        size_t count = 0;
+
+    public:
+        ///
+        /// Admit a task of the given utilization if the task set remains schedulable
+        ///
+        /// @param utilization The ratio of the worst-case execution time of the task to its period
+        /// @return `true` if the task has been admitted, `false` otherwise.
+        ///
+        bool tryAdmit(double utilization)
+        {
+            double total = this->utilization + utilization;
+
+            auto n = static_cast<double>(this->count + 1);
+
+            // Guard: Reject the task if the total utilization exceeds the bound
+            if (total > n * (std::exp2(1.0 / n) - 1.0))
+            {
+                return false;
+            }
+
+            this->utilization = total;
+
+            this->count += 1;
+
+            return true;
+        }
+
+        ///
+        /// Forget an admitted task of the given utilization
+        ///
+        /// @param utilization The utilization of the task when it was admitted
+        /// @note The sum is reset once no task is admitted, so that rounding errors do not accumulate.
+        ///
+        void release(double utilization)
+        {
+            this->count -= 1;
+
+            this->utilization = this->count == 0 ? 0 : std::max(0.0, this->utilization - utilization);
+        }
+
+        ///
+        /// Get the total utilization of admitted tasks
+        ///
+        /// @return The sum of the utilization of all admitted tasks.
+        ///
+        [[nodiscard]]
+        double getUtilization() const
+        {
+            return this->utilization;
+        }
+
+        ///
+        /// Get the number of admitted tasks
+        ///
+        /// @return The number of tasks admitted and not yet released.
+        ///
+        [[nodiscard]]
+        size_t size() const
+        {
+            return this->count;
+        }
+    };
+
+    ///
+    /// The hyperbolic bound of rate-monotonic scheduling derived by Bini, Buttazzo and Buttazzo
+    ///
+    /// @note A set of periodic tasks is schedulable if the product of `(U_i + 1)` over all tasks does not exceed 2.
+    ///       The bound keeps a running product, so each admission runs in constant time,
+    ///       and it admits every task set admitted by the Liu and Layland bound and more.
+    ///
+    struct HyperbolicBound
+    {
+    private:
+        /// The product of one plus the utilization of each admitted task
+        double product = 1;
+
+        /// The total utilization of admitted tasks
+        double utilization = 0;
+
+        /// The number of admitted tasks
+        size_t count = 0;
+
+    public:
+        ///
+        /// Admit a task of the given utilization if the task set remains schedulable
+        ///
+        /// @param utilization The ratio of the worst-case execution time of the task to its period
+        /// @return `true` if the task has been admitted, `false` otherwise.
+        ///
+        bool tryAdmit(double utilization)
+        {
+            double product = this->product * (utilization + 1.0);
+
+            // Guard: Reject the task if the product exceeds the bound
+            if (product > 2.0)
+            {
+                return false;
+            }
+
+            this->product = product;
+
+            this->utilization += utilization;
+
+            this->count += 1;
+
+            return true;
+        }
+
+        ///
+        /// Forget an admitted task of the given utilization
+        ///
+        /// @param utilization The utilization of the task when it was admitted
+        /// @note The product is reset once no task is admitted, so that rounding errors do not accumulate.
+        ///
+        void release(double utilization)
+        {
+            this->count -= 1;
+
+            if (this->count == 0)
+            {
+                this->product = 1;
+
+                this->utilization = 0;
+            }
+            else
+            {
+                this->product = std::max(1.0, this->product / (utilization + 1.0));
+
+                this->utilization = std::max(0.0, this->utilization - utilization);
+            }
+        }
+
+        ///
+        /// Get the total utilization of admitted tasks
+        ///
+        /// @return The sum of the utilization of all admitted tasks.
+        ///
+        [[nodiscard]]
+        double getUtilization() const
+        {
+            return this->utilization;
+        }
+
+        ///
+        /// Get the number of admitted tasks
+        ///
+        /// @return The number of tasks admitted and not yet released.
+        ///
+        [[nodiscard]]
+        size_t size() const
+        {
+            return this->count;
+        }
+    };
+
+    ///
+    /// A scheduling policy that admits periodic tasks through a schedulability test and assigns their priority levels by their periods
+    ///
+    /// @tparam BasePolicy Specify a policy that runs the ready task that has the highest priority level,
+    ///                    e.g. `PrioritizedMultiQueue::Normal::BitmapArrayMapImp` for constant-time dispatch
+    /// @tparam Bound Specify the schedulability test, `LiuLaylandBound` by default
+    /// @tparam PrioritySpecifier A callable type that maps the period of a task to its priority level
+    /// @note The caller admits a task before it is enqueued for the first time, e.g. via `EventHandlers::AdmissionControl::AdmitOnCreation`,
+    ///       and releases it once it leaves the task set, e.g. via `EventHandlers::AdmissionControl::ReleaseOnTermination`.
+    /// @note The schedulability test only holds if tasks are served in rate-monotonic order,
+    ///       so all admitted tasks at a priority level must have the same period, in which case their order does not matter.
+    ///       A task whose period maps to a level that already holds tasks of a different period is rejected.
+    /// @warning The period and the execution time of a task must not change while the task is admitted.
+    ///
+    template <typename BasePolicy, Concepts::SchedulabilityBound Bound, typename PrioritySpecifier>
+    requires Concepts::Policy<BasePolicy> &&
+             TaskConstraints::Periodic<Traits::PolicyTask<BasePolicy>> &&
+             TaskConstraints::PrioritizableByMutablePriority<Traits::PolicyTask<BasePolicy>>
+    struct PolicyWithAdmissionControl: public BasePolicy
+    {
+    public:
+        /// Type of the task managed by the policy component
+        using Task = Traits::PolicyTask<BasePolicy>;
+
+    private:
+        /// The type of the period
+        using Tick = typename Task::Tick;
+
+        /// The period shared by the admitted tasks at a priority level
+        struct Occupancy
+        {
+            /// The period of the admitted tasks
+            Tick period;
+
+            /// The number of admitted tasks
+            size_t count;
+        };
+
+        /// The schedulability test that keeps the state of admitted tasks
+        Bound bound;
+
+        /// Maps each priority level that has admitted tasks to their period
+        std::map<size_t, Occupancy> levels;
+
+    public:
+        ///
+        /// Get the utilization of the given task
+        ///
+        /// @param task A non-null periodic task
+        /// @return The ratio of the worst-case execution time of the task to its period.
+        ///
+        static double utilizationOf(const Task* task)
+        {
+            return static_cast<double>(task->getExecutionTime()) / static_cast<double>(task->getPeriod());
+        }
+
+        ///
+        /// Admit the given task if the task set remains schedulable and assign its priority level by its period
+        ///
+        /// @param task A non-null periodic task that has not been admitted
+        /// @return `true` if the task has been admitted, `false` if admitting it could make the task set unschedulable
+        ///         or tasks of a different period have been admitted at the priority level of the task.
+        /// @note The schedulability test runs in constant time regardless of the number of admitted tasks,
+        ///       and the period of the priority level is looked up in logarithmic time in the number of occupied levels.
+        ///
+        bool admit(Task* task)
+        {
+            // Guard: A task must have a non-zero period
+            if (task->getPeriod() == 0)
+            {
+                return false;
+            }
+
+            size_t priority = PrioritySpecifier{}(task->getPeriod());
+
+            auto iterator = this->levels.find(priority);
+
+            // Guard: Tasks of different periods at the same level would not be served in rate-monotonic order
+            if (iterator != this->levels.end() && iterator->second.period != task->getPeriod())
+            {
+                return false;
+            }
+
+            // Guard: Check whether the task set remains schedulable
+            if (!this->bound.tryAdmit(utilizationOf(task)))
+            {
+                return false;
+            }
+
+            if (iterator != this->levels.end())
+            {
+                iterator->second.count += 1;
+            }
+            else
+            {
+                this->levels.emplace(priority, Occupancy{task->getPeriod(), 1});
+            }
+
+            task->setPriority(static_cast<typename Task::Priority>(priority));
+
+            return true;
+        }
+
+        ///
+        /// Release the given admitted task, which no longer contributes to the utilization of the task set
+        ///
+        /// @param task A non-null task that has been admitted
+        ///
+        void release(Task* task)
+        {
+            this->bound.release(utilizationOf(task));
+
+            auto iterator = this->levels.find(PrioritySpecifier{}(task->getPeriod()));
+
+            passert(iterator != this->levels.end(), "The task to be released should have been admitted.");
+
+            // Guard: Forget the period once the level has no admitted task
+            if (--iterator->second.count == 0)
+            {
+                this->levels.erase(iterator);
+            }
+        }
+
+        ///
+        /// Get the total utilization of admitted tasks
+        ///
+        /// @return The sum of the utilization of all admitted tasks.
+        ///
+        [[nodiscard]]
+        double getUtilization() const
+        {
+            return this->bound.getUtilization();
+        }
+
+        ///
+        /// Get the number of admitted tasks
+        ///
+        /// @return The number of tasks admitted and not yet released.
+        ///
+        [[nodiscard]]
+        size_t getNumberOfAdmittedTasks() const
+        {
+            return this->bound.size();
+        }
+    };
+}
+
+#endif /* Scheduler_RateMonotonic_hpp */
@@ -0,0 +1,222 @@
+//
+//  TimingWheel.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Scheduler_Policy_TimingWheel_hpp
+#define Scheduler_Policy_TimingWheel_hpp
+
+#include <Scheduler/Policy/Policy.hpp>
+#include <Scheduler/Constraint/Prioritizable.hpp>
+#include <Scheduler/Container/TimingWheel.hpp>
+#include <LinkedList.hpp>
+#include <concepts>
+
+/// A namespace where task constraints related to the scheduler are defined
+namespace TaskConstraints
+{
+    /// A type that is prioritized by a point in time, such as a deadline, represented by an unsigned integer
+    template <typename Task>
+    concept PrioritizableByTime = PrioritizableByPriority<Task> && std::unsigned_integral<typename Task::Priority>;
+}
+
+/// Defines the functor that extracts the time key of a task
+namespace Scheduler::Policies::TimingWheel
+{
+    ///
+    /// Use the priority level of a task as its time key
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    ///
+    template <typename Task>
+    requires TaskConstraints::PrioritizableByTime<Task>
+    struct PriorityAsTimeKey
+    {
+        typename Task::Priority operator()(const Task& task) const
+        {
+            return task.getPriority();
+        }
+    };
+}
+
+///
+/// Defines scheduling policies that arrange schedulable tasks keyed by a point in time in a timing wheel
+///
+/// @note The priority level of a task is interpreted as a point in time, such as an absolute deadline,
+///       and the task that has the smallest priority level is dequeued first.
+///       Tasks that have the same priority level are served on a first-come, first-served basis.
+/// @note All structs do not define any virtual functions thus are suitable for schedulers that have a fixed policy.
+///
+namespace Scheduler::Policies::TimingWheel::Normal
+{
+    ///
+    /// Implements the policy by maintaining a timing wheel of linked lists without allocating memory dynamically
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam NumberOfSlots Specify the number of consecutive time keys covered by the wheel, which must be a power of two
+    /// @note Tasks whose keys fall into the window of the wheel are enqueued and dequeued in amortized constant time.
+    /// @seealso `Containers::TimingWheel` for details on how tasks beyond the window are handled.
+    ///
+    template <typename Task, size_t NumberOfSlots = 1024>
+    requires ListableItem<Task> && TaskConstraints::PrioritizableByTime<Task>
+    struct LinkedListImp
+    {
+    private:
+        /// An internal timing wheel
+        Containers::TimingWheel<Task, PriorityAsTimeKey<Task>, NumberOfSlots> queue;
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next()
+        {
+            return this->queue.pop();
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
+        ///
+        void ready(Task* task)
+        {
+            this->queue.insert(task);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method locates the task through its time key and unlinks it in constant time if the key is in the window.
+        ///
+        void remove(Task* task)
+        {
+            this->queue.remove(task, task->getPriority());
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note This method removes the task from the position of its old key and inserts it back with its new key.
+        ///
+        void adjustPosition(Task* task, const typename Task::Priority& oldPriority)
+        {
+            this->queue.remove(task, oldPriority);
+
+            this->queue.insert(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A callable object that takes each task in turn
+        ///
+        template <typename Visitor>
+        void forEach(Visitor&& visitor)
+        {
+            this->queue.forEach(visitor);
+        }
+    };
+}
+
+///
+/// Defines scheduling policies that arrange schedulable tasks keyed by a point in time in a timing wheel
+///
+/// @note The priority level of a task is interpreted as a point in time, such as an absolute deadline,
+///       and the task that has the smallest priority level is dequeued first.
+///       Tasks that have the same priority level are served on a first-come, first-served basis.
+/// @note All structs implement the interface `SchedulingPolicy` thus their instances can be treated as opaque policies.
+///
+namespace Scheduler::Policies::TimingWheel::Virtual
+{
+    ///
+    /// Implements the policy by maintaining a timing wheel of linked lists without allocating memory dynamically
+    ///
+    /// @tparam Task Specify the type of schedulable tasks managed by the scheduler
+    /// @tparam NumberOfSlots Specify the number of consecutive time keys covered by the wheel, which must be a power of two
+    /// @note Tasks whose keys fall into the window of the wheel are enqueued and dequeued in amortized constant time.
+    /// @seealso `Containers::TimingWheel` for details on how tasks beyond the window are handled.
+    ///
+    template <typename Task, size_t NumberOfSlots = 1024>
+    requires ListableItem<Task> && TaskConstraints::PrioritizableByTime<Task>
+    struct LinkedListImp: public Scheduler::Policy<Task>
+    {
+    private:
+        /// An internal timing wheel
+        Containers::TimingWheel<Task, PriorityAsTimeKey<Task>, NumberOfSlots> queue;
+
+    public:
+        /// Define the schedulable task type
+        using SchedulableTask = Task;
+
+        ///
+        /// Dequeue the next ready schedulable task
+        ///
+        /// @returns A task that is ready to run, `NULL` if no task is ready.
+        ///
+        Task* next() override
+        {
+            return this->queue.pop();
+        }
+
+        ///
+        /// Enqueue a ready schedulable task
+        ///
+        /// @param task A non-null task that is ready to run
+        /// @warning The given task is inserted into the queue regardless of whether it is the idle task or not.
+        ///
+        void ready(Task* task) override
+        {
+            this->queue.insert(task);
+        }
+
+        ///
+        /// Remove the given schedulable task from the ready queue
+        ///
+        /// @param task A non-null task that resides in the ready queue
+        /// @note This method locates the task through its time key and unlinks it in constant time if the key is in the window.
+        ///
+        void remove(Task* task) override
+        {
+            this->queue.remove(task, task->getPriority());
+        }
+
+        ///
+        /// Adjust the position of the given task in the ready queue
+        ///
+        /// @param task The task of which priority level has been changed
+        /// @param oldPriority The previous priority level
+        /// @note This method removes the task from the position of its old key and inserts it back with its new key.
+        ///
+        void adjustPosition(Task* task, const typename Task::Priority& oldPriority)
+        {
+            this->queue.remove(task, oldPriority);
+
+            this->queue.insert(task);
+        }
+
+        ///
+        /// Visit every task in the ready queue in the order they would be dequeued
+        ///
+        /// @param visitor A function that takes each task in turn along with the given context
+        /// @param context An opaque pointer passed to the visitor
+        ///
+        void forEachTask(void (*visitor)(Task*, void*), void* context) override
+        {
+            this->queue.forEach([&](Task* task) { visitor(task, context); });
+        }
+    };
+}
+
+#endif /* Scheduler_Policy_TimingWheel_hpp */
@@ -0,0 +1,249 @@
+//
+//  IdleGovernor.hpp
+//  Scheduler
+//
+//  Created by FireWolf on 2026-10-15.
+//
+
+#ifndef Scheduler_IdleGovernor_hpp
+#define Scheduler_IdleGovernor_hpp
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+/// Defines components that decide how deeply a core sleeps while it runs the idle task
+namespace Scheduler::Power
+{
+    ///
+    /// Describe an idle state of a core
+    ///
+    /// @note A deeper state saves more power but takes longer to leave,
+    ///       so it only pays off if the core stays idle for at least its target residency.
+    ///
+    struct IdleState
+    {
+        /// The number of ticks it takes to leave the state and run a task again
+        uint64_t exitLatency;
+
+        /// The minimum number of ticks the core must stay in the state to save more power than in a shallower one
+        uint64_t targetResidency;
+    };
+
+    ///
+    /// Predict how long a core will stay idle from its next timer event and the durations of its recent idle periods
+    ///
+    /// @tparam HistoryLength Specify the number of recent idle periods to keep
+    /// @note A core is woken up either by its next timer event, which is known in advance,
+    ///       or by an interrupt that makes a task ready, which is not.
+    ///       The latter tends to recur at a similar interval, e.g. a device that raises an interrupt periodically,
+    ///       so the predictor looks for a typical interval in the recent idle periods.
+    ///       The largest samples are discarded one value at a time until the remaining ones agree,
+    ///       i.e. their standard deviation is at most one sixth of their average,
+    ///       and the prediction falls back to the next timer event if a quarter of the samples have been discarded without agreement.
+    ///
+    template <size_t HistoryLength = 8>
+    requires (HistoryLength > 0)
+    struct IdlePredictor
+    {
+    private:
+        /// The durations of recent idle periods in ticks
+        std::array<uint64_t, HistoryLength> samples = {};
+
+        /// The index of the slot where the next sample is stored
+        size_t cursor = 0;
+
+        /// The number of samples stored
+        size_t count = 0;
+
+    public:
+        ///
+        /// Record the duration of an idle period that has just ended
+        ///
+        /// @param residency The number of ticks the core has stayed idle
+        /// @note Samples are clamped to 32 bits, so that their squares fit in 64 bits.
+        ///
+        void record(uint64_t residency)
+        {
+            this->samples[this->cursor] = std::min<uint64_t>(residency, UINT32_MAX);
+
+            this->cursor = (this->cursor + 1) % HistoryLength;
+
+            this->count = std::min(this->count + 1, HistoryLength);
+        }
+
+        ///
+        /// Get the typical duration of recent idle periods
+        ///
+        /// @return The average of the recent idle periods that agree with each other, `UINT64_MAX` if they do not agree.
+        ///
+        [[nodiscard]]
+        uint64_t getTypicalInterval() const
+        {
+            // Guard: Too few samples to tell a pattern
+            if (this->count < HistoryLength)
+            {
+                return UINT64_MAX;
+            }
+
+            uint64_t limit = UINT64_MAX;
+
+            while (true)
+            {
+                uint64_t sum = 0;
+
+                uint64_t max = 0;
+
+                size_t kept = 0;
+
+                for (uint64_t sample : this->samples)
+                {
+                    if (sample <= limit)
+                    {
+                        sum += sample;
+
+                        max = std::max(max, sample);
+
+                        kept += 1;
+                    }
+                }
+
+                // Guard: Give up once a quarter of the samples have been discarded
+                if (kept * 4 < HistoryLength * 3)
+                {
+                    return UINT64_MAX;
+                }
+
+                uint64_t average = sum / kept;
+
+                uint64_t variance = 0;
+
+                for (uint64_t sample : this->samples)
+                {
+                    if (sample <= limit)
+                    {
+                        uint64_t deviation = sample > average ? sample - average : average - sample;
+
+                        variance += deviation * deviation / kept;
+                    }
+                }
+
+                // Guard: The remaining samples agree with each other
+                if (variance <= average * average / 36)
+                {
+                    return average;
+                }
+
+                // Guard: Nothing is left to discard
+                if (max == 0)
+                {
+                    return UINT64_MAX;
+                }
+
+                limit = max - 1;
+            }
+        }
+
+        ///
+        /// Predict the duration of the idle period that is about to start
+        ///
+        /// @param nextWakeup The number of ticks until the next timer event of the core, `UINT64_MAX` if there is none
+        /// @return The predicted number of ticks the core will stay idle.
+        ///
+        [[nodiscard]]
+        uint64_t predict(uint64_t nextWakeup) const
+        {
+            return std::min(nextWakeup, this->getTypicalInterval());
+        }
+    };
+}
+
+/// Defines concepts related to scheduler components
+namespace Scheduler::Concepts
+{
+    /// An idle governor selects the idle state that a core enters when it has no task to run
+    template <typename Governor>
+    concept IdleGovernor = requires(Governor& governor, uint64_t predicted)
+    {
+        ///
+        /// Select an idle state for the given predicted idle duration
+        ///
+        /// @param predicted The number of ticks the core is predicted to stay idle, `UINT64_MAX` if it is unknown
+        /// @return The index of the selected idle state, where `0` is the shallowest state.
+        ///
+        { governor.select(predicted) } -> std::same_as<size_t>;
+    };
+}
+
+/// Defines some common idle governors
+namespace Scheduler::Power::Governors
+{
+    ///
+    /// A governor that selects the deepest idle state that pays off for the predicted idle duration
+    ///
+    /// @tparam NumberOfStates Specify the number of idle states supported by the core
+    /// @note States are ordered from the shallowest to the deepest one, and the shallowest state is always allowed.
+    /// @note A state is selected only if its target residency does not exceed the predicted idle duration
+    ///       and its exit latency does not exceed the latency limit,
+    ///       so that the core neither wastes the power spent on entering a deep state nor delays the next task too much.
+    ///
+    template <size_t NumberOfStates>
+    requires (NumberOfStates > 0)
+    struct Menu
+    {
+    private:
+        /// The idle states supported by the core
+        std::array<IdleState, NumberOfStates> states;
+
+        /// The maximum exit latency tolerated by the system in ticks
+        uint64_t latencyLimit;
+
+    public:
+        ///
+        /// Create a governor for the given idle states
+        ///
+        /// @param states The idle states ordered from the shallowest to the deepest one
+        /// @param latencyLimit The maximum exit latency tolerated by the system in ticks
+        ///
+        constexpr explicit Menu(const std::array<IdleState, NumberOfStates>& states, uint64_t latencyLimit = UINT64_MAX) :
+            states(states), latencyLimit(latencyLimit) {}
+
+        ///
+        /// Select an idle state for the given predicted idle duration
+        ///
+        /// @param predicted The number of ticks the core is predicted to stay idle, `UINT64_MAX` if it is unknown
+        /// @return The index of the deepest state that pays off.
+        ///
+        [[nodiscard]]
+        size_t select(uint64_t predicted) const
+        {
+            size_t selected = 0;
+
+            for (size_t index = 1; index < NumberOfStates; index += 1)
+            {
+                const IdleState& state = this->states[index];
+
+                if (state.targetResidency <= predicted && state.exitLatency <= this->latencyLimit)
+                {
+                    selected = index;
+                }
+            }
+
+            return selected;
+        }
+
+        ///
+        /// Set the maximum exit latency tolerated by the system
+        ///
+        /// @param latencyLimit The maximum exit latency in ticks, e.g. tightened while a latency-sensitive task is blocked on I/O
+        ///
+        void setLatencyLimit(uint64_t latencyLimit)
+        {
+            this->latencyLimit = latencyLimit;
+        }
+    };
+}
+
+#endif /* Scheduler_IdleGovernor_hpp */
@@ -17,12 +17,44 @@
 #include <Scheduler/Constraint/Prioritizable.hpp>
 #include <Scheduler/Constraint/Quantizable.hpp>
 #include <Scheduler/Constraint/QuantumSpecifier.hpp>
+#include <Scheduler/Constraint/Periodic.hpp>
+#include <Scheduler/Constraint/Deadline.hpp>
+#include <Scheduler/Constraint/HeapIndexable.hpp>
+#include <Scheduler/Constraint/SchedulingEntity.hpp>
+#include <Scheduler/Constraint/WakeupLinkable.hpp>
+#include <Scheduler/Constraint/TreeLinkable.hpp>
+#include <Scheduler/Constraint/WeightedRuntime.hpp>
+#include <Scheduler/Constraint/Reservable.hpp>
+#include <Scheduler/Constraint/Groupable.hpp>
+#include <Scheduler/Constraint/Affinity.hpp>
+#include <Scheduler/Constraint/GangSchedulable.hpp>
+#include <Scheduler/Constraint/PriorityInheritable.hpp>
+#include <Scheduler/Constraint/Boostable.hpp>
+#include <Scheduler/Constraint/Instrumentable.hpp>
+#include <Scheduler/Constraint/Resumable.hpp>
+
+// MARK: - Containers Used by Scheduling Policies
+#include <Scheduler/Container/PriorityBitmap.hpp>
+#include <Scheduler/Container/PriorityArray.hpp>
+#include <Scheduler/Container/IndexedHeap.hpp>
+#include <Scheduler/Container/RedBlackTree.hpp>
+#include <Scheduler/Container/TimingWheel.hpp>
+#include <Scheduler/Container/StaticObjectPool.hpp>
+#include <Scheduler/Container/TaskArena.hpp>
+#include <Scheduler/Container/FlatLevelMap.hpp>
 
 // MARK: - Scheduling Policy Components
 #include <Scheduler/Policy/FIFO.hpp>
 #include <Scheduler/Policy/Policy.hpp>
 #include <Scheduler/Policy/PrioritizedSingleQueue.hpp>
 #include <Scheduler/Policy/PrioritizedMultiQueue.hpp>
+#include <Scheduler/Policy/TimingWheel.hpp>
+#include <Scheduler/Policy/FairShare.hpp>
+#include <Scheduler/Policy/RateMonotonic.hpp>
+#include <Scheduler/Policy/EarliestDeadlineFirst.hpp>
+#include <Scheduler/Policy/ConstantBandwidth.hpp>
+#include <Scheduler/Policy/Hierarchical.hpp>
+#include <Scheduler/Policy/PriorityInheritance.hpp>
 #include <Scheduler/Policy/PolicyMaker.hpp>
 #include <Scheduler/Policy/PolicyExtension.hpp>
 
@@ -37,6 +69,29 @@
 #include <Scheduler/EventHandler/TaskSelfPriorityChangedHandler.hpp>
 #include <Scheduler/EventHandler/TaskQuantumUsedUpHandler.hpp>
 #include <Scheduler/EventHandler/TimerInterruptHandler.hpp>
+#include <Scheduler/EventHandler/AdmissionControlHandler.hpp>
+#include <Scheduler/EventHandler/ReservationHandler.hpp>
+#include <Scheduler/EventHandler/PlacementHandler.hpp>
+#include <Scheduler/EventHandler/PriorityInheritanceHandler.hpp>
+
+// MARK: - Multi-Core Components
+#include <Scheduler/MultiCore/SpinLock.hpp>
+#include <Scheduler/MultiCore/WorkStealing.hpp>
+#include <Scheduler/MultiCore/WakeupInbox.hpp>
+#include <Scheduler/MultiCore/Gang.hpp>
+
+// MARK: - Instrumentation Components
+#include <Scheduler/Instrumentation/Recorder.hpp>
+#include <Scheduler/Instrumentation/Statistics.hpp>
+#include <Scheduler/Instrumentation/Trace.hpp>
+#include <Scheduler/Instrumentation/Latency.hpp>
+#include <Scheduler/Instrumentation/Instrumented.hpp>
+
+// MARK: - Power Management Components
+#include <Scheduler/Power/IdleGovernor.hpp>
+
+// MARK: - Persistence Components
+#include <Scheduler/Persistence/Snapshot.hpp>
 
 // MARK: - Helper Type Traits & Functions
 #include <Scheduler/Misc/Traits.hpp>
@@ -71,7 +126,7 @@ namespace Scheduler
         Task* idleTask;
 
         /// Initialize with the given idle task
-        explicit IdleTaskSupport(Task* idleTask) : idleTask(idleTask) {}
+        constexpr explicit IdleTaskSupport(Task* idleTask) : idleTask(idleTask) {}
 
         ///
         /// Get the idle task
@@ -83,6 +138,93 @@ namespace Scheduler
             return this->idleTask;
         }
     };
+
+    ///
+    /// A scheduler component that provides the idle task along with an idle governor
+    ///
+    /// @tparam Task Specify the type of the task scheduled by the concrete scheduler
+    /// @tparam Governor Specify the governor that selects the idle state of the core, e.g. `Power::Governors::Menu`
+    /// @tparam HistoryLength Specify the number of recent idle periods used to predict the next one
+    /// @discussion Event handlers with idle task support fall back to the idle task when the policy has no ready task,
+    ///             and they invoke `enterIdle()` right before, so the governor selects an idle state for the predicted idle duration.
+    ///             The prediction is the earlier one of the next timer event, e.g. the earliest timeout of a sleeping task,
+    ///             and the typical duration of the recent idle periods of the core.
+    ///             The caller reports the next timer event via `setNextWakeup()` and the actual residency via `exitIdle()`,
+    ///             then puts the core in the state returned by `getIdleState()` while the idle task runs.
+    /// @note Each core has its own scheduler and thus its own idle history.
+    ///
+    template <typename Task, typename Governor, size_t HistoryLength = 8>
+    requires Concepts::IdleGovernor<Governor>
+    struct IdleTaskSupportWithGovernor: public IdleTaskSupport<Task>
+    {
+    private:
+        /// The governor that selects the idle state
+        Governor governor;
+
+        /// The durations of recent idle periods
+        Power::IdlePredictor<HistoryLength> predictor;
+
+        /// The number of ticks until the next timer event, `UINT64_MAX` if there is none
+        uint64_t nextWakeup = UINT64_MAX;
+
+        /// The idle state selected for the current idle period
+        size_t idleState = 0;
+
+    public:
+        /// Initialize with the given idle task and governor
+        constexpr IdleTaskSupportWithGovernor(Task* idleTask, const Governor& governor) : IdleTaskSupport<Task>(idleTask), governor(governor) {}
+
+        ///
+        /// Select the idle state for the idle period that is about to start
+        ///
+        /// @note This method is invoked when the scheduler falls back to the idle task.
+        ///
+        void enterIdle()
+        {
+            this->idleState = this->governor.select(this->predictor.predict(this->nextWakeup));
+        }
+
+        ///
+        /// Report that the idle period has ended
+        ///
+        /// @param residency The number of ticks the core has stayed idle
+        ///
+        void exitIdle(uint64_t residency)
+        {
+            this->predictor.record(residency);
+        }
+
+        ///
+        /// Set the number of ticks until the next timer event of the core
+        ///
+        /// @param ticks The number of ticks, `UINT64_MAX` if no timer event is pending
+        ///
+        void setNextWakeup(uint64_t ticks)
+        {
+            this->nextWakeup = ticks;
+        }
+
+        ///
+        /// Get the idle state selected for the current idle period
+        ///
+        /// @return The index of the idle state, where `0` is the shallowest state.
+        ///
+        [[nodiscard]]
+        size_t getIdleState() const
+        {
+            return this->idleState;
+        }
+
+        ///
+        /// Get the idle governor
+        ///
+        /// @return The governor, e.g. to adjust its latency limit.
+        ///
+        Governor& getGovernor()
+        {
+            return this->governor;
+        }
+    };
 }
 
 // MARK: - Examine Scheduler Components
@@ -235,6 +377,38 @@ namespace Scheduler
         { scheduler.onTaskKilled(current, task) } -> std::same_as<Task*>;
     };
 
+    template <typename ConcreteScheduler, typename Task = Traits::ScheduledTask<ConcreteScheduler>>
+    concept ProvidesTasksUnblockedHandler = requires(ConcreteScheduler& scheduler, Task* current, std::span<Task* const> tasks)
+    {
+        ///
+        /// Notify the delegate that a batch of tasks has been unblocked
+        ///
+        /// @param current The current running task
+        /// @param tasks Non-null tasks that just got unblocked
+        /// @returns The task that is selected to run if requested.
+        /// @note This method supports group operations in the same way as `onTaskUnblocked()`,
+        ///       except that an empty span of tasks indicates that the caller only wants to fetch the next task.
+        /// @note Signature: `Task* onTasksUnblocked(Task* current, std::span<Task* const> tasks)`.
+        ///
+        { scheduler.onTasksUnblocked(current, tasks) } -> std::same_as<Task*>;
+    };
+
+    template <typename ConcreteScheduler, typename Task = Traits::ScheduledTask<ConcreteScheduler>>
+    concept ProvidesTasksKilledHandler = requires(ConcreteScheduler& scheduler, Task* current, std::span<Task* const> tasks)
+    {
+        ///
+        /// Notify the delegate that a batch of tasks has been killed
+        ///
+        /// @param current The current running task
+        /// @param tasks Non-null tasks that just got killed
+        /// @return The task that is selected to run if requested.
+        /// @note This method supports group operations in the same way as `onTaskKilled()`,
+        ///       except that an empty span of tasks indicates that the caller only wants to fetch the next task.
+        /// @note Signature: `Task* onTasksKilled(Task* current, std::span<Task* const> tasks)`.
+        ///
+        { scheduler.onTasksKilled(current, tasks) } -> std::same_as<Task*>;
+    };
+
     template <typename ConcreteScheduler, typename Task = Traits::ScheduledTask<ConcreteScheduler>, typename Priority = Traits::TaskPriority<Task>>
     concept ProvidesTaskPriorityChangedHandler = requires(ConcreteScheduler& scheduler, Task* current, Task* task, const Priority& oldPriority)
     {
@@ -321,4 +495,10 @@ namespace Scheduler
     };
 }
 
+// MARK: - Validate Assembled Schedulers
+#include <Scheduler/Misc/Validation.hpp>
+
+// MARK: - Coroutine Components
+#include <Scheduler/Coroutine/Executor.hpp>
+
 #endif /* Scheduler_Scheduler_hpp */